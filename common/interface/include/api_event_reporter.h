@@ -15,7 +15,13 @@
 
 #ifndef ACCESSIBILITY_API_EVENT_REPORTER_H
 #define ACCESSIBILITY_API_EVENT_REPORTER_H
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include "accessibility_thread_shards.h"
 #include "singleton.h"
 
 namespace OHOS {
@@ -41,20 +47,45 @@ struct ApiEventConfig {
     ApiEvent event3;
 };
 
-struct EventPeriodExpandableData {
-    std::vector<int64_t> runTime;
-    int64_t sumTime;
-    int64_t successCount;
+struct ApiCallSummary {
+    int64_t callCount = 0;
+    int64_t successCount = 0;
+    int64_t sumTime = 0;
+    int64_t maxTime = 0;
+    int64_t minTime = 0;
 };
 
+/**
+ * Reports the calls of the accessibility APIs. Every API name is registered once for an id, which the
+ * call sites keep. The calls are added to a shard of the reporting thread with relaxed atomics, so
+ * reporting never takes a lock. An event is written once one shard has counted thresholdValue calls of
+ * an API since the last event, and carries the calls of every shard merged under the lock, so its
+ * call_times is at least thresholdValue and more when other threads report the same API.
+ */
 class ApiEventReporter : public Singleton<ApiEventReporter> {
     DECLARE_SINGLETON(ApiEventReporter);
 public:
+    static constexpr int32_t MAX_API_COUNT = 256;
+    static constexpr size_t MAX_SHARD_COUNT = 8;
+    static constexpr int32_t INVALID_API_ID = -1;
+
     int64_t AddProcessor();
-    void ThresholdWriteEndEvent(int result, std::string apiName, int64_t beginTime,
+
+    /**
+     * @brief Get the id of an API, registering it on its first use.
+     * @param apiName the name of the API.
+     * @return the id, INVALID_API_ID if MAX_API_COUNT APIs are already registered.
+     */
+    int32_t GetApiId(const std::string &apiName);
+
+    void ThresholdWriteEndEvent(int result, const std::string &apiName, int64_t beginTime,
         int32_t thresholdValue);
+    void ThresholdWriteEndEvent(int result, int32_t apiId, int64_t beginTime, int32_t thresholdValue);
     int64_t GetCurrentTime();
 
+    // merge and clear the calls of an API reported by every thread since the last event
+    ApiCallSummary TakeApiCallSummary(int32_t apiId);
+
 private:
     static bool LoadConfigurationFile(const std::string &configFile);
     static void GetConfigurationParams(ApiReportConfig &reportConfig, ApiEventConfig &eventConfig);
@@ -66,17 +97,33 @@ private:
     static void ParseEventConfig(std::istringstream &stream, ApiEventConfig &eventConfig);
     static void ParseApiOperationManagement(std::istringstream &stream, ApiReportConfig &reportConfig,
         ApiEventConfig &eventConfig);
-    std::shared_ptr<EventPeriodExpandableData> CacheEventInfo(std::string apiName,
-        int64_t beginTime, int result);
+    struct ApiAccumulator {
+        std::atomic<int64_t> callCount {0};
+        std::atomic<int64_t> successCount {0};
+        std::atomic<int64_t> sumTime {0};
+        std::atomic<int64_t> maxTime {INT64_MIN};
+        std::atomic<int64_t> minTime {INT64_MAX};
+    };
+    struct ApiShard {
+        std::array<ApiAccumulator, MAX_API_COUNT> apis;
+    };
+
+    int32_t RegisterApi(const std::string &apiName);
+    void FlushApi(int32_t apiId);
     bool IsAppEventProcessorValid();
-    void ExecuteThresholdWriteEndEvent(std::string apiName,
-        std::shared_ptr<EventPeriodExpandableData> expandableData, int32_t dataCount);
+    void ExecuteThresholdWriteEndEvent(const std::string &apiName, const ApiCallSummary &summary);
     static std::string g_fileContent;
     static std::mutex g_apiOperationMutex;
     static std::mutex g_apiExpandableDataMutex;
     static int64_t g_processorId;
     static const int64_t NULLPTR_PROCCESSORID = 0;
-    std::unordered_map<std::string, std::shared_ptr<EventPeriodExpandableData>> m_thresholdData;
+
+    // shards are created by the first thread using them and live as long as the reporter
+    AccessibilityThreadShards<std::atomic<ApiShard *>, MAX_SHARD_COUNT> shards_;
+
+    std::mutex apiRegistryMutex_;
+    std::unordered_map<std::string, int32_t> apiIds_;
+    std::array<std::string, MAX_API_COUNT> apiNames_;
 
     static bool IsValidPath(const std::string& filePath);
     static bool IsReal(const std::string& file, std::string& realFile);
@@ -26,23 +26,44 @@ public:
     {
         beginTime_ = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()).count();
-        apiName_ = name;
+        apiId_ = GetApiId(name);
     }
 
     ApiReportHelper(const std::string &name, int32_t thresholdValue)
     {
         beginTime_ = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()).count();
-        apiName_ = name;
+        apiId_ = GetApiId(name);
+        thresholdValue_ = thresholdValue;
+    }
+
+    // apiId from GetApiId, which the call sites keep in a static so the name is resolved once
+    explicit ApiReportHelper(int32_t apiId)
+    {
+        beginTime_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        apiId_ = apiId;
+    }
+
+    ApiReportHelper(int32_t apiId, int32_t thresholdValue)
+    {
+        beginTime_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        apiId_ = apiId;
         thresholdValue_ = thresholdValue;
     }
 
     ~ApiReportHelper()
     {
-        Accessibility::ApiEventReporter::GetInstance().ThresholdWriteEndEvent(result_, apiName_,
+        Accessibility::ApiEventReporter::GetInstance().ThresholdWriteEndEvent(result_, apiId_,
             beginTime_, thresholdValue_);
     }
 
+    static int32_t GetApiId(const std::string &name)
+    {
+        return Accessibility::ApiEventReporter::GetInstance().GetApiId(name);
+    }
+
     void setResult(int result)
     {
         result_ = result;
@@ -50,13 +71,13 @@ public:
 
     void setApiName(const std::string &name)
     {
-        apiName_ = name;
+        apiId_ = GetApiId(name);
     }
 private:
     int64_t beginTime_ = 0;
     int32_t thresholdValue_ = 1500;
     int result_ = 0;
-    std::string apiName_;
+    int32_t apiId_ = ApiEventReporter::INVALID_API_ID;
 };
 }  // namespace Accessibility
 }  // namespace OHOS
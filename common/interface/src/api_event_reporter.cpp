@@ -18,6 +18,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cstdlib>
+#include <cinttypes>
 #include <climits>
 #include <unordered_map>
 #include <functional>
@@ -42,7 +43,9 @@ ApiEventReporter::ApiEventReporter()
 
 ApiEventReporter::~ApiEventReporter()
 {
-    m_thresholdData.clear();
+    for (auto &shard : shards_) {
+        delete shard.exchange(nullptr, std::memory_order_acq_rel);
+    }
 }
 // LCOV_EXCL_START
 bool ApiEventReporter::IsAppEventProcessorValid()
@@ -272,80 +275,150 @@ int64_t ApiEventReporter::GetCurrentTime()
     return time;
 }
 
-void ApiEventReporter::ThresholdWriteEndEvent(int result, std::string apiName, int64_t beginTime,
+int32_t ApiEventReporter::GetApiId(const std::string &apiName)
+{
+    thread_local std::unordered_map<std::string, int32_t> cachedApiIds;
+    auto iter = cachedApiIds.find(apiName);
+    if (iter != cachedApiIds.end()) {
+        return iter->second;
+    }
+    int32_t apiId = RegisterApi(apiName);
+    if (apiId != INVALID_API_ID) {
+        cachedApiIds.emplace(apiName, apiId);
+    }
+    return apiId;
+}
+
+int32_t ApiEventReporter::RegisterApi(const std::string &apiName)
+{
+    std::lock_guard<std::mutex> lock(apiRegistryMutex_);
+    auto iter = apiIds_.find(apiName);
+    if (iter != apiIds_.end()) {
+        return iter->second;
+    }
+    if (apiIds_.size() >= static_cast<size_t>(MAX_API_COUNT)) {
+        HILOG_ERROR("too many apis to report, %{public}s is not reported", apiName.c_str());
+        return INVALID_API_ID;
+    }
+    int32_t apiId = static_cast<int32_t>(apiIds_.size());
+    apiIds_.emplace(apiName, apiId);
+    apiNames_[apiId] = apiName;
+    return apiId;
+}
+
+void ApiEventReporter::ThresholdWriteEndEvent(int result, const std::string &apiName, int64_t beginTime,
     int32_t thresholdValue)
 {
-    std::lock_guard<std::mutex> lock(g_apiExpandableDataMutex);
-    auto expandableData = CacheEventInfo(apiName, beginTime, result);
-    if (expandableData == nullptr) {
+    ThresholdWriteEndEvent(result, GetApiId(apiName), beginTime, thresholdValue);
+}
+
+void ApiEventReporter::ThresholdWriteEndEvent(int result, int32_t apiId, int64_t beginTime, int32_t thresholdValue)
+{
+    if (apiId < 0 || apiId >= MAX_API_COUNT) {
         return;
     }
+    std::atomic<ApiShard *> &localShard = shards_.Local();
+    ApiShard *shard = localShard.load(std::memory_order_acquire);
+    if (shard == nullptr) {
+        ApiShard *newShard = new(std::nothrow) ApiShard();
+        if (newShard == nullptr) {
+            HILOG_ERROR("create api shard failed");
+            return;
+        }
+        if (localShard.compare_exchange_strong(shard, newShard, std::memory_order_acq_rel)) {
+            shard = newShard;
+        } else {
+            delete newShard;
+        }
+    }
+    ApiAccumulator &accumulator = shard->apis[apiId];
+    int64_t costTime = GetCurrentTime() - beginTime;
+    accumulator.sumTime.fetch_add(costTime, std::memory_order_relaxed);
+    if (result == 0) {
+        accumulator.successCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    int64_t maxTime = accumulator.maxTime.load(std::memory_order_relaxed);
+    while (costTime > maxTime &&
+        !accumulator.maxTime.compare_exchange_weak(maxTime, costTime, std::memory_order_relaxed)) {
+    }
+    int64_t minTime = accumulator.minTime.load(std::memory_order_relaxed);
+    while (costTime < minTime &&
+        !accumulator.minTime.compare_exchange_weak(minTime, costTime, std::memory_order_relaxed)) {
+    }
+    int64_t callCount = accumulator.callCount.fetch_add(1, std::memory_order_relaxed) + 1;
     if (thresholdValue <= 0) {
         HILOG_ERROR("ApiEventReporter thresholdValue invalid!");
         return;
     }
-    uint32_t dataCount = expandableData->runTime.size();
-    HILOG_DEBUG("ThresholdWriteEndEvent apiName: %{public}s, dataCount: %{public}d, thresholdValue: %{public}d",
-        apiName.c_str(), dataCount, thresholdValue);
-    if (dataCount % static_cast<uint32_t>(thresholdValue) != 0) {
+    if (callCount % thresholdValue != 0) {
         return;
     }
-    ExecuteThresholdWriteEndEvent(apiName, expandableData, static_cast<int32_t>(dataCount));
+    FlushApi(apiId);
 }
 
-std::shared_ptr<EventPeriodExpandableData> ApiEventReporter::CacheEventInfo(std::string apiName,
-    int64_t beginTime, int result)
+ApiCallSummary ApiEventReporter::TakeApiCallSummary(int32_t apiId)
 {
-    std::lock_guard<std::mutex> lock(g_apiOperationMutex);
-    if (m_thresholdData.find(apiName) == m_thresholdData.end()) {
-        std::shared_ptr<EventPeriodExpandableData> expandableData = std::make_shared<EventPeriodExpandableData>();
-        if (expandableData == nullptr) {
-            HILOG_ERROR("ApiEventReporter CacheEventInfo expandableData make_shared failed");
-            return nullptr;
+    ApiCallSummary summary;
+    if (apiId < 0 || apiId >= MAX_API_COUNT) {
+        return summary;
+    }
+    int64_t maxTime = INT64_MIN;
+    int64_t minTime = INT64_MAX;
+    for (auto &shardPtr : shards_) {
+        ApiShard *shard = shardPtr.load(std::memory_order_acquire);
+        if (shard == nullptr) {
+            continue;
         }
-        m_thresholdData.insert(std::pair<std::string, std::shared_ptr<EventPeriodExpandableData>>(apiName,
-            expandableData));
+        ApiAccumulator &accumulator = shard->apis[apiId];
+        summary.callCount += accumulator.callCount.exchange(0, std::memory_order_relaxed);
+        summary.successCount += accumulator.successCount.exchange(0, std::memory_order_relaxed);
+        summary.sumTime += accumulator.sumTime.exchange(0, std::memory_order_relaxed);
+        maxTime = std::max(maxTime, accumulator.maxTime.exchange(INT64_MIN, std::memory_order_relaxed));
+        minTime = std::min(minTime, accumulator.minTime.exchange(INT64_MAX, std::memory_order_relaxed));
     }
-    auto expandableData = m_thresholdData[apiName];
-    int64_t costTime = GetCurrentTime() - beginTime;
-    expandableData->runTime.push_back(costTime);
-    expandableData->sumTime += costTime;
-    if (result == 0) {
-        expandableData->successCount++;
+    if (summary.callCount > 0) {
+        summary.maxTime = maxTime;
+        summary.minTime = minTime;
     }
-    return expandableData;
+    return summary;
+}
+
+void ApiEventReporter::FlushApi(int32_t apiId)
+{
+    std::string apiName;
+    {
+        std::lock_guard<std::mutex> lock(apiRegistryMutex_);
+        apiName = apiNames_[apiId];
+    }
+    std::lock_guard<std::mutex> lock(g_apiExpandableDataMutex);
+    // the calls are kept for the next event while there is no processor
+    if (!IsAppEventProcessorValid()) {
+        HILOG_ERROR("ExecuteThresholdWriteEndEvent processorid invalid!");
+        return;
+    }
+    ApiCallSummary summary = TakeApiCallSummary(apiId);
+    if (summary.callCount == 0) {
+        return;
+    }
+    HILOG_DEBUG("ThresholdWriteEndEvent apiName: %{public}s, callCount: %{public}" PRId64, apiName.c_str(),
+        summary.callCount);
+    ExecuteThresholdWriteEndEvent(apiName, summary);
 }
 
 // LCOV_EXCL_START
-void ApiEventReporter::ExecuteThresholdWriteEndEvent(std::string apiName,
-    std::shared_ptr<EventPeriodExpandableData> expandableData, int32_t dataCount)
+void ApiEventReporter::ExecuteThresholdWriteEndEvent(const std::string &apiName, const ApiCallSummary &summary)
 {
     HILOG_DEBUG("ExecuteThresholdWriteEndEvent enter.");
     HiviewDFX::HiAppEvent::Event event("api_diagnostic", "api_called_stat_cnt", OHOS::HiviewDFX::HiAppEvent::BEHAVIOR);
     event.AddParam("trans_id", std::string(""));
     event.AddParam("api_name", apiName);
     event.AddParam("sdk_name", std::string("AccessibilityKit"));
-    event.AddParam("call_times", static_cast<int32_t>(expandableData->runTime.size()));
-    event.AddParam("success_times", expandableData->successCount);
-    int64_t maxElement = 0;
-    int64_t minElement = 0;
-    if (!expandableData->runTime.empty()) {
-        maxElement = *max_element(expandableData->runTime.begin(), expandableData->runTime.end());
-        minElement = *min_element(expandableData->runTime.begin(), expandableData->runTime.end());
-    }
-    event.AddParam("max_cost_time", maxElement);
-    event.AddParam("min_cost_time", minElement);
-    event.AddParam("total_cost_time", expandableData->sumTime);
-    if (!IsAppEventProcessorValid()) {
-        HILOG_ERROR("ExecuteThresholdWriteEndEvent processorid invalid!");
-        return;
-    }
+    event.AddParam("call_times", static_cast<int32_t>(summary.callCount));
+    event.AddParam("success_times", summary.successCount);
+    event.AddParam("max_cost_time", summary.maxTime);
+    event.AddParam("min_cost_time", summary.minTime);
+    event.AddParam("total_cost_time", summary.sumTime);
     HiviewDFX::HiAppEvent::Write(event);
-
-    //重置数据
-    expandableData->runTime.clear();
-    expandableData->successCount = 0;
-    expandableData->sumTime = 0;
 }
 
 bool ApiEventReporter::IsValidPath(const std::string& filePath)
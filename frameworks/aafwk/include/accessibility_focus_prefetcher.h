@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_FOCUS_PREFETCHER_H
+#define ACCESSIBILITY_FOCUS_PREFETCHER_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include "accessibility_def.h"
+#include "accessibility_element_info.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct FocusPrefetchStatistics {
+    uint64_t lookupCount = 0;
+    uint64_t hitCount = 0;
+    uint64_t fetchCount = 0;
+    uint64_t wastedCount = 0; // fetched nodes dropped before a lookup used them
+    uint64_t invalidateCount = 0;
+};
+
+/**
+ * Answers the linear focus moves of a screen reader from nodes fetched ahead of time. After every move the
+ * next and previous nodes in traversal order are fetched in the background, so the next swipe is served
+ * without a round trip to the application. Content changes drop every node fetched so far.
+ */
+class AccessibilityFocusPrefetcher : public std::enable_shared_from_this<AccessibilityFocusPrefetcher> {
+public:
+    using Fetcher = std::function<RetError(const AccessibilityElementInfo &from, FocusMoveDirection direction,
+        bool systemApi, AccessibilityElementInfo &next)>;
+    using Executor = std::function<void(std::function<void()> task)>;
+    using Clock = std::function<int64_t()>;
+
+    static constexpr int32_t DEFAULT_DEPTH = 3;
+    static constexpr size_t MAX_ENTRY_COUNT = 64;
+    static constexpr int64_t ENTRY_TTL_MS = 2000;
+
+    /**
+     * @param fetcher the focus move search run for every node fetched ahead.
+     * @param executor runs the prefetch, a ffrt task by default.
+     * @param clock the time in milliseconds, the steady clock by default.
+     */
+    explicit AccessibilityFocusPrefetcher(Fetcher fetcher, Executor executor = nullptr, Clock clock = nullptr);
+    ~AccessibilityFocusPrefetcher() = default;
+
+    static bool IsPrefetchDirection(FocusMoveDirection direction);
+    static bool IsInvalidatingEvent(EventType eventType);
+
+    /**
+     * @brief Find the node a focus move from an element would land on.
+     * @return true if a node fetched ahead answers the move.
+     */
+    bool Lookup(const AccessibilityElementInfo &from, FocusMoveDirection direction, bool systemApi,
+        AccessibilityElementInfo &next);
+
+    /**
+     * @brief Fetch the nodes around the element the focus moved to, in the background.
+     */
+    void Schedule(const AccessibilityElementInfo &anchor, bool systemApi);
+
+    /**
+     * @brief Drop every node fetched so far and the fetches still running.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Drop every node fetched so far and wait for a fetch still running, no fetch starts afterwards.
+     *        Used before the owner of the fetcher goes away.
+     */
+    void Stop();
+
+    void SetDepth(int32_t depth);
+    FocusPrefetchStatistics GetStatistics();
+
+private:
+    struct EntryKey {
+        int32_t windowId = 0;
+        int64_t elementId = 0;
+        int32_t direction = 0;
+        bool systemApi = false;
+
+        bool operator<(const EntryKey &other) const
+        {
+            if (windowId != other.windowId) {
+                return windowId < other.windowId;
+            }
+            if (elementId != other.elementId) {
+                return elementId < other.elementId;
+            }
+            if (direction != other.direction) {
+                return direction < other.direction;
+            }
+            return systemApi < other.systemApi;
+        }
+    };
+
+    struct Entry {
+        AccessibilityElementInfo next;
+        int64_t fetchTime = 0;
+        bool used = false;
+        std::list<EntryKey>::iterator order; // the place of the key in entryOrder_
+    };
+
+    static EntryKey MakeKey(const AccessibilityElementInfo &from, FocusMoveDirection direction, bool systemApi);
+    void RunPending();
+    void PrefetchFrom(const AccessibilityElementInfo &anchor, FocusMoveDirection direction, bool systemApi,
+        uint64_t generation);
+    bool FindFresh(const EntryKey &key, AccessibilityElementInfo &next); // should be used in mutex
+    void Store(const EntryKey &key, const AccessibilityElementInfo &next); // should be used in mutex
+
+    Fetcher fetcher_;
+    Executor executor_;
+    Clock clock_;
+
+    ffrt::mutex mutex_;
+    std::map<EntryKey, Entry> entries_;
+    std::list<EntryKey> entryOrder_; // the oldest fetched first
+    uint64_t generation_ = 0;
+    int32_t depth_ = DEFAULT_DEPTH;
+    bool isRunning_ = false;
+    bool isStopped_ = false;
+    ffrt::condition_variable runningCondition_;
+    bool hasPending_ = false;
+    AccessibilityElementInfo pendingAnchor_;
+    bool pendingSystemApi_ = false;
+    FocusPrefetchStatistics statistics_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_FOCUS_PREFETCHER_H
@@ -22,6 +22,7 @@
 #include "accessible_ability_channel_client.h"
 #include "accessible_ability_client.h"
 #include "accessible_ability_client_stub.h"
+#include "accessibility_focus_prefetcher.h"
 #include "ffrt.h"
 #include "ffrt_inner.h"
 #include "iaccessible_ability_manager_service.h"
@@ -485,6 +486,11 @@ private:
     RetError CheckConnection(); // should be used in mutex, to check isConnected_ and channelClient_
     RetError CheckActionArguments(const ActionType action,
         const std::map<std::string, std::string> &actionArguments);
+    RetError FetchNextFocus(const AccessibilityElementInfo &from, FocusMoveDirection direction, bool systemApi,
+        AccessibilityElementInfo &next);
+    void InvalidateFocusPrefetch();
+    // log the hit and waste counters of the nodes fetched ahead for GetNext, when the ability disconnects
+    void ReportFocusPrefetchStatistics();
 
     sptr<IRemoteObject::DeathRecipient> deathRecipient_ = nullptr;
     sptr<IRemoteObject::DeathRecipient> accessibilityServiceDeathRecipient_ = nullptr;
@@ -494,6 +500,7 @@ private:
     uint32_t cacheMode_ = 0;
     int32_t cacheWindowId_ = -1;
     SafeMap<int64_t, AccessibilityElementInfo> cacheElementInfos_;
+    std::shared_ptr<AccessibilityFocusPrefetcher> focusPrefetcher_ = nullptr;
     std::atomic<bool> isConnected_ = false;
 
     ffrt::condition_variable proxyConVar_;
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_focus_prefetcher.h"
+
+#include <chrono>
+#include <cinttypes>
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    const char *PREFETCH_TASK_NAME = "AccessibilityFocusPrefetch";
+} // namespace
+
+AccessibilityFocusPrefetcher::AccessibilityFocusPrefetcher(Fetcher fetcher, Executor executor, Clock clock)
+    : fetcher_(std::move(fetcher)), executor_(std::move(executor)), clock_(std::move(clock))
+{
+    if (!executor_) {
+        executor_ = [](std::function<void()> task) {
+            ffrt::submit(std::move(task), {}, {}, ffrt::task_attr().name(PREFETCH_TASK_NAME));
+        };
+    }
+    if (!clock_) {
+        clock_ = []() {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        };
+    }
+}
+
+bool AccessibilityFocusPrefetcher::IsPrefetchDirection(FocusMoveDirection direction)
+{
+    return direction == FocusMoveDirection::FORWARD || direction == FocusMoveDirection::BACKWARD;
+}
+
+bool AccessibilityFocusPrefetcher::IsInvalidatingEvent(EventType eventType)
+{
+    switch (eventType) {
+        case TYPE_VIEW_CLICKED_EVENT:
+        case TYPE_VIEW_LONG_CLICKED_EVENT:
+        case TYPE_VIEW_SELECTED_EVENT:
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+        case TYPE_PAGE_STATE_UPDATE:
+        case TYPE_PAGE_CONTENT_UPDATE:
+        case TYPE_VIEW_SCROLLED_EVENT:
+        case TYPE_WINDOW_UPDATE:
+        case TYPE_PAGE_CLOSE:
+        case TYPE_PAGE_OPEN:
+        case TYPE_ELEMENT_INFO_CHANGE:
+        case TYPE_VIEW_SCROLLING_EVENT:
+        case TYPE_PAGE_ACTIVE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+AccessibilityFocusPrefetcher::EntryKey AccessibilityFocusPrefetcher::MakeKey(const AccessibilityElementInfo &from,
+    FocusMoveDirection direction, bool systemApi)
+{
+    EntryKey key;
+    key.windowId = from.GetWindowId();
+    key.elementId = from.GetAccessibilityId();
+    key.direction = static_cast<int32_t>(direction);
+    key.systemApi = systemApi;
+    return key;
+}
+
+bool AccessibilityFocusPrefetcher::Lookup(const AccessibilityElementInfo &from, FocusMoveDirection direction,
+    bool systemApi, AccessibilityElementInfo &next)
+{
+    if (!IsPrefetchDirection(direction)) {
+        return false;
+    }
+    EntryKey key = MakeKey(from, direction, systemApi);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    statistics_.lookupCount++;
+    if (!FindFresh(key, next)) {
+        return false;
+    }
+    entries_[key].used = true;
+    statistics_.hitCount++;
+    HILOG_DEBUG("prefetch hit, elementId[%{public}" PRId64 "], direction[%{public}d]", key.elementId, direction);
+    return true;
+}
+
+void AccessibilityFocusPrefetcher::Schedule(const AccessibilityElementInfo &anchor, bool systemApi)
+{
+    if (!fetcher_) {
+        return;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (depth_ <= 0 || isStopped_) {
+            return;
+        }
+        // only the last move matters, a prefetch still running picks it up when it is done
+        pendingAnchor_ = anchor;
+        pendingSystemApi_ = systemApi;
+        hasPending_ = true;
+        if (isRunning_) {
+            return;
+        }
+        isRunning_ = true;
+    }
+    std::shared_ptr<AccessibilityFocusPrefetcher> self = shared_from_this();
+    executor_([self]() { self->RunPending(); });
+}
+
+void AccessibilityFocusPrefetcher::RunPending()
+{
+    while (true) {
+        AccessibilityElementInfo anchor;
+        bool systemApi = false;
+        uint64_t generation = 0;
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            if (!hasPending_) {
+                isRunning_ = false;
+                runningCondition_.notify_all();
+                return;
+            }
+            anchor = pendingAnchor_;
+            systemApi = pendingSystemApi_;
+            generation = generation_;
+            hasPending_ = false;
+        }
+        PrefetchFrom(anchor, FocusMoveDirection::FORWARD, systemApi, generation);
+        PrefetchFrom(anchor, FocusMoveDirection::BACKWARD, systemApi, generation);
+    }
+}
+
+void AccessibilityFocusPrefetcher::PrefetchFrom(const AccessibilityElementInfo &anchor, FocusMoveDirection direction,
+    bool systemApi, uint64_t generation)
+{
+    AccessibilityElementInfo current = anchor;
+    int32_t depth = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        depth = depth_;
+    }
+    for (int32_t step = 0; step < depth; step++) {
+        EntryKey key = MakeKey(current, direction, systemApi);
+        AccessibilityElementInfo next;
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            if (generation != generation_ || hasPending_) {
+                // the content changed or the focus moved on, the nodes ahead of the last move come first
+                return;
+            }
+            if (FindFresh(key, next)) {
+                current = next;
+                continue;
+            }
+        }
+
+        RetError ret = fetcher_(current, direction, systemApi, next);
+        if (ret != RET_OK || next.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID ||
+            (next.GetAccessibilityId() == current.GetAccessibilityId() &&
+            next.GetWindowId() == current.GetWindowId())) {
+            HILOG_DEBUG("prefetch stops at elementId[%{public}" PRId64 "], ret[%{public}d]",
+                current.GetAccessibilityId(), ret);
+            return;
+        }
+
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (generation != generation_) {
+            statistics_.wastedCount++;
+            return;
+        }
+        statistics_.fetchCount++;
+        Store(key, next);
+        current = next;
+    }
+}
+
+bool AccessibilityFocusPrefetcher::FindFresh(const EntryKey &key, AccessibilityElementInfo &next)
+{
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return false;
+    }
+    if (clock_() - iter->second.fetchTime > ENTRY_TTL_MS) {
+        if (!iter->second.used) {
+            statistics_.wastedCount++;
+        }
+        entryOrder_.erase(iter->second.order);
+        entries_.erase(iter);
+        return false;
+    }
+    next = iter->second.next;
+    return true;
+}
+
+void AccessibilityFocusPrefetcher::Store(const EntryKey &key, const AccessibilityElementInfo &next)
+{
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+        iter->second.next = next;
+        iter->second.fetchTime = clock_();
+        entryOrder_.splice(entryOrder_.end(), entryOrder_, iter->second.order);
+        return;
+    }
+    while (!entryOrder_.empty() && entries_.size() >= MAX_ENTRY_COUNT) {
+        auto oldest = entries_.find(entryOrder_.front());
+        if (oldest != entries_.end()) {
+            if (!oldest->second.used) {
+                statistics_.wastedCount++;
+            }
+            entries_.erase(oldest);
+        }
+        entryOrder_.pop_front();
+    }
+    Entry entry;
+    entry.next = next;
+    entry.fetchTime = clock_();
+    entry.order = entryOrder_.insert(entryOrder_.end(), key);
+    entries_.emplace(key, entry);
+}
+
+void AccessibilityFocusPrefetcher::Invalidate()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto &entry : entries_) {
+        if (!entry.second.used) {
+            statistics_.wastedCount++;
+        }
+    }
+    entries_.clear();
+    entryOrder_.clear();
+    generation_++;
+    hasPending_ = false;
+    statistics_.invalidateCount++;
+}
+
+void AccessibilityFocusPrefetcher::Stop()
+{
+    Invalidate();
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    isStopped_ = true;
+    runningCondition_.wait(lock, [this]() { return !isRunning_; });
+}
+
+void AccessibilityFocusPrefetcher::SetDepth(int32_t depth)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    depth_ = depth;
+}
+
+FocusPrefetchStatistics AccessibilityFocusPrefetcher::GetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return statistics_;
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -78,6 +78,9 @@ AccessibleAbilityClientImpl::AccessibleAbilityClientImpl()
     if (!InitAccessibilityServiceProxy()) {
         HILOG_ERROR("Init accessibility service proxy failed");
     }
+    focusPrefetcher_ = std::make_shared<AccessibilityFocusPrefetcher>(
+        [this](const AccessibilityElementInfo &from, FocusMoveDirection direction, bool systemApi,
+            AccessibilityElementInfo &next) { return FetchNextFocus(from, direction, systemApi, next); });
 #ifndef ACCESSIBILITY_WATCH_FEATURE
     int retSysParam = WatchParameter(SYSTEM_PARAMETER_AAMS_SERVICE.c_str(),
         &AccessibleAbilityClientImpl::OnParameterChanged, this);
@@ -93,6 +96,10 @@ AccessibleAbilityClientImpl::AccessibleAbilityClientImpl()
 AccessibleAbilityClientImpl::~AccessibleAbilityClientImpl()
 {
     HILOG_DEBUG();
+    // the prefetch task calls back into this client, let a fetch still running finish first
+    if (focusPrefetcher_ != nullptr) {
+        focusPrefetcher_->Stop();
+    }
     std::unique_lock<ffrt::shared_mutex> wLock(rwServiceLock_);
     if (serviceProxy_ && serviceProxy_->AsObject()) {
         HILOG_DEBUG("Remove service death recipient");
@@ -352,6 +359,8 @@ void AccessibleAbilityClientImpl::Disconnect(const int32_t channelId)
         }
     }
 
+    InvalidateFocusPrefetch();
+    ReportFocusPrefetchStatistics();
     if (listener) {
         listener->OnAbilityDisconnected();
     }
@@ -364,6 +373,9 @@ void AccessibleAbilityClientImpl::Disconnect(const int32_t channelId)
 void AccessibleAbilityClientImpl::OnAccessibilityEvent(const AccessibilityEventInfo &eventInfo)
 {
     HILOG_DEBUG();
+    if (AccessibilityFocusPrefetcher::IsInvalidatingEvent(eventInfo.GetEventType())) {
+        InvalidateFocusPrefetch();
+    }
     std::shared_ptr<AccessibleAbilityListener> listener = nullptr;
     {
         std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
@@ -403,7 +415,8 @@ RetError AccessibleAbilityClientImpl::GetFocus(
 {
     HILOG_DEBUG("focusType[%{public}d]", focusType);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetFocus");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetFocus");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -434,7 +447,8 @@ RetError AccessibleAbilityClientImpl::GetFocusByElementInfo(const AccessibilityE
 {
     HILOG_DEBUG("focusType[%{public}d]", focusType);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetFocusByElementInfo");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetFocusByElementInfo");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -500,7 +514,8 @@ RetError AccessibleAbilityClientImpl::GetRoot(AccessibilityElementInfo &elementI
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetRoot");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetRoot");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -684,7 +699,8 @@ RetError AccessibleAbilityClientImpl::GetWindows(std::vector<AccessibilityWindow
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetWindows");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetWindows");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -708,7 +724,8 @@ RetError AccessibleAbilityClientImpl::GetWindows(const uint64_t displayId,
 {
     HILOG_DEBUG("displayId[%{public}" PRIu64 "]", displayId);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetWindows");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetWindows");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -733,7 +750,8 @@ RetError AccessibleAbilityClientImpl::GetNext(const AccessibilityElementInfo& el
     HILOG_DEBUG("windowId[%{public}d], elementId[%{public}" PRId64 "], direction[%{public}d]",
         elementInfo.GetWindowId(), elementInfo.GetAccessibilityId(), direction);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetNext");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetNext");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -749,10 +767,18 @@ RetError AccessibleAbilityClientImpl::GetNext(const AccessibilityElementInfo& el
         HILOG_ERROR("direction is invalid.");
         return RET_ERR_INVALID_PARAM;
     }
-    RetError ret = channelClient_->FocusMoveSearch(elementInfo.GetWindowId(),
-        elementInfo.GetAccessibilityId(), direction, nextElementInfo, systemApi);
+    RetError ret = RET_OK;
+    if (focusPrefetcher_ == nullptr ||
+        !focusPrefetcher_->Lookup(elementInfo, direction, systemApi, nextElementInfo)) {
+        ret = channelClient_->FocusMoveSearch(elementInfo.GetWindowId(),
+            elementInfo.GetAccessibilityId(), direction, nextElementInfo, systemApi);
+    }
     if (ret == RET_OK) {
         nextElementInfo.SetMainWindowId(elementInfo.GetMainWindowId());
+        if (focusPrefetcher_ != nullptr && AccessibilityFocusPrefetcher::IsPrefetchDirection(direction) &&
+            nextElementInfo.GetAccessibilityId() != AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
+            focusPrefetcher_->Schedule(nextElementInfo, systemApi);
+        }
     }
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
     reporter.setResult(ret);
@@ -760,12 +786,46 @@ RetError AccessibleAbilityClientImpl::GetNext(const AccessibilityElementInfo& el
     return ret;
 }
 
+RetError AccessibleAbilityClientImpl::FetchNextFocus(const AccessibilityElementInfo &from,
+    FocusMoveDirection direction, bool systemApi, AccessibilityElementInfo &next)
+{
+    std::shared_ptr<AccessibleAbilityChannelClient> channelClient = nullptr;
+    {
+        std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
+        channelClient = channelClient_;
+    }
+    if (!isConnected_ || channelClient == nullptr) {
+        return RET_ERR_NO_CONNECTION;
+    }
+    return channelClient->FocusMoveSearch(from.GetWindowId(), from.GetAccessibilityId(), direction, next,
+        systemApi);
+}
+
+void AccessibleAbilityClientImpl::InvalidateFocusPrefetch()
+{
+    if (focusPrefetcher_ != nullptr) {
+        focusPrefetcher_->Invalidate();
+    }
+}
+
+void AccessibleAbilityClientImpl::ReportFocusPrefetchStatistics()
+{
+    if (focusPrefetcher_ == nullptr) {
+        return;
+    }
+    FocusPrefetchStatistics statistics = focusPrefetcher_->GetStatistics();
+    HILOG_INFO("focus prefetch: lookups[%{public}" PRIu64 "], hits[%{public}" PRIu64 "], fetches[%{public}"
+        PRIu64 "], wasted[%{public}" PRIu64 "], invalidates[%{public}" PRIu64 "]", statistics.lookupCount,
+        statistics.hitCount, statistics.fetchCount, statistics.wastedCount, statistics.invalidateCount);
+}
+
 RetError AccessibleAbilityClientImpl::GetChildElementInfo(const int32_t index, const AccessibilityElementInfo &parent,
     AccessibilityElementInfo &child)
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetChildElementInfo");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetChildElementInfo");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -1082,7 +1142,8 @@ RetError AccessibleAbilityClientImpl::GetByElementId(const int64_t elementId, co
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetByElementId");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetByElementId");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -1124,7 +1185,8 @@ RetError AccessibleAbilityClientImpl::GetCursorPosition(const AccessibilityEleme
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.GetCursorPosition");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.GetCursorPosition");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -1163,7 +1225,8 @@ RetError AccessibleAbilityClientImpl::ExecuteAction(const AccessibilityElementIn
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.ExecuteAction");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.ExecuteAction");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -1205,7 +1268,8 @@ RetError AccessibleAbilityClientImpl::ExecuteAction(const AccessibilityElementIn
 RetError AccessibleAbilityClientImpl::EnableScreenCurtain(bool isEnable)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.EnableScreenCurtain");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.EnableScreenCurtain");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
     if (!channelClient_) {
@@ -1224,7 +1288,8 @@ RetError AccessibleAbilityClientImpl::SetTargetBundleName(const std::vector<std:
 {
     HILOG_DEBUG("targetBundleNames size[%{public}zu]", targetBundleNames.size());
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.SetTargetBundleName");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.SetTargetBundleName");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!isConnected_) {
         HILOG_ERROR("connection is broken");
@@ -1280,6 +1345,7 @@ void AccessibleAbilityClientImpl::NotifyServiceDied(const wptr<IRemoteObject> &r
     }
 
     isConnected_ = false;
+    InvalidateFocusPrefetch();
     if (listener) {
         listener->OnAbilityDisconnected();
     }
@@ -1299,6 +1365,7 @@ void AccessibleAbilityClientImpl::ResetAAClient(const wptr<IRemoteObject> &remot
     }
 
     isConnected_ = false;
+    InvalidateFocusPrefetch();
 }
 
 RetError AccessibleAbilityClientImpl::SetCacheMode(const int32_t cacheMode)
@@ -1716,7 +1783,8 @@ RetError AccessibleAbilityClientImpl::GetDefaultFocusedElementIds(const int32_t
 RetError AccessibleAbilityClientImpl::HoldRunningLock()
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.HoldRunningLock");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.HoldRunningLock");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     std::unique_lock<ffrt::shared_mutex> wLock(rwRunningLock_);
     if (!channelClient_) {
@@ -1734,7 +1802,8 @@ RetError AccessibleAbilityClientImpl::HoldRunningLock()
 RetError AccessibleAbilityClientImpl::UnholdRunningLock()
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibleAbilityClientImpl.UnholdRunningLock");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibleAbilityClientImpl.UnholdRunningLock");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     std::unique_lock<ffrt::shared_mutex> wLock(rwRunningLock_);
     if (!channelClient_) {
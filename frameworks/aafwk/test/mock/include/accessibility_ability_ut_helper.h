@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_ABILITY_UT_HELPER_H
 #define ACCESSIBILITY_ABILITY_UT_HELPER_H
 
+#include <atomic>
 #include <cstdint>
 
 namespace OHOS {
@@ -48,9 +49,37 @@ public:
         return cacheMode_;
     }
 
+    // the queries of the mock client which go to the service in a real one
+    void AddRoundTrip()
+    {
+        roundTripCount_++;
+    }
+
+    uint32_t GetRoundTripCount() const
+    {
+        return roundTripCount_;
+    }
+
+    void ResetRoundTripCount()
+    {
+        roundTripCount_ = 0;
+    }
+
+    void SetRoundTripLatency(int64_t latencyUs)
+    {
+        roundTripLatencyUs_ = latencyUs;
+    }
+
+    int64_t GetRoundTripLatency() const
+    {
+        return roundTripLatencyUs_;
+    }
+
 private:
     bool isNeedAbilityClientNull_ = false;
     int32_t cacheMode_ = 0;
+    std::atomic<uint32_t> roundTripCount_ = 0;
+    int64_t roundTripLatencyUs_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
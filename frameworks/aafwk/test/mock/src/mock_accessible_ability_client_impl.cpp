@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <thread>
 #include "accessibility_ability_ut_helper.h"
 #include "accessible_ability_client_impl.h"
 #include "hilog_wrapper.h"
@@ -22,6 +24,17 @@ namespace Accessibility {
 namespace {
     ffrt::mutex g_Mutex;
     sptr<AccessibleAbilityClientImpl> g_Instance = nullptr;
+
+    // a query which goes to the service in the real client
+    void SimulateRoundTrip()
+    {
+        AccessibilityAbilityUtHelper &helper = AccessibilityAbilityUtHelper::GetInstance();
+        helper.AddRoundTrip();
+        int64_t latency = helper.GetRoundTripLatency();
+        if (latency > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(latency));
+        }
+    }
 } // namespace
 
 sptr<AccessibleAbilityClient> AccessibleAbilityClient::GetInstance()
@@ -136,6 +149,7 @@ RetError AccessibleAbilityClientImpl::GetRootByWindow(const AccessibilityWindowI
     AccessibilityElementInfo &elementInfo, bool systemApi)
 {
     HILOG_DEBUG();
+    SimulateRoundTrip();
     (void)windowInfo;
     (void)elementInfo;
     (void)systemApi;
@@ -201,6 +215,7 @@ RetError AccessibleAbilityClientImpl::GetChildren(const AccessibilityElementInfo
     std::vector<AccessibilityElementInfo> &children, bool systemApi)
 {
     HILOG_DEBUG();
+    SimulateRoundTrip();
     (void)parent;
     (void)children;
     (void)systemApi;
@@ -231,6 +246,7 @@ RetError AccessibleAbilityClientImpl::GetParentElementInfo(const AccessibilityEl
     AccessibilityElementInfo &parent, bool systemApi)
 {
     HILOG_DEBUG();
+    SimulateRoundTrip();
     (void)child;
     (void)parent;
     (void)systemApi;
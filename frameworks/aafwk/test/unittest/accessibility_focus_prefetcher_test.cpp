@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "accessibility_focus_prefetcher.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t WINDOW_ID = 1;
+    constexpr int64_t FIRST_ELEMENT_ID = 1;
+    constexpr int64_t LAST_ELEMENT_ID = 100;
+    constexpr int32_t SWIPE_COUNT = 10;
+} // namespace
+
+class AccessibilityFocusPrefetcherTest : public ::testing::Test {
+public:
+    AccessibilityFocusPrefetcherTest()
+    {}
+    ~AccessibilityFocusPrefetcherTest()
+    {}
+
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityFocusPrefetcherTest Start";
+    }
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityFocusPrefetcherTest End";
+    }
+    void SetUp()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityFocusPrefetcherTest SetUp()";
+        fetchCount_ = 0;
+        nowMs_ = 0;
+        tasks_.clear();
+        // the nodes of the window are a single line, FORWARD goes to the next id and BACKWARD to the previous one
+        prefetcher_ = std::make_shared<AccessibilityFocusPrefetcher>(
+            [this](const AccessibilityElementInfo &from, FocusMoveDirection direction, bool systemApi,
+                AccessibilityElementInfo &next) { return Fetch(from, direction, next); },
+            [this](std::function<void()> task) { tasks_.push_back(std::move(task)); },
+            [this]() { return nowMs_; });
+    }
+    void TearDown()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityFocusPrefetcherTest TearDown()";
+        prefetcher_ = nullptr;
+    }
+
+    RetError Fetch(const AccessibilityElementInfo &from, FocusMoveDirection direction,
+        AccessibilityElementInfo &next)
+    {
+        fetchCount_++;
+        int64_t elementId = from.GetAccessibilityId() + (direction == FocusMoveDirection::FORWARD ? 1 : -1);
+        if (elementId < FIRST_ELEMENT_ID || elementId > LAST_ELEMENT_ID) {
+            return RET_ERR_FAILED;
+        }
+        next = CreateElement(elementId);
+        return RET_OK;
+    }
+
+    static AccessibilityElementInfo CreateElement(int64_t elementId)
+    {
+        AccessibilityElementInfo info;
+        info.SetWindowId(WINDOW_ID);
+        info.SetAccessibilityId(elementId);
+        return info;
+    }
+
+    void RunTasks()
+    {
+        std::vector<std::function<void()>> tasks;
+        tasks.swap(tasks_);
+        for (auto &task : tasks) {
+            task();
+        }
+    }
+
+    std::shared_ptr<AccessibilityFocusPrefetcher> prefetcher_ = nullptr;
+    std::vector<std::function<void()>> tasks_;
+    int32_t fetchCount_ = 0;
+    int64_t nowMs_ = 0;
+};
+
+/**
+ * @tc.number: Prefetch_001
+ * @tc.name: Schedule
+ * @tc.desc: Test the nodes before and after the focused node are fetched in the background and answer the moves.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Prefetch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Prefetch_001 start";
+    prefetcher_->Schedule(CreateElement(5), false);
+    EXPECT_EQ(fetchCount_, 0);
+    RunTasks();
+    EXPECT_EQ(fetchCount_, AccessibilityFocusPrefetcher::DEFAULT_DEPTH * 2);
+
+    AccessibilityElementInfo next;
+    EXPECT_TRUE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, false, next));
+    EXPECT_EQ(next.GetAccessibilityId(), 6);
+    EXPECT_TRUE(prefetcher_->Lookup(CreateElement(3), FocusMoveDirection::BACKWARD, false, next));
+    EXPECT_EQ(next.GetAccessibilityId(), 2);
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(8), FocusMoveDirection::FORWARD, false, next));
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, true, next));
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::DOWN, false, next));
+
+    FocusPrefetchStatistics statistics = prefetcher_->GetStatistics();
+    EXPECT_EQ(statistics.lookupCount, 4);
+    EXPECT_EQ(statistics.hitCount, 2);
+    EXPECT_EQ(statistics.fetchCount, AccessibilityFocusPrefetcher::DEFAULT_DEPTH * 2);
+    GTEST_LOG_(INFO) << "Prefetch_001 end";
+}
+
+/**
+ * @tc.number: Prefetch_002
+ * @tc.name: Lookup
+ * @tc.desc: Test a run of forward swipes is answered locally after the first one and stops at the last node.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Prefetch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Prefetch_002 start";
+    AccessibilityElementInfo focused = CreateElement(FIRST_ELEMENT_ID);
+    int32_t roundTrips = 0;
+    for (int32_t swipe = 0; swipe < SWIPE_COUNT; swipe++) {
+        AccessibilityElementInfo next;
+        if (!prefetcher_->Lookup(focused, FocusMoveDirection::FORWARD, false, next)) {
+            roundTrips++;
+            EXPECT_EQ(Fetch(focused, FocusMoveDirection::FORWARD, next), RET_OK);
+        }
+        focused = next;
+        prefetcher_->Schedule(focused, false);
+        RunTasks();
+    }
+    EXPECT_EQ(focused.GetAccessibilityId(), FIRST_ELEMENT_ID + SWIPE_COUNT);
+    EXPECT_EQ(roundTrips, 1);
+    EXPECT_EQ(prefetcher_->GetStatistics().hitCount, SWIPE_COUNT - 1);
+
+    // the fetch past the last node fails and nothing is stored for it
+    prefetcher_->Schedule(CreateElement(LAST_ELEMENT_ID), false);
+    RunTasks();
+    AccessibilityElementInfo next;
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(LAST_ELEMENT_ID), FocusMoveDirection::FORWARD, false, next));
+    GTEST_LOG_(INFO) << "Prefetch_002 end";
+}
+
+/**
+ * @tc.number: Invalidate_001
+ * @tc.name: Invalidate
+ * @tc.desc: Test a content change drops the nodes fetched so far and counts the unused ones as wasted.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Invalidate_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Invalidate_001 start";
+    EXPECT_TRUE(AccessibilityFocusPrefetcher::IsInvalidatingEvent(TYPE_PAGE_CONTENT_UPDATE));
+    EXPECT_TRUE(AccessibilityFocusPrefetcher::IsInvalidatingEvent(TYPE_VIEW_CLICKED_EVENT));
+    EXPECT_TRUE(AccessibilityFocusPrefetcher::IsInvalidatingEvent(TYPE_VIEW_SELECTED_EVENT));
+    EXPECT_FALSE(AccessibilityFocusPrefetcher::IsInvalidatingEvent(TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT));
+
+    prefetcher_->Schedule(CreateElement(5), false);
+    RunTasks();
+    AccessibilityElementInfo next;
+    EXPECT_TRUE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, false, next));
+    prefetcher_->Invalidate();
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, false, next));
+
+    // a move scheduled before the change is not fetched after it
+    prefetcher_->Schedule(CreateElement(10), false);
+    prefetcher_->Invalidate();
+    int32_t fetchCount = fetchCount_;
+    RunTasks();
+    EXPECT_EQ(fetchCount_, fetchCount);
+
+    FocusPrefetchStatistics statistics = prefetcher_->GetStatistics();
+    EXPECT_EQ(statistics.wastedCount, AccessibilityFocusPrefetcher::DEFAULT_DEPTH * 2 - 1);
+    EXPECT_EQ(statistics.invalidateCount, 2);
+    GTEST_LOG_(INFO) << "Invalidate_001 end";
+}
+
+/**
+ * @tc.number: Expire_001
+ * @tc.name: Lookup
+ * @tc.desc: Test a node fetched too long ago does not answer a move.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Expire_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Expire_001 start";
+    prefetcher_->Schedule(CreateElement(5), false);
+    RunTasks();
+    nowMs_ += AccessibilityFocusPrefetcher::ENTRY_TTL_MS + 1;
+    AccessibilityElementInfo next;
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, false, next));
+    EXPECT_EQ(prefetcher_->GetStatistics().wastedCount, 1);
+
+    prefetcher_->SetDepth(0);
+    prefetcher_->Schedule(CreateElement(5), false);
+    EXPECT_TRUE(tasks_.empty());
+    GTEST_LOG_(INFO) << "Expire_001 end";
+}
+
+/**
+ * @tc.number: Evict_001
+ * @tc.name: Schedule
+ * @tc.desc: Test a node fetched again after it expired counts as the newest one, the oldest node is dropped
+ *           when the prefetcher is full.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Evict_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Evict_001 start";
+    prefetcher_->SetDepth(1);
+    // the first and the last node add one node each, every other anchor the node before and the node after it
+    prefetcher_->Schedule(CreateElement(LAST_ELEMENT_ID), false);
+    RunTasks();
+    prefetcher_->Schedule(CreateElement(FIRST_ELEMENT_ID), false);
+    RunTasks();
+    nowMs_ += AccessibilityFocusPrefetcher::ENTRY_TTL_MS + 1;
+    AccessibilityElementInfo next;
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(FIRST_ELEMENT_ID), FocusMoveDirection::FORWARD, false, next));
+    prefetcher_->Schedule(CreateElement(3), false);
+    RunTasks();
+    prefetcher_->Schedule(CreateElement(FIRST_ELEMENT_ID), false);
+    RunTasks();
+
+    // two nodes more than fit, the last node and the one after the anchor 3 are dropped
+    int64_t anchor = 4;
+    size_t entryCount = 4;
+    while (entryCount < AccessibilityFocusPrefetcher::MAX_ENTRY_COUNT + 2) {
+        prefetcher_->Schedule(CreateElement(anchor++), false);
+        RunTasks();
+        entryCount += 2;
+    }
+    EXPECT_TRUE(prefetcher_->Lookup(CreateElement(FIRST_ELEMENT_ID), FocusMoveDirection::FORWARD, false, next));
+    EXPECT_EQ(next.GetAccessibilityId(), 2);
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(3), FocusMoveDirection::FORWARD, false, next));
+    EXPECT_TRUE(prefetcher_->Lookup(CreateElement(3), FocusMoveDirection::BACKWARD, false, next));
+    GTEST_LOG_(INFO) << "Evict_001 end";
+}
+
+/**
+ * @tc.number: Stop_001
+ * @tc.name: Stop
+ * @tc.desc: Test stop waits for the prefetch still running and no prefetch starts after it.
+ */
+HWTEST_F(AccessibilityFocusPrefetcherTest, Stop_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Stop_001 start";
+    prefetcher_->Schedule(CreateElement(5), false);
+    // the scheduled task is still to run, stop returns once it did
+    std::thread stopThread([this]() { prefetcher_->Stop(); });
+    RunTasks();
+    stopThread.join();
+
+    AccessibilityElementInfo next;
+    EXPECT_FALSE(prefetcher_->Lookup(CreateElement(5), FocusMoveDirection::FORWARD, false, next));
+    prefetcher_->Schedule(CreateElement(10), false);
+    EXPECT_TRUE(tasks_.empty());
+    // nothing is running, stop returns at once
+    prefetcher_->Stop();
+    GTEST_LOG_(INFO) << "Stop_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
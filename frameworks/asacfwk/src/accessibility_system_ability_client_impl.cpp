@@ -527,7 +527,9 @@ RetError AccessibilitySystemAbilityClientImpl::IsScreenReaderEnabled(bool &isEna
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.IsScreenReaderEnabled");
+    static const int32_t apiId =
+        ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.IsScreenReaderEnabled");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     sptr<IAccessibleAbilityManagerService> serviceProxy;
     {
@@ -622,7 +624,8 @@ RetError AccessibilitySystemAbilityClientImpl::GetAbilityList(const uint32_t acc
 bool AccessibilitySystemAbilityClientImpl::CheckEventType(EventType eventType)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.CheckEventType");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.CheckEventType");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if ((eventType < EventType::TYPE_VIEW_CLICKED_EVENT) ||
         ((eventType >= EventType::TYPE_MAX_NUM) && (eventType != EventType::TYPES_ALL_MASK))) {
@@ -680,7 +683,9 @@ RetError AccessibilitySystemAbilityClientImpl::SubscribeStateObserver(
     HILOG_DEBUG();
     std::lock_guard<ffrt::mutex> lock(observersArrayMutex_);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.SubscribeStateObserver");
+    static const int32_t apiId =
+        ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.SubscribeStateObserver");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (eventType >= AccessibilityStateEventType::EVENT_TYPE_MAX) {
         HILOG_ERROR("Input eventType is out of scope");
@@ -707,7 +712,9 @@ RetError AccessibilitySystemAbilityClientImpl::UnsubscribeStateObserver(
     HILOG_DEBUG("eventType is [%{public}d]", eventType);
     std::lock_guard<ffrt::mutex> lock(observersArrayMutex_);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.UnsubscribeStateObserver");
+    static const int32_t apiId =
+        ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.UnsubscribeStateObserver");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (eventType >= AccessibilityStateEventType::EVENT_TYPE_MAX) {
         HILOG_ERROR("Input eventType is out of scope");
@@ -1354,7 +1361,8 @@ RetError AccessibilitySystemAbilityClientImpl::GetAnimationOffState(bool &state)
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.GetAnimationOffState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.GetAnimationOffState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     sptr<IAccessibleAbilityManagerService> serviceProxy;
     {
@@ -1377,7 +1385,8 @@ RetError AccessibilitySystemAbilityClientImpl::GetAudioMonoState(bool &state)
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.GetAudioMonoState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.GetAudioMonoState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     sptr<IAccessibleAbilityManagerService> serviceProxy;
     {
@@ -1400,7 +1409,9 @@ RetError AccessibilitySystemAbilityClientImpl::GetFlashReminderSwitch(bool &stat
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.GetFlashReminderSwitch");
+    static const int32_t apiId =
+        ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.GetFlashReminderSwitch");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     sptr<IAccessibleAbilityManagerService> serviceProxy;
     {
@@ -1423,7 +1434,8 @@ RetError AccessibilitySystemAbilityClientImpl::GetSeniorModeState(bool &state)
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilitySystemAbilityClientImpl.GetSeniorModeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibilitySystemAbilityClientImpl.GetSeniorModeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     sptr<IAccessibleAbilityManagerService> serviceProxy;
     {
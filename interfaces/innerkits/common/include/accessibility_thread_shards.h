@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_THREAD_SHARDS_H
+#define ACCESSIBILITY_THREAD_SHARDS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * Counters split in SHARD_COUNT shards so the threads recording them do not write the same cache lines.
+ * A thread is given the next shard the first time it records and keeps it. Threads beyond SHARD_COUNT
+ * share shards, so a shard must only hold atomics. The shard of a thread is kept per Shard type, which
+ * suits the singletons using it; a reader sums every shard.
+ */
+template <typename Shard, size_t SHARD_COUNT>
+class AccessibilityThreadShards {
+public:
+    static_assert(SHARD_COUNT > 0, "at least one shard is needed");
+
+    Shard &Local()
+    {
+        thread_local uint32_t shardIndex = shardCount_.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+        return shards_[shardIndex];
+    }
+
+    typename std::array<Shard, SHARD_COUNT>::iterator begin()
+    {
+        return shards_.begin();
+    }
+
+    typename std::array<Shard, SHARD_COUNT>::iterator end()
+    {
+        return shards_.end();
+    }
+
+    typename std::array<Shard, SHARD_COUNT>::const_iterator begin() const
+    {
+        return shards_.begin();
+    }
+
+    typename std::array<Shard, SHARD_COUNT>::const_iterator end() const
+    {
+        return shards_.end();
+    }
+
+private:
+    std::array<Shard, SHARD_COUNT> shards_ {};
+    std::atomic<uint32_t> shardCount_ {0};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_THREAD_SHARDS_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "accessibility_ability_ut_helper.h"
+#include "accessibility_element_info.h"
+#define private public
+#include "napi_accessibility_element.h"
+#undef private
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr size_t SIBLING_COUNT = 50;
+    constexpr int32_t WINDOW_ID = 1;
+    constexpr int64_t PARENT_ID = 100;
+    // the time a query takes to go to the service and back
+    constexpr int64_t ROUND_TRIP_LATENCY_US = 100;
+
+    std::vector<AccessibilityElement> CreateSiblings()
+    {
+        std::vector<AccessibilityElement> siblings;
+        siblings.reserve(SIBLING_COUNT);
+        for (size_t i = 0; i < SIBLING_COUNT; i++) {
+            auto elementInfo = std::make_shared<AccessibilityElementInfo>();
+            elementInfo->SetWindowId(WINDOW_ID);
+            elementInfo->SetAccessibilityId(PARENT_ID + 1 + static_cast<int64_t>(i));
+            elementInfo->SetParent(PARENT_ID);
+            siblings.emplace_back(elementInfo);
+        }
+        return siblings;
+    }
+
+    void SetUpRoundTrips()
+    {
+        AccessibilityAbilityUtHelper &helper = AccessibilityAbilityUtHelper::GetInstance();
+        helper.SetRoundTripLatency(ROUND_TRIP_LATENCY_US);
+        helper.ResetRoundTripCount();
+    }
+
+    void ReportRoundTrips(benchmark::State &state)
+    {
+        AccessibilityAbilityUtHelper &helper = AccessibilityAbilityUtHelper::GetInstance();
+        state.counters["roundTrips"] = benchmark::Counter(static_cast<double>(helper.GetRoundTripCount()),
+            benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(state.iterations() * SIBLING_COUNT);
+        helper.SetRoundTripLatency(0);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForAttributeValuePerElement
+     * @tc.desc: Testcase for getting the parent of 50 siblings by 50 attributeValue calls, each resolved in its
+     *           own execute of the async work.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForAttributeValuePerElement(benchmark::State &state)
+    {
+        std::vector<AccessibilityElement> siblings = CreateSiblings();
+        SetUpRoundTrips();
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<NAccessibilityElementData> requests(SIBLING_COUNT);
+            for (size_t i = 0; i < SIBLING_COUNT; i++) {
+                requests[i].attribute_ = "parent";
+                requests[i].accessibilityElement_ = siblings[i];
+            }
+            state.ResumeTiming();
+            for (auto &request : requests) {
+                NAccessibilityElement::AttributeValueExecute(nullptr, &request);
+            }
+            benchmark::DoNotOptimize(requests.data());
+        }
+        ReportRoundTrips(state);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForAttributeValuesBatch
+     * @tc.desc: Testcase for getting the parent of 50 siblings by one attributeValues call, resolved in a single
+     *           execute of the async work.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForAttributeValuesBatch(benchmark::State &state)
+    {
+        std::vector<AccessibilityElement> siblings = CreateSiblings();
+        SetUpRoundTrips();
+        for (auto _ : state) {
+            state.PauseTiming();
+            NAccessibilityElementBatchData batchData;
+            batchData.items_.resize(SIBLING_COUNT);
+            for (size_t i = 0; i < SIBLING_COUNT; i++) {
+                batchData.items_[i].attribute_ = "parent";
+                batchData.items_[i].accessibilityElement_ = siblings[i];
+            }
+            state.ResumeTiming();
+            NAccessibilityElement::AttributeValuesExecute(nullptr, &batchData);
+            benchmark::DoNotOptimize(batchData.items_.data());
+        }
+        ReportRoundTrips(state);
+    }
+
+    BENCHMARK(BenchmarkTestForAttributeValuePerElement)->Iterations(100);
+    BENCHMARK(BenchmarkTestForAttributeValuesBatch)->Iterations(100);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "accessibility_element_info.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr size_t ELEMENT_COUNT = 1000;
+    constexpr size_t CONTENT_COUNT = 4;
+
+    std::vector<AccessibilityElementInfo> CreateElements()
+    {
+        std::vector<AccessibilityElementInfo> elements(ELEMENT_COUNT);
+        for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+            AccessibilityElementInfo &element = elements[i];
+            element.SetAccessibilityId(static_cast<int64_t>(i));
+            element.SetComponentType("Button");
+            element.SetContent("the text of the element " + std::to_string(i));
+            element.SetHint("the hint text of the element " + std::to_string(i));
+            element.SetDescriptionInfo("the description of the element " + std::to_string(i));
+            element.SetInspectorKey("inspector_key_" + std::to_string(i));
+            element.SetAccessibilityText("the accessibility text of the element " + std::to_string(i));
+            std::vector<std::string> contents;
+            for (size_t j = 0; j < CONTENT_COUNT; j++) {
+                contents.push_back("the content " + std::to_string(j) + " of the element " + std::to_string(i));
+            }
+            element.SetContentList(contents);
+        }
+        return elements;
+    }
+
+    // what the attribute getters hand to js: the id, the component type and the text
+    size_t ReadAttributes(const std::vector<std::shared_ptr<AccessibilityElementInfo>> &wrapped)
+    {
+        size_t length = 0;
+        for (const auto &element : wrapped) {
+            int64_t id = element->GetAccessibilityId();
+            std::string componentType = element->GetComponentType();
+            std::string text = element->GetContent();
+            length += componentType.size() + text.size() + static_cast<size_t>(id > 0);
+        }
+        return length;
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForDeepCopyElements
+     * @tc.desc: Testcase for converting 1000 elements the way the js wrapper did before, copying every element
+     *           into its own object, and reading 3 attributes from each.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForDeepCopyElements(benchmark::State &state)
+    {
+        size_t length = 0;
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<AccessibilityElementInfo> elements = CreateElements();
+            state.ResumeTiming();
+            std::vector<std::shared_ptr<AccessibilityElementInfo>> wrapped;
+            wrapped.reserve(elements.size());
+            for (const auto &element : elements) {
+                wrapped.push_back(std::make_shared<AccessibilityElementInfo>(element));
+            }
+            length = ReadAttributes(wrapped);
+            benchmark::DoNotOptimize(length);
+        }
+        state.SetItemsProcessed(state.iterations() * ELEMENT_COUNT);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForSharedBatchElements
+     * @tc.desc: Testcase for converting 1000 elements into one shared batch the js wrappers point into,
+     *           and reading 3 attributes from each.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForSharedBatchElements(benchmark::State &state)
+    {
+        size_t length = 0;
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<AccessibilityElementInfo> elements = CreateElements();
+            state.ResumeTiming();
+            auto batch = std::make_shared<std::vector<AccessibilityElementInfo>>(std::move(elements));
+            std::vector<std::shared_ptr<AccessibilityElementInfo>> wrapped;
+            wrapped.reserve(batch->size());
+            for (size_t index = 0; index < batch->size(); index++) {
+                wrapped.emplace_back(batch, &(*batch)[index]);
+            }
+            length = ReadAttributes(wrapped);
+            benchmark::DoNotOptimize(length);
+        }
+        state.SetItemsProcessed(state.iterations() * ELEMENT_COUNT);
+    }
+
+    BENCHMARK(BenchmarkTestForDeepCopyElements)->Iterations(100);
+    BENCHMARK(BenchmarkTestForSharedBatchElements)->Iterations(100);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <climits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "api_event_reporter.h"
+#include "api_reporter_helper.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    const std::string API_NAME = "AccessibilityElement.attributeValue";
+    constexpr int32_t NO_THRESHOLD = INT32_MAX;
+
+    // the reporting before, every call of every thread appended its time under one lock
+    struct MutexMapCall {
+        std::vector<int64_t> runTime;
+        int64_t sumTime = 0;
+        int64_t successCount = 0;
+    };
+    std::mutex g_mutexMapMutex;
+    std::map<std::string, std::shared_ptr<MutexMapCall>> g_mutexMapCalls;
+
+    void MutexMapReport(int result, const std::string &apiName, int64_t beginTime)
+    {
+        std::lock_guard<std::mutex> lock(g_mutexMapMutex);
+        auto &call = g_mutexMapCalls[apiName];
+        if (call == nullptr) {
+            call = std::make_shared<MutexMapCall>();
+        }
+        int64_t costTime = ApiEventReporter::GetInstance().GetCurrentTime() - beginTime;
+        call->runTime.push_back(costTime);
+        call->sumTime += costTime;
+        if (result == 0) {
+            call->successCount++;
+        }
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForMutexMapReport
+     * @tc.desc: Testcase for reporting an API call the way it was before, under one lock, from 1 to 8 threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForMutexMapReport(benchmark::State &state)
+    {
+        for (auto _ : state) {
+            MutexMapReport(0, API_NAME, ApiEventReporter::GetInstance().GetCurrentTime());
+        }
+        state.SetItemsProcessed(state.iterations());
+        if (state.thread_index() == 0) {
+            std::lock_guard<std::mutex> lock(g_mutexMapMutex);
+            g_mutexMapCalls.clear();
+        }
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForShardedReport
+     * @tc.desc: Testcase for reporting an API call the way the call sites do, through ApiReportHelper with the
+     *           id resolved once, from 1 to 8 threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForShardedReport(benchmark::State &state)
+    {
+        static const int32_t apiId = ApiReportHelper::GetApiId(API_NAME);
+        for (auto _ : state) {
+            ApiReportHelper reporter(apiId, NO_THRESHOLD);
+        }
+        state.SetItemsProcessed(state.iterations());
+        if (state.thread_index() == 0) {
+            state.counters["calls"] =
+                static_cast<double>(ApiEventReporter::GetInstance().TakeApiCallSummary(apiId).callCount);
+        }
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForShardedReportByName
+     * @tc.desc: Testcase for reporting an API call by its name, which looks the id up on every call, from 1 to 8
+     *           threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForShardedReportByName(benchmark::State &state)
+    {
+        for (auto _ : state) {
+            ApiReportHelper reporter(API_NAME, NO_THRESHOLD);
+        }
+        state.SetItemsProcessed(state.iterations());
+        if (state.thread_index() == 0) {
+            int32_t apiId = ApiReportHelper::GetApiId(API_NAME);
+            state.counters["calls"] =
+                static_cast<double>(ApiEventReporter::GetInstance().TakeApiCallSummary(apiId).callCount);
+        }
+    }
+
+    BENCHMARK(BenchmarkTestForMutexMapReport)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(BenchmarkTestForShardedReport)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(BenchmarkTestForShardedReportByName)->ThreadRange(1, 8)->UseRealTime();
+}
+
+BENCHMARK_MAIN();
@@ -339,6 +339,22 @@ export default class AccessibilityExtensionContext extends ExtensionContext {
    */
   getElements(windowId: number, elementId?: number): Promise<Array<AccessibilityElement>>;
 
+  /**
+   * Get the values of several attributes of several elements at once.
+   * Each value is undefined in the result if it could not be got, as the parent of a root element.
+   *
+   * @param { Array<ElementAttributeRequest> } requests Indicates the elements and the attribute names.
+   * @returns { Promise<Array<ElementAttributeValues[keyof ElementAttributeValues] | undefined>> } The values,
+   *          in the order of the requests.
+   * @throws { BusinessError } 401 - Input parameter error.
+   * @throws { BusinessError } 9300004 - This property does not exist.
+   * @syscap SystemCapability.BarrierFree.Accessibility.Core
+   * @since 21
+   */
+  attributeValues(
+    requests: Array<ElementAttributeRequest>
+  ): Promise<Array<ElementAttributeValues[keyof ElementAttributeValues] | undefined>>;
+
   /**
    * Hold running lock to prevent screen turning off automatically.
    *
@@ -1045,6 +1061,18 @@ type FocusType = 'accessibility' | 'normal';
  */
 type WindowType = 'application' | 'system';
 
+/**
+ * Indicates an attribute of an element to get.
+ *
+ * @typedef ElementAttributeRequest
+ * @syscap SystemCapability.BarrierFree.Accessibility.Core
+ * @since 21
+ */
+interface ElementAttributeRequest {
+  element: AccessibilityElement;
+  attributeName: keyof ElementAttributeValues;
+}
+
 /**
  * Indicates rectangle.
  *
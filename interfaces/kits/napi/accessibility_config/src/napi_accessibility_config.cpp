@@ -239,8 +239,9 @@ napi_value NAccessibilityConfig::EnableAbility(napi_env env, napi_callback_info
             auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
             if (callbackInfo->capabilities_ != 0) {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-                Accessibility::ApiReportHelper reporter(
-                    "AccessibilityConfig.Impl.EnableAbility", REPORTER_THRESHOLD_VALUE);
+                static const int32_t apiId =
+                    Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.EnableAbility");
+                Accessibility::ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
                 callbackInfo->ret_ = instance.EnableAbility(
                     callbackInfo->abilityName_, callbackInfo->capabilities_, false);
@@ -314,8 +315,8 @@ void NAccessibilityConfig::EnableAbilityWithCallbackExecute(napi_env env, void*
     auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
     if (callbackInfo->capabilities_ != 0) {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-        Accessibility::ApiReportHelper reporter(
-            "AccessibilityConfig.Impl.EnableAbility", REPORTER_THRESHOLD_VALUE);
+        static const int32_t apiId = Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.EnableAbility");
+        Accessibility::ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
         callbackInfo->ret_ = instance.EnableAbility(callbackInfo->abilityName_,
             callbackInfo->capabilities_, true);
@@ -395,7 +396,8 @@ napi_value NAccessibilityConfig::DisableAbility(napi_env env, napi_callback_info
             auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
             if (callbackInfo) {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.Impl.DisableAbility", REPORTER_THRESHOLD_VALUE);
+    static const int32_t apiId = Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.DisableAbility");
+    Accessibility::ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
                 callbackInfo->ret_ = instance.DisableAbility(callbackInfo->abilityName_);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
@@ -500,7 +502,8 @@ napi_value NAccessibilityConfig::SubscribeState(napi_env env, napi_callback_info
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityConfig.SubscribeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityConfig.SubscribeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!IsAvailable(env, info)) {
         return nullptr;
@@ -565,7 +568,8 @@ napi_value NAccessibilityConfig::UnsubscribeState(napi_env env, napi_callback_in
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityConfig.UnsubscribeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityConfig.UnsubscribeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!IsAvailable(env, info)) {
         return nullptr;
@@ -677,14 +681,27 @@ void NAccessibilityConfig::SetScreenTouchConfigExecute(NAccessibilityConfigData*
     }
 }
 
-static std::string GetConfigApiTag(OHOS::AccessibilityConfig::CONFIG_ID configId, int32_t flag)
+static int32_t GetConfigApiId(OHOS::AccessibilityConfig::CONFIG_ID configId, int32_t flag)
 {
     if (flag > 1) {
-        return "";
-    }
-    auto iter = configApiMap.find(configId);
-    if (iter == configApiMap.end()) {
-        return flag == 0 ? "AccessibilityConfig.Impl.Setter" : "AccessibilityConfig.Impl.Getter";
+        return ApiEventReporter::INVALID_API_ID;
+    }
+    // the names are resolved once, the config calls only look up the ids
+    static const std::map<OHOS::AccessibilityConfig::CONFIG_ID, std::vector<int32_t>> configApiIds = [] {
+        std::map<OHOS::AccessibilityConfig::CONFIG_ID, std::vector<int32_t>> apiIds;
+        for (const auto &config : configApiMap) {
+            for (const auto &name : config.second) {
+                apiIds[config.first].push_back(ApiReportHelper::GetApiId(name));
+            }
+        }
+        return apiIds;
+    }();
+    static const std::vector<int32_t> defaultApiIds = {
+        ApiReportHelper::GetApiId("AccessibilityConfig.Impl.Setter"),
+        ApiReportHelper::GetApiId("AccessibilityConfig.Impl.Getter")};
+    auto iter = configApiIds.find(configId);
+    if (iter == configApiIds.end()) {
+        return defaultApiIds[flag];
     } else {
         return iter->second[flag];
     }
@@ -701,7 +718,7 @@ void NAccessibilityConfig::SetConfigExecute(napi_env env, void* data)
     HILOG_DEBUG("callbackInfo->id_ = %{public}d", callbackInfo->id_);
     auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter(GetConfigApiTag(callbackInfo->id_, SET_FLAG), REPORTER_THRESHOLD_VALUE);
+    Accessibility::ApiReportHelper reporter(GetConfigApiId(callbackInfo->id_, SET_FLAG), REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
 
     if (callbackInfo->id_ == OHOS::AccessibilityConfig::CONFIG_ID::CONFIG_HIGH_CONTRAST_TEXT) {
@@ -856,7 +873,7 @@ void NAccessibilityConfig::GetConfigExecute(napi_env env, void* data)
 
     HILOG_DEBUG("callbackInfo->id_ = %{public}d", callbackInfo->id_);
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter(GetConfigApiTag(callbackInfo->id_, GET_FLAG), REPORTER_THRESHOLD_VALUE);
+    Accessibility::ApiReportHelper reporter(GetConfigApiId(callbackInfo->id_, GET_FLAG), REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
     if (callbackInfo->id_ == OHOS::AccessibilityConfig::CONFIG_ID::CONFIG_HIGH_CONTRAST_TEXT) {
@@ -1183,7 +1200,9 @@ napi_value NAccessibilityConfig::SubscribeConfigObserver(napi_env env, napi_call
         return nullptr;
     }
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.Impl.SubscribeConfigObserver");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.SubscribeConfigObserver");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     configObservers_->SubscribeObserver(env, obj->GetConfigId(), parameters[PARAM0]);
     return nullptr;
@@ -1214,7 +1233,9 @@ napi_value NAccessibilityConfig::UnSubscribeConfigObserver(napi_env env, napi_ca
         return nullptr;
     }
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.Impl.UnsubscribeConfigObserver");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.UnsubscribeConfigObserver");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (argc >= ARGS_SIZE_ONE && CheckJsFunction(env, parameters[PARAM0])) {
         configObservers_->UnsubscribeObserver(env, obj->GetConfigId(), parameters[PARAM0]);
@@ -1358,7 +1379,9 @@ int EnableAbilityCallbackObserver::OnEnableAbilityListsRemoteDiedWork(
 void EnableAbilityListsObserverImpl::SubscribeToFramework()
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.Impl.SubscribeEnableAbilityListsObserver");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.SubscribeEnableAbilityListsObserver");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
     instance.SubscribeEnableAbilityListsObserver(shared_from_this());
@@ -1367,7 +1390,9 @@ void EnableAbilityListsObserverImpl::SubscribeToFramework()
 void EnableAbilityListsObserverImpl::UnsubscribeFromFramework()
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.Impl.UnsubscribeEnableAbilityListsObserver");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.Impl.UnsubscribeEnableAbilityListsObserver");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO("UnsubscribeFromFramework");
     auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
@@ -1540,7 +1565,9 @@ napi_value NAccessibilityConfig::SubscribeSelfSeniorMode(napi_env env, napi_call
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.SubscribeSelfSeniorMode");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.SubscribeSelfSeniorMode");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!IsAvailable(env, info)) {
         return nullptr;
@@ -1573,7 +1600,9 @@ napi_value NAccessibilityConfig::UnsubscribeSelfSeniorMode(napi_env env, napi_ca
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.UnsubscribeSelfSeniorMode");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.UnsubscribeSelfSeniorMode");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!IsAvailable(env, info)) {
         return nullptr;
@@ -1627,7 +1656,9 @@ napi_value NAccessibilityConfig::GetSeniorModeStateForApp(napi_env env, napi_cal
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    Accessibility::ApiReportHelper reporter("AccessibilityConfig.GetSeniorModeStateForApp");
+    static const int32_t apiId =
+        Accessibility::ApiReportHelper::GetApiId("AccessibilityConfig.GetSeniorModeStateForApp");
+    Accessibility::ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     NAccessibilityConfigData* callbackInfo = new(std::nothrow) NAccessibilityConfigData();
     if (callbackInfo == nullptr) {
@@ -23,6 +23,11 @@
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 
+/**
+ * The native object behind a js AccessibilityElement. The element info of a query returning a list points
+ * into the batch of that query, which is shared by all of its js objects and never changed after the query,
+ * so the attributes are only converted when js reads them.
+ */
 struct AccessibilityElement {
     AccessibilityElement() = default;
     AccessibilityElement(std::shared_ptr<OHOS::Accessibility::AccessibilityElementInfo> elementInfo)
@@ -67,6 +72,14 @@ struct NAccessibilityElementData {
     OHOS::Accessibility::RetError ret_ = OHOS::Accessibility::RetError::RET_ERR_FAILED;
 };
 
+// attributeValues of the extension context, the requests of one call resolved in a single async work
+struct NAccessibilityElementBatchData {
+    napi_async_work work_ {};
+    napi_deferred deferred_ {};
+    napi_env env_ {};
+    std::vector<NAccessibilityElementData> items_ {};
+};
+
 using ParseConditionFunc = std::function<OHOS::Accessibility::RetError(OHOS::Accessibility::NAPICbInfo&,
     NAccessibilityElementData*)>;
 
@@ -95,11 +108,15 @@ public:
         const OHOS::Accessibility::AccessibilityElementInfo& elementInfo);
     static void ConvertElementInfosToJS(napi_env env, napi_value result,
         const std::vector<OHOS::Accessibility::AccessibilityElementInfo>& elementInfos);
+    // the elements are moved into one batch shared by the js objects, nothing is copied per element
+    static void ConvertElementInfosToJS(napi_env env, napi_value result,
+        std::vector<OHOS::Accessibility::AccessibilityElementInfo>&& elementInfos);
     static void ConvertElementIdVecToJS(napi_env env, napi_value result,
         const std::vector<OHOS::Accessibility::AccessibilityElementInfo>& elementInfos);
 
     static napi_value AttributeNames(napi_env env, napi_callback_info info);
     static napi_value AttributeValue(napi_env env, napi_callback_info info);
+    static napi_value AttributeValues(napi_env env, napi_callback_info info);
     static napi_value ActionNames(napi_env env, napi_callback_info info);
     static napi_value PerformAction(napi_env env, napi_callback_info info);
     static napi_value EnableScreenCurtain(napi_env env, napi_callback_info info);
@@ -229,6 +246,12 @@ private:
     static void AttributeNamesComplete(napi_env env, napi_status status, void* data);
     static void AttributeValueExecute(napi_env env, void* data);
     static void AttributeValueComplete(napi_env env, napi_status status, void* data);
+    static void ResolveAttribute(NAccessibilityElementData* callbackInfo);
+    static void ConvertAttributeValue(NAccessibilityElementData* callbackInfo, napi_value& value);
+    static OHOS::Accessibility::RetError ParseAttributeValuesRequests(napi_env env, napi_value requests,
+        NAccessibilityElementBatchData* batchData);
+    static void AttributeValuesExecute(napi_env env, void* data);
+    static void AttributeValuesComplete(napi_env env, napi_status status, void* data);
     static void ActionNamesComplete(napi_env env, napi_status status, void* data);
     static void PerformActionExecute(napi_env env, void* data);
     static void PerformActionComplete(napi_env env, napi_status status, void* data);
@@ -278,6 +301,11 @@ private:
     static OHOS::Accessibility::RetError RunAttributeValue(
         OHOS::Accessibility::NAPICbInfo& cbInfo, NAccessibilityElementData* elementData, napi_value& result);
 
+    static void ConvertElementBatchToJS(napi_env env, napi_value result,
+        const std::shared_ptr<std::vector<OHOS::Accessibility::AccessibilityElementInfo>>& batch);
+    static void WrapAccessibilityElement(napi_env env, napi_value result,
+        const std::shared_ptr<OHOS::Accessibility::AccessibilityElementInfo>& elementInfo);
+
     NAccessibilityElement() = default;
     ~NAccessibilityElement() = default;
 };
@@ -183,7 +183,8 @@ RetError AccessibilityExtensionContext::StartAbility(const AAFwk::Want &want)
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("AccessibilityExtensionContext.StartAbility");
+    static const int32_t apiId = ApiReportHelper::GetApiId("AccessibilityExtensionContext.StartAbility");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     if (!Permission::IsSystemApp()) {
         HILOG_ERROR("Not system app");
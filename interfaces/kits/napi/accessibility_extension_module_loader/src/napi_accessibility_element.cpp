@@ -16,6 +16,7 @@
 #include "napi_accessibility_element.h"
 #include <algorithm>
 #include <map>
+#include <tuple>
 #include <vector>
 #include <cinttypes>
 #include "accessible_ability_client.h"
@@ -332,10 +333,16 @@ napi_value NAccessibilityElement::JSConstructor(napi_env env, napi_callback_info
 void NAccessibilityElement::ConvertElementInfoToJS(napi_env env, napi_value result,
     const AccessibilityElementInfo& elementInfo)
 {
-    // Bind js object to a Native object
     std::shared_ptr<AccessibilityElementInfo> elementInformation =
         std::make_shared<AccessibilityElementInfo>(elementInfo);
-    AccessibilityElement* pAccessibilityElement = new(std::nothrow) AccessibilityElement(elementInformation);
+    WrapAccessibilityElement(env, result, elementInformation);
+}
+
+void NAccessibilityElement::WrapAccessibilityElement(napi_env env, napi_value result,
+    const std::shared_ptr<AccessibilityElementInfo>& elementInfo)
+{
+    // Bind js object to a Native object
+    AccessibilityElement* pAccessibilityElement = new(std::nothrow) AccessibilityElement(elementInfo);
     if (pAccessibilityElement == nullptr) {
         HILOG_ERROR("Failed to create elementInformation.");
         return;
@@ -362,19 +369,37 @@ void NAccessibilityElement::ConvertElementInfoToJS(napi_env env, napi_value resu
 void NAccessibilityElement::ConvertElementInfosToJS(
     napi_env env, napi_value result, const std::vector<OHOS::Accessibility::AccessibilityElementInfo>& elementInfos)
 {
-    HILOG_DEBUG("elementInfo size(%{public}zu)", elementInfos.size());
+    ConvertElementBatchToJS(env, result,
+        std::make_shared<std::vector<AccessibilityElementInfo>>(elementInfos));
+}
+
+void NAccessibilityElement::ConvertElementInfosToJS(
+    napi_env env, napi_value result, std::vector<OHOS::Accessibility::AccessibilityElementInfo>&& elementInfos)
+{
+    ConvertElementBatchToJS(env, result,
+        std::make_shared<std::vector<AccessibilityElementInfo>>(std::move(elementInfos)));
+}
+
+void NAccessibilityElement::ConvertElementBatchToJS(napi_env env, napi_value result,
+    const std::shared_ptr<std::vector<AccessibilityElementInfo>>& batch)
+{
+    if (batch == nullptr) {
+        HILOG_ERROR("Failed to create the element batch.");
+        return;
+    }
+    HILOG_DEBUG("elementInfo size(%{public}zu)", batch->size());
 
     napi_value constructor = nullptr;
     napi_get_reference_value(env, NAccessibilityElement::consRef_, &constructor);
 
-    size_t index = 0;
-    for (auto& elementInfo : elementInfos) {
+    for (size_t index = 0; index < batch->size(); index++) {
         napi_value obj = nullptr;
         napi_status status = napi_new_instance(env, constructor, 0, nullptr, &obj);
         HILOG_DEBUG("status is %{public}d", status);
-        ConvertElementInfoToJS(env, obj, elementInfo);
+        // shares the ownership of the batch, the last js object collected releases it
+        std::shared_ptr<AccessibilityElementInfo> elementInfo(batch, &(*batch)[index]);
+        WrapAccessibilityElement(env, obj, elementInfo);
         napi_set_element(env, result, index, obj);
-        index++;
     }
 }
 
@@ -404,7 +429,8 @@ napi_value NAccessibilityElement::AttributeNames(napi_env env, napi_callback_inf
 {
     HILOG_DEBUG();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityElement.AttributeNames");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityElement.AttributeNames");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value argv = nullptr;
@@ -614,7 +640,8 @@ napi_value NAccessibilityElement::AttributeValueAsync(
 void NAccessibilityElement::AttributeValueExecute(napi_env env, void* data)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityElement.AttributeValueExecute");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityElement.AttributeValueExecute");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     NAccessibilityElementData* callbackInfo = static_cast<NAccessibilityElementData*>(data);
     if (callbackInfo == nullptr) {
@@ -622,6 +649,11 @@ void NAccessibilityElement::AttributeValueExecute(napi_env env, void* data)
         return;
     }
 
+    ResolveAttribute(callbackInfo);
+}
+
+void NAccessibilityElement::ResolveAttribute(NAccessibilityElementData* callbackInfo)
+{
     bool systemApi = callbackInfo->systemApi;
     HILOG_DEBUG("systemApi: %{public}d", systemApi);
 
@@ -660,49 +692,204 @@ void NAccessibilityElement::AttributeValueComplete(napi_env env, napi_status sta
         return;
     }
     napi_value result[ARGS_SIZE_TWO] = {0};
+    ConvertAttributeValue(callbackInfo, result[PARAM1]);
+
+    HILOG_DEBUG("result is %{public}d", callbackInfo->ret_);
+    result[PARAM0] = CreateBusinessError(env, callbackInfo->ret_);
+    if (callbackInfo->callback_) {
+        napi_value callback = nullptr;
+        napi_value returnVal = nullptr;
+        napi_value undefined = nullptr;
+        napi_get_reference_value(env, callbackInfo->callback_, &callback);
+        napi_get_undefined(env, &undefined); // 是否加判断
+        napi_call_function(env, undefined, callback, ARGS_SIZE_TWO, result, &returnVal);
+        napi_delete_reference(env, callbackInfo->callback_);
+    } else {
+        if (callbackInfo->ret_ == RET_OK) {
+            napi_resolve_deferred(env, callbackInfo->deferred_, result[PARAM1]);
+        } else {
+            napi_reject_deferred(env, callbackInfo->deferred_, result[PARAM0]);
+        }
+    }
+    napi_delete_async_work(env, callbackInfo->work_);
+    delete callbackInfo;
+    callbackInfo = nullptr;
+}
 
+void NAccessibilityElement::ConvertAttributeValue(NAccessibilityElementData* callbackInfo, napi_value& value)
+{
     if (callbackInfo->accessibilityElement_.isElementInfo_) {
         HILOG_DEBUG("It is element info");
         auto elementIter = elementInfoCompleteMap.find(callbackInfo->attribute_);
         if (elementIter == elementInfoCompleteMap.end()) {
             HILOG_ERROR("There is no the attribute[%{public}s] in element info", callbackInfo->attribute_.c_str());
-            napi_get_undefined(callbackInfo->env_, &result[PARAM1]);
+            napi_get_undefined(callbackInfo->env_, &value);
             callbackInfo->ret_ = RET_ERR_PROPERTY_NOT_EXIST;
         } else {
-            (*elementIter->second)(callbackInfo, result[PARAM1]);
+            (*elementIter->second)(callbackInfo, value);
         }
     } else {
         HILOG_DEBUG("It is window info");
         auto windowIter = windowInfoCompleteMap.find(callbackInfo->attribute_);
         if (windowIter == windowInfoCompleteMap.end()) {
             HILOG_ERROR("There is no the attribute[%{public}s]", callbackInfo->attribute_.c_str());
-            napi_get_undefined(callbackInfo->env_, &result[PARAM1]);
+            napi_get_undefined(callbackInfo->env_, &value);
             callbackInfo->ret_ = RET_ERR_PROPERTY_NOT_EXIST;
         } else {
-            (*windowIter->second)(callbackInfo, result[PARAM1]);
+            (*windowIter->second)(callbackInfo, value);
         }
     }
+}
 
-    HILOG_DEBUG("result is %{public}d", callbackInfo->ret_);
-    result[PARAM0] = CreateBusinessError(env, callbackInfo->ret_);
-    if (callbackInfo->callback_) {
-        napi_value callback = nullptr;
-        napi_value returnVal = nullptr;
-        napi_value undefined = nullptr;
-        napi_get_reference_value(env, callbackInfo->callback_, &callback);
-        napi_get_undefined(env, &undefined); // 是否加判断
-        napi_call_function(env, undefined, callback, ARGS_SIZE_TWO, result, &returnVal);
-        napi_delete_reference(env, callbackInfo->callback_);
-    } else {
-        if (callbackInfo->ret_ == RET_OK) {
-            napi_resolve_deferred(env, callbackInfo->deferred_, result[PARAM1]);
+napi_value NAccessibilityElement::AttributeValues(napi_env env, napi_callback_info info)
+{
+    size_t argc = ARGS_SIZE_ONE;
+    napi_value argv[ARGS_SIZE_ONE] = {0};
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    if (status != napi_ok || argc < ARGS_SIZE_ONE) {
+        HILOG_ERROR("argc is invalid: %{public}zu", argc);
+        napi_throw(env, CreateBusinessError(env, RetError::RET_ERR_INVALID_PARAM));
+        return nullptr;
+    }
+
+    NAccessibilityElementBatchData* batchData = new(std::nothrow) NAccessibilityElementBatchData();
+    if (batchData == nullptr) {
+        HILOG_ERROR("Failed to create batchData.");
+        napi_throw(env, CreateBusinessError(env, RetError::RET_ERR_NULLPTR));
+        return nullptr;
+    }
+    batchData->env_ = env;
+    RetError ret = ParseAttributeValuesRequests(env, argv[PARAM0], batchData);
+    if (ret != RET_OK) {
+        delete batchData;
+        batchData = nullptr;
+        napi_throw(env, CreateBusinessError(env, ret));
+        return nullptr;
+    }
+
+    napi_value promise = nullptr;
+    napi_create_promise(env, &batchData->deferred_, &promise);
+    napi_value resource = nullptr;
+    napi_create_string_utf8(env, "AttributeValues", NAPI_AUTO_LENGTH, &resource);
+    if (napi_create_async_work(env, nullptr, resource, AttributeValuesExecute, AttributeValuesComplete,
+        reinterpret_cast<void*>(batchData), &batchData->work_) != napi_ok) {
+        delete batchData;
+        batchData = nullptr;
+        return nullptr;
+    }
+    napi_queue_async_work_with_qos(env, batchData->work_, napi_qos_user_initiated);
+    return promise;
+}
+
+RetError NAccessibilityElement::ParseAttributeValuesRequests(napi_env env, napi_value requests,
+    NAccessibilityElementBatchData* batchData)
+{
+    bool isArray = false;
+    uint32_t length = 0;
+    if (napi_is_array(env, requests, &isArray) != napi_ok || !isArray ||
+        napi_get_array_length(env, requests, &length) != napi_ok) {
+        HILOG_ERROR("requests is not an array");
+        return RetError::RET_ERR_INVALID_PARAM;
+    }
+
+    batchData->items_.resize(length);
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value request = nullptr;
+        napi_value element = nullptr;
+        napi_value attributeName = nullptr;
+        AccessibilityElement* accessibilityElement = nullptr;
+        NAccessibilityElementData& item = batchData->items_[i];
+        if (napi_get_element(env, requests, i, &request) != napi_ok ||
+            napi_get_named_property(env, request, "element", &element) != napi_ok ||
+            napi_get_named_property(env, request, "attributeName", &attributeName) != napi_ok ||
+            !ParseString(env, item.attribute_, attributeName)) {
+            HILOG_ERROR("request[%{public}u] is invalid", i);
+            return RetError::RET_ERR_INVALID_PARAM;
+        }
+        // napi_unwrap takes any wrapped object, only an AccessibilityElement is read as one
+        napi_value constructor = nullptr;
+        bool isElement = false;
+        if (napi_get_reference_value(env, consRef_, &constructor) != napi_ok ||
+            napi_instanceof(env, element, constructor, &isElement) != napi_ok || !isElement ||
+            napi_unwrap(env, element, reinterpret_cast<void**>(&accessibilityElement)) != napi_ok ||
+            accessibilityElement == nullptr) {
+            HILOG_ERROR("element of request[%{public}u] is invalid", i);
+            return RetError::RET_ERR_INVALID_PARAM;
+        }
+        const auto& infoMap = accessibilityElement->isElementInfo_ ? elementInfoCompleteMap : windowInfoCompleteMap;
+        if (infoMap.find(item.attribute_) == infoMap.end()) {
+            HILOG_ERROR("There is no the attribute[%{public}s]", item.attribute_.c_str());
+            return RetError::RET_ERR_PROPERTY_NOT_EXIST;
+        }
+        item.env_ = env;
+        item.accessibilityElement_ = *accessibilityElement;
+    }
+    return RetError::RET_OK;
+}
+
+void NAccessibilityElement::AttributeValuesExecute(napi_env env, void* data)
+{
+    NAccessibilityElementBatchData* batchData = static_cast<NAccessibilityElementBatchData*>(data);
+    if (batchData == nullptr) {
+        HILOG_ERROR("batchData is nullptr");
+        return;
+    }
+
+    // requests reaching the same node, as the parent of siblings, ask the client once
+    using QueryKey = std::tuple<std::string, int32_t, int64_t>;
+    std::map<QueryKey, size_t> resolved;
+    for (size_t i = 0; i < batchData->items_.size(); i++) {
+        NAccessibilityElementData& item = batchData->items_[i];
+        const AccessibilityElement& element = item.accessibilityElement_;
+        QueryKey key;
+        if (item.attribute_ == "parent" && element.elementInfo_) {
+            key = {item.attribute_, element.elementInfo_->GetWindowId(), element.elementInfo_->GetParentNodeId()};
+        } else if (item.attribute_ == "children" && element.elementInfo_) {
+            key = {item.attribute_, element.elementInfo_->GetWindowId(), element.elementInfo_->GetAccessibilityId()};
+        } else if (item.attribute_ == "rootElement" && element.windowInfo_) {
+            key = {item.attribute_, element.windowInfo_->GetWindowId(), 0};
         } else {
-            napi_reject_deferred(env, callbackInfo->deferred_, result[PARAM0]);
+            item.ret_ = RET_OK;
+            continue;
+        }
+        auto iter = resolved.find(key);
+        if (iter != resolved.end()) {
+            const NAccessibilityElementData& first = batchData->items_[iter->second];
+            item.ret_ = first.ret_;
+            item.nodeInfo_ = first.nodeInfo_;
+            item.nodeInfos_ = first.nodeInfos_;
+            continue;
         }
+        ResolveAttribute(&item);
+        resolved.emplace(key, i);
     }
-    napi_delete_async_work(env, callbackInfo->work_);
-    delete callbackInfo;
-    callbackInfo = nullptr;
+    HILOG_DEBUG("requests[%{public}zu], queries[%{public}zu]", batchData->items_.size(), resolved.size());
+}
+
+void NAccessibilityElement::AttributeValuesComplete(napi_env env, napi_status status, void* data)
+{
+    NAccessibilityElementBatchData* batchData = static_cast<NAccessibilityElementBatchData*>(data);
+    if (batchData == nullptr) {
+        HILOG_ERROR("batchData is nullptr");
+        return;
+    }
+
+    // a request failing on its own is undefined in the result, the others are still returned
+    napi_value result = nullptr;
+    napi_create_array_with_length(env, batchData->items_.size(), &result);
+    for (size_t i = 0; i < batchData->items_.size(); i++) {
+        NAccessibilityElementData& item = batchData->items_[i];
+        napi_value value = nullptr;
+        ConvertAttributeValue(&item, value);
+        if (item.ret_ != RET_OK || value == nullptr) {
+            napi_get_undefined(env, &value);
+        }
+        napi_set_element(env, result, i, value);
+    }
+    napi_resolve_deferred(env, batchData->deferred_, result);
+    napi_delete_async_work(env, batchData->work_);
+    delete batchData;
+    batchData = nullptr;
 }
 
 bool NAccessibilityElement::CheckElementInfoParameter(NAccessibilityElementData *callbackInfo, napi_value &value)
@@ -1184,7 +1371,7 @@ void NAccessibilityElement::GetElementInfoChildren(NAccessibilityElementData *ca
     }
     if (callbackInfo->ret_ == RET_OK) {
         NAPI_CALL_RETURN_VOID(callbackInfo->env_, napi_create_array(callbackInfo->env_, &value));
-        ConvertElementInfosToJS(callbackInfo->env_, value, callbackInfo->nodeInfos_);
+        ConvertElementInfosToJS(callbackInfo->env_, value, std::move(callbackInfo->nodeInfos_));
     } else {
         HILOG_ERROR("GetElementInfoChildren failed!");
         napi_get_undefined(callbackInfo->env_, &value);
@@ -2062,7 +2249,8 @@ void NAccessibilityElement::GetWindowInfoHotArea(NAccessibilityElementData *call
 napi_value NAccessibilityElement::ActionNames(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityElement.ActionNames");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityElement.ActionNames");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value argv = nullptr;
@@ -2578,7 +2766,7 @@ void NAccessibilityElement::FindElementsByConditionComplete(napi_env env, napi_s
 
     napi_value value = nullptr;
     napi_create_array(callbackInfo->env_, &value);
-    ConvertElementInfosToJS(env, value, callbackInfo->nodeInfos_);
+    ConvertElementInfosToJS(env, value, std::move(callbackInfo->nodeInfos_));
 
     napi_value nResult = nullptr;
     napi_status nStatus = napi_create_int64(env, callbackInfo->moveSearchResult_, &nResult);
@@ -3093,7 +3281,9 @@ void NAccessibilityElement::FindElementExecute(napi_env env, void* data)
         case FindElementCondition::FIND_ELEMENT_CONDITION_CONTENT:
             {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-                ApiReportHelper reporter("NAccessibilityElement.FindElementExecute.content");
+                static const int32_t apiId =
+                    ApiReportHelper::GetApiId("NAccessibilityElement.FindElementExecute.content");
+                ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
                 FindElementByText(callbackInfo);
             }
@@ -3101,7 +3291,9 @@ void NAccessibilityElement::FindElementExecute(napi_env env, void* data)
         case FindElementCondition::FIND_ELEMENT_CONDITION_TEXT_TYPE:
             {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-                ApiReportHelper reporterText("NAccessibilityElement.FindElementExecute.textType");
+                static const int32_t reporterTextApiId =
+                    ApiReportHelper::GetApiId("NAccessibilityElement.FindElementExecute.textType");
+                ApiReportHelper reporterText(reporterTextApiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
                 FindElementByText(callbackInfo);
             }
@@ -3255,11 +3447,11 @@ void NAccessibilityElement::GetElement(NAccessibilityElementData *callbackInfo,
             return;
         case FindElementCondition::FIND_ELEMENT_CONDITION_CONTENT:
             napi_create_array(env, &value);
-            ConvertElementInfosToJS(env, value, callbackInfo->nodeInfos_);
+            ConvertElementInfosToJS(env, value, std::move(callbackInfo->nodeInfos_));
             break;
         case FindElementCondition::FIND_ELEMENT_CONDITION_TEXT_TYPE:
             napi_create_array(env, &value);
-            ConvertElementInfosToJS(env, value, callbackInfo->nodeInfos_);
+            ConvertElementInfosToJS(env, value, std::move(callbackInfo->nodeInfos_));
             break;
         case FindElementCondition::FIND_ELEMENT_CONDITION_FOCUS_TYPE:
             {
@@ -172,7 +172,8 @@ void NAccessibilityExtension::OnAbilityConnected()
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityExtension.OnAbilityConnected");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityExtension.OnAbilityConnected");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     uv_loop_s* loop = nullptr;
     napi_get_uv_event_loop(env_, &loop);
@@ -227,7 +228,8 @@ void NAccessibilityExtension::OnAbilityDisconnected()
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityExtension.OnAbilityDisconnected");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityExtension.OnAbilityDisconnected");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     uv_loop_s* loop = nullptr;
     napi_get_uv_event_loop(env_, &loop);
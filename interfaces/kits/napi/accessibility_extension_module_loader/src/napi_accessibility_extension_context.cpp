@@ -1020,7 +1020,8 @@ private:
     napi_value OnGestureInjectSync(napi_env env, NapiCallbackInfo& info)
     {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityExtensionContext.OnGestureInjectSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityExtensionContext.OnGestureInjectSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
         HILOG_INFO();
         NAccessibilityErrorCode errCode = NAccessibilityErrorCode::ACCESSIBILITY_OK;
@@ -1096,7 +1097,8 @@ private:
         napi_env env, NapiCallbackInfo& info, std::shared_ptr<AccessibilityGestureInjectPath> gesturePath)
     {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityExtensionContext.OnGestureInject");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityExtensionContext.OnGestureInject");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
         auto ret = std::make_shared<RetError>(RET_OK);
         NapiAsyncTask::ExecuteCallback execute = [weak = context_, gesturePath, ret] () {
@@ -1239,7 +1241,9 @@ private:
     napi_value GetElementsAsync(napi_env env, napi_value lastParam, int32_t windowId, int64_t elementId)
     {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-        Accessibility::ApiReportHelper reporter("NAccessibilityExtensionContext.GetElements", REPORTER_THRESHOLD_VALUE);
+        static const int32_t apiId =
+            Accessibility::ApiReportHelper::GetApiId("NAccessibilityExtensionContext.GetElements");
+        Accessibility::ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
         auto accessibilityElements = std::make_shared<std::vector<OHOS::Accessibility::AccessibilityElementInfo>>();
         auto ret = std::make_shared<RetError>(RET_OK);
@@ -1271,7 +1275,8 @@ private:
                 if (*ret == RET_OK) {
                     napi_value napiElementInfos = nullptr;
                     napi_create_array(env, &napiElementInfos);
-                    NAccessibilityElement::ConvertElementInfosToJS(env, napiElementInfos, *accessibilityElements);
+                    NAccessibilityElement::ConvertElementInfosToJS(env, napiElementInfos,
+                        std::move(*accessibilityElements));
                     task.Resolve(env, napiElementInfos);
                 } else {
                     HILOG_ERROR("Get GetElementsAsync failed.");
@@ -1781,6 +1786,7 @@ napi_value CreateJsAccessibilityExtensionContext(
     BindNativeFunction(env, object, "enableScreenCurtain", moduleName,
         NAccessibilityExtensionContext::EnableScreenCurtain);
     BindNativeFunction(env, object, "getElements", moduleName, NAccessibilityExtensionContext::GetElements);
+    BindNativeFunction(env, object, "attributeValues", moduleName, NAccessibilityElement::AttributeValues);
     BindNativeFunction(env, object, "getDefaultFocusedElementIds", moduleName,
         NAccessibilityExtensionContext::GetDefaultFocusedElementIds);
     BindNativeFunction(env, object, "holdRunningLockSync", moduleName,
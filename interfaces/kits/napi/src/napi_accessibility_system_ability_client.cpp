@@ -98,7 +98,8 @@ napi_value NAccessibilityClient::IsScreenReaderOpenSync(napi_env env, napi_callb
 napi_value NAccessibilityClient::IsOpenAccessibilitySync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.IsOpenAccessibilitySync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.IsOpenAccessibilitySync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -123,7 +124,8 @@ napi_value NAccessibilityClient::IsOpenAccessibilitySync(napi_env env, napi_call
 napi_value NAccessibilityClient::IsOpenAccessibility(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.IsOpenAccessibility");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.IsOpenAccessibility");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -171,7 +173,8 @@ napi_value NAccessibilityClient::IsOpenAccessibility(napi_env env, napi_callback
 napi_value NAccessibilityClient::IsOpenTouchExplorationSync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.IsOpenTouchExplorationSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.IsOpenTouchExplorationSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -196,7 +199,8 @@ napi_value NAccessibilityClient::IsOpenTouchExplorationSync(napi_env env, napi_c
 napi_value NAccessibilityClient::IsOpenTouchExploration(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.IsOpenTouchExploration");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.IsOpenTouchExploration");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     NAccessibilitySystemAbilityClient* callbackInfo = new(std::nothrow) NAccessibilitySystemAbilityClient();
@@ -360,7 +364,8 @@ void NAccessibilityClient::GetAbilityListComplete(napi_env env, napi_status stat
 napi_value NAccessibilityClient::GetAbilityList(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAbilityList");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAbilityList");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     NAccessibilitySystemAbilityClient* callbackInfo = new(std::nothrow) NAccessibilitySystemAbilityClient();
     if (callbackInfo == nullptr) {
@@ -406,7 +411,8 @@ napi_value NAccessibilityClient::GetAbilityList(napi_env env, napi_callback_info
 napi_value NAccessibilityClient::GetAccessibilityExtensionList(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAccessibilityExtensionList");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAccessibilityExtensionList");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     NAccessibilitySystemAbilityClient* callbackInfo = new(std::nothrow) NAccessibilitySystemAbilityClient();
     if (callbackInfo == nullptr) {
@@ -494,7 +500,8 @@ napi_value NAccessibilityClient::GetAccessibilityExtensionListAsync(
 napi_value NAccessibilityClient::GetAccessibilityExtensionListSync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAccessibilityExtensionListSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAccessibilityExtensionListSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_THREE;
     napi_value parameters[ARGS_SIZE_THREE] = {0};
@@ -594,7 +601,8 @@ void NAccessibilityClient::SendEventComplete(napi_env env, napi_status status, v
 napi_value NAccessibilityClient::SendEvent(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SendEvent", REPORTER_THRESHOLD_VALUE);
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SendEvent");
+    ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     NAccessibilitySystemAbilityClient* callbackInfo = new(std::nothrow) NAccessibilitySystemAbilityClient();
@@ -634,7 +642,8 @@ napi_value NAccessibilityClient::SendEvent(napi_env env, napi_callback_info info
 napi_value NAccessibilityClient::SendAccessibilityEvent(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SendAccessibilityEvent", REPORTER_THRESHOLD_VALUE);
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SendAccessibilityEvent");
+    ApiReportHelper reporter(apiId, REPORTER_THRESHOLD_VALUE);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     NAccessibilitySystemAbilityClient* callbackInfo = new(std::nothrow) NAccessibilitySystemAbilityClient();
@@ -698,7 +707,8 @@ napi_value NAccessibilityClient::SubscribeState(napi_env env, napi_callback_info
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_TWO;
     napi_value args[ARGS_SIZE_TWO] = {0};
@@ -794,7 +804,8 @@ napi_value NAccessibilityClient::UnsubscribeState(napi_env env, napi_callback_in
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_TWO;
     napi_value args[ARGS_SIZE_TWO] = {0};
@@ -986,7 +997,8 @@ napi_value NAccessibilityClient::GetCaptionsManager(napi_env env, napi_callback_
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetCaptionsManager");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetCaptionsManager");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     napi_value result = 0;
     napi_value aaCons = nullptr;
@@ -999,7 +1011,8 @@ napi_value NAccessibilityClient::SubscribeStateAudioMonoState(napi_env env, napi
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeStateAudioMonoState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeStateAudioMonoState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1025,7 +1038,8 @@ napi_value NAccessibilityClient::UnsubscribeStateAudioMonoState(napi_env env, na
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeStateAudioMonoState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeStateAudioMonoState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1047,7 +1061,8 @@ napi_value NAccessibilityClient::UnsubscribeStateAudioMonoState(napi_env env, na
 napi_value NAccessibilityClient::GetAudioMonoState(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAudioMonoState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAudioMonoState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1090,7 +1105,8 @@ napi_value NAccessibilityClient::GetAudioMonoState(napi_env env, napi_callback_i
 napi_value NAccessibilityClient::GetAudioMonoStateSync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAudioMonoStateSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAudioMonoStateSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1116,7 +1132,8 @@ napi_value NAccessibilityClient::SubscribeStateAnimationReduce(napi_env env, nap
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeStateAnimationReduce");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeStateAnimationReduce");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1142,7 +1159,8 @@ napi_value NAccessibilityClient::UnsubscribeStateAnimationReduce(napi_env env, n
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeStateAnimationReduce");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeStateAnimationReduce");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1164,7 +1182,8 @@ napi_value NAccessibilityClient::UnsubscribeStateAnimationReduce(napi_env env, n
 napi_value NAccessibilityClient::GetAnimationOffState(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAnimationOffState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAnimationOffState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1207,7 +1226,8 @@ napi_value NAccessibilityClient::GetAnimationOffState(napi_env env, napi_callbac
 napi_value NAccessibilityClient::GetAnimationOffStateSync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetAnimationOffStateSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetAnimationOffStateSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1233,7 +1253,8 @@ napi_value NAccessibilityClient::SubscribeStateFlashReminder(napi_env env, napi_
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeStateFlashReminder");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeStateFlashReminder");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1259,7 +1280,8 @@ napi_value NAccessibilityClient::UnsubscribeStateFlashReminder(napi_env env, nap
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeStateFlashReminder");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeStateFlashReminder");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1281,7 +1303,8 @@ napi_value NAccessibilityClient::UnsubscribeStateFlashReminder(napi_env env, nap
 napi_value NAccessibilityClient::GetFlashReminderSwitch(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetFlashReminderSwitch");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetFlashReminderSwitch");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1324,7 +1347,8 @@ napi_value NAccessibilityClient::GetFlashReminderSwitch(napi_env env, napi_callb
 napi_value NAccessibilityClient::GetFlashReminderSwitchSync(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetFlashReminderSwitchSync");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetFlashReminderSwitchSync");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -1849,7 +1873,8 @@ napi_value NAccessibilityClient::SubscribeStateSeniorMode(napi_env env, napi_cal
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeStateSeniorMode");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeStateSeniorMode");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1875,7 +1900,8 @@ napi_value NAccessibilityClient::UnsubscribeStateSeniorMode(napi_env env, napi_c
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeStateSeniorMode");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeStateSeniorMode");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -1897,7 +1923,8 @@ napi_value NAccessibilityClient::UnsubscribeStateSeniorMode(napi_env env, napi_c
 napi_value NAccessibilityClient::GetSeniorModeState(napi_env env, napi_callback_info info)
 {
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetSeniorModeState");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetSeniorModeState");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     HILOG_INFO();
     size_t argc = ARGS_SIZE_ONE;
@@ -2059,7 +2086,8 @@ napi_value NAccessibilityClient::SubscribeSelfSeniorMode(napi_env env, napi_call
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.SubscribeSelfSeniorMode");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.SubscribeSelfSeniorMode");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -2085,7 +2113,8 @@ napi_value NAccessibilityClient::UnsubscribeSelfSeniorMode(napi_env env, napi_ca
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.UnsubscribeSelfSeniorMode");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.UnsubscribeSelfSeniorMode");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value args[ARGS_SIZE_ONE] = {0};
@@ -2108,7 +2137,8 @@ napi_value NAccessibilityClient::GetSeniorModeStateForApp(napi_env env, napi_cal
 {
     HILOG_INFO();
 #ifdef ACCESSIBILITY_EMULATOR_DEFINED
-    ApiReportHelper reporter("NAccessibilityClient.GetSeniorModeStateForApp");
+    static const int32_t apiId = ApiReportHelper::GetApiId("NAccessibilityClient.GetSeniorModeStateForApp");
+    ApiReportHelper reporter(apiId);
 #endif // ACCESSIBILITY_EMULATOR_DEFINED
     size_t argc = ARGS_SIZE_ONE;
     napi_value argv = nullptr;
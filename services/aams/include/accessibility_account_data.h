@@ -21,6 +21,8 @@
 #include <vector>
 
 #include "accessibility_caption.h"
+#include "accessibility_cow_table.h"
+#include "accessibility_installed_ability_index.h"
 #include "iaccessibility_enable_ability_lists_observer.h"
 #include "iaccessibility_enable_ability_callback_observer.h"
 #include "accessibility_settings_config.h"
@@ -270,6 +272,15 @@ public:
         return isGesturesSimulation_;
     }
     bool GetInstalledAbilitiesFromBMS();
+    /**
+     * @brief Compare the installed abilities read from the index file with the bundle manager once.
+     * @param changes set to the bundles which changed while the index was not updated.
+     * @return false if the abilities were not read from the file or the query failed.
+     */
+    bool RevalidateInstalledAbilities(std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> &changes);
+    void RemoveInstalledAbilityIndex();
+    // delete the index file of a user whose account data is not loaded
+    static void RemoveInstalledAbilityIndexFile(int32_t accountId);
     inline bool GetForeGroundOsAccountFlag() {
         return isForegroundOsAccount_;
     }
@@ -412,6 +423,7 @@ private:
     ffrt::mutex configCallbacksMutex_; // mutex for vector configCallbacks_
     std::shared_ptr<AccessibilitySettingsConfig> config_ = nullptr;
     AccessibleAbilityManager accessibleAbilityManager_;
+    std::shared_ptr<AccessibilityInstalledAbilityIndex> installedAbilityIndex_ = nullptr;
     ElementOperatorManager elementOperatorManager_;
     AccessibilityWindowManager windowManager_;
     StateObservers stateObservers_;
@@ -421,6 +433,10 @@ private:
     ffrt::mutex seniorModeStateObserversMutex_;
 };
 
+/**
+ * Every IPC entry point looks up the account of its caller here, the lookups never take a lock and only
+ * adding or removing an account copies the table.
+ */
 class AccessibilityAccountDataMap {
 public:
     AccessibilityAccountDataMap() = default;
@@ -432,8 +448,7 @@ public:
     std::vector<int32_t> GetAllAccountIds();
     void Clear();
 private:
-    std::map<int32_t, sptr<AccessibilityAccountData>> accountDataMap_;
-    ffrt::mutex accountDataMutex_;
+    AccessibilityCowTable<int32_t, sptr<AccessibilityAccountData>> accountDataTable_;
 };
 
 class AccountSubscriber final : public AccountSA::OsAccountSubscriber {
@@ -40,23 +40,49 @@ public:
 
     void UpdatePointerVisible(bool state);
     void CreatePointerWindow(int32_t physicalX, int32_t physicalY, uint64_t screenId);
-    void DrawPointer(int32_t physicalX, int32_t physicalY, int32_t angle, uint64_t screenId, int32_t startAngle);
+
+    /**
+     * @brief Show the circle of a press with an empty arc, in one transaction.
+     */
+    void BeginProgress(int32_t physicalX, int32_t physicalY, uint64_t screenId, int32_t startAngle);
+
+    /**
+     * @brief Move the circle and sweep the arc, in one transaction and only for what changed.
+     */
+    void UpdateProgress(int32_t physicalX, int32_t physicalY, int32_t angle);
+
+    /**
+     * @brief Hide the circle and log the transactions the press took.
+     */
+    void EndProgress();
+
     void SetPointerLocation(int32_t physicalX, int32_t physicalY, uint64_t screenId);
-    void DrawingProgress(int32_t physicalX, int32_t physicalY, int32_t angle);
+    void DrawingProgress(int32_t angle);
+
+    uint64_t GetTransactionCount() const
+    {
+        return transactionCount_;
+    }
 
     int32_t ParseStringToInteger(const std::string& color);
     std::vector<int32_t> ParseColorString(const std::string& color);
 
 #ifndef USE_ROSEN_DRAWING
-    void DrawingProgressByOpenSource(int32_t physicalX, int32_t physicalY, int32_t angle);
+    void DrawingBackgroundByOpenSource();
+    void DrawingProgressByOpenSource(int32_t angle);
 #else
-    void DrawingProgressByRosenDrawing(int32_t physicalX, int32_t physicalY, int32_t angle);
+    void DrawingBackgroundByRosenDrawing();
+    void DrawingProgressByRosenDrawing(int32_t angle);
 #endif
 private:
+    void DrawingBackground();
     void FlushImplicitTransaction();
 private:
     std::shared_ptr<Rosen::RSSurfaceNode> surfaceNode_;
+    // the circles which do not change, recorded once when the window is created
     std::shared_ptr<Rosen::RSCanvasNode> canvasNode_;
+    // the arc, the only node recorded again while a press goes on
+    std::shared_ptr<Rosen::RSCanvasNode> progressNode_;
     std::shared_ptr<Rosen::RSUIDirector> rsUiDirector_;
     uint64_t screenId_;
     int32_t imageWidth_;
@@ -64,6 +90,12 @@ private:
     int32_t half_;
     int32_t startAngle_ = 0;
     float dispalyDensity_;
+    int32_t locationX_ = 0;
+    int32_t locationY_ = 0;
+    int32_t progressAngle_ = -1;
+    bool visible_ = false;
+    uint64_t transactionCount_ = 0;
+    uint64_t pressTransactionCount_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
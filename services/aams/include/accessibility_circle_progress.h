@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_CIRCLE_PROGRESS_H
+#define ACCESSIBILITY_CIRCLE_PROGRESS_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * The mapping from display coordinates to the physical coordinates of the click response circle,
+ * worked out once when a press starts so the moves of the press only do the arithmetic.
+ */
+class CircleProgressTransform {
+public:
+    CircleProgressTransform() = default;
+
+    /**
+     * @brief The mapping of a screen which does not rotate, or of a rotation the display reports.
+     * @param quarterTurns the clockwise quarter turns of the display, 0 for portrait.
+     * @param displayWidth the width of the display.
+     * @param displayHeight the height of the display.
+     * @return the mapping, invalid for an unknown rotation.
+     */
+    static CircleProgressTransform Create(int32_t quarterTurns, int32_t displayWidth, int32_t displayHeight);
+
+    /**
+     * @brief Map a display position to the circle center.
+     * @return false if the mapping is invalid, the outputs are left as they are then.
+     */
+    bool Apply(int32_t displayX, int32_t displayY, int32_t &physicalX, int32_t &physicalY) const;
+
+    bool IsValid() const
+    {
+        return valid_;
+    }
+
+    int32_t GetStartAngle() const
+    {
+        return startAngle_;
+    }
+
+private:
+    bool valid_ = false;
+    bool swapAxes_ = false;
+    int32_t signX_ = 1;
+    int32_t signY_ = 1;
+    int32_t offsetX_ = 0;
+    int32_t offsetY_ = 0;
+    int32_t startAngle_ = 0;
+};
+
+/**
+ * @brief The sweep of the progress arc after a time, so a late frame catches up instead of lagging.
+ * @param elapsedMs the time since the press.
+ * @param durationMs the click response time.
+ * @return the sweep in degrees, from 0 to 360.
+ */
+int32_t GetCircleProgressAngle(int64_t elapsedMs, uint32_t durationMs);
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_CIRCLE_PROGRESS_H
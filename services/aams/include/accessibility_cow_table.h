@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_COW_TABLE_H
+#define ACCESSIBILITY_COW_TABLE_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * A small table which is read far more often than it is written. Every write copies the table and
+ * publishes the copy through an atomic pointer, so a lookup never takes a lock. A reader announces the
+ * table it reads in its thread's hazard slot and a replaced table is only freed once no slot holds it.
+ * Writers are serialized by a mutex. Lookups must not read the same kind of table while they hold the
+ * slot, which only the key compare and the value copy run under.
+ */
+template <typename Key, typename Value>
+class AccessibilityCowTable {
+public:
+    AccessibilityCowTable() = default;
+    ~AccessibilityCowTable()
+    {
+        // no reader is left once the owner goes away
+        delete table_.load();
+        for (const Table *table : retired_) {
+            delete table;
+        }
+    }
+    AccessibilityCowTable(const AccessibilityCowTable &) = delete;
+    AccessibilityCowTable &operator=(const AccessibilityCowTable &) = delete;
+
+    bool Find(const Key &key, Value &value) const
+    {
+        std::optional<Value> found;
+        HazardRecord *record = GetHazardRecord();
+        const Table *table = Protect(*record);
+        if (table != nullptr) {
+            auto iter = LowerBound(*table, key);
+            if (iter != table->end() && iter->first == key) {
+                found.emplace(iter->second);
+            }
+        }
+        record->hazard.store(nullptr, std::memory_order_release);
+        if (!found) {
+            return false;
+        }
+        value = std::move(*found);
+        return true;
+    }
+
+    std::vector<Key> GetKeys() const
+    {
+        std::vector<Key> keys;
+        HazardRecord *record = GetHazardRecord();
+        const Table *table = Protect(*record);
+        if (table != nullptr) {
+            keys.reserve(table->size());
+            for (const auto &entry : *table) {
+                keys.push_back(entry.first);
+            }
+        }
+        record->hazard.store(nullptr, std::memory_order_release);
+        return keys;
+    }
+
+    /**
+     * @brief Find the value of the key, or insert the one made by the factory under the writer lock.
+     * @param factory makes the value, a value equal to Value() is not inserted.
+     * @param inserted set to true if the value is made by the factory.
+     */
+    template <typename Factory>
+    Value FindOrInsert(const Key &key, Factory &&factory, bool &inserted)
+    {
+        inserted = false;
+        std::lock_guard<ffrt::mutex> lock(writeMutex_);
+        const Table *current = table_.load();
+        if (current != nullptr) {
+            auto iter = LowerBound(*current, key);
+            if (iter != current->end() && iter->first == key) {
+                return iter->second;
+            }
+        }
+
+        Value value = factory();
+        if (value == Value()) {
+            return value;
+        }
+        auto table = current == nullptr ? std::make_unique<Table>() : std::make_unique<Table>(*current);
+        table->insert(LowerBound(*table, key), std::make_pair(key, value));
+        PublishLocked(table.release());
+        inserted = true;
+        return value;
+    }
+
+    bool Erase(const Key &key, Value &value)
+    {
+        std::lock_guard<ffrt::mutex> lock(writeMutex_);
+        const Table *current = table_.load();
+        if (current == nullptr) {
+            return false;
+        }
+        auto found = LowerBound(*current, key);
+        if (found == current->end() || found->first != key) {
+            return false;
+        }
+        value = found->second;
+        auto table = std::make_unique<Table>(*current);
+        table->erase(table->begin() + (found - current->begin()));
+        PublishLocked(table.release());
+        return true;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<ffrt::mutex> lock(writeMutex_);
+        if (table_.load() != nullptr) {
+            PublishLocked(nullptr);
+        }
+    }
+
+private:
+    using Table = std::vector<std::pair<Key, Value>>;
+
+    struct HazardRecord {
+        std::atomic<const Table *> hazard {nullptr};
+        std::atomic<bool> owned {false};
+        HazardRecord *next = nullptr;
+    };
+
+    // holds the hazard record of a thread and gives it back when the thread exits
+    struct HazardRecordOwner {
+        HazardRecordOwner() : record(AcquireHazardRecord()) {}
+        ~HazardRecordOwner()
+        {
+            record->hazard.store(nullptr, std::memory_order_release);
+            record->owned.store(false, std::memory_order_release);
+        }
+        HazardRecord *record = nullptr;
+    };
+
+    static typename Table::const_iterator LowerBound(const Table &table, const Key &key)
+    {
+        return std::lower_bound(table.begin(), table.end(), key,
+            [](const std::pair<Key, Value> &entry, const Key &target) { return entry.first < target; });
+    }
+
+    static typename Table::iterator LowerBound(Table &table, const Key &key)
+    {
+        return std::lower_bound(table.begin(), table.end(), key,
+            [](const std::pair<Key, Value> &entry, const Key &target) { return entry.first < target; });
+    }
+
+    static HazardRecord *GetHazardRecord()
+    {
+        thread_local HazardRecordOwner owner;
+        return owner.record;
+    }
+
+    static HazardRecord *AcquireHazardRecord()
+    {
+        for (HazardRecord *record = hazardRecords_.load(std::memory_order_acquire); record != nullptr;
+            record = record->next) {
+            bool owned = false;
+            if (record->owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+        // records are never freed, there are as many as threads ever read at the same time
+        HazardRecord *record = new HazardRecord();
+        record->owned.store(true, std::memory_order_relaxed);
+        HazardRecord *head = hazardRecords_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!hazardRecords_.compare_exchange_weak(head, record, std::memory_order_release,
+            std::memory_order_relaxed));
+        return record;
+    }
+
+    const Table *Protect(HazardRecord &record) const
+    {
+        const Table *table = table_.load();
+        while (true) {
+            record.hazard.store(table);
+            // the table is safe once it is still published after the slot is set
+            const Table *current = table_.load();
+            if (current == table) {
+                return table;
+            }
+            table = current;
+        }
+    }
+
+    void PublishLocked(const Table *table)
+    {
+        const Table *old = table_.exchange(table);
+        if (old != nullptr) {
+            retired_.push_back(old);
+        }
+
+        std::vector<const Table *> hazards;
+        for (HazardRecord *record = hazardRecords_.load(std::memory_order_acquire); record != nullptr;
+            record = record->next) {
+            const Table *hazard = record->hazard.load();
+            if (hazard != nullptr) {
+                hazards.push_back(hazard);
+            }
+        }
+        auto keep = std::partition(retired_.begin(), retired_.end(), [&hazards](const Table *retired) {
+            return std::find(hazards.begin(), hazards.end(), retired) != hazards.end();
+        });
+        for (auto iter = keep; iter != retired_.end(); iter++) {
+            delete *iter;
+        }
+        retired_.erase(keep, retired_.end());
+    }
+
+    static inline std::atomic<HazardRecord *> hazardRecords_ {nullptr};
+
+    std::atomic<const Table *> table_ {nullptr};
+    // replaced tables still read by some thread, freed by a later write
+    std::vector<const Table *> retired_;
+    ffrt::mutex writeMutex_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_COW_TABLE_H
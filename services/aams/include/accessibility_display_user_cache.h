@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_DISPLAY_USER_CACHE_H
+#define ACCESSIBILITY_DISPLAY_USER_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct DisplayUserCacheStatistics {
+    // lookups answered from the cache, each one is an account service call avoided
+    uint64_t hitCount = 0;
+    // lookups resolved by the account service
+    uint64_t missCount = 0;
+    uint64_t checkCount = 0;
+    // consistency checks which found the cached user out of date
+    uint64_t mismatchCount = 0;
+};
+
+/**
+ * The foreground user of every display, filled on the first lookup of a display and kept up to date
+ * by the account events. Lookups are lock free: every slot packs the display id and the user id in
+ * one atomic word. Once every CHECK_INTERVAL_MS a lookup resolves the user again to catch a missed
+ * account event.
+ */
+class AccessibilityDisplayUserCache {
+public:
+    // resolve the foreground user of the display from the account service
+    using Resolver = std::function<bool(uint64_t displayId, int32_t &userId)>;
+    // the current time in milliseconds
+    using Clock = std::function<int64_t()>;
+
+    static constexpr uint32_t CAPACITY = 8;
+    static constexpr int64_t CHECK_INTERVAL_MS = 5000;
+
+    AccessibilityDisplayUserCache(Resolver resolver, Clock clock);
+    ~AccessibilityDisplayUserCache() = default;
+
+    /**
+     * @brief Get the foreground user of the display.
+     * @param displayId the display.
+     * @param userId set to the user.
+     * @return false if neither the cache nor the account service knows the user.
+     */
+    bool GetUserId(uint64_t displayId, int32_t &userId);
+
+    /**
+     * @brief Check if the user is cached as the foreground user of a display.
+     */
+    bool IsForegroundUser(int32_t userId);
+
+    void SetUserId(uint64_t displayId, int32_t userId);
+    void RemoveUser(int32_t userId);
+    void Invalidate();
+
+    DisplayUserCacheStatistics GetStatistics() const;
+    void ResetStatistics();
+    void Dump(std::string &dumpInfo) const;
+
+private:
+    static constexpr uint64_t EMPTY_ENTRY = UINT64_MAX;
+    static constexpr uint32_t ID_BITS = 32;
+
+    static bool IsCacheable(uint64_t displayId, int32_t userId);
+    static uint64_t MakeEntry(uint64_t displayId, int32_t userId);
+    bool FindUser(uint64_t displayId, int32_t &userId) const;
+    bool IsCheckDue();
+    void StoreLocked(uint64_t displayId, int32_t userId);
+
+    Resolver resolver_;
+    Clock clock_;
+    std::array<std::atomic<uint64_t>, CAPACITY> entries_;
+    // changed by every account event, a lookup only caches what it resolved if no event came meanwhile
+    std::atomic<uint64_t> generation_ {0};
+    std::atomic<int64_t> lastCheckTime_ {0};
+    ffrt::mutex mutex_;
+
+    std::atomic<uint64_t> hitCount_ {0};
+    std::atomic<uint64_t> missCount_ {0};
+    std::atomic<uint64_t> checkCount_ {0};
+    std::atomic<uint64_t> mismatchCount_ {0};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_DISPLAY_USER_CACHE_H
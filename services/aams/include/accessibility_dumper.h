@@ -25,6 +25,12 @@ enum DumpType : uint32_t {
     DUMP_USER = 0,
     DUMP_CLIENT,
     DUMP_ACCESSIBILITY_WINDOW,
+    DUMP_INPUT_STATISTICS,
+    RESET_INPUT_STATISTICS,
+    START_INPUT_RECORD,
+    STOP_INPUT_RECORD,
+    DUMP_RUNTIME_COUNTERS,
+    DUMP_DISPLAY_USER_CACHE,
     DUMP_NONE = 100,
 };
 class AccessibilityDumper : public RefBase {
@@ -37,6 +43,12 @@ private:
     int DumpAccessibilityClientInfo(std::string& dumpInfo) const;
     int DumpAccessibilityWindowInfo(std::string& dumpInfo) const;
     int DumpAccessibilityUserInfo(std::string& dumpInfo) const;
+    int DumpInputStatistics(std::string& dumpInfo) const;
+    int ResetInputStatistics(std::string& dumpInfo) const;
+    int StartInputRecord(std::string& dumpInfo) const;
+    int StopInputRecord(std::string& dumpInfo) const;
+    int DumpRuntimeCounters(const std::vector<std::string>& args, std::string& dumpInfo) const;
+    int DumpDisplayUserCache(std::string& dumpInfo) const;
     void ShowHelpInfo(std::string& dumpInfo) const;
     void ShowIllegalArgsInfo(std::string& dumpInfo) const;
 };
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_DWELL_DETECTOR_H
+#define ACCESSIBILITY_DWELL_DETECTOR_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "accessibility_gesture_timer_wheel.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct DwellStatistics {
+    uint64_t moveCount = 0;
+    // moves inside the tolerance of the dwell position, they do not restart the dwell
+    uint64_t toleratedCount = 0;
+    uint64_t armCount = 0;
+    // timer expiries before the deadline, which was pushed back by later moves
+    uint64_t rearmCount = 0;
+    uint64_t dwellCount = 0;
+};
+
+/**
+ * Detects the pointer resting for a delay. A move only records the position and pushes the deadline
+ * back, the one timer of the detector is armed when a dwell starts and compares the deadline when it
+ * fires, re-arming itself for the rest if the pointer moved meanwhile. Moves within the tolerance
+ * radius of the position the dwell started at do not restart it.
+ */
+class AccessibilityDwellDetector {
+public:
+    using DwellCallback = std::function<void(int32_t posX, int32_t posY)>;
+
+    AccessibilityDwellDetector(const std::shared_ptr<GestureTimerWheel> &wheel, DwellCallback callback);
+    ~AccessibilityDwellDetector();
+
+    /**
+     * @brief Record a pointer move.
+     * @param posX the display x of the pointer.
+     * @param posY the display y of the pointer.
+     * @param delayMs the time the pointer has to rest.
+     */
+    void OnMove(int32_t posX, int32_t posY, int64_t delayMs);
+
+    /**
+     * @brief Drop the pending dwell, the timer is left to expire on its own.
+     */
+    void Cancel();
+
+    /**
+     * @brief Set the radius in px moves may stay within without restarting the dwell, 0 by default.
+     */
+    void SetTolerance(int32_t radius);
+    bool IsPending();
+    DwellStatistics GetStatistics();
+    void ResetStatistics();
+
+private:
+    void OnTimer();
+
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    DwellCallback callback_;
+    GestureTimerWheel::Timer timer_;
+
+    ffrt::mutex mutex_;
+    bool pending_ = false;
+    bool timerArmed_ = false;
+    int32_t tolerance_ = 0;
+    int32_t anchorX_ = 0;
+    int32_t anchorY_ = 0;
+    int64_t deadline_ = 0;
+    DwellStatistics statistics_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_DWELL_DETECTOR_H
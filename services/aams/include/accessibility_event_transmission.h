@@ -24,10 +24,33 @@
 
 namespace OHOS {
 namespace Accessibility {
+enum class TransmissionType : uint32_t {
+    TRANSMISSION_UNKNOWN = 0,
+    TRANSMISSION_MOUSE_KEY,
+    TRANSMISSION_MOUSE_AUTOCLICK,
+    TRANSMISSION_TOUCH_EVENT_INJECTOR,
+    TRANSMISSION_ZOOM_GESTURE,
+    TRANSMISSION_WINDOW_MAGNIFICATION_GESTURE,
+    TRANSMISSION_TOUCH_EXPLORATION,
+    TRANSMISSION_SCREEN_TOUCH,
+    TRANSMISSION_KEY_EVENT_FILTER,
+    TRANSMISSION_INPUT_INTERCEPTOR,
+    TRANSMISSION_TYPE_MAX,
+};
+
 class EventTransmission : public RefBase {
 public:
     EventTransmission() {};
     virtual ~EventTransmission() {};
+
+    /**
+     * @brief Get the type of this node in the event transmission chain, used to tag statistics.
+     * @return the transmission type of this node.
+     */
+    virtual TransmissionType GetTransmissionType() const
+    {
+        return TransmissionType::TRANSMISSION_UNKNOWN;
+    }
     virtual bool OnKeyEvent(MMI::KeyEvent &event);
     virtual bool OnPointerEvent(MMI::PointerEvent &event);
     virtual void OnMoveMouse(int32_t offsetX, int32_t offsetY);
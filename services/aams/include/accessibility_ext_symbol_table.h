@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_EXT_SYMBOL_TABLE_H
+#define ACCESSIBILITY_EXT_SYMBOL_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * The entry points of a loaded library, one slot each, resolved the first time they are used. Lookups of a
+ * resolved entry point are a single atomic load, so they may run side by side under a shared lock. Two
+ * callers racing on the same slot resolve the same symbol and only one of them counts it. The owner resets
+ * the table under its exclusive lock when the library is unloaded.
+ */
+template <size_t SLOT_COUNT>
+class AccessibilityExtSymbolTable {
+public:
+    AccessibilityExtSymbolTable()
+    {
+        Reset();
+    }
+    AccessibilityExtSymbolTable(const AccessibilityExtSymbolTable &) = delete;
+    AccessibilityExtSymbolTable &operator=(const AccessibilityExtSymbolTable &) = delete;
+
+    /**
+     * @brief Get the entry point of a slot.
+     * @param slot the slot of the entry point.
+     * @param name the symbol of the entry point.
+     * @param resolve called with the symbol when the slot is empty, returns nullptr if it is missing.
+     * @return the entry point, nullptr if the slot is out of range or the symbol is missing.
+     */
+    template <typename Resolve>
+    void *Get(size_t slot, const char *name, Resolve &&resolve)
+    {
+        if (slot >= SLOT_COUNT) {
+            return nullptr;
+        }
+        void *symbol = slots_[slot].load(std::memory_order_acquire);
+        if (symbol != nullptr) {
+            return symbol;
+        }
+        symbol = resolve(name);
+        if (symbol == nullptr) {
+            return nullptr;
+        }
+        void *expected = nullptr;
+        if (slots_[slot].compare_exchange_strong(expected, symbol, std::memory_order_acq_rel)) {
+            resolvedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return symbol;
+    }
+
+    void Reset()
+    {
+        for (auto &slot : slots_) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+        resolvedCount_.store(0, std::memory_order_relaxed);
+    }
+
+    size_t GetResolvedCount() const
+    {
+        return resolvedCount_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<std::atomic<void *>, SLOT_COUNT> slots_;
+    std::atomic<size_t> resolvedCount_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_EXT_SYMBOL_TABLE_H
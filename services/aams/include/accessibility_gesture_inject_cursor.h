@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_GESTURE_INJECT_CURSOR_H
+#define ACCESSIBILITY_GESTURE_INJECT_CURSOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "accessibility_gesture_inject_path.h"
+
+namespace OHOS {
+namespace Accessibility {
+const int64_t DOUBLE_TAP_MIN_TIME = 50000; // microsecond
+
+struct GestureInjectPoint {
+    int32_t action = 0; // MMI::PointerEvent::POINTER_ACTION_*
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+    int64_t downTime = 0; // microsecond
+    int64_t actionTime = 0; // microsecond
+};
+
+/**
+ * A cursor over the touch events of a gesture path, each event computed from the path when it is asked
+ * for, so the cursor takes the same memory whatever the path length. A path of one position, or whose
+ * first two positions are the same, is a series of taps, each a down and an up. Any other path is one
+ * stroke, a down on the first position, a move on each of the others and an up on the last.
+ */
+class AccessibilityGestureInjectCursor {
+public:
+    /**
+     * @param gesturePath the path, shared with the caller and not copied.
+     * @param startTime the time of the first down event, in microsecond.
+     */
+    AccessibilityGestureInjectCursor(const std::shared_ptr<AccessibilityGestureInjectPath> &gesturePath,
+        int64_t startTime);
+    ~AccessibilityGestureInjectCursor() = default;
+
+    /**
+     * @brief Get the next event of the path.
+     * @param point set to the next event.
+     * @return false if there is no more event.
+     */
+    bool Next(GestureInjectPoint &point);
+
+    bool HasNext() const
+    {
+        return index_ < eventCount_;
+    }
+
+    // the count of events of the whole path, 0 if the path can not be injected
+    size_t GetEventCount() const
+    {
+        return eventCount_;
+    }
+
+private:
+    void NextTapEvent(const AccessibilityGesturePosition &position, GestureInjectPoint &point) const;
+    void NextMoveEvent(const AccessibilityGesturePosition &position, GestureInjectPoint &point) const;
+
+    std::shared_ptr<AccessibilityGestureInjectPath> gesturePath_ = nullptr;
+    int64_t startTime_ = 0;
+    int64_t perDurationTime_ = 0; // microsecond
+    bool isTap_ = false;
+    size_t eventCount_ = 0;
+    size_t index_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_GESTURE_INJECT_CURSOR_H
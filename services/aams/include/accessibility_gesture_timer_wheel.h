@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_GESTURE_TIMER_WHEEL_H
+#define ACCESSIBILITY_GESTURE_TIMER_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "event_handler.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * Hierarchical timer wheel shared by the gesture recognizers of the input pipeline. Arming and
+ * cancelling a timer are O(1) list operations, and the wheel posts at most one wake-up task to its
+ * runner for the earliest deadline instead of one task per timeout. A wheel created with a clock
+ * has no runner and only fires when ProcessExpiredTimers is called, which gives tests virtual time.
+ */
+class GestureTimerWheel : public std::enable_shared_from_this<GestureTimerWheel> {
+public:
+    using Clock = std::function<int64_t()>;
+
+    // level 0 has 1ms slots, every higher level covers a whole turn of the level below in one slot.
+    static constexpr uint32_t LEVEL_COUNT = 3;
+    static constexpr uint32_t LEVEL0_BITS = 8;
+    static constexpr uint32_t LEVELN_BITS = 6;
+
+    class Timer {
+    public:
+        Timer() = default;
+        explicit Timer(std::function<void()> callback) : callback_(std::move(callback)) {}
+        ~Timer() = default;
+        Timer(const Timer &) = delete;
+        Timer &operator=(const Timer &) = delete;
+
+    private:
+        friend class GestureTimerWheel;
+        Timer *prev_ = nullptr;
+        Timer *next_ = nullptr;
+        int64_t expireTime_ = 0;
+        int32_t level_ = -1;
+        std::function<void()> callback_;
+    };
+
+    /**
+     * @brief Create a wheel which fires its timers on the runner, timed by the monotonic clock.
+     * @param runner the runner the timer callbacks are executed on.
+     * @param fireMutex if not null, held while a timer callback runs, it must outlive the wheel.
+     */
+    explicit GestureTimerWheel(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
+        ffrt::mutex *fireMutex = nullptr);
+
+    /**
+     * @brief Create a wheel driven by the caller, timed by the given clock in milliseconds.
+     * @param clock the clock of the wheel.
+     * @param fireMutex if not null, held while a timer callback runs, it must outlive the wheel.
+     */
+    explicit GestureTimerWheel(Clock clock, ffrt::mutex *fireMutex = nullptr);
+    ~GestureTimerWheel();
+
+    /**
+     * @brief Arm the timer to fire after the delay, re-arming it if it is already armed.
+     * @param timer the timer, which must stay alive until it fires or is cancelled.
+     * @param delayMs the delay in milliseconds.
+     */
+    void Arm(Timer &timer, int64_t delayMs);
+    void Cancel(Timer &timer);
+    bool IsArmed(const Timer &timer);
+    size_t GetArmedCount();
+    int64_t GetCurrentTime() const;
+
+    /**
+     * @brief Fire all timers which are due at the current time of the clock.
+     */
+    void ProcessExpiredTimers();
+
+private:
+    static constexpr int32_t LEVEL_EXPIRED = static_cast<int32_t>(LEVEL_COUNT);
+    static constexpr uint32_t LEVEL0_SLOTS = 1u << LEVEL0_BITS;
+    static constexpr uint32_t LEVELN_SLOTS = 1u << LEVELN_BITS;
+    static constexpr int64_t NO_WAKE_UP = -1;
+
+    void InitListHeads();
+    void InsertLocked(Timer &timer);
+    void UnlinkLocked(Timer &timer);
+    void AdvanceLocked(int64_t now);
+    void CascadeLocked(uint32_t level, int64_t tick);
+    int64_t GetNextWakeUpLocked() const;
+    void ScheduleWakeUpLocked();
+    static void InitHead(Timer &head);
+    static bool IsEmpty(const Timer &head);
+    static void PushBack(Timer &head, Timer &timer);
+    static void Remove(Timer &timer);
+    static int64_t GetMonotonicTime();
+
+    Clock clock_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_ = nullptr;
+    // serializes the callbacks with the code which runs the same filters off the runner
+    ffrt::mutex *fireMutex_ = nullptr;
+    ffrt::mutex mutex_;
+    // every tick before currentTick_ has been processed
+    int64_t currentTick_ = 0;
+    int64_t scheduledWakeUp_ = NO_WAKE_UP;
+    size_t armedCount_ = 0;
+    std::array<size_t, LEVEL_COUNT> levelCount_ {};
+    std::array<Timer, LEVEL0_SLOTS> level0_ {};
+    std::array<std::array<Timer, LEVELN_SLOTS>, LEVEL_COUNT - 1> levelN_ {};
+    Timer expired_;
+};
+
+/**
+ * Drop-in replacement of the SendEvent/RemoveEvent/HasInnerEvent part of AppExecFwk::EventHandler
+ * for gesture timeouts. Each event id owns one timer on the shared wheel, so sending an event id
+ * which is still pending re-arms it instead of queueing a second event. The handler must be owned
+ * by a shared_ptr, a timer which expires after the handler is released is dropped.
+ */
+class GestureTimerHandler : public std::enable_shared_from_this<GestureTimerHandler> {
+public:
+    explicit GestureTimerHandler(const std::shared_ptr<GestureTimerWheel> &wheel);
+    virtual ~GestureTimerHandler();
+
+    bool SendEvent(uint32_t innerEventId, int64_t param = 0, int64_t delayTime = 0);
+    void RemoveEvent(uint32_t innerEventId);
+    bool HasInnerEvent(uint32_t innerEventId);
+    void RemoveAllEvents();
+
+    /**
+     * @brief Process the event whose timer expired, on the thread which drives the wheel.
+     * @param event Indicates the event to be processed.
+     */
+    virtual void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) = 0;
+
+private:
+    struct EventTimer {
+        explicit EventTimer(std::function<void()> callback) : timer(std::move(callback)) {}
+        GestureTimerWheel::Timer timer;
+        int64_t param = 0;
+    };
+
+    void OnTimerExpired(uint32_t innerEventId);
+
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    ffrt::mutex mutex_;
+    std::unordered_map<uint32_t, std::unique_ptr<EventTimer>> timers_ {};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_GESTURE_TIMER_WHEEL_H
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "accessibility_event_transmission.h"
+#include "accessibility_gesture_timer_wheel.h"
 #include "accessibility_mouse_key.h"
 #include "accessibility_zoom_gesture.h"
 #include "event_handler.h"
@@ -46,6 +47,8 @@ public:
     void OnInputEvent(std::shared_ptr<MMI::AxisEvent> axisEvent) const override {};
 private:
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
+    // true: process events on the MMI callback thread instead of posting them to eventHandler_
+    bool inlineDispatch_ = false;
 };
 
 class AccessibilityInputInterceptor : public EventTransmission {
@@ -81,8 +84,20 @@ public:
     void ProcessPointerEvent(std::shared_ptr<MMI::PointerEvent> event);
     bool OnKeyEvent(MMI::KeyEvent &event) override;
     bool OnPointerEvent(MMI::PointerEvent &event) override;
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_INPUT_INTERCEPTOR;
+    }
     void OnMoveMouse(int32_t offsetX, int32_t offsetY) override;
     void SetAvailableFunctions(uint32_t availableFunctions);
+    /**
+     * @brief Rebuild the filter chain at once on the calling thread, used to replay recorded input.
+     * @param availableFunctions the features of the new chain, 0 to only destroy the chain.
+     * @param wheel the wheel the filters of the new chain run their timeouts on.
+     * @return the wheel used before.
+     */
+    std::shared_ptr<GestureTimerWheel> RebuildTransmitters(uint32_t availableFunctions,
+        const std::shared_ptr<GestureTimerWheel> &wheel);
     RetError InjectEvents(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
 
     // flag = true shield zoom gesture | flag = false restore zoom gesture
@@ -110,6 +125,17 @@ public:
         return inputManagerRunner_;
     }
 
+    inline std::shared_ptr<GestureTimerWheel> &GetGestureTimerWheel()
+    {
+        return gestureTimerWheel_;
+    }
+
+    // held while the filter chain runs, a task of inputManagerRunner_ entering the chain must hold it too
+    inline ffrt::mutex &GetDispatchMutex()
+    {
+        return mutex_;
+    }
+
     inline bool IsZoomGestureEnabled()
     {
         return availableFunctions_ & FEATURE_SCREEN_MAGNIFICATION;
@@ -121,6 +147,7 @@ private:
     static ffrt::mutex instanceMutex_;
     void CreateTransmitters();
     void DestroyTransmitters();
+    void DestroyTransmittersLocked(); // should be used in mutex_
     void CreatePointerEventTransmitters();
     void CreateKeyEventTransmitters();
     void SetNextEventTransmitter(sptr<EventTransmission> &header, sptr<EventTransmission> &current,
@@ -141,6 +168,8 @@ private:
     std::shared_ptr<AccessibilityInputEventConsumer> inputEventConsumer_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
     std::shared_ptr<AppExecFwk::EventRunner> inputManagerRunner_;
+    // timeouts of all gesture recognizers, fired on inputManagerRunner_ holding mutex_
+    std::shared_ptr<GestureTimerWheel> gestureTimerWheel_ = nullptr;
     ffrt::mutex mutex_;
     ffrt::mutex eventHandlerMutex_;
 
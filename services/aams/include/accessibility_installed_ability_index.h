@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_INSTALLED_ABILITY_INDEX_H
+#define ACCESSIBILITY_INSTALLED_ABILITY_INDEX_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "accessibility_ability_info.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * The parsed accessibility extension abilities installed for one user, kept in a file so the startup and
+ * the user switch read them back instead of asking the bundle manager and parsing every profile again.
+ * The package events update the index one bundle at a time. A file written by another index version or
+ * under another system fingerprint is ignored and rebuilt from a full query. Packages changed while the
+ * service was not running are caught by revalidating an index read from the file once with a full query.
+ */
+class AccessibilityInstalledAbilityIndex {
+public:
+    // query and parse every accessibility extension ability of the user, false if the query failed
+    using FullQuery = std::function<bool(std::vector<AccessibilityAbilityInitParams> &abilities)>;
+
+    static constexpr int32_t INDEX_VERSION = 1;
+
+    enum class BundleChange {
+        ADDED,
+        CHANGED,
+        REMOVED,
+    };
+
+    /**
+     * @param filePath the file of the index.
+     * @param fingerprint changes whenever the installed abilities may change without a package event,
+     *                    the system version in the service.
+     */
+    AccessibilityInstalledAbilityIndex(const std::string &filePath, const std::string &fingerprint);
+    ~AccessibilityInstalledAbilityIndex() = default;
+
+    /**
+     * @brief Get the installed abilities, from the file if it is valid and from the full query if not.
+     * @param query the full query, which also rewrites the file.
+     * @param abilities set to the installed abilities.
+     * @return false if the file is not valid and the full query failed.
+     */
+    bool Load(const FullQuery &query, std::vector<AccessibilityAbilityInitParams> &abilities);
+
+    /**
+     * @brief Compare the index with a full query and keep the query, after the last load was answered by the file.
+     * @param query the full query, which also rewrites the file if anything changed.
+     * @param changes set to the bundles the query differs in.
+     * @return false if the index was not loaded from the file or the query failed, the index is kept then.
+     */
+    bool Revalidate(const FullQuery &query, std::map<std::string, BundleChange> &changes);
+
+    /**
+     * @brief Replace the abilities of a bundle after it was added or changed, an empty list removes it.
+     */
+    void UpdateBundle(const std::string &bundleName, const std::vector<AccessibilityAbilityInitParams> &abilities);
+    void RemoveBundle(const std::string &bundleName);
+
+    /**
+     * @brief Forget the index and delete its file, as when the user is removed.
+     */
+    void Clear();
+
+    /**
+     * @brief Delete the file of an index which is not loaded, as when a user without account data is removed.
+     */
+    static void RemoveFile(const std::string &filePath);
+
+    // true if the last load was answered by the file and was not revalidated yet
+    bool IsLoadedFromFile();
+
+private:
+    bool ReadFile(); // should be used in mutex
+    bool WriteFile(); // should be used in mutex
+    void CollectAbilities(std::vector<AccessibilityAbilityInitParams> &abilities) const; // should be used in mutex
+
+    std::string filePath_;
+    std::string fingerprint_;
+
+    ffrt::mutex mutex_;
+    bool isLoaded_ = false;
+    bool isLoadedFromFile_ = false;
+    std::map<std::string, std::vector<AccessibilityAbilityInitParams>> bundles_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_INSTALLED_ABILITY_INDEX_H
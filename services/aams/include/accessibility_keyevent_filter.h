@@ -16,11 +16,14 @@
 #ifndef ACCESSIBILITY_KEYEVENT_FILTER_H
 #define ACCESSIBILITY_KEYEVENT_FILTER_H
 
-#include <map>
+#include <array>
 #include <vector>
 #include <memory>
 
 #include "accessibility_event_transmission.h"
+#include "accessibility_gesture_timer_wheel.h"
+#include "accessibility_keyevent_latency_tracker.h"
+#include "accessibility_keyevent_pending_table.h"
 #include "event_handler.h"
 #include "ffrt.h"
 
@@ -30,12 +33,6 @@ class KeyEventFilterEventHandler;
 
 class KeyEventFilter : public EventTransmission {
 public:
-    struct ProcessingEvent {
-        std::shared_ptr<MMI::KeyEvent> event_;
-        uint32_t usedCount_;
-        uint32_t seqNum_;
-    };
-
     /**
      * @brief A constructor used to create a KeyEventFilter instance.
      */
@@ -54,6 +51,11 @@ public:
      */
     bool OnKeyEvent(MMI::KeyEvent &event) override;
 
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_KEY_EVENT_FILTER;
+    }
+
     /**
      * @brief Send key event to next stream node.
      * @param event the key event prepared to send
@@ -74,11 +76,9 @@ public:
     void DestroyEvents() override;
 
     /**
-     * @brief Remove the processing event.
-     * @param event the event be removed
-     * @return true if remove successfully else false
+     * @brief Send the pending events which timed out to the next stream node.
      */
-    bool RemoveProcessingEvent(std::shared_ptr<ProcessingEvent> event);
+    void ProcessTimeoutEvents();
 
 private:
     /**
@@ -87,27 +87,29 @@ private:
      */
     void DispatchKeyEvent(MMI::KeyEvent &event);
 
-    /**
-     * @brief Find processing event.
-     * @param connection the corresponding AccessibleAbility
-     * @param sequenceNum the sequence of event
-     * @return the processing event
-     */
-    std::shared_ptr<ProcessingEvent> FindProcessingEvent(int32_t connectionId, uint32_t sequenceNum);
+    // all pending events share one timer, armed for the deadline of the oldest one
+    void ScheduleTimeoutLocked();
+
+    // the latest deadline of the connections waited for, not earlier than the deadline of the last pending event
+    int64_t GetDeadlineLocked(const std::vector<int32_t> &connectionIds, int64_t now);
 
-    std::map<int32_t, std::vector<std::shared_ptr<ProcessingEvent>>> eventMaps_;
+    KeyEventPendingTable pendingTable_;
+    KeyEventLatencyTracker latencyTracker_;
+    // the dispatch time of the pending events, in the slot of their sequence number
+    std::array<int64_t, KeyEventPendingTable::CAPACITY> dispatchTimes_ {};
+    int64_t lastDeadline_ = 0;
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
     std::shared_ptr<KeyEventFilterEventHandler> timeoutHandler_ = nullptr;
-    std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
     uint32_t sequenceNum_ = 0;
     ffrt::mutex mutex_;
 };
 
-class KeyEventFilterEventHandler : public AppExecFwk::EventHandler {
+class KeyEventFilterEventHandler : public GestureTimerHandler {
 public:
     /**
      * @brief A constructor used to create a KeyEventFilterEventHandler instance.
      */
-    KeyEventFilterEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner, KeyEventFilter &keyEventFilter);
+    KeyEventFilterEventHandler(const std::shared_ptr<GestureTimerWheel> &wheel, KeyEventFilter &keyEventFilter);
     virtual ~KeyEventFilterEventHandler() = default;
 
     /**
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_KEYEVENT_LATENCY_TRACKER_H
+#define ACCESSIBILITY_KEYEVENT_LATENCY_TRACKER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * How long each connection takes to answer the key events dispatched to it, kept as a histogram of
+ * latencies per connection. The deadline of a connection is twice the latency most of its answers come
+ * within, bounded by the fixed timeout, and the fixed timeout until enough answers are seen. A timeout
+ * counts as an answer in the slowest bucket. A connection missing its deadline several times in a row is
+ * skipped for a while, then tried again from a fresh histogram. The tracker is not thread safe.
+ */
+class KeyEventLatencyTracker {
+public:
+    static constexpr size_t BUCKET_COUNT = 12;
+    // the upper bound of each bucket in ms, the last one is the fixed timeout
+    static constexpr std::array<int64_t, BUCKET_COUNT - 1> BUCKET_BOUNDS = {
+        5, 10, 20, 30, 50, 75, 100, 150, 200, 300, 400
+    };
+    static constexpr uint32_t MIN_SAMPLE_COUNT = 8;
+    // the counts are halved past it, so the histogram follows a connection getting slower or faster
+    static constexpr uint32_t MAX_SAMPLE_COUNT = 128;
+    static constexpr uint32_t PERCENTILE = 95;
+    static constexpr int64_t MIN_TIMEOUT = 20; // ms
+    static constexpr uint32_t MAX_CONSECUTIVE_MISSES = 3;
+    static constexpr int64_t SKIP_DURATION = 30000; // ms
+
+    /**
+     * @param maxTimeout the fixed timeout in ms, no deadline is later.
+     */
+    explicit KeyEventLatencyTracker(int64_t maxTimeout);
+    ~KeyEventLatencyTracker() = default;
+
+    /**
+     * @brief Record the answer of a connection before its deadline.
+     * @param connectionId the connection.
+     * @param latency the time from the dispatch to the answer, in ms.
+     */
+    void RecordLatency(int32_t connectionId, int64_t latency);
+
+    /**
+     * @brief Record a connection not answering before its deadline.
+     * @param connectionId the connection.
+     * @param now the current time in ms.
+     */
+    void RecordMiss(int32_t connectionId, int64_t now);
+
+    // the timeout in ms of a key event dispatched to the connection
+    int64_t GetDeadline(int32_t connectionId) const;
+
+    /**
+     * @brief Get the connections the key events should not be dispatched to.
+     * @param now the current time in ms, a connection skipped long enough is tried again.
+     * @param connectionIds the skipped connections are appended to it.
+     */
+    void GetSkippedConnections(int64_t now, std::vector<int32_t> &connectionIds);
+
+    void Clear();
+
+private:
+    struct ConnectionStats {
+        std::array<uint32_t, BUCKET_COUNT> buckets {};
+        uint32_t sampleCount = 0;
+        uint32_t consecutiveMisses = 0;
+        bool isSkipped = false;
+        int64_t skipUntil = 0;
+    };
+
+    void AddSample(ConnectionStats &stats, size_t bucket);
+    int64_t GetBucketBound(size_t bucket) const;
+
+    int64_t maxTimeout_ = 0;
+    std::map<int32_t, ConnectionStats> stats_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_KEYEVENT_LATENCY_TRACKER_H
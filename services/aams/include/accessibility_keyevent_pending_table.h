@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_KEYEVENT_PENDING_TABLE_H
+#define ACCESSIBILITY_KEYEVENT_PENDING_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "key_event.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * Key events dispatched to the accessibility abilities and waiting for their results, in a fixed
+ * capacity open addressing table whose slot is the sequence number modulo the capacity. Sequence
+ * numbers are inserted densely in increasing order with non-decreasing deadlines, so a slot is only
+ * taken by the event CAPACITY sequence numbers older, which is the oldest pending one, and the
+ * oldest pending event is always the one which times out first. The table is not thread safe.
+ */
+class KeyEventPendingTable {
+public:
+    // must be a power of two
+    static constexpr uint32_t CAPACITY = 256;
+
+    enum class AckResult : int32_t {
+        // the event is not pending, or the connection has already answered it
+        NOT_FOUND = 0,
+        // other connections have not answered yet
+        WAITING,
+        // the event is handled by the connection and removed
+        HANDLED,
+        // no connection handles the event, it is removed and returned to be sent to the next node
+        UNHANDLED,
+    };
+
+    KeyEventPendingTable() = default;
+    ~KeyEventPendingTable() = default;
+
+    /**
+     * @brief Add a dispatched event.
+     * @param sequenceNum the sequence number, next to the one of the last inserted event.
+     * @param event the dispatched event.
+     * @param connectionIds the connections the event is dispatched to.
+     * @param deadline the time the event times out.
+     * @param evictedEvent set to the pending event which occupied the slot, if any.
+     */
+    void Insert(uint32_t sequenceNum, const std::shared_ptr<MMI::KeyEvent> &event,
+        const std::vector<int32_t> &connectionIds, int64_t deadline, std::shared_ptr<MMI::KeyEvent> &evictedEvent);
+
+    /**
+     * @brief Apply the result of a connection to the pending event.
+     * @param connectionId the connection which answers.
+     * @param sequenceNum the sequence number of the event.
+     * @param isHandled true if the connection handles the event.
+     * @param event set to the event if the result is UNHANDLED.
+     * @return the result of the acknowledgement.
+     */
+    AckResult Acknowledge(int32_t connectionId, uint32_t sequenceNum, bool isHandled,
+        std::shared_ptr<MMI::KeyEvent> &event);
+
+    /**
+     * @brief Remove the events whose deadline is not later than now, oldest first.
+     * @param now the current time.
+     * @param events the removed events are appended to it.
+     */
+    void PopExpired(int64_t now, std::vector<std::shared_ptr<MMI::KeyEvent>> &events);
+
+    /**
+     * @brief Remove the events whose deadline is not later than now, oldest first.
+     * @param now the current time.
+     * @param events the removed events are appended to it.
+     * @param missedConnectionIds the connections which did not answer a removed event are appended to it,
+     *                            once per event.
+     */
+    void PopExpired(int64_t now, std::vector<std::shared_ptr<MMI::KeyEvent>> &events,
+        std::vector<int32_t> &missedConnectionIds);
+
+    /**
+     * @brief Get the deadline of the oldest pending event.
+     * @param deadline set to the deadline.
+     * @return false if the table is empty.
+     */
+    bool GetNextDeadline(int64_t &deadline);
+
+    void Clear();
+
+    inline size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    static constexpr uint32_t MASK = CAPACITY - 1;
+
+    struct Entry {
+        bool used = false;
+        uint32_t sequenceNum = 0;
+        int64_t deadline = 0;
+        std::shared_ptr<MMI::KeyEvent> event = nullptr;
+        // the connections which have not answered yet, the slot keeps the capacity for the next event
+        std::vector<int32_t> connectionIds {};
+    };
+
+    Entry *FindEntry(uint32_t sequenceNum);
+    Entry *FindOldestEntry();
+    void RemoveEntry(Entry &entry);
+
+    std::array<Entry, CAPACITY> entries_ {};
+    size_t size_ = 0;
+    // no pending event has a sequence number older than oldestSequenceNum_
+    uint32_t oldestSequenceNum_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_KEYEVENT_PENDING_TABLE_H
@@ -16,8 +16,9 @@
 #ifndef ACCESSIBILITY_MOUSE_AUTOCLICK_H
 #define ACCESSIBILITY_MOUSE_AUTOCLICK_H
 
+#include "accessibility_dwell_detector.h"
 #include "accessibility_event_transmission.h"
-#include "event_handler.h"
+#include "accessibility_gesture_timer_wheel.h"
 
 namespace OHOS {
 namespace Accessibility {
@@ -41,6 +42,11 @@ public:
      */
     bool OnPointerEvent(MMI::PointerEvent &event) override;
 
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_MOUSE_AUTOCLICK;
+    }
+
     void SendMouseClickEvent();
     void ResetAutoclickInfo();
 
@@ -50,33 +56,22 @@ public:
     void DestroyEvents() override;
 
 private:
-    class MouseAutoclickEventHandler : public AppExecFwk::EventHandler {
-    public:
-        /**
-         * @brief A constructor used to create a MouseAutoclickEventHandler instance.
-         */
-        MouseAutoclickEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-            AccessibilityMouseAutoclick &mouseAutoclick);
-        virtual ~MouseAutoclickEventHandler() = default;
-
-        /**
-         * @brief Process the event of install system bundles.
-         * @param event Indicates the event to be processed.
-         */
-        virtual void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override;
-
-    private:
-        AccessibilityMouseAutoclick &mouseAutoclick_;
-    };
-
     void CancelAutoclick();
     void RecognizeAutoclick(MMI::PointerEvent &event);
-    bool IsMouseMovement(MMI::PointerEvent &event);
+    void LogStatistics();
     int64_t GetSystemTime();
     int64_t GetDelayTime();
 
-    std::shared_ptr<MouseAutoclickEventHandler> timeoutHandler_ = nullptr;
-    std::shared_ptr<MMI::PointerEvent> lastMouseEvent_ = nullptr;
+    std::unique_ptr<AccessibilityDwellDetector> dwellDetector_ = nullptr;
+    // what the click is made from, saved from every move instead of a copy of the whole event
+    bool hasLastMove_ = false;
+    int32_t lastPointerId_ = 0;
+    int32_t lastDeviceId_ = 0;
+    int32_t lastTargetDisplayId_ = 0;
+    int32_t lastTargetWindowId_ = 0;
+    int32_t lastAgentWindowId_ = 0;
+    MMI::PointerEvent::PointerItem lastPointerItem_;
+    int64_t lastStatisticsLogTime_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -47,6 +47,11 @@ public:
      *         false: the event is not processed.
      */
     bool OnKeyEvent(MMI::KeyEvent &event) override;
+
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_MOUSE_KEY;
+    }
 private:
     enum SELECTED_KEY_TYPE : uint32_t {
         LEFT_KEY = 0,
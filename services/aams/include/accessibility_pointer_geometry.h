@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_POINTER_GEOMETRY_H
+#define ACCESSIBILITY_POINTER_GEOMETRY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace Accessibility {
+enum class PointerCoordinate : int32_t {
+    DISPLAY = 0,
+    RAW_DISPLAY,
+};
+
+/**
+ * The positions of the pointers of one event, read out of the event once and kept as one array per
+ * coordinate so the kernels below run over plain float lanes. The lanes past the pointer count are
+ * zero and carry a zero weight, which lets the kernels always run over whole blocks of lanes.
+ */
+class PointerGeometry {
+public:
+    static constexpr size_t MAX_POINTER_COUNT = 10;
+    static constexpr size_t LANE_COUNT = 4;
+    static constexpr size_t PADDED_COUNT = (MAX_POINTER_COUNT + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+    static constexpr size_t INVALID_INDEX = MAX_POINTER_COUNT;
+
+    PointerGeometry() = default;
+
+    /**
+     * @brief Read the pointers of the event, the pointers past MAX_POINTER_COUNT are dropped.
+     * @param event the pointer event.
+     * @param excludePointerId the pointer to leave out, -1 to read them all.
+     * @return the count of pointers read.
+     */
+    size_t Load(const MMI::PointerEvent &event, int32_t excludePointerId = -1);
+    bool Add(int32_t pointerId, int32_t displayX, int32_t displayY, int32_t rawDisplayX, int32_t rawDisplayY);
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return count_;
+    }
+
+    int32_t GetPointerId(size_t index) const
+    {
+        return pointerIds_[index];
+    }
+
+    float GetX(size_t index, PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+    float GetY(size_t index, PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+
+    bool GetCentroid(float &centerX, float &centerY, PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+
+    /**
+     * @brief The mean absolute distance of the pointers from the center along each axis.
+     */
+    bool GetMeanDeviation(float centerX, float centerY, float &deviationX, float &deviationY,
+        PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+
+    float GetSeparation(size_t first, size_t second, PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+
+    /**
+     * @brief Find the pointer nearest to a point.
+     * @param excludeMask the indexes to skip, bit i stands for index i.
+     * @param distance the distance to the nearest pointer.
+     * @return the index of the nearest pointer, INVALID_INDEX if every pointer is skipped.
+     */
+    size_t FindNearest(float posX, float posY, uint32_t excludeMask, float &distance,
+        PointerCoordinate coordinate = PointerCoordinate::DISPLAY) const;
+
+private:
+    using Lanes = std::array<float, PADDED_COUNT>;
+
+    const Lanes &GetXLanes(PointerCoordinate coordinate) const
+    {
+        return coordinate == PointerCoordinate::RAW_DISPLAY ? rawX_ : x_;
+    }
+
+    const Lanes &GetYLanes(PointerCoordinate coordinate) const
+    {
+        return coordinate == PointerCoordinate::RAW_DISPLAY ? rawY_ : y_;
+    }
+
+    void SquaredDistances(float posX, float posY, PointerCoordinate coordinate, Lanes &distances) const;
+
+    size_t count_ = 0;
+    alignas(16) Lanes x_ {};
+    alignas(16) Lanes y_ {};
+    alignas(16) Lanes rawX_ {};
+    alignas(16) Lanes rawY_ {};
+    alignas(16) Lanes weight_ {};
+    std::array<int32_t, MAX_POINTER_COUNT> pointerIds_ {};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_POINTER_GEOMETRY_H
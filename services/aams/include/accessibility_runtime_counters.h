@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_RUNTIME_COUNTERS_H
+#define ACCESSIBILITY_RUNTIME_COUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "accessibility_thread_shards.h"
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * Counters of the service at runtime: the accessibility events received and dropped by type and the
+ * IPC calls with their latency by interface code. Every recording thread owns a shard which it updates
+ * with relaxed atomics, so recording never takes a lock. The dump adds the gauges and cache counters
+ * the caller samples, and prints one "name{labels} value" line per counter, either the totals or the
+ * change since the last dump.
+ */
+class AccessibilityRuntimeCounters {
+    DECLARE_SINGLETON(AccessibilityRuntimeCounters)
+public:
+    // slot 0 holds the unknown types, slots 1 to 31 the single bit types, the rest the extended types
+    static constexpr size_t EVENT_SLOT_COUNT = 38;
+    // the codes from IPC_SLOT_COUNT - 1 on share the last slot
+    static constexpr size_t IPC_SLOT_COUNT = 128;
+    // bucket 0 holds 0us, bucket i holds [2^(i-1), 2^i) us, the last bucket holds everything above.
+    static constexpr size_t HISTOGRAM_BUCKET_COUNT = 20;
+    static constexpr size_t MAX_SHARD_COUNT = 4;
+
+    struct CacheCounter {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+    };
+
+    struct Snapshot {
+        int64_t timeMs = 0;
+        std::array<uint64_t, EVENT_SLOT_COUNT> eventsReceived {};
+        std::array<uint64_t, EVENT_SLOT_COUNT> eventsDropped {};
+        std::array<std::array<uint64_t, HISTOGRAM_BUCKET_COUNT>, IPC_SLOT_COUNT> ipcLatency {};
+        // monotonic counters of the caches, by cache name
+        std::map<std::string, CacheCounter> caches;
+        // gauges, never turned into a delta
+        std::map<std::string, uint64_t> queueDepths;
+    };
+
+    void RecordEventReceived(uint32_t eventType);
+    void RecordEventDropped(uint32_t eventType);
+
+    /**
+     * @brief Record one IPC call served by the service.
+     * @param code the interface code of the call.
+     * @param latencyUs the time spent serving it, in microseconds.
+     */
+    void RecordIpcCall(uint32_t code, int64_t latencyUs);
+
+    /**
+     * @brief Merge the shards into the snapshot, stamped with the current time.
+     */
+    void GetSnapshot(Snapshot &snapshot) const;
+
+    /**
+     * @brief Append the counters and remember them as the base of the next delta dump.
+     * @param snapshot the counters of GetSnapshot, with the caches and queue depths of the caller added.
+     * @param isDelta true to dump the change since the last dump instead of the totals.
+     * @param dumpInfo the string to append to.
+     */
+    void Dump(const Snapshot &snapshot, bool isDelta, std::string &dumpInfo);
+
+    /**
+     * @brief Append the counters of a snapshot, or their change since a previous one.
+     * @param current the counters now.
+     * @param previous the counters of the last dump, nullptr to append the totals. A counter lower than
+     *                 before was reset in between and counts from zero.
+     * @param dumpInfo the string to append to.
+     */
+    static void FormatCounters(const Snapshot &current, const Snapshot *previous, std::string &dumpInfo);
+
+    static size_t GetEventSlot(uint32_t eventType);
+    static uint32_t GetEventType(size_t slot);
+
+    // the sum of the priority sizes in the output of EventQueue::DumpCurrentQueueSize
+    static uint64_t ParseQueueSize(const std::string &queueSize);
+
+    static int64_t GetCurrentTimeUs();
+
+private:
+    struct CounterShard {
+        std::array<std::atomic<uint64_t>, EVENT_SLOT_COUNT> eventsReceived {};
+        std::array<std::atomic<uint64_t>, EVENT_SLOT_COUNT> eventsDropped {};
+        std::array<std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKET_COUNT>, IPC_SLOT_COUNT> ipcLatency {};
+    };
+
+    AccessibilityThreadShards<CounterShard, MAX_SHARD_COUNT> shards_;
+
+    ffrt::mutex dumpMutex_;
+    bool hasLastSnapshot_ = false;
+    Snapshot lastSnapshot_;
+};
+
+/**
+ * Measures one IPC call and records it when the scope ends.
+ */
+class IpcCallScope {
+public:
+    explicit IpcCallScope(uint32_t code);
+    ~IpcCallScope();
+
+private:
+    uint32_t code_ = 0;
+    int64_t startTime_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_RUNTIME_COUNTERS_H
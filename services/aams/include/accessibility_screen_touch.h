@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (C) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,9 +17,11 @@
 #define ACCESSIBILITY_SCREEN_TOUCH_H
 
 #include <atomic>
+#include <list>
 #include <string>
-#include <thread>
+#include "accessibility_circle_progress.h"
 #include "accessibility_event_transmission.h"
+#include "accessibility_gesture_timer_wheel.h"
 #include "event_handler.h"
 #include "event_runner.h"
 
@@ -33,10 +35,23 @@ enum ScreenTouchState : int32_t {
     BOTH_RESPONSE_DELAY_IGNORE_REPEAT_CLICK
 };
 
+/**
+ * The click response circle of one press, shared with the frames drawn on the circle progress runner.
+ */
+struct CircleProgressState {
+    std::atomic<int32_t> centerX {0};
+    std::atomic<int32_t> centerY {0};
+    std::atomic<bool> isStopped {false};
+    int64_t startTime = 0; // millisecond
+    uint32_t duration = 0; // millisecond
+    uint64_t screenId = 0;
+    int32_t startAngle = 0;
+};
+
 class AccessibilityScreenTouch;
-class ScreenTouchHandler : public AppExecFwk::EventHandler {
+class ScreenTouchHandler : public GestureTimerHandler {
 public:
-    ScreenTouchHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner, AccessibilityScreenTouch &server);
+    ScreenTouchHandler(const std::shared_ptr<GestureTimerWheel> &wheel, AccessibilityScreenTouch &server);
     virtual ~ScreenTouchHandler() = default;
     /**
      * @brief Process the event of install system bundles.
@@ -70,6 +85,11 @@ public:
      */
     bool OnPointerEvent(MMI::PointerEvent &event) override;
 
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_SCREEN_TOUCH;
+    }
+
     uint32_t GetRealClickResponseTime();
     uint32_t GetRealIgnoreRepeatClickTime();
     bool GetRealIgnoreRepeatClickState();
@@ -94,8 +114,11 @@ private:
     void Clear();
 
     void HandleCoordinates(MMI::PointerEvent::PointerItem &item);
-    void ConversionCoordinates(int32_t originalX, int32_t originalY);
-    void DrawCircleProgress();
+    CircleProgressTransform CreateCircleTransform();
+    CircleProgressTransform CreateRotationTransform();
+    void StartCircleProgress(MMI::PointerEvent::PointerItem &item);
+    void StopCircleProgress();
+    bool InitCircleProgressRunner();
 
     void SetTargetScreenId();
 
@@ -112,16 +135,15 @@ private:
     bool ignoreRepeatClickState_ = false;
     uint32_t ignoreRepeatClickTime_ = 0;
 
-    std::atomic<int32_t> circleCenterPhysicalX_;
-    std::atomic<int32_t> circleCenterPhysicalY_;
-    int32_t startAngle_ = 0;
-    std::atomic<bool> isStopDrawCircle_;
-    std::shared_ptr<std::thread> drawCircleThread_ = nullptr;
+    std::atomic<bool> isStopDrawCircle_ {false};
+    CircleProgressTransform circleTransform_ {};
+    std::shared_ptr<CircleProgressState> circleState_ = nullptr;
+    std::shared_ptr<AppExecFwk::EventRunner> circleRunner_ = nullptr;
+    std::shared_ptr<AppExecFwk::EventHandler> circleHandler_ = nullptr;
 
     static int64_t lastUpTime; // global last up time
 
     std::shared_ptr<ScreenTouchHandler> handler_ = nullptr;
-    std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
     
     std::list<MMI::PointerEvent> cachedDownPointerEvents_ {};
 };
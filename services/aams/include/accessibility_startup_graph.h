@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_STARTUP_GRAPH_H
+#define ACCESSIBILITY_STARTUP_GRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct StartupPhaseRecord {
+    std::string name;
+    // the time the dependencies of the step were met and it was handed to its runner, -1 if it never was
+    int64_t readyTime = -1;
+    int64_t startTime = -1;
+    int64_t endTime = -1;
+    bool succeeded = false;
+};
+
+/**
+ * The startup of the service as steps which each declare the system abilities and the earlier steps they
+ * need. A step is handed to its runner as soon as its own dependencies are met, so independent steps do not
+ * wait for every system ability and concurrent steps run side by side. A step which fails runs again on the
+ * next system ability added, and the removal of a system ability makes every step run again once it is back.
+ */
+class AccessibilityStartupGraph {
+public:
+    enum class StepRunner : int32_t {
+        // the service event handler, for the steps which change the service state
+        SERIAL = 0,
+        // a task of its own, for the steps which only wait on other services
+        CONCURRENT,
+    };
+
+    // the step, false if it failed
+    using StepTask = std::function<bool()>;
+    // run a task named after its step
+    using Executor = std::function<void(const std::string &name, std::function<void()> task)>;
+    // the current time in milliseconds
+    using Clock = std::function<int64_t()>;
+
+    AccessibilityStartupGraph(Executor serialExecutor, Executor concurrentExecutor, Clock clock = nullptr);
+    ~AccessibilityStartupGraph() = default;
+
+    /**
+     * @brief Add a step, the steps it comes after must be added before it.
+     * @param name the name of the step, unique in the graph.
+     * @param systemAbilities the system abilities the step needs.
+     * @param predecessors the steps which must have succeeded before it.
+     * @param runner where the step runs.
+     * @param task the step.
+     * @return false if the name is taken or a predecessor is unknown.
+     */
+    bool AddStep(const std::string &name, const std::vector<int32_t> &systemAbilities,
+        const std::vector<std::string> &predecessors, StepRunner runner, StepTask task);
+
+    /**
+     * @brief Mark a system ability as added and start the steps it completes.
+     * @return false if no step needs the system ability.
+     */
+    bool OnSystemAbilityAdded(int32_t systemAbilityId);
+
+    /**
+     * @brief Mark a system ability as removed, every step runs again once it is back.
+     * @return false if no step needs the system ability.
+     */
+    bool OnSystemAbilityRemoved(int32_t systemAbilityId);
+
+    /**
+     * @brief Mark every system ability as removed, as when the service stops.
+     */
+    void Clear();
+
+    bool IsFinished(const std::string &name);
+
+    /**
+     * @brief The timing of every step, in the order the steps were added.
+     */
+    std::vector<StartupPhaseRecord> GetRecords();
+    void Dump(std::string &dumpInfo);
+
+private:
+    struct Step {
+        std::vector<int32_t> systemAbilities;
+        std::vector<size_t> predecessors;
+        StepRunner runner = StepRunner::SERIAL;
+        StepTask task;
+        bool isRunning = false;
+        bool isFinished = false;
+        StartupPhaseRecord record;
+    };
+
+    bool IsReady(const Step &step) const; // should be used in mutex
+    void ResetSteps(); // should be used in mutex
+    void ScheduleReadySteps();
+    void RunStep(size_t index, uint64_t generation);
+
+    Executor serialExecutor_;
+    Executor concurrentExecutor_;
+    Clock clock_;
+
+    ffrt::mutex mutex_;
+    std::vector<Step> steps_;
+    std::map<std::string, size_t> stepIndexes_;
+    std::map<int32_t, bool> systemAbilities_;
+    // changed by every removal, a step started before it does not count as finished
+    uint64_t generation_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_STARTUP_GRAPH_H
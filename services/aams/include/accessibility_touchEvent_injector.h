@@ -21,16 +21,17 @@
 #include "accessibility_event_transmission.h"
 #include "event_handler.h"
 #include "event_runner.h"
+#include "accessibility_gesture_inject_cursor.h"
 #include "accessibility_gesture_inject_path.h"
+#include "ffrt.h"
 #include "pointer_event.h"
 #include "singleton.h"
 
 namespace OHOS {
 namespace Accessibility {
-const int64_t DOUBLE_TAP_MIN_TIME = 50000; // microsecond
-
 struct SendEventArgs {
     std::shared_ptr<MMI::PointerEvent> event_;
+    uint64_t injectId_ = 0; // the injection the event belongs to
 };
 
 class TouchEventInjector;
@@ -69,6 +70,11 @@ public:
      */
     bool OnPointerEvent(MMI::PointerEvent &event) override;
 
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_TOUCH_EVENT_INJECTOR;
+    }
+
     /**
      * @brief Destroy event state.
      */
@@ -86,6 +92,19 @@ public:
      */
     void InjectEvents(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
 
+    /**
+     * @brief Post the next event of the injection once the previous one is sent.
+     * @param injectId the injection of the event sent, an injection replaced since then is ignored.
+     */
+    void InjectNextEvent(uint64_t injectId);
+
+    /**
+     * @brief Check whether an event belongs to the injection still running.
+     * @param injectId the injection of the event.
+     * @return false if the injection was cancelled or replaced since the event was posted.
+     */
+    bool IsCurrentInjection(uint64_t injectId);
+
 private:
     /**
      * @brief Cancel the gesture.
@@ -113,32 +132,20 @@ private:
     int64_t GetSystemTime();
 
     /**
-     * @brief Parse taps events.
-     * @param startTime the start time of gesture injection
-     * @param gesturePath the gesture path
-     */
-    void ParseTapsEvents(int64_t startTime, const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
-
-    /**
-     * @brief Parse move events.
-     * @param startTime the start time of gesture injection
-     * @param gesturePath the gesture path
+     * @brief Post the next event of the cursor to the handler, due at its action time.
+     * @return false if the cursor has no more event.
      */
-    void ParseMovesEvents(int64_t startTime, const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
-
-    /**
-     * @brief Parse touchevents from gesturepath.
-     * @param startTime the start time of gesture injection
-     * @param gesturePath the gesture path
-     */
-    void ParseTouchEventsFromGesturePath(int64_t startTime,
-        const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
+    bool PostNextEvent(); // should be used in injectMutex_
 
     bool isGestureUnderway_ = false;
     bool isDestroyEvent_ = false;
     std::shared_ptr<TouchInjectHandler> handler_ = nullptr;
     std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
-    std::vector<std::shared_ptr<MMI::PointerEvent>> injectedEvents_;
+
+    // only the next event of the injection is built and posted, the others stay in the path
+    ffrt::mutex injectMutex_;
+    std::unique_ptr<AccessibilityGestureInjectCursor> injectCursor_ = nullptr;
+    uint64_t injectId_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -23,6 +23,7 @@
 #include <functional>
 #include "accessibility_element_info.h"
 #include "accessibility_event_transmission.h"
+#include "accessibility_gesture_timer_wheel.h"
 #include "accessibility_def.h"
 #include "event_handler.h"
 #include "hilog_wrapper.h"
@@ -140,9 +141,9 @@ struct Pointer {
     float py_;
 };
 
-class TouchExplorationEventHandler : public AppExecFwk::EventHandler {
+class TouchExplorationEventHandler : public GestureTimerHandler {
 public:
-    TouchExplorationEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
+    TouchExplorationEventHandler(const std::shared_ptr<GestureTimerWheel> &wheel,
                  TouchExploration &tgServer);
     virtual ~TouchExplorationEventHandler() = default;
     /**
@@ -256,6 +257,11 @@ public:
      */
     bool OnPointerEvent(MMI::PointerEvent &event) override;
 
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_TOUCH_EXPLORATION;
+    }
+
     /* Set current state */
     inline void SetCurrentState(TouchExplorationState state)
     {
@@ -379,9 +385,7 @@ private:
     }
 
     std::shared_ptr<TouchExplorationEventHandler> handler_ = nullptr;
-    std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> gestureHandler_ = nullptr;
-    std::shared_ptr<AppExecFwk::EventRunner> gestureRunner_;
     using HandleEventFunc = std::function<void(MMI::PointerEvent &)>;
     std::map<TouchExplorationState, std::map<int32_t, HandleEventFunc>> handleEventFuncMap_ {};
 
@@ -17,6 +17,8 @@
 #define ACCESSIBILITY_ZOOM_GESTURE_H
 
 #include "accessibility_event_transmission.h"
+#include "accessibility_gesture_timer_wheel.h"
+#include "accessibility_pointer_geometry.h"
 #include "event_handler.h"
 #include "pointer_event.h"
 #include "dm_common.h"
@@ -56,6 +58,12 @@ public:
     ~AccessibilityZoomGesture() = default;
 
     virtual bool OnPointerEvent(MMI::PointerEvent &event) override;
+
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_ZOOM_GESTURE;
+    }
+
     void DestroyEvents() override;
     // flag = true shield zoom gesture | flag = false restore zoom gesture
     void ShieldZoomGesture(bool state);
@@ -70,9 +78,9 @@ public:
     }
 
 private:
-    class ZoomGestureEventHandler : public AppExecFwk::EventHandler {
+    class ZoomGestureEventHandler : public GestureTimerHandler {
     public:
-        ZoomGestureEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
+        ZoomGestureEventHandler(const std::shared_ptr<GestureTimerWheel> &wheel,
             AccessibilityZoomGesture &zoomGesture);
         virtual ~ZoomGestureEventHandler() = default;
 
@@ -96,8 +104,11 @@ private:
     void RecognizeInZoomStateMoveEvent(MMI::PointerEvent &event);
     void RecognizeScroll(ZOOM_FOCUS_COORDINATE &coordinate, bool reverse = false);
     bool RecognizeScale(MMI::PointerEvent &event);
+    bool RecognizeScale(const PointerGeometry &geometry);
     void CalcFocusCoordinate(MMI::PointerEvent &event, ZOOM_FOCUS_COORDINATE &coordinate);
+    void CalcFocusCoordinate(const PointerGeometry &geometry, ZOOM_FOCUS_COORDINATE &coordinate);
     float CalcScaleSpan(MMI::PointerEvent &event, ZOOM_FOCUS_COORDINATE coordinate);
+    float CalcScaleSpan(const PointerGeometry &geometry, ZOOM_FOCUS_COORDINATE coordinate);
     bool IsTapOnInputMethod(MMI::PointerEvent &event);
     bool IsDownValid(std::shared_ptr<MMI::PointerEvent> curEvent, std::shared_ptr<MMI::PointerEvent> lastEvent);
     bool IsMoveValid(std::shared_ptr<MMI::PointerEvent> curEvent, std::shared_ptr<MMI::PointerEvent> lastEvent);
@@ -106,6 +117,7 @@ private:
     void OnTripleTap(MMI::PointerEvent &event);
     bool IsThreeFingerMultiTap(MMI::PointerEvent &event);
     float CalcSeparationDistance(MMI::PointerEvent &event);
+    float CalcSeparationDistance(const PointerGeometry &geometry);
     float CalcSeparationDistance(MMI::PointerEvent &firstEvent, MMI::PointerEvent &secondEvent);
     void OnZoom(int32_t centerX, int32_t centerY, bool showMenu);
     void OffZoom();
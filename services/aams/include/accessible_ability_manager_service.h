@@ -16,6 +16,7 @@
 #ifndef ACCESSIBLE_ABILITY_MANAGER_SERVICE_H
 #define ACCESSIBLE_ABILITY_MANAGER_SERVICE_H
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -26,9 +27,11 @@
 #include "accessible_ability_manager_service_event_handler.h"
 #include "accessibility_account_data.h"
 #include "accessibility_common_event.h"
+#include "accessibility_display_user_cache.h"
 #include "accessibility_element_operator_callback_stub.h"
 #include "accessibility_keyevent_filter.h"
 #include "accessibility_settings.h"
+#include "accessibility_startup_graph.h"
 #include "accessibility_touchEvent_injector.h"
 #include "accessibility_window_info.h"
 #include "bundlemgr/bundle_mgr_interface.h"
@@ -79,6 +82,8 @@ public:
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     int Dump(int fd, const std::vector<std::u16string>& args) override;
+    int32_t OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option) override;
     void PostDelayUnloadTask();
     void PostUpdateCriticalTask();
 
@@ -194,7 +199,7 @@ public:
 
     inline int32_t GetCurrentAccountId()
     {
-        return currentAccountId_;
+        return currentAccountId_.load();
     }
 
     inline std::shared_ptr<AAMSEventHandler> &GetMainHandler()
@@ -216,6 +221,19 @@ public:
     sptr<AccessibilityAccountData> GetCurrentAccountData();
     std::vector<int32_t> GetAllAccountIds();
 
+    inline std::shared_ptr<AccessibilityDisplayUserCache> GetDisplayUserCache()
+    {
+        return displayUserCache_;
+    }
+
+    inline std::shared_ptr<AccessibilityStartupGraph> GetStartupGraph()
+    {
+        return startupGraph_;
+    }
+
+    // the number of tasks waiting in each event runner of the service, by runner name
+    void GetRunnerQueueDepths(std::map<std::string, uint64_t> &queueDepths);
+
     /* For common event */
     void AddedUser(int32_t accountId);
     void RemovedUser(int32_t accountId);
@@ -223,6 +241,8 @@ public:
     void PackageChanged(const std::string &bundleName, int32_t userId);
     void PackageRemoved(const std::string &bundleName, int32_t userId);
     void PackageAdd(const std::string &bundleName, int32_t userId);
+    // replay the package events the installed ability index of the user missed, once after it was read from the file
+    void RevalidateInstalledAbilities(int32_t userId);
 
     void UpdateAccessibilityManagerService();
     bool CheckWindowIdEventExist(int32_t windowId);
@@ -318,6 +338,7 @@ private:
     bool SetHighContrastTextAbility(bool state);
     void PublishAccessibilityCommonEvent(const std::string &event);
     int32_t GetUserIdByDisplayId(uint64_t displayId);
+    void UpdateDisplayUserCache(int32_t accountId);
     class StateCallbackDeathRecipient final : public IRemoteObject::DeathRecipient {
     public:
         StateCallbackDeathRecipient() = default;
@@ -354,8 +375,12 @@ private:
         void OnRemoteDied(const wptr<IRemoteObject> &remote) final;
     };
 
-    bool Init();
+    void InitStartupGraph();
+    bool QueryForegroundAccounts();
+    bool InitForegroundAccounts();
+    bool PublishService();
     void InitInnerResource();
+    void OnServiceReady();
 
     class ConfigCallbackDeathRecipient final : public IRemoteObject::DeathRecipient {
     public:
@@ -405,6 +430,7 @@ private:
     void InitializeShortKeyState();
     void RegisterProvisionCallback();
     void RegisterShortKeyEvent();
+    void PostObserverRegistration(std::function<void()> task, const std::string &name);
     bool IsNeedUnload();
     void OnScreenMagnificationStateChanged();
     void RegisterScreenMagnificationState();
@@ -440,8 +466,11 @@ private:
 
     bool isReady_ = false;
     bool isPublished_ = false;
-    std::map<int32_t, bool> dependentServicesStatus_;
-    int32_t currentAccountId_ = -1;
+    std::shared_ptr<AccessibilityStartupGraph> startupGraph_ = nullptr;
+    ffrt::mutex foregroundAccountsMutex_;
+    std::vector<int32_t> foregroundAccountIds_ {}; // found by the startup account query
+    // switched on the handler, read by the setting observer registrations running as ffrt tasks
+    std::atomic<int32_t> currentAccountId_ = -1;
     uint32_t currentAccessibilityState_ = 0;
     AccessibilityAccountDataMap  a11yAccountsData_;
 
@@ -474,6 +503,7 @@ private:
     std::vector<sptr<IAccessibleAbilityManagerConfigObserver>> defaultConfigCallbacks_;
     std::shared_ptr<AccessibilitySettings> accessibilitySettings_ = nullptr;
     std::shared_ptr<AccessibilityShortKey> accessibilityShortKey_ = nullptr;
+    std::shared_ptr<AccessibilityDisplayUserCache> displayUserCache_ = nullptr;
     std::vector<std::string> removedAutoStartAbilities_ {};
 
     std::map<int32_t, std::map<int32_t, std::set<int32_t>>> windowRequestIdMap_ {}; // windowId->treeId->requestId
@@ -22,6 +22,7 @@
 #include "accessibility_def.h"
 #include "key_event.h"
 #include "ffrt.h"
+#include "accessibility_ext_symbol_table.h"
 #include <set>
 
 namespace OHOS {
@@ -58,8 +59,14 @@ enum class ExtMethod : int32_t {
     OFF_ZOOM_GESTURE,
     SET_MAGNIFICATION_STATE,
     IS_MAGNIFICATION_WINDOW_ACTIVATE,
-    SET_CURRENT_ACCOUNT_ID
+    SET_CURRENT_ACCOUNT_ID,
+    DUMP_INPUT_STATISTICS,
+    RESET_INPUT_STATISTICS,
+    START_INPUT_RECORD,
+    STOP_INPUT_RECORD
 };
+
+constexpr size_t EXT_METHOD_COUNT = static_cast<size_t>(ExtMethod::STOP_INPUT_RECORD) + 1;
 class ExtendManagerServiceProxy {
     DECLARE_SINGLETON(ExtendManagerServiceProxy);
 public:
@@ -98,6 +105,10 @@ public:
     void SetMagnificationState(const bool state, const uint32_t type, const uint32_t mode);
     bool IsMagnificationWindowActivate();
     void SetCurrentAccountId(int32_t accountId);
+    bool DumpInputStatistics(std::string &dumpInfo);
+    bool ResetInputStatistics();
+    bool StartInputRecord();
+    bool StopInputRecord(std::string &records);
  
     // callback
     bool SetSendAccessibilityEventToAACallback();
@@ -126,9 +137,12 @@ public:
     bool SetGetNotifyZoomGestureConflictCallback();
 private:
     void* GetFunc(const std::string& funcName);
+    // the entry point of a method, resolved on its first use, should be used in rwLock_
+    template<typename Func>
+    Func GetExtFunc(ExtMethod method, const char* funcName);
     void* handle_ = nullptr;
     ffrt::shared_mutex rwLock_;
-    std::set<ExtMethod> readyFunc_;
+    AccessibilityExtSymbolTable<EXT_METHOD_COUNT> extFuncs_;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -26,6 +26,13 @@ struct PointerPos {
     int32_t posY;
 };
 
+struct MagnificationRect {
+    int32_t posX;
+    int32_t posY;
+    int32_t width;
+    int32_t height;
+};
+
 enum class RotationType : uint32_t {
     LEFT_ROTATE = 0,
     RIGHT_ROTATE,
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MAGNIFICATION_FOCUS_FOLLOWER_H
+#define MAGNIFICATION_FOCUS_FOLLOWER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "accessibility_gesture_timer_wheel.h"
+#include "ffrt.h"
+#include "magnification_def.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct MagnificationFocusStatistics {
+    uint64_t focusCount = 0;
+    // focus targets replaced by a newer one before they were followed
+    uint64_t debouncedCount = 0;
+    // focus targets already inside the comfort margin of the magnified region
+    uint64_t insideMarginCount = 0;
+    uint64_t followCount = 0;
+    uint64_t frameCount = 0;
+};
+
+/**
+ * Moves the magnified region to the accessibility focus. The first focus after a quiet period is
+ * followed at once, a burst of focus changes is followed once it settles for DEBOUNCE_MS. A target
+ * inside the comfort margin of the magnified region is not followed, any other is reached by an ease
+ * out animation of at most MAX_ANIMATION_FRAMES frames paced by the gesture timer wheel.
+ */
+class MagnificationFocusFollower {
+public:
+    // get the source rect of the magnification, return false if it is not shown
+    using SourceRectGetter = std::function<bool(uint32_t magnificationType, MagnificationRect &rect)>;
+    using Mover = std::function<void(uint32_t magnificationType, int32_t centerX, int32_t centerY)>;
+
+    static constexpr int64_t DEBOUNCE_MS = 60;
+    static constexpr int64_t FRAME_INTERVAL_MS = 16;
+    static constexpr int32_t MAX_ANIMATION_FRAMES = 6;
+    // distance moved by one frame at least, short moves take fewer frames
+    static constexpr int32_t MIN_FRAME_STEP = 48;
+    // part of the source rect width and height kept as margin on every side
+    static constexpr float COMFORT_MARGIN_RATIO = 0.2f;
+
+    MagnificationFocusFollower(const std::shared_ptr<GestureTimerWheel> &wheel, SourceRectGetter sourceRectGetter,
+        Mover mover);
+    ~MagnificationFocusFollower();
+
+    void OnFocus(uint32_t magnificationType, int32_t centerX, int32_t centerY);
+
+    /**
+     * @brief Drop the pending focus and stop the animation, used when the user pans or the
+     *        magnification is disabled.
+     */
+    void Cancel();
+
+    bool IsAnimating();
+    // a focus is pending or the region is moving to it
+    bool IsFollowing() const;
+    MagnificationFocusStatistics GetStatistics();
+    void ResetStatistics();
+    void Dump(std::string &dumpInfo);
+
+private:
+    void Follow();
+    void OnFrame();
+
+    static bool IsInsideComfortMargin(const MagnificationRect &rect, int32_t posX, int32_t posY);
+    static int32_t GetFrameCount(int32_t deltaX, int32_t deltaY);
+    PointerPos GetFramePositionLocked() const;
+    void UpdateFollowingLocked();
+
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    SourceRectGetter sourceRectGetter_;
+    Mover mover_;
+    GestureTimerWheel::Timer debounceTimer_;
+    GestureTimerWheel::Timer frameTimer_;
+
+    ffrt::mutex mutex_;
+    bool hasTarget_ = false;
+    uint32_t targetType_ = 0;
+    PointerPos target_ = {0, 0};
+    bool hasLastFocus_ = false;
+    int64_t lastFocusTime_ = 0;
+
+    bool animating_ = false;
+    uint32_t animationType_ = 0;
+    PointerPos animationStart_ = {0, 0};
+    PointerPos animationEnd_ = {0, 0};
+    int32_t frameIndex_ = 0;
+    int32_t frameTotal_ = 0;
+
+    MagnificationFocusStatistics statistics_;
+    // hasTarget_ || animating_, read without the lock on every pan sample
+    std::atomic<bool> following_ {false};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // MAGNIFICATION_FOCUS_FOLLOWER_H
@@ -19,6 +19,8 @@
 #include "window_magnification_manager.h"
 #include "full_screen_magnification_manager.h"
 #include "magnification_menu_manager.h"
+#include "magnification_focus_follower.h"
+#include "magnification_update_scheduler.h"
 #include "common_event_subscriber.h"
 
 namespace OHOS {
@@ -67,6 +69,12 @@ public:
     std::shared_ptr<WindowMagnificationManager> GetWindowMagnificationManager();
     std::shared_ptr<FullScreenMagnificationManager> GetFullScreenMagnificationManager();
     std::shared_ptr<MagnificationMenuManager> GetMenuManager();
+    std::shared_ptr<MagnificationUpdateScheduler> GetUpdateScheduler();
+    // the update scheduler if it is created, nullptr otherwise
+    std::shared_ptr<MagnificationUpdateScheduler> FindUpdateScheduler();
+    std::shared_ptr<MagnificationFocusFollower> GetFocusFollower();
+    // the focus follower if it is created, nullptr otherwise
+    std::shared_ptr<MagnificationFocusFollower> FindFocusFollower();
     void OnMagnificationTypeChanged(uint32_t magnificationType);
     void OnModeChanged(uint32_t mode);
     void DisableMagnification();
@@ -82,11 +90,18 @@ public:
     }
     void OnReceiveEvent(const EventFwk::CommonEventData &data);
 private:
+    bool IsMagnificationWindowShow(uint32_t magnificationType);
+    void MoveToFocus(uint32_t magnificationType, int32_t centerX, int32_t centerY);
+
     static std::shared_ptr<MagnificationManager> instance_;
     static ffrt::mutex instanceMutex_;
     std::shared_ptr<WindowMagnificationManager> windowMagnificationManager_ = nullptr;
     std::shared_ptr<FullScreenMagnificationManager> fullScreenMagnificationManager_ = nullptr;
     std::shared_ptr<MagnificationMenuManager> menuManager_ = nullptr;
+    std::shared_ptr<MagnificationUpdateScheduler> updateScheduler_ = nullptr;
+    ffrt::mutex updateSchedulerMutex_;
+    std::shared_ptr<MagnificationFocusFollower> focusFollower_ = nullptr;
+    ffrt::mutex focusFollowerMutex_;
     uint32_t currentMode_ = 0;
     std::shared_ptr<SystemEventSubscriber> subscriber_ = nullptr;
 };
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MAGNIFICATION_UPDATE_SCHEDULER_H
+#define MAGNIFICATION_UPDATE_SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "accessibility_gesture_timer_wheel.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct MagnificationUpdate {
+    uint32_t magnificationType = 0;
+    bool hasScale = false;
+    // sum of the coalesced scale spans, each span is small against the screen span so the sum
+    // matches applying them one by one up to second order terms
+    float scaleSpan = 0.0f;
+    bool hasMove = false;
+    int32_t deltaX = 0;
+    int32_t deltaY = 0;
+    // time the first coalesced sample was posted, in milliseconds
+    int64_t postTime = 0;
+};
+
+struct MagnificationUpdateStatistics {
+    uint64_t postCount = 0;
+    uint64_t applyCount = 0;
+    uint64_t vsyncApplyCount = 0;
+    uint64_t timerApplyCount = 0;
+    // post to apply latency of the first sample of every applied update
+    int64_t totalLatencyMs = 0;
+    int64_t maxLatencyMs = 0;
+};
+
+/**
+ * Coalesces the pan and zoom samples of the magnification gestures, so the magnification window is
+ * updated at most once per display frame. Samples posted between two frames are summed and applied
+ * on the next vsync. If no vsync source is available, or the requested vsync does not arrive in
+ * time, a timer on the gesture timer wheel applies them instead. Scale is applied before move.
+ */
+class MagnificationUpdateScheduler {
+public:
+    using Applier = std::function<void(const MagnificationUpdate &update)>;
+    // request one call of the callback on the next vsync, return false if there is no vsync source
+    using VsyncRequester = std::function<bool(const std::function<void()> &callback)>;
+
+    static constexpr int64_t FRAME_INTERVAL_MS = 16;
+    static constexpr int64_t VSYNC_TIMEOUT_MS = 2 * FRAME_INTERVAL_MS;
+
+    MagnificationUpdateScheduler(const std::shared_ptr<GestureTimerWheel> &wheel, Applier applier,
+        VsyncRequester vsyncRequester);
+    ~MagnificationUpdateScheduler();
+
+    void PostScale(uint32_t magnificationType, float scaleSpan);
+    void PostMove(uint32_t magnificationType, int32_t deltaX, int32_t deltaY);
+
+    /**
+     * @brief Apply the pending update now, before an operation which depends on the window state.
+     */
+    void Flush();
+
+    /**
+     * @brief Drop the pending update, used when the magnification is disabled.
+     */
+    void Clear();
+
+    bool IsMovePending();
+    MagnificationUpdateStatistics GetStatistics();
+    void ResetStatistics();
+    void Dump(std::string &dumpInfo);
+
+private:
+    enum class ApplyReason : int32_t {
+        FLUSH = 0,
+        VSYNC,
+        TIMER,
+    };
+
+    // returns false if a pending update of another type has to be flushed first
+    bool PrepareLocked(uint32_t magnificationType);
+    void ScheduleLocked();
+    void ApplyPending(ApplyReason reason);
+
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    Applier applier_;
+    VsyncRequester vsyncRequester_;
+    GestureTimerWheel::Timer fallbackTimer_;
+
+    ffrt::mutex mutex_;
+    bool hasPending_ = false;
+    bool frameRequested_ = false;
+    MagnificationUpdate pending_;
+    MagnificationUpdateStatistics statistics_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // MAGNIFICATION_UPDATE_SCHEDULER_H
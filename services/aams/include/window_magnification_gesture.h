@@ -92,6 +92,12 @@ public:
     ~WindowMagnificationGesture() = default;
 
     bool OnPointerEvent(MMI::PointerEvent &event) override;
+
+    TransmissionType GetTransmissionType() const override
+    {
+        return TransmissionType::TRANSMISSION_WINDOW_MAGNIFICATION_GESTURE;
+    }
+
     void DestroyEvents() override;
 
     void CancelPostEvent(MagnificationGestureMsg msg);
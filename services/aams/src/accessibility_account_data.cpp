@@ -36,6 +36,7 @@
 #include "accessibility_notification_helper.h"
 #include "accessibility_short_key_dialog.h"
 #include "nlohmann/json.hpp"
+#include "parameters.h"
 #include "accesstoken_kit.h"
 
 using namespace OHOS::Security::AccessToken;
@@ -48,6 +49,10 @@ namespace {
     constexpr int32_t INIT_DATASHARE_HELPER_SLEEP_TIME = 500;
     constexpr int DEFAULT_ACCOUNT_ID = 100;
     constexpr int SHORT_KEY_TIMEOUT_BEFORE_USE = 3000; // ms
+    const std::string INSTALLED_ABILITY_INDEX_PATH =
+        "/data/service/el1/public/barrierfree/accessibility_ability_manager_service/installed_abilities_";
+    const std::string INSTALLED_ABILITY_INDEX_SUFFIX = ".json";
+    const std::string SOFTWARE_VERSION = "const.product.software.version";
     const std::string HIGH_TEXT_CONTRAST_ENABLED = "high_text_contrast_enabled";
     const std::string ACCESSIBILITY_DISPLAY_INVERSION_ENABLED = "accessibility_display_inversion_enabled";
     const std::string ACCESSIBILITY_DISPLAY_DALTONIZER_ENABLED = "accessibility_display_daltonizer_enabled";
@@ -93,6 +98,30 @@ namespace {
 
     // Feature flag for screen touch.
     static constexpr uint32_t FEATURE_SCREEN_TOUCH = 0x00000080;
+
+    std::string GetInstalledAbilityIndexPath(int32_t accountId)
+    {
+        return INSTALLED_ABILITY_INDEX_PATH + std::to_string(accountId) + INSTALLED_ABILITY_INDEX_SUFFIX;
+    }
+
+    AccessibilityInstalledAbilityIndex::FullQuery CreateInstalledAbilityQuery(int32_t accountId)
+    {
+        return [accountId](std::vector<AccessibilityAbilityInitParams> &abilities) {
+            std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
+            // a failed query must not be written to the index as an empty list of abilities
+            if (!Singleton<AccessibilityResourceBundleManager>::GetInstance().QueryExtensionAbilityInfos(
+                AppExecFwk::ExtensionAbilityType::ACCESSIBILITY, accountId, extensionInfos)) {
+                return false;
+            }
+            HILOG_DEBUG("query extensionAbilityInfos' size is %{public}zu.", extensionInfos.size());
+            for (auto& info : extensionInfos) {
+                AccessibilityAbilityInitParams initParams;
+                Utils::Parse(info, initParams);
+                abilities.push_back(initParams);
+            }
+            return true;
+        };
+    }
 } // namespace
 
 AccessibilityAccountData::AccessibilityAccountData(int32_t accountId)
@@ -101,6 +130,8 @@ AccessibilityAccountData::AccessibilityAccountData(int32_t accountId)
     elementOperatorManager_.SetAccountData(accountId, this);
     windowManager_.SetAccountData(accountId, this);
     accessibleAbilityManager_.SetAccountData(accountId, this);
+    installedAbilityIndex_ = std::make_shared<AccessibilityInstalledAbilityIndex>(
+        GetInstalledAbilityIndexPath(accountId), system::GetParameter(SOFTWARE_VERSION, ""));
 }
 
 AccessibilityAccountData::~AccessibilityAccountData()
@@ -758,20 +789,39 @@ bool AccessibilityAccountData::GetInstalledAbilitiesFromBMS()
 #ifdef OHOS_BUILD_ENABLE_HITRACE
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "QueryInstalledAbilityInfo");
 #endif // OHOS_BUILD_ENABLE_HITRACE
-    std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
-    Singleton<AccessibilityResourceBundleManager>::GetInstance().QueryExtensionAbilityInfos(
-        AppExecFwk::ExtensionAbilityType::ACCESSIBILITY, id_, extensionInfos);
-    HILOG_DEBUG("query extensionAbilityInfos' size is %{public}zu.", extensionInfos.size());
-    for (auto& info : extensionInfos) {
-        AccessibilityAbilityInitParams initParams;
-        Utils::Parse(info, initParams);
-        std::shared_ptr<AccessibilityAbilityInfo> accessibilityInfo =
-            std::make_shared<AccessibilityAbilityInfo>(initParams);
-        AddInstalledAbility(*accessibilityInfo);
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    if (!installedAbilityIndex_ || !installedAbilityIndex_->Load(CreateInstalledAbilityQuery(id_), abilities)) {
+        return false;
+    }
+    for (auto& initParams : abilities) {
+        AccessibilityAbilityInfo accessibilityInfo(initParams);
+        AddInstalledAbility(accessibilityInfo);
     }
     return true;
 }
 
+bool AccessibilityAccountData::RevalidateInstalledAbilities(
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> &changes)
+{
+    HILOG_DEBUG();
+    if (!installedAbilityIndex_) {
+        return false;
+    }
+    return installedAbilityIndex_->Revalidate(CreateInstalledAbilityQuery(id_), changes);
+}
+
+void AccessibilityAccountData::RemoveInstalledAbilityIndex()
+{
+    if (installedAbilityIndex_) {
+        installedAbilityIndex_->Clear();
+    }
+}
+
+void AccessibilityAccountData::RemoveInstalledAbilityIndexFile(int32_t accountId)
+{
+    AccessibilityInstalledAbilityIndex::RemoveFile(GetInstalledAbilityIndexPath(accountId));
+}
+
 void AccessibilityAccountData::InitScreenReaderStateObserver()
 {
     if (!config_) {
@@ -992,6 +1042,9 @@ void AccessibilityAccountData::UpdateAbilities(std::string callerBundleName)
 bool AccessibilityAccountData::RemoveAbility(const std::string &bundleName)
 {
     HILOG_DEBUG("bundleName(%{public}s)", bundleName.c_str());
+    if (installedAbilityIndex_) {
+        installedAbilityIndex_->RemoveBundle(bundleName);
+    }
     bool result = accessibleAbilityManager_.RemoveAbility(bundleName);
     if (result) {
         UpdateAbilities();
@@ -1005,19 +1058,29 @@ void AccessibilityAccountData::AddAbility(const std::string &bundleName)
     HILOG_DEBUG("bundleName(%{public}s)", bundleName.c_str());
 
     std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
-    Singleton<AccessibilityResourceBundleManager>::GetInstance().QueryExtensionAbilityInfos(
-        AppExecFwk::ExtensionAbilityType::ACCESSIBILITY, id_, extensionInfos);
+    // a failed query says nothing about the bundle, neither the index nor the installed abilities may drop it
+    if (!Singleton<AccessibilityResourceBundleManager>::GetInstance().QueryExtensionAbilityInfos(
+        AppExecFwk::ExtensionAbilityType::ACCESSIBILITY, id_, extensionInfos)) {
+        HILOG_ERROR("query extensionAbilityInfos failed, bundle %{public}s is not updated", bundleName.c_str());
+        return;
+    }
     HILOG_DEBUG("query extensionAbilityInfos' size is %{public}zu.", extensionInfos.size());
     
+    std::vector<AccessibilityAbilityInitParams> bundleAbilities;
     std::vector<AccessibilityAbilityInfo> accessibilityInfos;
     for (auto &newAbility : extensionInfos) {
         if (newAbility.bundleName == bundleName) {
             HILOG_DEBUG("The package%{public}s added", (bundleName + "/" + newAbility.name).c_str());
             AccessibilityAbilityInitParams initParams;
             Utils::Parse(newAbility, initParams);
+            bundleAbilities.push_back(initParams);
             accessibilityInfos.emplace_back(initParams);
         }
     }
+    // a changed package comes here too, an empty list drops the abilities it no longer has
+    if (installedAbilityIndex_) {
+        installedAbilityIndex_->UpdateBundle(bundleName, bundleAbilities);
+    }
 
     if (!accessibilityInfos.empty()) {
         accessibleAbilityManager_.AddAbility(bundleName, accessibilityInfos);
@@ -1118,52 +1181,50 @@ void AccessibilityAccountData::OnSingleClickModeChanged()
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::AddAccountData(
     int32_t accountId)
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
+    bool inserted = false;
+    sptr<AccessibilityAccountData> accountData = accountDataTable_.FindOrInsert(accountId,
+        [accountId]() -> sptr<AccessibilityAccountData> {
+            sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
+            if (accountData == nullptr) {
+                HILOG_ERROR("accountData is null");
+                return nullptr;
+            }
+            // 0 for system service
+            if (accountId != 0) {
+                accountData->Init();
+            }
+            return accountData;
+        }, inserted);
+    if (accountData != nullptr && !inserted) {
         HILOG_WARN("accountId is existed");
-        return iter->second;
-    }
-
-    sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
-    if (accountData == nullptr) {
-        HILOG_ERROR("accountData is null");
-        return nullptr;
     }
-    // 0 for system service
-    if (accountId != 0) {
-        accountData->Init();
-    }
-    accountDataMap_[accountId] = accountData;
     return accountData;
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::GetCurrentAccountData(
     int32_t accountId)
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        return iter->second;
-    }
-
-    sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
-    if (!accountData) {
-        HILOG_ERROR("accountData is null");
-        return nullptr;
+    sptr<AccessibilityAccountData> accountData = nullptr;
+    if (accountDataTable_.Find(accountId, accountData)) {
+        return accountData;
     }
 
-    accountDataMap_[accountId] = accountData;
-    return accountData;
+    bool inserted = false;
+    return accountDataTable_.FindOrInsert(accountId, [accountId]() -> sptr<AccessibilityAccountData> {
+        sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
+        if (!accountData) {
+            HILOG_ERROR("accountData is null");
+        }
+        return accountData;
+    }, inserted);
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::GetAccountData(
     int32_t accountId)
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        return iter->second;
+    sptr<AccessibilityAccountData> accountData = nullptr;
+    if (accountDataTable_.Find(accountId, accountData)) {
+        return accountData;
     }
 
     HILOG_DEBUG("accountId is not existed");
@@ -1174,30 +1235,18 @@ sptr<AccessibilityAccountData> AccessibilityAccountDataMap::RemoveAccountData(
     int32_t accountId)
 {
     sptr<AccessibilityAccountData> accountData = nullptr;
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        accountData = iter->second;
-        accountDataMap_.erase(iter);
-    }
-
+    accountDataTable_.Erase(accountId, accountData);
     return accountData;
 }
 
 std::vector<int32_t> AccessibilityAccountDataMap::GetAllAccountIds()
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    std::vector<int32_t> accountIds;
-    for (auto it = accountDataMap_.begin(); it != accountDataMap_.end(); it++) {
-        accountIds.push_back(it->first);
-    }
-    return accountIds;
+    return accountDataTable_.GetKeys();
 }
 
 void AccessibilityAccountDataMap::Clear()
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    accountDataMap_.clear();
+    accountDataTable_.Clear();
 }
 
 // LCOV_EXCL_START
@@ -1334,6 +1383,13 @@ void AccountSubscriber::OnStateChanged(const AccountSA::OsAccountStateData &data
             }
         }
     }
+    if (data.state == AccountSA::OsAccountState::SWITCHED) {
+        // the switched common event comes later, do not resolve displays to the old user meanwhile
+        auto displayUserCache = Singleton<AccessibleAbilityManagerService>::GetInstance().GetDisplayUserCache();
+        if (displayUserCache != nullptr) {
+            displayUserCache->Invalidate();
+        }
+    }
 }
 
 RetError AccessibilityAccountData::RegisterStateObserver(
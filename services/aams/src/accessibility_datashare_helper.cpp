@@ -313,16 +313,30 @@ RetError AccessibilityDatashareHelper::RegisterObserver(const std::string& key,
     if (observer == nullptr) {
         return RET_ERR_NULLPTR;
     }
-    auto iter = settingObserverMap_.find(key);
-    if (iter != settingObserverMap_.end() && iter->second != nullptr) {
-        HILOG_INFO("observer of key = %{public}s already exist", key.c_str());
-        return RET_OK;
+    {
+        std::lock_guard<ffrt::mutex> lock(observerMutex_);
+        auto iter = settingObserverMap_.find(key);
+        if (iter != settingObserverMap_.end() && iter->second != nullptr) {
+            HILOG_INFO("observer of key = %{public}s already exist", key.c_str());
+            return RET_OK;
+        }
     }
     if (RegisterObserver(observer) != ERR_OK) {
         return RET_ERR_NULLPTR;
     }
-    std::lock_guard<ffrt::mutex> lock(observerMutex_);
-    settingObserverMap_.insert(std::make_pair(key, observer));
+    bool inserted = false;
+    {
+        // the observers register from concurrent tasks, the first one of a key is kept
+        std::lock_guard<ffrt::mutex> lock(observerMutex_);
+        auto iter = settingObserverMap_.find(key);
+        if (iter == settingObserverMap_.end() || iter->second == nullptr) {
+            settingObserverMap_[key] = observer;
+            inserted = true;
+        }
+    }
+    if (!inserted) {
+        UnregisterObserver(observer);
+    }
     return RET_OK;
 }
 
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_display_user_cache.h"
+
+#include <cinttypes>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityDisplayUserCache::AccessibilityDisplayUserCache(Resolver resolver, Clock clock)
+    : resolver_(std::move(resolver)), clock_(std::move(clock))
+{
+    for (auto &entry : entries_) {
+        entry.store(EMPTY_ENTRY, std::memory_order_relaxed);
+    }
+    if (clock_) {
+        lastCheckTime_.store(clock_(), std::memory_order_relaxed);
+    }
+}
+
+bool AccessibilityDisplayUserCache::GetUserId(uint64_t displayId, int32_t &userId)
+{
+    int32_t cachedUserId = -1;
+    bool isCached = FindUser(displayId, cachedUserId);
+    if (isCached && !IsCheckDue()) {
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        userId = cachedUserId;
+        return true;
+    }
+
+    uint64_t generation = generation_.load(std::memory_order_acquire);
+    int32_t resolvedUserId = -1;
+    if (!resolver_ || !resolver_(displayId, resolvedUserId)) {
+        if (!isCached) {
+            return false;
+        }
+        // the account service is not reachable, the cached user is the best answer there is
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        userId = cachedUserId;
+        return true;
+    }
+
+    if (isCached) {
+        checkCount_.fetch_add(1, std::memory_order_relaxed);
+        if (resolvedUserId != cachedUserId) {
+            mismatchCount_.fetch_add(1, std::memory_order_relaxed);
+            HILOG_WARN("display %{public}" PRIu64 " user changed from %{public}d to %{public}d without event",
+                displayId, cachedUserId, resolvedUserId);
+        }
+    } else {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (generation_.load(std::memory_order_relaxed) == generation) {
+            StoreLocked(displayId, resolvedUserId);
+        }
+    }
+    userId = resolvedUserId;
+    return true;
+}
+
+bool AccessibilityDisplayUserCache::IsForegroundUser(int32_t userId)
+{
+    if (userId < 0) {
+        return false;
+    }
+    for (const auto &entry : entries_) {
+        uint64_t value = entry.load(std::memory_order_acquire);
+        if (value != EMPTY_ENTRY && static_cast<int32_t>(static_cast<uint32_t>(value)) == userId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AccessibilityDisplayUserCache::SetUserId(uint64_t displayId, int32_t userId)
+{
+    HILOG_INFO("display %{public}" PRIu64 " user %{public}d", displayId, userId);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
+    StoreLocked(displayId, userId);
+}
+
+void AccessibilityDisplayUserCache::RemoveUser(int32_t userId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
+    for (auto &entry : entries_) {
+        uint64_t value = entry.load(std::memory_order_relaxed);
+        if (value != EMPTY_ENTRY && static_cast<int32_t>(static_cast<uint32_t>(value)) == userId) {
+            entry.store(EMPTY_ENTRY, std::memory_order_release);
+        }
+    }
+}
+
+void AccessibilityDisplayUserCache::Invalidate()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
+    for (auto &entry : entries_) {
+        entry.store(EMPTY_ENTRY, std::memory_order_release);
+    }
+}
+
+DisplayUserCacheStatistics AccessibilityDisplayUserCache::GetStatistics() const
+{
+    DisplayUserCacheStatistics statistics;
+    statistics.hitCount = hitCount_.load(std::memory_order_relaxed);
+    statistics.missCount = missCount_.load(std::memory_order_relaxed);
+    statistics.checkCount = checkCount_.load(std::memory_order_relaxed);
+    statistics.mismatchCount = mismatchCount_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void AccessibilityDisplayUserCache::ResetStatistics()
+{
+    hitCount_.store(0, std::memory_order_relaxed);
+    missCount_.store(0, std::memory_order_relaxed);
+    checkCount_.store(0, std::memory_order_relaxed);
+    mismatchCount_.store(0, std::memory_order_relaxed);
+}
+
+void AccessibilityDisplayUserCache::Dump(std::string &dumpInfo) const
+{
+    DisplayUserCacheStatistics statistics = GetStatistics();
+    dumpInfo.append("display user cache: account calls avoided=").append(std::to_string(statistics.hitCount))
+        .append(" misses=").append(std::to_string(statistics.missCount))
+        .append(" checks=").append(std::to_string(statistics.checkCount))
+        .append(" mismatches=").append(std::to_string(statistics.mismatchCount))
+        .append("\n");
+}
+
+bool AccessibilityDisplayUserCache::IsCacheable(uint64_t displayId, int32_t userId)
+{
+    // the display id takes the high half of the entry, the all ones entry means empty
+    return displayId < (static_cast<uint64_t>(1) << ID_BITS) - 1 && userId >= 0;
+}
+
+uint64_t AccessibilityDisplayUserCache::MakeEntry(uint64_t displayId, int32_t userId)
+{
+    return (displayId << ID_BITS) | static_cast<uint32_t>(userId);
+}
+
+bool AccessibilityDisplayUserCache::FindUser(uint64_t displayId, int32_t &userId) const
+{
+    for (const auto &entry : entries_) {
+        uint64_t value = entry.load(std::memory_order_acquire);
+        if (value != EMPTY_ENTRY && (value >> ID_BITS) == displayId) {
+            userId = static_cast<int32_t>(static_cast<uint32_t>(value));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AccessibilityDisplayUserCache::IsCheckDue()
+{
+    if (!clock_) {
+        return false;
+    }
+    int64_t now = clock_();
+    int64_t lastCheckTime = lastCheckTime_.load(std::memory_order_relaxed);
+    if (now - lastCheckTime < CHECK_INTERVAL_MS) {
+        return false;
+    }
+    // only the lookup which moves the check time does the check
+    return lastCheckTime_.compare_exchange_strong(lastCheckTime, now, std::memory_order_relaxed);
+}
+
+void AccessibilityDisplayUserCache::StoreLocked(uint64_t displayId, int32_t userId)
+{
+    if (!IsCacheable(displayId, userId)) {
+        return;
+    }
+    std::atomic<uint64_t> *target = nullptr;
+    for (auto &entry : entries_) {
+        uint64_t value = entry.load(std::memory_order_relaxed);
+        if (value != EMPTY_ENTRY && (value >> ID_BITS) == displayId) {
+            target = &entry;
+            break;
+        }
+        if (value == EMPTY_ENTRY && target == nullptr) {
+            target = &entry;
+        }
+    }
+    if (target == nullptr) {
+        // more displays than slots, the evicted display is resolved again on its next lookup
+        target = &entries_[displayId % CAPACITY];
+    }
+    target->store(MakeEntry(displayId, userId), std::memory_order_release);
+}
+} // namespace Accessibility
+} // namespace OHOS
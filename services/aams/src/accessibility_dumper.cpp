@@ -19,11 +19,14 @@
 #include <csignal>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <sstream>
 
 #include "accessibility_account_data.h"
+#include "accessibility_runtime_counters.h"
 #include "accessibility_window_manager.h"
 #include "accessible_ability_manager_service.h"
+#include "accessible_extend_manager_service_proxy.h"
 #include "hilog_wrapper.h"
 #include "string_ex.h"
 #include "unique_fd.h"
@@ -35,6 +38,14 @@ const std::string ARG_DUMP_HELP = "-h";
 const std::string ARG_DUMP_USER = "-u";
 const std::string ARG_DUMP_CLIENT = "-c";
 const std::string ARG_DUMP_ACCESSIBILITY_WINDOW = "-w";
+const std::string ARG_DUMP_INPUT_STATISTICS = "-i";
+const std::string ARG_RESET_INPUT_STATISTICS = "-r";
+const std::string ARG_START_INPUT_RECORD = "-p";
+const std::string ARG_STOP_INPUT_RECORD = "-e";
+const std::string ARG_DUMP_RUNTIME_COUNTERS = "-m";
+const std::string ARG_DELTA = "-d";
+const std::string ARG_DUMP_DISPLAY_USER_CACHE = "-k";
+const std::string DISPLAY_USER_CACHE_NAME = "displayUser";
 
 // Helper: dump capabilities and various settings from AccessibilitySettingsConfig
 void AppendCapabilitiesAndSettings(std::ostringstream& oss, const AccessibilitySettingsConfig& config)
@@ -291,6 +302,10 @@ int AccessibilityDumper::DumpAccessibilityClientInfo(std::string& dumpInfo) cons
 int AccessibilityDumper::DumpAccessibilityUserInfo(std::string& dumpInfo) const
 {
     HILOG_INFO();
+    auto startupGraph = Singleton<AccessibleAbilityManagerService>::GetInstance().GetStartupGraph();
+    if (startupGraph != nullptr) {
+        startupGraph->Dump(dumpInfo);
+    }
     sptr<AccessibilityAccountData> currentAccount =
         Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
     if (!currentAccount) {
@@ -312,6 +327,79 @@ int AccessibilityDumper::DumpAccessibilityUserInfo(std::string& dumpInfo) const
     return 0;
 }
 
+int AccessibilityDumper::DumpInputStatistics(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    if (!Singleton<ExtendManagerServiceProxy>::GetInstance().DumpInputStatistics(dumpInfo)) {
+        dumpInfo.append("input statistics are unavailable, no input filter is enabled");
+        return -1;
+    }
+    return 0;
+}
+
+int AccessibilityDumper::ResetInputStatistics(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    if (!Singleton<ExtendManagerServiceProxy>::GetInstance().ResetInputStatistics()) {
+        dumpInfo.append("input statistics are unavailable, no input filter is enabled");
+        return -1;
+    }
+    dumpInfo.append("input statistics reset");
+    return 0;
+}
+
+int AccessibilityDumper::StartInputRecord(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    if (!Singleton<ExtendManagerServiceProxy>::GetInstance().StartInputRecord()) {
+        dumpInfo.append("input record is unavailable, it needs an enabled input filter on a debuggable build with "
+            "debug.accessibility.input_record set to true");
+        return -1;
+    }
+    dumpInfo.append("input record started");
+    return 0;
+}
+
+int AccessibilityDumper::StopInputRecord(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    if (!Singleton<ExtendManagerServiceProxy>::GetInstance().StopInputRecord(dumpInfo)) {
+        dumpInfo.append("input record is unavailable, no input filter is enabled");
+        return -1;
+    }
+    return 0;
+}
+
+int AccessibilityDumper::DumpRuntimeCounters(const std::vector<std::string>& args, std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    bool isDelta = args.size() > 1 && args[1] == ARG_DELTA;
+    AccessibilityRuntimeCounters &counters = Singleton<AccessibilityRuntimeCounters>::GetInstance();
+    auto snapshot = std::make_unique<AccessibilityRuntimeCounters::Snapshot>();
+    counters.GetSnapshot(*snapshot);
+    AccessibleAbilityManagerService &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
+    aams.GetRunnerQueueDepths(snapshot->queueDepths);
+    auto displayUserCache = aams.GetDisplayUserCache();
+    if (displayUserCache != nullptr) {
+        DisplayUserCacheStatistics statistics = displayUserCache->GetStatistics();
+        snapshot->caches[DISPLAY_USER_CACHE_NAME] = {statistics.hitCount, statistics.missCount};
+    }
+    counters.Dump(*snapshot, isDelta, dumpInfo);
+    return 0;
+}
+
+int AccessibilityDumper::DumpDisplayUserCache(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    auto displayUserCache = Singleton<AccessibleAbilityManagerService>::GetInstance().GetDisplayUserCache();
+    if (displayUserCache == nullptr) {
+        dumpInfo.append("display user cache is unavailable");
+        return -1;
+    }
+    displayUserCache->Dump(dumpInfo);
+    return 0;
+}
+
 int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& args, std::string& dumpInfo) const
 {
     if (args.empty()) {
@@ -324,6 +412,18 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         dumpType = DumpType::DUMP_CLIENT;
     } else if (args[0] == ARG_DUMP_ACCESSIBILITY_WINDOW) {
         dumpType = DumpType::DUMP_ACCESSIBILITY_WINDOW;
+    } else if (args[0] == ARG_DUMP_INPUT_STATISTICS) {
+        dumpType = DumpType::DUMP_INPUT_STATISTICS;
+    } else if (args[0] == ARG_RESET_INPUT_STATISTICS) {
+        dumpType = DumpType::RESET_INPUT_STATISTICS;
+    } else if (args[0] == ARG_START_INPUT_RECORD) {
+        dumpType = DumpType::START_INPUT_RECORD;
+    } else if (args[0] == ARG_STOP_INPUT_RECORD) {
+        dumpType = DumpType::STOP_INPUT_RECORD;
+    } else if (args[0] == ARG_DUMP_RUNTIME_COUNTERS) {
+        dumpType = DumpType::DUMP_RUNTIME_COUNTERS;
+    } else if (args[0] == ARG_DUMP_DISPLAY_USER_CACHE) {
+        dumpType = DumpType::DUMP_DISPLAY_USER_CACHE;
     }
     int ret = 0;
     switch (dumpType) {
@@ -336,6 +436,24 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         case DumpType::DUMP_ACCESSIBILITY_WINDOW:
             ret = DumpAccessibilityWindowInfo(dumpInfo);
             break;
+        case DumpType::DUMP_INPUT_STATISTICS:
+            ret = DumpInputStatistics(dumpInfo);
+            break;
+        case DumpType::RESET_INPUT_STATISTICS:
+            ret = ResetInputStatistics(dumpInfo);
+            break;
+        case DumpType::START_INPUT_RECORD:
+            ret = StartInputRecord(dumpInfo);
+            break;
+        case DumpType::STOP_INPUT_RECORD:
+            ret = StopInputRecord(dumpInfo);
+            break;
+        case DumpType::DUMP_RUNTIME_COUNTERS:
+            ret = DumpRuntimeCounters(args, dumpInfo);
+            break;
+        case DumpType::DUMP_DISPLAY_USER_CACHE:
+            ret = DumpDisplayUserCache(dumpInfo);
+            break;
         default:
             ret = -1;
             break;
@@ -358,7 +476,21 @@ void AccessibilityDumper::ShowHelpInfo(std::string& dumpInfo) const
         .append(" -c                    ")
         .append("|dump accessibility client in the system\n")
         .append(" -w                    ")
-        .append("|dump accessibility window info in the system\n");
+        .append("|dump accessibility window info in the system\n")
+        .append(" -i                    ")
+        .append("|dump accessibility input filter and magnification render statistics\n")
+        .append(" -r                    ")
+        .append("|reset accessibility input filter and magnification render statistics\n")
+        .append(" -p                    ")
+        .append("|start recording the pointer events entering the input filters\n")
+        .append(" -e                    ")
+        .append("|stop recording and dump the recorded input events\n")
+        .append(" -m                    ")
+        .append("|dump accessibility runtime counters, one \"name{labels} value\" line each\n")
+        .append(" -m -d                 ")
+        .append("|dump the change of accessibility runtime counters since the last -m\n")
+        .append(" -k                    ")
+        .append("|dump the statistics of the display user cache\n");
 }
 } // namespace Accessibility
 } // OHOS
\ No newline at end of file
@@ -487,10 +487,9 @@ void ElementOperatorManager::OnFocusedEvent(const AccessibilityEventInfo &eventI
     int32_t centerY = static_cast<int32_t>((rect.GetLeftTopYScreenPostion() +
         rect.GetRightBottomYScreenPostion()) / static_cast<float>(DIVISOR_TWO));
  
+    // the magnification is on so the ext is loaded, reloading it would take the proxy lock for every focus
     if (Singleton<ExtendManagerServiceProxy>::GetInstance().CheckExtProxyStatus()) {
-        if (Singleton<ExtendManagerServiceProxy>::GetInstance().LoadExtProxy()) {
-            Singleton<ExtendManagerServiceProxy>::GetInstance().FollowFocuseElement(centerX, centerY);
-        }
+        Singleton<ExtendManagerServiceProxy>::GetInstance().FollowFocuseElement(centerX, centerY);
     }
 }
 
@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_installed_ability_index.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "hilog_wrapper.h"
+#include "nlohmann/json.hpp"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    const std::string KEY_VERSION = "version";
+    const std::string KEY_FINGERPRINT = "fingerprint";
+    const std::string KEY_ABILITIES = "abilities";
+    const std::string KEY_BUNDLE_NAME = "bundleName";
+    const std::string KEY_DESCRIPTION = "description";
+    const std::string KEY_MODULE_NAME = "moduleName";
+    const std::string KEY_NAME = "name";
+    const std::string KEY_RATIONALE = "rationale";
+    const std::string KEY_SETTINGS_ABILITY = "settingsAbility";
+    const std::string KEY_LABEL = "label";
+    const std::string KEY_STATIC_CAPABILITIES = "staticCapabilities";
+    const std::string KEY_ABILITY_TYPES = "abilityTypes";
+    const std::string KEY_IS_IMPORTANT = "isImportant";
+    const std::string KEY_NEED_HIDE = "needHide";
+    const std::string KEY_EVENT_CONFIGURE = "eventConfigure";
+    const std::string KEY_READABLE_RULES = "readableRules";
+    const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+    bool GetString(const nlohmann::json &json, const std::string &key, std::string &value)
+    {
+        if (!json.contains(key) || !json[key].is_string()) {
+            return false;
+        }
+        value = json[key].get<std::string>();
+        return true;
+    }
+
+    bool GetUint32(const nlohmann::json &json, const std::string &key, uint32_t &value)
+    {
+        if (!json.contains(key) || !json[key].is_number_unsigned()) {
+            return false;
+        }
+        value = json[key].get<uint32_t>();
+        return true;
+    }
+
+    bool GetBool(const nlohmann::json &json, const std::string &key, bool &value)
+    {
+        if (!json.contains(key) || !json[key].is_boolean()) {
+            return false;
+        }
+        value = json[key].get<bool>();
+        return true;
+    }
+
+    bool GetStringVec(const nlohmann::json &json, const std::string &key, std::vector<std::string> &value)
+    {
+        if (!json.contains(key) || !json[key].is_array()) {
+            return false;
+        }
+        value.clear();
+        for (const auto &item : json[key]) {
+            if (!item.is_string()) {
+                return false;
+            }
+            value.push_back(item.get<std::string>());
+        }
+        return true;
+    }
+
+    nlohmann::json ToJson(const AccessibilityAbilityInitParams &ability)
+    {
+        nlohmann::json json;
+        json[KEY_BUNDLE_NAME] = ability.bundleName;
+        json[KEY_DESCRIPTION] = ability.description;
+        json[KEY_MODULE_NAME] = ability.moduleName;
+        json[KEY_NAME] = ability.name;
+        json[KEY_RATIONALE] = ability.rationale;
+        json[KEY_SETTINGS_ABILITY] = ability.settingsAbility;
+        json[KEY_LABEL] = ability.label;
+        json[KEY_STATIC_CAPABILITIES] = ability.staticCapabilities;
+        json[KEY_ABILITY_TYPES] = ability.abilityTypes;
+        json[KEY_IS_IMPORTANT] = ability.isImportant;
+        json[KEY_NEED_HIDE] = ability.needHide;
+        json[KEY_EVENT_CONFIGURE] = ability.eventConfigure;
+        json[KEY_READABLE_RULES] = ability.readableRules;
+        return json;
+    }
+
+    bool FromJson(const nlohmann::json &json, AccessibilityAbilityInitParams &ability)
+    {
+        return json.is_object() && GetString(json, KEY_BUNDLE_NAME, ability.bundleName) &&
+            GetString(json, KEY_DESCRIPTION, ability.description) &&
+            GetString(json, KEY_MODULE_NAME, ability.moduleName) && GetString(json, KEY_NAME, ability.name) &&
+            GetString(json, KEY_RATIONALE, ability.rationale) &&
+            GetString(json, KEY_SETTINGS_ABILITY, ability.settingsAbility) &&
+            GetString(json, KEY_LABEL, ability.label) &&
+            GetUint32(json, KEY_STATIC_CAPABILITIES, ability.staticCapabilities) &&
+            GetUint32(json, KEY_ABILITY_TYPES, ability.abilityTypes) &&
+            GetBool(json, KEY_IS_IMPORTANT, ability.isImportant) && GetBool(json, KEY_NEED_HIDE, ability.needHide) &&
+            GetStringVec(json, KEY_EVENT_CONFIGURE, ability.eventConfigure) &&
+            GetString(json, KEY_READABLE_RULES, ability.readableRules);
+    }
+
+    bool IsSameAbilities(const std::vector<AccessibilityAbilityInitParams> &left,
+        const std::vector<AccessibilityAbilityInitParams> &right)
+    {
+        if (left.size() != right.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < left.size(); i++) {
+            if (ToJson(left[i]) != ToJson(right[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+AccessibilityInstalledAbilityIndex::AccessibilityInstalledAbilityIndex(const std::string &filePath,
+    const std::string &fingerprint) : filePath_(filePath), fingerprint_(fingerprint)
+{
+}
+
+bool AccessibilityInstalledAbilityIndex::Load(const FullQuery &query,
+    std::vector<AccessibilityAbilityInitParams> &abilities)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (isLoaded_ || ReadFile()) {
+        isLoadedFromFile_ = true;
+        CollectAbilities(abilities);
+        HILOG_INFO("installed abilities read from the index, size is %{public}zu", abilities.size());
+        return true;
+    }
+
+    isLoadedFromFile_ = false;
+    std::vector<AccessibilityAbilityInitParams> queried;
+    if (!query || !query(queried)) {
+        HILOG_ERROR("query installed abilities failed");
+        return false;
+    }
+    bundles_.clear();
+    for (auto &ability : queried) {
+        bundles_[ability.bundleName].push_back(std::move(ability));
+    }
+    isLoaded_ = true;
+    WriteFile();
+    CollectAbilities(abilities);
+    return true;
+}
+
+bool AccessibilityInstalledAbilityIndex::Revalidate(const FullQuery &query,
+    std::map<std::string, BundleChange> &changes)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!isLoadedFromFile_) {
+        return false;
+    }
+    std::vector<AccessibilityAbilityInitParams> queried;
+    if (!query || !query(queried)) {
+        HILOG_ERROR("query installed abilities failed, the index is not revalidated");
+        return false;
+    }
+    isLoadedFromFile_ = false;
+
+    std::map<std::string, std::vector<AccessibilityAbilityInitParams>> bundles;
+    for (auto &ability : queried) {
+        bundles[ability.bundleName].push_back(std::move(ability));
+    }
+    for (const auto &bundle : bundles) {
+        auto iter = bundles_.find(bundle.first);
+        if (iter == bundles_.end()) {
+            changes[bundle.first] = BundleChange::ADDED;
+        } else if (!IsSameAbilities(iter->second, bundle.second)) {
+            changes[bundle.first] = BundleChange::CHANGED;
+        }
+    }
+    for (const auto &bundle : bundles_) {
+        if (bundles.find(bundle.first) == bundles.end()) {
+            changes[bundle.first] = BundleChange::REMOVED;
+        }
+    }
+    if (changes.empty()) {
+        return true;
+    }
+    HILOG_INFO("installed ability index is stale, %{public}zu bundles changed", changes.size());
+    bundles_ = std::move(bundles);
+    WriteFile();
+    return true;
+}
+
+void AccessibilityInstalledAbilityIndex::UpdateBundle(const std::string &bundleName,
+    const std::vector<AccessibilityAbilityInitParams> &abilities)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    // a package event before the first load changes the file, a missing file is built by the next load
+    if (!isLoaded_ && !ReadFile()) {
+        return;
+    }
+    if (abilities.empty()) {
+        if (bundles_.erase(bundleName) == 0) {
+            return;
+        }
+    } else {
+        bundles_[bundleName] = abilities;
+    }
+    WriteFile();
+}
+
+void AccessibilityInstalledAbilityIndex::RemoveBundle(const std::string &bundleName)
+{
+    UpdateBundle(bundleName, {});
+}
+
+void AccessibilityInstalledAbilityIndex::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    bundles_.clear();
+    isLoaded_ = false;
+    isLoadedFromFile_ = false;
+    RemoveFile(filePath_);
+}
+
+void AccessibilityInstalledAbilityIndex::RemoveFile(const std::string &filePath)
+{
+    if (std::remove(filePath.c_str()) != 0) {
+        HILOG_DEBUG("no index file to remove");
+    }
+}
+
+bool AccessibilityInstalledAbilityIndex::IsLoadedFromFile()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return isLoadedFromFile_;
+}
+
+bool AccessibilityInstalledAbilityIndex::ReadFile()
+{
+    std::ifstream file(filePath_);
+    if (!file.is_open()) {
+        HILOG_DEBUG("no installed ability index");
+        return false;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string jsonStr = content.str();
+    if (!nlohmann::json::accept(jsonStr)) {
+        HILOG_ERROR("installed ability index is broken");
+        return false;
+    }
+    nlohmann::json root = nlohmann::json::parse(jsonStr);
+    uint32_t version = 0;
+    std::string fingerprint;
+    if (!root.is_object() || !GetUint32(root, KEY_VERSION, version) || version != INDEX_VERSION ||
+        !GetString(root, KEY_FINGERPRINT, fingerprint) || fingerprint != fingerprint_ ||
+        !root.contains(KEY_ABILITIES) || !root[KEY_ABILITIES].is_array()) {
+        HILOG_INFO("installed ability index is out of date");
+        return false;
+    }
+
+    std::map<std::string, std::vector<AccessibilityAbilityInitParams>> bundles;
+    for (const auto &item : root[KEY_ABILITIES]) {
+        AccessibilityAbilityInitParams ability;
+        if (!FromJson(item, ability)) {
+            HILOG_ERROR("installed ability index has a broken ability");
+            return false;
+        }
+        bundles[ability.bundleName].push_back(std::move(ability));
+    }
+    bundles_ = std::move(bundles);
+    isLoaded_ = true;
+    return true;
+}
+
+bool AccessibilityInstalledAbilityIndex::WriteFile()
+{
+    nlohmann::json abilities = nlohmann::json::array();
+    for (const auto &bundle : bundles_) {
+        for (const auto &ability : bundle.second) {
+            abilities.push_back(ToJson(ability));
+        }
+    }
+    nlohmann::json root;
+    root[KEY_VERSION] = INDEX_VERSION;
+    root[KEY_FINGERPRINT] = fingerprint_;
+    root[KEY_ABILITIES] = abilities;
+
+    // a crash while writing leaves the old index or none, never half of one
+    std::string tempPath = filePath_ + TEMP_FILE_SUFFIX;
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        if (!file.is_open()) {
+            HILOG_ERROR("open installed ability index failed");
+            return false;
+        }
+        file << root.dump();
+        if (!file.good()) {
+            HILOG_ERROR("write installed ability index failed");
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tempPath.c_str(), filePath_.c_str()) != 0) {
+        HILOG_ERROR("replace installed ability index failed");
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void AccessibilityInstalledAbilityIndex::CollectAbilities(std::vector<AccessibilityAbilityInitParams> &abilities) const
+{
+    abilities.clear();
+    for (const auto &bundle : bundles_) {
+        abilities.insert(abilities.end(), bundle.second.begin(), bundle.second.end());
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_runtime_counters.h"
+
+#include <algorithm>
+#include <cctype>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t SEC_TO_US = 1000000;
+    constexpr int64_t NS_TO_US = 1000;
+    constexpr int64_t US_TO_MS = 1000;
+    constexpr uint32_t SINGLE_BIT_TYPE_COUNT = 31;
+    constexpr uint32_t EXTENDED_TYPE_BASE = 0x40000000;
+    constexpr uint32_t EXTENDED_TYPE_COUNT = 6;
+    constexpr int32_t EVENT_TYPE_WIDTH = 8;
+    constexpr uint64_t PERCENT_50 = 50;
+    constexpr uint64_t PERCENT_99 = 99;
+    constexpr uint64_t PERCENT_100 = 100;
+    constexpr int32_t HIT_RATE_PRECISION = 4;
+    constexpr int32_t DECIMAL_BASE = 10;
+
+    size_t GetBucketIndex(int64_t latencyUs)
+    {
+        size_t index = 0;
+        uint64_t value = static_cast<uint64_t>(latencyUs);
+        while (value > 0 && index < AccessibilityRuntimeCounters::HISTOGRAM_BUCKET_COUNT - 1) {
+            value >>= 1;
+            index++;
+        }
+        return index;
+    }
+
+    int64_t GetBucketUpperBound(size_t index)
+    {
+        return (index == 0) ? 0 : (static_cast<int64_t>(1) << index) - 1;
+    }
+
+    // the difference of a monotonic counter, a counter lower than before was reset and counts from zero
+    uint64_t GetDelta(uint64_t current, uint64_t previous)
+    {
+        return current >= previous ? current - previous : current;
+    }
+
+    int64_t GetPercentile(const std::array<uint64_t, AccessibilityRuntimeCounters::HISTOGRAM_BUCKET_COUNT> &buckets,
+        uint64_t count, uint64_t percent)
+    {
+        uint64_t target = (count * percent + PERCENT_100 - 1) / PERCENT_100;
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            accumulated += buckets[i];
+            if (accumulated >= target) {
+                return GetBucketUpperBound(i);
+            }
+        }
+        return GetBucketUpperBound(buckets.size() - 1);
+    }
+
+    std::string FormatEventType(uint32_t eventType)
+    {
+        std::ostringstream oss;
+        oss << "0x" << std::hex << std::setw(EVENT_TYPE_WIDTH) << std::setfill('0') << eventType;
+        return oss.str();
+    }
+
+    void AppendEventCounters(std::ostringstream &oss, const AccessibilityRuntimeCounters::Snapshot &current,
+        const AccessibilityRuntimeCounters::Snapshot *previous)
+    {
+        for (size_t slot = 0; slot < AccessibilityRuntimeCounters::EVENT_SLOT_COUNT; slot++) {
+            uint64_t received = GetDelta(current.eventsReceived[slot], previous ? previous->eventsReceived[slot] : 0);
+            uint64_t dropped = GetDelta(current.eventsDropped[slot], previous ? previous->eventsDropped[slot] : 0);
+            if (received == 0 && dropped == 0) {
+                continue;
+            }
+            std::string type = FormatEventType(AccessibilityRuntimeCounters::GetEventType(slot));
+            oss << "aams_events_received{type=\"" << type << "\"} " << received << std::endl;
+            oss << "aams_events_dropped{type=\"" << type << "\"} " << dropped << std::endl;
+        }
+    }
+
+    void AppendIpcCounters(std::ostringstream &oss, const AccessibilityRuntimeCounters::Snapshot &current,
+        const AccessibilityRuntimeCounters::Snapshot *previous)
+    {
+        for (size_t code = 0; code < AccessibilityRuntimeCounters::IPC_SLOT_COUNT; code++) {
+            std::array<uint64_t, AccessibilityRuntimeCounters::HISTOGRAM_BUCKET_COUNT> buckets {};
+            uint64_t count = 0;
+            for (size_t i = 0; i < buckets.size(); i++) {
+                buckets[i] = GetDelta(current.ipcLatency[code][i], previous ? previous->ipcLatency[code][i] : 0);
+                count += buckets[i];
+            }
+            if (count == 0) {
+                continue;
+            }
+            oss << "aams_ipc_calls{code=\"" << code << "\"} " << count << std::endl;
+            oss << "aams_ipc_latency_us{code=\"" << code << "\",quantile=\"0.5\"} "
+                << GetPercentile(buckets, count, PERCENT_50) << std::endl;
+            oss << "aams_ipc_latency_us{code=\"" << code << "\",quantile=\"0.99\"} "
+                << GetPercentile(buckets, count, PERCENT_99) << std::endl;
+        }
+    }
+
+    void AppendCacheCounters(std::ostringstream &oss, const AccessibilityRuntimeCounters::Snapshot &current,
+        const AccessibilityRuntimeCounters::Snapshot *previous)
+    {
+        for (const auto &[name, counter] : current.caches) {
+            uint64_t hitCount = counter.hitCount;
+            uint64_t missCount = counter.missCount;
+            if (previous) {
+                auto iter = previous->caches.find(name);
+                if (iter != previous->caches.end()) {
+                    hitCount = GetDelta(hitCount, iter->second.hitCount);
+                    missCount = GetDelta(missCount, iter->second.missCount);
+                }
+            }
+            uint64_t total = hitCount + missCount;
+            double hitRate = total == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(total);
+            oss << "aams_cache_hits{cache=\"" << name << "\"} " << hitCount << std::endl;
+            oss << "aams_cache_misses{cache=\"" << name << "\"} " << missCount << std::endl;
+            oss << "aams_cache_hit_rate{cache=\"" << name << "\"} " << std::fixed
+                << std::setprecision(HIT_RATE_PRECISION) << hitRate << std::defaultfloat << std::endl;
+        }
+    }
+} // namespace
+
+AccessibilityRuntimeCounters::AccessibilityRuntimeCounters()
+{
+}
+
+AccessibilityRuntimeCounters::~AccessibilityRuntimeCounters()
+{
+}
+
+int64_t AccessibilityRuntimeCounters::GetCurrentTimeUs()
+{
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    return static_cast<int64_t>(times.tv_sec) * SEC_TO_US + static_cast<int64_t>(times.tv_nsec) / NS_TO_US;
+}
+
+size_t AccessibilityRuntimeCounters::GetEventSlot(uint32_t eventType)
+{
+    if (eventType > EXTENDED_TYPE_BASE && eventType <= EXTENDED_TYPE_BASE + EXTENDED_TYPE_COUNT) {
+        return SINGLE_BIT_TYPE_COUNT + (eventType - EXTENDED_TYPE_BASE);
+    }
+    if (eventType == 0 || (eventType & (eventType - 1)) != 0) {
+        return 0;
+    }
+    size_t bit = 0;
+    while ((eventType >> bit) != 1) {
+        bit++;
+    }
+    return bit < SINGLE_BIT_TYPE_COUNT ? bit + 1 : 0;
+}
+
+uint32_t AccessibilityRuntimeCounters::GetEventType(size_t slot)
+{
+    if (slot == 0 || slot >= EVENT_SLOT_COUNT) {
+        return 0;
+    }
+    if (slot <= SINGLE_BIT_TYPE_COUNT) {
+        return static_cast<uint32_t>(1) << (slot - 1);
+    }
+    return EXTENDED_TYPE_BASE + static_cast<uint32_t>(slot - SINGLE_BIT_TYPE_COUNT);
+}
+
+uint64_t AccessibilityRuntimeCounters::ParseQueueSize(const std::string &queueSize)
+{
+    uint64_t total = 0;
+    size_t pos = queueSize.find('=');
+    while (pos != std::string::npos) {
+        pos++;
+        while (pos < queueSize.size() && queueSize[pos] == ' ') {
+            pos++;
+        }
+        uint64_t value = 0;
+        while (pos < queueSize.size() && std::isdigit(static_cast<unsigned char>(queueSize[pos]))) {
+            value = value * DECIMAL_BASE + static_cast<uint64_t>(queueSize[pos] - '0');
+            pos++;
+        }
+        total += value;
+        pos = queueSize.find('=', pos);
+    }
+    return total;
+}
+
+void AccessibilityRuntimeCounters::RecordEventReceived(uint32_t eventType)
+{
+    shards_.Local().eventsReceived[GetEventSlot(eventType)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void AccessibilityRuntimeCounters::RecordEventDropped(uint32_t eventType)
+{
+    shards_.Local().eventsDropped[GetEventSlot(eventType)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void AccessibilityRuntimeCounters::RecordIpcCall(uint32_t code, int64_t latencyUs)
+{
+    size_t slot = std::min<size_t>(code, IPC_SLOT_COUNT - 1);
+    shards_.Local().ipcLatency[slot][GetBucketIndex(std::max<int64_t>(latencyUs, 0))].fetch_add(1,
+        std::memory_order_relaxed);
+}
+
+void AccessibilityRuntimeCounters::GetSnapshot(Snapshot &snapshot) const
+{
+    snapshot.timeMs = GetCurrentTimeUs() / US_TO_MS;
+    snapshot.eventsReceived.fill(0);
+    snapshot.eventsDropped.fill(0);
+    for (auto &buckets : snapshot.ipcLatency) {
+        buckets.fill(0);
+    }
+    for (const auto &shard : shards_) {
+        for (size_t slot = 0; slot < EVENT_SLOT_COUNT; slot++) {
+            snapshot.eventsReceived[slot] += shard.eventsReceived[slot].load(std::memory_order_relaxed);
+            snapshot.eventsDropped[slot] += shard.eventsDropped[slot].load(std::memory_order_relaxed);
+        }
+        for (size_t code = 0; code < IPC_SLOT_COUNT; code++) {
+            for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+                snapshot.ipcLatency[code][i] += shard.ipcLatency[code][i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+void AccessibilityRuntimeCounters::Dump(const Snapshot &snapshot, bool isDelta, std::string &dumpInfo)
+{
+    std::lock_guard<ffrt::mutex> lock(dumpMutex_);
+    FormatCounters(snapshot, (isDelta && hasLastSnapshot_) ? &lastSnapshot_ : nullptr, dumpInfo);
+    lastSnapshot_ = snapshot;
+    hasLastSnapshot_ = true;
+}
+
+void AccessibilityRuntimeCounters::FormatCounters(const Snapshot &current, const Snapshot *previous,
+    std::string &dumpInfo)
+{
+    std::ostringstream oss;
+    oss << "# mode=" << (previous ? "delta" : "total") << " intervalMs="
+        << (previous ? current.timeMs - previous->timeMs : 0) << std::endl;
+    AppendEventCounters(oss, current, previous);
+    AppendIpcCounters(oss, current, previous);
+    for (const auto &[runner, depth] : current.queueDepths) {
+        oss << "aams_queue_depth{runner=\"" << runner << "\"} " << depth << std::endl;
+    }
+    AppendCacheCounters(oss, current, previous);
+    dumpInfo.append(oss.str());
+}
+
+IpcCallScope::IpcCallScope(uint32_t code) : code_(code),
+    startTime_(AccessibilityRuntimeCounters::GetCurrentTimeUs())
+{
+}
+
+IpcCallScope::~IpcCallScope()
+{
+    Singleton<AccessibilityRuntimeCounters>::GetInstance().RecordIpcCall(code_,
+        AccessibilityRuntimeCounters::GetCurrentTimeUs() - startTime_);
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_startup_graph.h"
+
+#include <chrono>
+#include <cinttypes>
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityStartupGraph::AccessibilityStartupGraph(Executor serialExecutor, Executor concurrentExecutor,
+    Clock clock) : serialExecutor_(std::move(serialExecutor)), concurrentExecutor_(std::move(concurrentExecutor)),
+    clock_(std::move(clock))
+{
+    if (!clock_) {
+        clock_ = []() {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        };
+    }
+}
+
+bool AccessibilityStartupGraph::AddStep(const std::string &name, const std::vector<int32_t> &systemAbilities,
+    const std::vector<std::string> &predecessors, StepRunner runner, StepTask task)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!task || stepIndexes_.find(name) != stepIndexes_.end()) {
+        HILOG_ERROR("step %{public}s is invalid or exists", name.c_str());
+        return false;
+    }
+    Step step;
+    for (const auto &predecessor : predecessors) {
+        auto iter = stepIndexes_.find(predecessor);
+        if (iter == stepIndexes_.end()) {
+            HILOG_ERROR("step %{public}s comes after the unknown step %{public}s", name.c_str(),
+                predecessor.c_str());
+            return false;
+        }
+        step.predecessors.push_back(iter->second);
+    }
+    for (int32_t systemAbilityId : systemAbilities) {
+        step.systemAbilities.push_back(systemAbilityId);
+        systemAbilities_.emplace(systemAbilityId, false);
+    }
+    step.runner = runner;
+    step.task = std::move(task);
+    step.record.name = name;
+    stepIndexes_[name] = steps_.size();
+    steps_.push_back(std::move(step));
+    return true;
+}
+
+bool AccessibilityStartupGraph::OnSystemAbilityAdded(int32_t systemAbilityId)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto iter = systemAbilities_.find(systemAbilityId);
+        if (iter == systemAbilities_.end()) {
+            return false;
+        }
+        iter->second = true;
+    }
+    ScheduleReadySteps();
+    return true;
+}
+
+bool AccessibilityStartupGraph::OnSystemAbilityRemoved(int32_t systemAbilityId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = systemAbilities_.find(systemAbilityId);
+    if (iter == systemAbilities_.end()) {
+        return false;
+    }
+    iter->second = false;
+    ResetSteps();
+    return true;
+}
+
+void AccessibilityStartupGraph::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto &iter : systemAbilities_) {
+        iter.second = false;
+    }
+    ResetSteps();
+}
+
+bool AccessibilityStartupGraph::IsFinished(const std::string &name)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = stepIndexes_.find(name);
+    return iter != stepIndexes_.end() && steps_[iter->second].isFinished;
+}
+
+std::vector<StartupPhaseRecord> AccessibilityStartupGraph::GetRecords()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    std::vector<StartupPhaseRecord> records;
+    records.reserve(steps_.size());
+    for (const auto &step : steps_) {
+        records.push_back(step.record);
+    }
+    return records;
+}
+
+void AccessibilityStartupGraph::Dump(std::string &dumpInfo)
+{
+    std::vector<StartupPhaseRecord> records = GetRecords();
+    int64_t origin = -1;
+    for (const auto &record : records) {
+        if (record.readyTime >= 0 && (origin < 0 || record.readyTime < origin)) {
+            origin = record.readyTime;
+        }
+    }
+    dumpInfo.append("startup phases, in ms from the first ready step:\n");
+    for (const auto &record : records) {
+        dumpInfo.append("    ").append(record.name);
+        if (record.readyTime < 0) {
+            dumpInfo.append(" not ready\n");
+            continue;
+        }
+        dumpInfo.append(" ready=").append(std::to_string(record.readyTime - origin));
+        if (record.startTime >= 0) {
+            dumpInfo.append(" wait=").append(std::to_string(record.startTime - record.readyTime));
+        }
+        if (record.endTime >= 0) {
+            dumpInfo.append(" run=").append(std::to_string(record.endTime - record.startTime))
+                .append(record.succeeded ? " ok" : " failed");
+        }
+        dumpInfo.append("\n");
+    }
+}
+
+bool AccessibilityStartupGraph::IsReady(const Step &step) const
+{
+    for (int32_t systemAbilityId : step.systemAbilities) {
+        auto iter = systemAbilities_.find(systemAbilityId);
+        if (iter == systemAbilities_.end() || !iter->second) {
+            return false;
+        }
+    }
+    for (size_t predecessor : step.predecessors) {
+        if (!steps_[predecessor].isFinished) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AccessibilityStartupGraph::ResetSteps()
+{
+    generation_++;
+    for (auto &step : steps_) {
+        step.isRunning = false;
+        step.isFinished = false;
+    }
+}
+
+void AccessibilityStartupGraph::ScheduleReadySteps()
+{
+    std::vector<size_t> readySteps;
+    std::vector<std::string> readyNames;
+    std::vector<StepRunner> readyRunners;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        generation = generation_;
+        int64_t now = clock_();
+        for (size_t index = 0; index < steps_.size(); index++) {
+            Step &step = steps_[index];
+            if (step.isRunning || step.isFinished || !IsReady(step)) {
+                continue;
+            }
+            step.isRunning = true;
+            step.record.readyTime = now;
+            step.record.startTime = -1;
+            step.record.endTime = -1;
+            step.record.succeeded = false;
+            readySteps.push_back(index);
+            readyNames.push_back(step.record.name);
+            readyRunners.push_back(step.runner);
+        }
+    }
+
+    for (size_t i = 0; i < readySteps.size(); i++) {
+        size_t index = readySteps[i];
+        Executor &executor = readyRunners[i] == StepRunner::CONCURRENT ? concurrentExecutor_ : serialExecutor_;
+        HILOG_DEBUG("startup step %{public}s is ready", readyNames[i].c_str());
+        executor(readyNames[i], [this, index, generation]() { RunStep(index, generation); });
+    }
+}
+
+void AccessibilityStartupGraph::RunStep(size_t index, uint64_t generation)
+{
+    StepTask task;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+        steps_[index].record.startTime = clock_();
+        task = steps_[index].task;
+    }
+
+    bool succeeded = task();
+
+    std::string name;
+    int64_t duration = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+        Step &step = steps_[index];
+        step.isRunning = false;
+        step.isFinished = succeeded;
+        step.record.endTime = clock_();
+        step.record.succeeded = succeeded;
+        name = step.record.name;
+        duration = step.record.endTime - step.record.startTime;
+    }
+    HILOG_INFO("startup step %{public}s %{public}s in %{public}" PRId64 "ms", name.c_str(),
+        succeeded ? "finished" : "failed", duration);
+    if (succeeded) {
+        ScheduleReadySteps();
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -32,6 +32,7 @@
 #ifdef OHOS_BUILD_ENABLE_POWER_MANAGER
 #include "accessibility_power_manager.h"
 #endif
+#include "accessibility_runtime_counters.h"
 #include "accessibility_short_key_dialog.h"
 #include "accessibility_window_manager.h"
 #include "hilog_wrapper.h"
@@ -112,6 +113,13 @@ namespace {
     constexpr int32_t INVALID_SHORTCUT_STATE = 2;
     constexpr int32_t QUERY_USER_ID_RETRY_COUNT = 600;
     constexpr int32_t QUERY_USER_ID_SLEEP_TIME = 50;
+    const std::string STARTUP_STEP_SUBSCRIBE_COMMON_EVENT = "SubscribeCommonEvent";
+    const std::string STARTUP_STEP_QUERY_ACCOUNTS = "QueryForegroundAccounts";
+    const std::string STARTUP_STEP_INIT_ACCOUNTS = "InitForegroundAccounts";
+    const std::string STARTUP_STEP_PUBLISH = "Publish";
+    const std::string STARTUP_STEP_INNER_RESOURCE = "InitInnerResource";
+    const std::string STARTUP_STEP_REGISTER_OBSERVERS = "RegisterSettingObservers";
+    const std::string STARTUP_STEP_READY = "ServiceReady";
     constexpr int32_t DEFAULT_ACCOUNT_ID = 100;
     constexpr int32_t ROOT_UID = 0;
     constexpr int32_t TREE_ID_INVALID = 0;
@@ -176,16 +184,15 @@ AccessibleAbilityManagerService::AccessibleAbilityManagerService()
     : SystemAbility(ACCESSIBILITY_MANAGER_SERVICE_ID, true)
 {
     HILOG_INFO("AccessibleAbilityManagerService is constructed");
-    dependentServicesStatus_[ABILITY_MGR_SERVICE_ID] = false;
-    dependentServicesStatus_[BUNDLE_MGR_SERVICE_SYS_ABILITY_ID] = false;
-    dependentServicesStatus_[COMMON_EVENT_SERVICE_ID] = false;
-    dependentServicesStatus_[DISPLAY_MANAGER_SERVICE_SA_ID] = false;
-    dependentServicesStatus_[SUBSYS_ACCOUNT_SYS_ABILITY_ID_BEGIN] = false;
-    dependentServicesStatus_[WINDOW_MANAGER_SERVICE_ID] = false;
-    dependentServicesStatus_[DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID] = false;
+    InitStartupGraph();
 
     accessibilitySettings_ = std::make_shared<AccessibilitySettings>();
     accessibilityShortKey_ = std::make_shared<AccessibilityShortKey>();
+    displayUserCache_ = std::make_shared<AccessibilityDisplayUserCache>(
+        [](uint64_t displayId, int32_t &userId) {
+            return AccountSA::OsAccountManager::GetForegroundOsAccountLocalId(displayId, userId) == ERR_OK;
+        },
+        []() { return Utils::GetSystemTime(); });
 }
 
 AccessibleAbilityManagerService::~AccessibleAbilityManagerService()
@@ -333,7 +340,7 @@ void AccessibleAbilityManagerService::OnStop()
         }
         UnsubscribeOsAccount();
 
-        currentAccountId_ = -1;
+        currentAccountId_.store(-1);
         a11yAccountsData_.Clear();
         stateObserversDeathRecipient_ = nullptr;
 
@@ -341,9 +348,7 @@ void AccessibleAbilityManagerService::OnStop()
         }, "TASK_ONSTOP");
     syncFuture.wait();
 
-    for (auto &iter : dependentServicesStatus_) {
-        iter.second = false;
-    }
+    startupGraph_->Clear();
 
     isReady_ = false;
     isPublished_ = false;
@@ -369,53 +374,8 @@ void AccessibleAbilityManagerService::OnAddSystemAbility(int32_t systemAbilityId
             PostUpdateCriticalTask();
             return;
         }
-        auto iter = dependentServicesStatus_.find(systemAbilityId);
-        if (iter == dependentServicesStatus_.end()) {
+        if (!startupGraph_->OnSystemAbilityAdded(systemAbilityId)) {
             HILOG_ERROR("SystemAbilityId is not found!");
-            return;
-        }
-
-        dependentServicesStatus_[systemAbilityId] = true;
-        if (std::any_of(dependentServicesStatus_.begin(), dependentServicesStatus_.end(),
-            [](const std::map<int32_t, bool>::value_type &status) { return !status.second; })) {
-            HILOG_DEBUG("Not all the dependence is ready!");
-            return;
-        }
-
-        if (Init() == false) {
-            HILOG_COMM_ERROR("AccessibleAbilityManagerService::Init failed!");
-            return;
-        }
-
-        if (!isPublished_) {
-            if (Publish(this) == false) {
-                HILOG_ERROR("AccessibleAbilityManagerService::Publish failed!");
-                return;
-            }
-            isPublished_ = true;
-        }
-
-        InitInnerResource();
-
-        isReady_ = true;
-        SetParameter(SYSTEM_PARAMETER_AAMS_NAME, "true");
-        PublishAccessibilityCommonEvent(SYSTEM_PARAMETER_AAMS_NAME);
-        HILOG_COMM_INFO("AAMS is ready!");
-        RegisterShortKeyEvent();
-        PostDelayUnloadTask();
-        RegisterScreenMagnificationState();
-        RegisterScreenMagnificationType();
-        RegisterVoiceRecognitionState();
-        RegisterFlashReminderSwitch();
-        RegisterFlashReminderMode();
-        RegisterFlashReminderFunctionEnabled();
-        RegisterFlashReminderUnlock();
-        RegisterSeniorModeState();
-        RegisterSeniorModeStateForAppObserver();
-
-        if (accessibilitySettings_) {
-            accessibilitySettings_->RegisterParamWatcher();
-            UpdateAccessibilityState();
         }
         }, "OnAddSystemAbility");
 }
@@ -431,13 +391,10 @@ void AccessibleAbilityManagerService::OnRemoveSystemAbility(int32_t systemAbilit
 
     handler_->PostTask([=]() {
         HILOG_INFO("Remove system ability start");
-        auto iter = dependentServicesStatus_.find(systemAbilityId);
-        if (iter == dependentServicesStatus_.end()) {
+        if (!startupGraph_->OnSystemAbilityRemoved(systemAbilityId)) {
             HILOG_ERROR("SystemAbilityId is not found!");
             return;
         }
-
-        dependentServicesStatus_[systemAbilityId] = false;
         if (isReady_ && systemAbilityId != DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID) {
             SwitchedUser(-1);
             Singleton<AccessibilityCommonEvent>::GetInstance().UnSubscriberEvent();
@@ -489,6 +446,29 @@ int AccessibleAbilityManagerService::Dump(int fd, const std::vector<std::u16stri
     return syncFuture.get();
 }
 
+int32_t AccessibleAbilityManagerService::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    IpcCallScope scope(code);
+    return AccessibleAbilityManagerServiceStub::OnRemoteRequest(code, data, reply, option);
+}
+
+void AccessibleAbilityManagerService::GetRunnerQueueDepths(std::map<std::string, uint64_t> &queueDepths)
+{
+    const std::pair<const char *, std::shared_ptr<AppExecFwk::EventRunner>> runners[] = {
+        {AAMS_SERVICE_NAME, runner_}, {AAMS_ACTION_RUNNER_NAME, actionRunner_},
+        {AAMS_SEND_EVENT_RUNNER_NAME, sendEventRunner_}, {AAMS_CHANNEL_RUNNER_NAME, channelRunner_},
+        {AAMS_HOVER_ENTER_RUNNER_NAME, hoverEnterRunner_},
+    };
+    for (const auto &[name, runner] : runners) {
+        if (runner == nullptr || runner->GetEventQueue() == nullptr) {
+            continue;
+        }
+        queueDepths[name] = AccessibilityRuntimeCounters::ParseQueueSize(
+            runner->GetEventQueue()->DumpCurrentQueueSize());
+    }
+}
+
 // LCOV_EXCL_START
 RetError AccessibleAbilityManagerService::VerifyingToKenId(const int32_t windowId, const int64_t elementId,
     int32_t userId, uint32_t tokenId)
@@ -515,8 +495,7 @@ RetError AccessibleAbilityManagerService::VerifyingToKenId(const int32_t windowI
 int32_t AccessibleAbilityManagerService::GetUserIdByDisplayId(uint64_t displayId)
 {
     int32_t localId = -1;
-    ErrCode errCode = AccountSA::OsAccountManager::GetForegroundOsAccountLocalId(displayId, localId);
-    if (errCode != ERR_OK) {
+    if (displayUserCache_ == nullptr || !displayUserCache_->GetUserId(displayId, localId)) {
         return GetCurrentAccountId();
     }
     return localId;
@@ -566,21 +545,27 @@ ErrCode AccessibleAbilityManagerService::SendEvent(
 ErrCode AccessibleAbilityManagerService::InnerSendEvent(
     const AccessibilityEventInfoParcel &eventInfoParcel, int32_t flag, int32_t userId)
 {
+    AccessibilityEventInfo uiEvent = static_cast<AccessibilityEventInfo>(eventInfoParcel);
+    EventType eventType = uiEvent.GetEventType();
+    AccessibilityRuntimeCounters &counters = Singleton<AccessibilityRuntimeCounters>::GetInstance();
+    counters.RecordEventReceived(eventType);
     if (!sendEventHandler_ || !hoverEnterHandler_) {
         HILOG_ERROR("Parameters check failed!");
+        counters.RecordEventDropped(eventType);
         return RET_ERR_NULLPTR;
     }
-    AccessibilityEventInfo uiEvent = static_cast<AccessibilityEventInfo>(eventInfoParcel);
-    EventType eventType = uiEvent.GetEventType();
     uint32_t tokenId = IPCSkeleton::GetCallingTokenID();
     auto sendEventTask = [this, uiEvent, flag, tokenId, userId]() {
         HILOG_DEBUG();
         sptr<AccessibilityAccountData> accountData = GetAccountData(userId);
         if (!accountData) {
             HILOG_ERROR("accountData is nullptr. userId = %{public}d", userId);
+            Singleton<AccessibilityRuntimeCounters>::GetInstance().RecordEventDropped(uiEvent.GetEventType());
             return;
         }
-        accountData->GetElementOperatorManager().SendEvent(uiEvent, flag, tokenId);
+        if (accountData->GetElementOperatorManager().SendEvent(uiEvent, flag, tokenId) != RET_OK) {
+            Singleton<AccessibilityRuntimeCounters>::GetInstance().RecordEventDropped(uiEvent.GetEventType());
+        }
     };
 
     if (eventType == TYPE_VIEW_HOVER_ENTER_EVENT) {
@@ -1642,11 +1627,64 @@ ErrCode AccessibleAbilityManagerService::GetActiveWindowEx(int32_t &windowId)
 }
 // LCOV_EXCL_STOP
 
-bool AccessibleAbilityManagerService::Init()
+void AccessibleAbilityManagerService::InitStartupGraph()
+{
+    using StepRunner = AccessibilityStartupGraph::StepRunner;
+    startupGraph_ = std::make_shared<AccessibilityStartupGraph>(
+        [this](const std::string &name, std::function<void()> task) {
+            if (handler_ == nullptr) {
+                HILOG_ERROR("handler_ is nullptr");
+                return;
+            }
+            handler_->PostTask(task, name);
+        },
+        [](const std::string &name, std::function<void()> task) {
+            ffrt::submit(std::move(task), {}, {}, ffrt::task_attr().name(name.c_str()));
+        });
+
+    startupGraph_->AddStep(STARTUP_STEP_SUBSCRIBE_COMMON_EVENT, {COMMON_EVENT_SERVICE_ID}, {}, StepRunner::SERIAL,
+        [this]() {
+            Singleton<AccessibilityCommonEvent>::GetInstance().SubscriberEvent(handler_);
+            return true;
+        });
+    startupGraph_->AddStep(STARTUP_STEP_QUERY_ACCOUNTS, {SUBSYS_ACCOUNT_SYS_ABILITY_ID_BEGIN}, {},
+        StepRunner::CONCURRENT, [this]() { return QueryForegroundAccounts(); });
+    // switching to the foreground user loads the installed abilities, connects the enabled ones and reads the settings
+    startupGraph_->AddStep(STARTUP_STEP_INIT_ACCOUNTS, {ABILITY_MGR_SERVICE_ID, BUNDLE_MGR_SERVICE_SYS_ABILITY_ID,
+        DISPLAY_MANAGER_SERVICE_SA_ID, WINDOW_MANAGER_SERVICE_ID, DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID},
+        {STARTUP_STEP_SUBSCRIBE_COMMON_EVENT, STARTUP_STEP_QUERY_ACCOUNTS}, StepRunner::SERIAL,
+        [this]() { return InitForegroundAccounts(); });
+    startupGraph_->AddStep(STARTUP_STEP_PUBLISH, {}, {STARTUP_STEP_INIT_ACCOUNTS}, StepRunner::SERIAL,
+        [this]() { return PublishService(); });
+    startupGraph_->AddStep(STARTUP_STEP_INNER_RESOURCE, {}, {STARTUP_STEP_INIT_ACCOUNTS}, StepRunner::SERIAL,
+        [this]() {
+            InitInnerResource();
+            return true;
+        });
+    // every registration runs a task of its own, see PostObserverRegistration
+    startupGraph_->AddStep(STARTUP_STEP_REGISTER_OBSERVERS, {DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID},
+        {STARTUP_STEP_INIT_ACCOUNTS}, StepRunner::SERIAL, [this]() {
+            RegisterScreenMagnificationState();
+            RegisterScreenMagnificationType();
+            RegisterVoiceRecognitionState();
+            RegisterFlashReminderSwitch();
+            RegisterFlashReminderMode();
+            RegisterFlashReminderFunctionEnabled();
+            RegisterFlashReminderUnlock();
+            RegisterSeniorModeState();
+            RegisterSeniorModeStateForAppObserver();
+            return true;
+        });
+    startupGraph_->AddStep(STARTUP_STEP_READY, {}, {STARTUP_STEP_PUBLISH, STARTUP_STEP_INNER_RESOURCE},
+        StepRunner::SERIAL, [this]() {
+            OnServiceReady();
+            return true;
+        });
+}
+
+bool AccessibleAbilityManagerService::QueryForegroundAccounts()
 {
     HILOG_DEBUG();
-    Singleton<AccessibilityCommonEvent>::GetInstance().SubscriberEvent(handler_);
-
     int32_t retry = QUERY_USER_ID_RETRY_COUNT;
     int32_t sleepTime = QUERY_USER_ID_SLEEP_TIME;
     std::vector<AccountSA::ForegroundOsAccount> accountIds;
@@ -1657,17 +1695,34 @@ bool AccessibleAbilityManagerService::Init()
             HILOG_ERROR("Query account information failed!!!");
             break;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleepTime));
+        // the query runs as an ffrt task, sleep without holding its worker thread
+        ffrt::this_task::sleep_for(std::chrono::milliseconds(sleepTime));
         ret = AccountSA::OsAccountManager::GetForegroundOsAccounts(accountIds);
         retry--;
     }
 
+    std::lock_guard<ffrt::mutex> lock(foregroundAccountsMutex_);
+    foregroundAccountIds_.clear();
+    for (const auto &iter : accountIds) {
+        foregroundAccountIds_.push_back(iter.localId);
+    }
+    return true;
+}
+
+bool AccessibleAbilityManagerService::InitForegroundAccounts()
+{
+    HILOG_DEBUG();
+    std::vector<int32_t> accountIds;
+    {
+        std::lock_guard<ffrt::mutex> lock(foregroundAccountsMutex_);
+        accountIds = foregroundAccountIds_;
+    }
+
     if (accountIds.size() > 0) {
-        HILOG_DEBUG("Query account information success, account id:%{public}d", accountIds[0].localId);
-        SwitchedUser(accountIds[0].localId);
+        HILOG_DEBUG("Query account information success, account id:%{public}d", accountIds[0]);
+        SwitchedUser(accountIds[0]);
     }
-    for (const auto& iter : accountIds) {
-        int32_t userId = iter.localId;
+    for (int32_t userId : accountIds) {
         HILOG_INFO("init accountId = %{public}d", userId);
         AddedUser(userId);
         handler_->PostTask([this, userId]() mutable {
@@ -1681,26 +1736,59 @@ bool AccessibleAbilityManagerService::Init()
                 accountData->SetDisplayId(static_cast<int32_t>(displayId));
             }
             accountData->SetForeGroundOsAccountFlag(true);
-            accountData->GetInstalledAbilitiesFromBMS();
+            if (accountData->GetInstalledAbilitiesFromBMS()) {
+                handler_->PostTask([this, userId]() {
+                    RevalidateInstalledAbilities(userId);
+                }, "RevalidateInstalledAbilities");
+            }
         }, "AddedUser");
     }
     return true;
 }
 
+bool AccessibleAbilityManagerService::PublishService()
+{
+    if (isPublished_) {
+        return true;
+    }
+    if (Publish(this) == false) {
+        HILOG_ERROR("AccessibleAbilityManagerService::Publish failed!");
+        return false;
+    }
+    isPublished_ = true;
+    return true;
+}
+
 void AccessibleAbilityManagerService::InitInnerResource()
 {
     UpdateSettingsInAtoHosTask();
 }
 
+void AccessibleAbilityManagerService::OnServiceReady()
+{
+    isReady_ = true;
+    SetParameter(SYSTEM_PARAMETER_AAMS_NAME, "true");
+    PublishAccessibilityCommonEvent(SYSTEM_PARAMETER_AAMS_NAME);
+    HILOG_COMM_INFO("AAMS is ready!");
+    RegisterShortKeyEvent();
+    PostDelayUnloadTask();
+
+    if (accessibilitySettings_) {
+        accessibilitySettings_->RegisterParamWatcher();
+        UpdateAccessibilityState();
+    }
+}
+
 sptr<AccessibilityAccountData> AccessibleAbilityManagerService::GetCurrentAccountData()
 {
     HILOG_DEBUG();
-    if (currentAccountId_ == -1) {
+    int32_t accountId = currentAccountId_.load();
+    if (accountId == -1) {
         HILOG_ERROR("current account id is wrong");
         return nullptr;
     }
 
-    return a11yAccountsData_.GetCurrentAccountData(currentAccountId_);
+    return a11yAccountsData_.GetCurrentAccountData(accountId);
 }
 
 sptr<AccessibilityAccountData> AccessibleAbilityManagerService::GetAccountData(int32_t accountId)
@@ -1716,8 +1804,11 @@ sptr<AccessibilityAccountData> AccessibleAbilityManagerService::GetAccountData(i
     }
     AddedUser(accountId);
     accountData = a11yAccountsData_.GetAccountData(accountId);
-    bool isForeground = false;
-    ErrCode errCode = OHOS::AccountSA::OsAccountManager::IsOsAccountForeground(accountId, isForeground);
+    bool isForeground = displayUserCache_ != nullptr && displayUserCache_->IsForegroundUser(accountId);
+    ErrCode errCode = RET_OK;
+    if (!isForeground) {
+        errCode = OHOS::AccountSA::OsAccountManager::IsOsAccountForeground(accountId, isForeground);
+    }
     if (accountData && errCode == RET_OK && isForeground) {
         HILOG_INFO("set foreGroundFlag %{public}d", accountId);
         accountData->SetForeGroundOsAccountFlag(true);
@@ -1788,32 +1879,53 @@ void AccessibleAbilityManagerService::AddedUser(int32_t accountId)
 void AccessibleAbilityManagerService::RemovedUser(int32_t accountId)
 {
     HILOG_DEBUG();
-    if (accountId == currentAccountId_) {
+    if (accountId == currentAccountId_.load()) {
         HILOG_ERROR("Remove user failed, this account is current account.");
         return;
     }
+    if (displayUserCache_ != nullptr) {
+        displayUserCache_->RemoveUser(accountId);
+    }
     auto accountData = a11yAccountsData_.RemoveAccountData(accountId);
     if (accountData) {
         accountData->GetConfig()->ClearData();
+        accountData->RemoveInstalledAbilityIndex();
         return;
     }
 
+    // the index file of a user outlives its account data, as after a restart before the removal
+    AccessibilityAccountData::RemoveInstalledAbilityIndexFile(accountId);
     HILOG_ERROR("accountId is not exist");
 }
 // LCOV_EXCL_STOP
 
+void AccessibleAbilityManagerService::UpdateDisplayUserCache(int32_t accountId)
+{
+    if (displayUserCache_ == nullptr) {
+        return;
+    }
+    // the switched user replaces the foreground user of its display, other displays are resolved again
+    displayUserCache_->Invalidate();
+    uint64_t displayId = 0;
+    ErrCode errCode = AccountSA::OsAccountManager::GetForegroundOsAccountDisplayId(accountId, displayId);
+    if (errCode == ERR_OK) {
+        displayUserCache_->SetUserId(displayId, accountId);
+    }
+}
+
 void AccessibleAbilityManagerService::SwitchedUser(int32_t accountId)
 {
     HILOG_DEBUG();
 
-    if (accountId == currentAccountId_) {
+    int32_t currentAccountId = currentAccountId_.load();
+    if (accountId == currentAccountId) {
         HILOG_WARN("The account is current account id.");
         return;
     }
 
     std::map<std::string, uint32_t> importantEnabledAbilities;
     SCREENREADER_STATE screenReaderState = SCREENREADER_STATE::UNINIT;
-    if (currentAccountId_ != -1) {
+    if (currentAccountId != -1) {
         HILOG_DEBUG();
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (!accountData) {
@@ -1836,13 +1948,14 @@ void AccessibleAbilityManagerService::SwitchedUser(int32_t accountId)
         UpdateAccessibilityState();
         UpdateShortKeyRegister();
         bool isForeground = false;
-        ErrCode errCode = OHOS::AccountSA::OsAccountManager::IsOsAccountForeground(currentAccountId_, isForeground);
+        ErrCode errCode = OHOS::AccountSA::OsAccountManager::IsOsAccountForeground(currentAccountId, isForeground);
         if (errCode == RET_OK && !isForeground) {
-            HILOG_INFO("set foreGroundFlag %{public}d", currentAccountId_); 
+            HILOG_INFO("set foreGroundFlag %{public}d", currentAccountId); 
             accountData->SetForeGroundOsAccountFlag(false);
         }
     }
-    currentAccountId_ = accountId;
+    currentAccountId_.store(accountId);
+    UpdateDisplayUserCache(accountId);
     if (Singleton<ExtendManagerServiceProxy>::GetInstance().CheckExtProxyStatus()) {
         Singleton<ExtendManagerServiceProxy>::GetInstance().SetCurrentAccountId(accountId);
     }
@@ -1875,11 +1988,14 @@ void AccessibleAbilityManagerService::SwitchedUser(int32_t accountId)
         HILOG_INFO("set screenreader auto-start state = %{public}d", state);
     }
 
-    handler_->PostTask([this, accountData, importantEnabledAbilities]() mutable {
+    handler_->PostTask([this, accountData, importantEnabledAbilities, accountId]() mutable {
         if (accountData->GetInstalledAbilitiesFromBMS()) {
             accountData->UpdateImportantEnabledAbilities(importantEnabledAbilities);
             accountData->UpdateAbilities();
             UpdateAccessibilityManagerService();
+            handler_->PostTask([this, accountId]() {
+                RevalidateInstalledAbilities(accountId);
+            }, "RevalidateInstalledAbilities");
         }
     }, "SwitchedUser");
 
@@ -1962,6 +2078,35 @@ void AccessibleAbilityManagerService::PackageAdd(const std::string &bundleName,
     packageAccount->AddAbility(bundleName);
 }
 
+void AccessibleAbilityManagerService::RevalidateInstalledAbilities(int32_t userId)
+{
+    sptr<AccessibilityAccountData> accountData = GetAccountData(userId);
+    if (!accountData) {
+        HILOG_ERROR("accountData is nullptr");
+        return;
+    }
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> changes;
+    if (!accountData->RevalidateInstalledAbilities(changes)) {
+        return;
+    }
+    for (auto &change : changes) {
+        HILOG_INFO("bundle %{public}s changed while the index was not updated", change.first.c_str());
+        switch (change.second) {
+            case AccessibilityInstalledAbilityIndex::BundleChange::ADDED:
+                PackageAdd(change.first, userId);
+                break;
+            case AccessibilityInstalledAbilityIndex::BundleChange::CHANGED:
+                PackageChanged(change.first, userId);
+                break;
+            case AccessibilityInstalledAbilityIndex::BundleChange::REMOVED:
+                PackageRemoved(change.first, userId);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 void AccessibleAbilityManagerService::PackageChanged(const std::string &bundleName, int32_t userId)
 {
     sptr<AccessibilityAccountData> packageAccount = GetAccountData(userId);
@@ -2122,7 +2267,7 @@ void AccessibleAbilityManagerService::UpdateSettingsInAtoHos()
         return;
     }
 
-    if (!accountData->GetConfig()->GetStartToHosState() || currentAccountId_ != DEFAULT_ACCOUNT_ID) {
+    if (!accountData->GetConfig()->GetStartToHosState() || currentAccountId_.load() != DEFAULT_ACCOUNT_ID) {
         HILOG_INFO("Not first start from a to hos.");
         return;
     }
@@ -3185,6 +3330,13 @@ void AccessibleAbilityManagerService::RegisterShortKeyEvent()
         }, "REGISTER_SHORTKEY_OBSERVER");
 }
 
+void AccessibleAbilityManagerService::PostObserverRegistration(std::function<void()> task, const std::string &name)
+{
+    // the setting observers only wait on the datashare service, so they register side by side instead of
+    // one after another on the handler. What a registration changes in the service is posted to the handler.
+    ffrt::submit(std::move(task), {}, {}, ffrt::task_attr().name(name.c_str()));
+}
+
 void AccessibleAbilityManagerService::OnScreenMagnificationStateChanged()
 {
     HILOG_DEBUG();
@@ -3223,7 +3375,7 @@ void AccessibleAbilityManagerService::RegisterScreenMagnificationState()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3263,7 +3415,8 @@ void AccessibleAbilityManagerService::OnScreenMagnificationTypeChanged()
     screenMagnificationType =
         static_cast<uint32_t>(config->GetDbHandle()->GetIntValue(SCREEN_MAGNIFICATION_TYPE, 0));
     config->SetScreenMagnificationType(screenMagnificationType);
-    if (Singleton<ExtendManagerServiceProxy>::GetInstance().LoadExtProxy()) {
+    // an extension loaded later reads the type through its callback, the change alone does not load it
+    if (Singleton<ExtendManagerServiceProxy>::GetInstance().CheckExtProxyStatus()) {
         Singleton<ExtendManagerServiceProxy>::GetInstance().OnScreenMagnificationTypeChanged(screenMagnificationType);
     }
 }
@@ -3331,7 +3484,7 @@ void AccessibleAbilityManagerService::OnScreenMagnificationTriggerMethodChanged(
         THREE_FINGER_DOUBLE_TAP_MODE);
  
     SetConfigScreenMagnificationTriggerMethod(screenMagnificationTriggerMethod);
-    if (Singleton<ExtendManagerServiceProxy>::GetInstance().LoadExtProxy()) {
+    if (Singleton<ExtendManagerServiceProxy>::GetInstance().CheckExtProxyStatus()) {
         Singleton<ExtendManagerServiceProxy>::GetInstance().
             OnScreenMagnificationTriggerMethodChanged(screenMagnificationTriggerMethod);
     }
@@ -3344,7 +3497,7 @@ void AccessibleAbilityManagerService::RegisterScreenMagnificationType()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3404,7 +3557,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderSwitch()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3417,7 +3570,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderSwitch()
         if (accountData->GetConfig()->GetDbHandle()) {
             accountData->GetConfig()->GetDbHandle()->RegisterObserver(FLASH_REMINDER_SWITCH_KEY, func);
         }
-        OnFlashReminderSwitchChanged();
+        handler_->PostTask([=]() { OnFlashReminderSwitchChanged(); }, "FLASH_REMINDER_SWITCH_KEY_OBSERVER");
         }, "FLASH_REMINDER_SWITCH_KEY_OBSERVER");
 }
 
@@ -3454,7 +3607,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderMode()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3467,7 +3620,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderMode()
         if (accountData->GetConfig()->GetDbHandle()) {
             accountData->GetConfig()->GetDbHandle()->RegisterObserver(FLASH_REMINDER_MODE_KEY, func);
         }
-        OnFlashReminderModeChanged();
+        handler_->PostTask([=]() { OnFlashReminderModeChanged(); }, "FLASH_REMINDER_MODE_KEY_OBSERVER");
         }, "FLASH_REMINDER_MODE_KEY_OBSERVER");
 }
 
@@ -3504,7 +3657,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderFunctionEnabled()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3517,7 +3670,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderFunctionEnabled()
         if (accountData->GetConfig()->GetDbHandle()) {
             accountData->GetConfig()->GetDbHandle()->RegisterObserver(FLASH_REMINDER_ENABLED_KEY, func);
         }
-        OnFlashReminderFunctionEnabledChanged();
+        handler_->PostTask([=]() { OnFlashReminderFunctionEnabledChanged(); }, "FLASH_REMINDER_ENABLED_KEY_OBSERVER");
         }, "FLASH_REMINDER_ENABLED_KEY_OBSERVER");
 }
 
@@ -3556,7 +3709,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderUnlock()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3569,7 +3722,7 @@ void AccessibleAbilityManagerService::RegisterFlashReminderUnlock()
         if (accountData->GetConfig()->GetDbHandle()) {
             accountData->GetConfig()->GetDbHandle()->RegisterObserver(FLASH_REMINDER_UNLOCK_KEY, func);
         }
-        OnFlashReminderUnlockChanged();
+        handler_->PostTask([=]() { OnFlashReminderUnlockChanged(); }, "FLASH_REMINDER_UNLOCK_KEY_OBSERVER");
         }, "FLASH_REMINDER_UNLOCK_KEY_OBSERVER");
 }
 
@@ -3605,7 +3758,7 @@ void AccessibleAbilityManagerService::RegisterSeniorModeState()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -3686,7 +3839,7 @@ void AccessibleAbilityManagerService::RegisterVoiceRecognitionState()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
             HILOG_ERROR("accountData is nullptr");
@@ -4130,6 +4283,7 @@ void AccessibleAbilityManagerService::SubscribeOsAccount()
     }
     std::set<AccountSA::OsAccountState> states;
     states.insert(AccountSA::OsAccountState::SWITCHING);
+    states.insert(AccountSA::OsAccountState::SWITCHED);
     AccountSA::OsAccountSubscribeInfo info(states, false);
     accountSubscriber_ = std::make_shared<AccountSubscriber>(info);
     if (accountSubscriber_ == nullptr) {
@@ -4313,7 +4467,7 @@ void AccessibleAbilityManagerService::RegisterSeniorModeStateForAppObserver()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    handler_->PostTask([=]() {
+    PostObserverRegistration([=]() {
         HILOG_INFO("RegisterSeniorModeStateForAppObserver");
         sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
         if (accountData == nullptr) {
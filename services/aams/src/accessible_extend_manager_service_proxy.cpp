@@ -22,6 +22,7 @@
 #undef private
 #undef protected
 #include "accessibility_window_manager.h"
+#include <algorithm>
 #include <dlfcn.h>
 #include <shared_mutex>
 
@@ -53,7 +54,8 @@ static void SendTouchGuideGestureToAA(uint64_t displayId, const std::string gest
         displayId, gestureType);
 }
 
-static std::vector<int32_t> DispatchKeyEvent(MMI::KeyEvent &event, uint32_t sequenceNum)
+static std::vector<int32_t> DispatchKeyEvent(MMI::KeyEvent &event, uint32_t sequenceNum,
+    const std::vector<int32_t> &skippedConnectionIds)
 {
     sptr<AccessibilityAccountData> accountData =
         Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
@@ -64,6 +66,10 @@ static std::vector<int32_t> DispatchKeyEvent(MMI::KeyEvent &event, uint32_t sequ
     std::vector<int32_t> connctionIds {};
     std::map<std::string, sptr<AccessibleAbilityConnection>> connectionMaps = accountData->GetConnectedA11yAbilities();
     for (auto iter = connectionMaps.begin(); iter != connectionMaps.end(); iter++) {
+        if (std::find(skippedConnectionIds.begin(), skippedConnectionIds.end(), iter->second->GetChannelId()) !=
+            skippedConnectionIds.end()) {
+            continue;
+        }
         if (iter->second->OnKeyPressEvent(event, sequenceNum)) {
             connctionIds.emplace_back(iter->second->GetChannelId());
         }
@@ -77,6 +83,13 @@ bool ExtendManagerServiceProxy::LoadExtProxy()
         std::unique_lock<ffrt::shared_mutex> wLock(rwLock_);
         if (!handle_) {
             handle_ = dlopen(extendServiceName_.c_str(), RTLD_LAZY);
+            if (!handle_) {
+                HILOG_ERROR("dlopen error: %{public}s", dlerror());
+                return false;
+            }
+            HILOG_INFO("load %{public}s", extendServiceName_.c_str());
+            // the library calls back into the service from its first entry point on, the entry points
+            // themselves are resolved on their first use
             SetSendAccessibilityEventToAACallback();
             SetSendTouchGuideGestureToAACallback();
             SetFindFocusedElementCallback();
@@ -102,10 +115,6 @@ bool ExtendManagerServiceProxy::LoadExtProxy()
             SetNotifyZoomGesutureConflictDialogCallback();
             SetGetNotifyZoomGestureConflictCallback();
         }
-        if (!handle_) {
-            HILOG_ERROR("dlopen error: %{public}s", dlerror());
-            return false;
-        }
     }
     int32_t accountId = Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountId();
     SetCurrentAccountId(accountId);
@@ -115,7 +124,7 @@ bool ExtendManagerServiceProxy::LoadExtProxy()
 bool ExtendManagerServiceProxy::RemoveExtProxy()
 {
     std::unique_lock<ffrt::shared_mutex> wLock(rwLock_);
-    readyFunc_.clear();
+    extFuncs_.Reset();
     if (!handle_) {
         return false;
     }
@@ -397,6 +406,14 @@ void *ExtendManagerServiceProxy::GetFunc(const std::string &funcName)
     return func;
 }
 
+template<typename Func>
+Func ExtendManagerServiceProxy::GetExtFunc(ExtMethod method, const char* funcName)
+{
+    void* func = extFuncs_.Get(static_cast<size_t>(method), funcName,
+        [this](const char* name) { return GetFunc(name); });
+    return reinterpret_cast<Func>(func);
+}
+
 bool ExtendManagerServiceProxy::SetSendAccessibilityEventToAACallback()
 {
     if (!handle_) {
@@ -429,7 +446,8 @@ bool ExtendManagerServiceProxy::SetDispatchKeyEventCallback()
         HILOG_ERROR("Extension Proxy is not load");
         return false;
     }
-    using DispatchKeyEventCallback =  std::vector<int32_t> (*) (MMI::KeyEvent &event, uint32_t sequenceNum);
+    using DispatchKeyEventCallback =  std::vector<int32_t> (*) (MMI::KeyEvent &event, uint32_t sequenceNum,
+        const std::vector<int32_t> &skippedConnectionIds);
     using SetDispatchKeyEventCallback = void (*)(DispatchKeyEventCallback cb);
     SetDispatchKeyEventCallback setDispatchKeyEventCallback = (
         SetDispatchKeyEventCallback)GetFunc("SetDispatchKeyEventCallback");
@@ -441,20 +459,14 @@ RetError ExtendManagerServiceProxy::InjectEvents(const std::shared_ptr<Accessibi
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using InjectEvents = RetError(*)(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
-    static InjectEvents func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::INJECT_EVENTS) == readyFunc_.end()) {
-        func = (InjectEvents)GetFunc("InjectEvents");
-        if (func) {
-            readyFunc_.insert(ExtMethod::INJECT_EVENTS);
-            return func(gesturePath);
-        } else {
-            HILOG_ERROR("get InjectEvents func failed");
-            return RET_ERR_NULLPTR;
-        }
+    InjectEvents func = GetExtFunc<InjectEvents>(ExtMethod::INJECT_EVENTS, "InjectEvents");
+    if (!func) {
+        HILOG_ERROR("get InjectEvents func failed");
+        return RET_ERR_NULLPTR;
     }
     return func(gesturePath);
 }
@@ -463,20 +475,15 @@ void ExtendManagerServiceProxy::SetServiceOnKeyEventResult(int32_t connectionId,
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetServiceOnKeyEventResult = void(*)(int32_t connectionId, bool isHandled, uint32_t sequenceNum);
-    static SetServiceOnKeyEventResult func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_SERVICE_ON_KEY_EVENT_RESULT) == readyFunc_.end()) {
-        func = (SetServiceOnKeyEventResult)GetFunc("SetServiceOnKeyEventResult");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_SERVICE_ON_KEY_EVENT_RESULT);
-            return func(connectionId, isHandled, sequenceNum);
-        } else {
-            HILOG_ERROR("get SetServiceOnKeyEventResult func failed");
-            return;
-        }
+    SetServiceOnKeyEventResult func = GetExtFunc<SetServiceOnKeyEventResult>(
+        ExtMethod::SET_SERVICE_ON_KEY_EVENT_RESULT, "SetServiceOnKeyEventResult");
+    if (!func) {
+        HILOG_ERROR("get SetServiceOnKeyEventResult func failed");
+        return;
     }
     return func(connectionId, isHandled, sequenceNum);
 }
@@ -485,20 +492,14 @@ RetError ExtendManagerServiceProxy::SetMouseAutoClick(int32_t time)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetMouseAutoClick = RetError(*)(int32_t time);
-    static SetMouseAutoClick func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_MOUSE_AUTO_CLICK) == readyFunc_.end()) {
-        func = (SetMouseAutoClick)GetFunc("SetMouseAutoClick");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_MOUSE_AUTO_CLICK);
-            return func(time);
-        } else {
-            HILOG_ERROR("get SetMouseAutoClick func failed");
-            return RET_ERR_NULLPTR;
-        }
+    SetMouseAutoClick func = GetExtFunc<SetMouseAutoClick>(ExtMethod::SET_MOUSE_AUTO_CLICK, "SetMouseAutoClick");
+    if (!func) {
+        HILOG_ERROR("get SetMouseAutoClick func failed");
+        return RET_ERR_NULLPTR;
     }
     return func(time);
 }
@@ -509,20 +510,14 @@ RetError ExtendManagerServiceProxy::SetClickConfig(AccessibilityConfig::IGNORE_R
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetClickConfig = RetError(*)(AccessibilityConfig::IGNORE_REPEAT_CLICK_TIME clickTime, bool state,
         AccessibilityConfig::CLICK_RESPONSE_TIME responseTime);
-    static SetClickConfig func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_CLICK_CONFIG) == readyFunc_.end()) {
-        func = (SetClickConfig)GetFunc("SetClickConfig");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_CLICK_CONFIG);
-            return func(clickTime, state, responseTime);
-        } else {
-            HILOG_ERROR("get SetClickConfig func failed");
-            return RET_ERR_NULLPTR;
-        }
+    SetClickConfig func = GetExtFunc<SetClickConfig>(ExtMethod::SET_CLICK_CONFIG, "SetClickConfig");
+    if (!func) {
+        HILOG_ERROR("get SetClickConfig func failed");
+        return RET_ERR_NULLPTR;
     }
     return func(clickTime, state, responseTime);
 }
@@ -531,20 +526,15 @@ void ExtendManagerServiceProxy::SetMagnificationMode(uint32_t mode)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetMagnificationMode = void(*)(uint32_t mode);
-    static SetMagnificationMode func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_MAGNIFICATION_MODE) == readyFunc_.end()) {
-        func = (SetMagnificationMode)GetFunc("SetMagnificationMode");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_MAGNIFICATION_MODE);
-            return func(mode);
-        } else {
-            HILOG_ERROR("get SetMagnificationMode func failed");
-            return;
-        }
+    SetMagnificationMode func = GetExtFunc<SetMagnificationMode>(
+        ExtMethod::SET_MAGNIFICATION_MODE, "SetMagnificationMode");
+    if (!func) {
+        HILOG_ERROR("get SetMagnificationMode func failed");
+        return;
     }
     return func(mode);
 }
@@ -553,20 +543,15 @@ void ExtendManagerServiceProxy::SetMagnificationType(uint32_t type)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetMagnificationType = void(*)(uint32_t type);
-    static SetMagnificationType func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_MAGNIFICATION_TYPE) == readyFunc_.end()) {
-        func = (SetMagnificationType)GetFunc("SetMagnificationType");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_MAGNIFICATION_TYPE);
-            return func(type);
-        } else {
-            HILOG_ERROR("get SetMagnificationType func failed");
-            return;
-        }
+    SetMagnificationType func = GetExtFunc<SetMagnificationType>(
+        ExtMethod::SET_MAGNIFICATION_TYPE, "SetMagnificationType");
+    if (!func) {
+        HILOG_ERROR("get SetMagnificationType func failed");
+        return;
     }
     return func(type);
 }
@@ -575,20 +560,15 @@ void ExtendManagerServiceProxy::SetMagnificationScale(float scale)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetMagnificationScale = void(*)(float scale);
-    static SetMagnificationScale func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_MAGNIFICATION_SCALE) == readyFunc_.end()) {
-        func = (SetMagnificationScale)GetFunc("SetMagnificationScale");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_MAGNIFICATION_SCALE);
-            return func(scale);
-        } else {
-            HILOG_ERROR("get SetMagnificationScale func failed");
-            return;
-        }
+    SetMagnificationScale func = GetExtFunc<SetMagnificationScale>(
+        ExtMethod::SET_MAGNIFICATION_SCALE, "SetMagnificationScale");
+    if (!func) {
+        HILOG_ERROR("get SetMagnificationScale func failed");
+        return;
     }
     return func(scale);
 }
@@ -597,20 +577,14 @@ void ExtendManagerServiceProxy::UpdateInputFilter(uint32_t flag)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using UpdateInputFilter = void(*)(uint32_t flag);
-    static UpdateInputFilter func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::UPDATE_INPUT_FILTER) == readyFunc_.end()) {
-        func = (UpdateInputFilter)GetFunc("UpdateInputFilter");
-        if (func) {
-            readyFunc_.insert(ExtMethod::UPDATE_INPUT_FILTER);
-            return func(flag);
-        } else {
-            HILOG_ERROR("get UpdateInputFilter func failed");
-            return;
-        }
+    UpdateInputFilter func = GetExtFunc<UpdateInputFilter>(ExtMethod::UPDATE_INPUT_FILTER, "UpdateInputFilter");
+    if (!func) {
+        HILOG_ERROR("get UpdateInputFilter func failed");
+        return;
     }
     return func(flag);
 }
@@ -619,20 +593,15 @@ RetError ExtendManagerServiceProxy::SetCurtainScreenUsingStatus(bool isEnable)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetCurtainScreenUsingStatus = RetError(*)(bool isEnable);
-    static SetCurtainScreenUsingStatus func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_CURTAIN_SCREEN_USING_STATUS) == readyFunc_.end()) {
-        func = (SetCurtainScreenUsingStatus)GetFunc("SetCurtainScreenUsingStatus");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_CURTAIN_SCREEN_USING_STATUS);
-            return func(isEnable);
-        } else {
-            HILOG_ERROR("get SetCurtainScreenUsingStatus func failed");
-            return RET_ERR_NULLPTR;
-        }
+    SetCurtainScreenUsingStatus func = GetExtFunc<SetCurtainScreenUsingStatus>(
+        ExtMethod::SET_CURTAIN_SCREEN_USING_STATUS, "SetCurtainScreenUsingStatus");
+    if (!func) {
+        HILOG_ERROR("get SetCurtainScreenUsingStatus func failed");
+        return RET_ERR_NULLPTR;
     }
     return func(isEnable);
 }
@@ -641,20 +610,15 @@ uint64_t ExtendManagerServiceProxy::GetDefaultDisplayId()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using GetDefaultDisplayId = uint64_t(*)();
-    static GetDefaultDisplayId func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return 0;
     }
-    if (!func || readyFunc_.find(ExtMethod::GET_DEFAULT_DISPLAY_ID) == readyFunc_.end()) {
-        func = (GetDefaultDisplayId)GetFunc("GetDefaultDisplayId");
-        if (func) {
-            readyFunc_.insert(ExtMethod::GET_DEFAULT_DISPLAY_ID);
-            return func();
-        } else {
-            HILOG_ERROR("get GetDefaultDisplayId func failed");
-            return 0;
-        }
+    GetDefaultDisplayId func = GetExtFunc<GetDefaultDisplayId>(
+        ExtMethod::GET_DEFAULT_DISPLAY_ID, "GetDefaultDisplayId");
+    if (!func) {
+        HILOG_ERROR("get GetDefaultDisplayId func failed");
+        return 0;
     }
     return func();
 }
@@ -663,20 +627,15 @@ int32_t ExtendManagerServiceProxy::PublishIgnoreRepeatClickReminder()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using PublishIgnoreRepeatClickReminder = int32_t(*)();
-    static PublishIgnoreRepeatClickReminder func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::PUBLISH_IGNORE_REPEAT_CLICK_REMINDER) == readyFunc_.end()) {
-        func = (PublishIgnoreRepeatClickReminder)GetFunc("PublishIgnoreRepeatClickReminder");
-        if (func) {
-            readyFunc_.insert(ExtMethod::PUBLISH_IGNORE_REPEAT_CLICK_REMINDER);
-            return func();
-        } else {
-            HILOG_ERROR("get PublishIgnoreRepeatClickReminder func failed");
-            return RET_ERR_NULLPTR;
-        }
+    PublishIgnoreRepeatClickReminder func = GetExtFunc<PublishIgnoreRepeatClickReminder>(
+        ExtMethod::PUBLISH_IGNORE_REPEAT_CLICK_REMINDER, "PublishIgnoreRepeatClickReminder");
+    if (!func) {
+        HILOG_ERROR("get PublishIgnoreRepeatClickReminder func failed");
+        return RET_ERR_NULLPTR;
     }
     return func();
 }
@@ -685,20 +644,14 @@ void ExtendManagerServiceProxy::CancelNotification()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using CancelNotification = void(*)();
-    static CancelNotification func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::CANCEl_NOTIFICATION) == readyFunc_.end()) {
-        func = (CancelNotification)GetFunc("CancelNotification");
-        if (func) {
-            readyFunc_.insert(ExtMethod::CANCEl_NOTIFICATION);
-            return func();
-        } else {
-            HILOG_ERROR("get CancelNotification func failed");
-            return;
-        }
+    CancelNotification func = GetExtFunc<CancelNotification>(ExtMethod::CANCEl_NOTIFICATION, "CancelNotification");
+    if (!func) {
+        HILOG_ERROR("get CancelNotification func failed");
+        return;
     }
     return func();
 }
@@ -707,20 +660,14 @@ int32_t ExtendManagerServiceProxy::RegisterTimers(uint64_t beginTime)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using RegisterTimers = int32_t(*)(uint64_t beginTime);
-    static RegisterTimers func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return RET_ERR_NULLPTR;
     }
-    if (!func || readyFunc_.find(ExtMethod::REGISTER_TIMERS) == readyFunc_.end()) {
-        func = (RegisterTimers)GetFunc("RegisterTimers");
-        if (func) {
-            readyFunc_.insert(ExtMethod::REGISTER_TIMERS);
-            return func(beginTime);
-        } else {
-            HILOG_ERROR("get RegisterTimers func failed");
-            return RET_ERR_NULLPTR;
-        }
+    RegisterTimers func = GetExtFunc<RegisterTimers>(ExtMethod::REGISTER_TIMERS, "RegisterTimers");
+    if (!func) {
+        HILOG_ERROR("get RegisterTimers func failed");
+        return RET_ERR_NULLPTR;
     }
     return func(beginTime);
 }
@@ -729,20 +676,14 @@ void ExtendManagerServiceProxy::DestroyTimers()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using DestroyTimers = void(*)();
-    static DestroyTimers func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::DESTORY_TIMERS) == readyFunc_.end()) {
-        func = (DestroyTimers)GetFunc("DestroyTimers");
-        if (func) {
-            readyFunc_.insert(ExtMethod::DESTORY_TIMERS);
-            return func();
-        } else {
-            HILOG_ERROR("get DestroyTimers func failed");
-            return;
-        }
+    DestroyTimers func = GetExtFunc<DestroyTimers>(ExtMethod::DESTORY_TIMERS, "DestroyTimers");
+    if (!func) {
+        HILOG_ERROR("get DestroyTimers func failed");
+        return;
     }
     return func();
 }
@@ -751,20 +692,14 @@ int64_t ExtendManagerServiceProxy::GetWallTimeMs()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using GetWallTimeMs = int64_t(*)();
-    static GetWallTimeMs func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return 0;
     }
-    if (!func || readyFunc_.find(ExtMethod::GET_WALL_TIME_MS) == readyFunc_.end()) {
-        func = (GetWallTimeMs)GetFunc("GetWallTimeMs");
-        if (func) {
-            readyFunc_.insert(ExtMethod::GET_WALL_TIME_MS);
-            return func();
-        } else {
-            HILOG_ERROR("get GetWallTimeMs func failed");
-            return 0;
-        }
+    GetWallTimeMs func = GetExtFunc<GetWallTimeMs>(ExtMethod::GET_WALL_TIME_MS, "GetWallTimeMs");
+    if (!func) {
+        HILOG_ERROR("get GetWallTimeMs func failed");
+        return 0;
     }
     return func();
 }
@@ -773,20 +708,15 @@ int32_t ExtendManagerServiceProxy::PublishTransitionAnimationsReminder()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using PublishTransitionAnimationsReminder = int32_t(*)();
-    static PublishTransitionAnimationsReminder func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return 0;
     }
-    if (!func || readyFunc_.find(ExtMethod::PUBLISH_TRANSITION_ANIMATIONS_REMINDER) == readyFunc_.end()) {
-        func = (PublishTransitionAnimationsReminder)GetFunc("PublishTransitionAnimationsReminder");
-        if (func) {
-            readyFunc_.insert(ExtMethod::PUBLISH_TRANSITION_ANIMATIONS_REMINDER);
-            return func();
-        } else {
-            HILOG_ERROR("get PublishTransitionAnimationsReminder func failed");
-            return 0;
-        }
+    PublishTransitionAnimationsReminder func = GetExtFunc<PublishTransitionAnimationsReminder>(
+        ExtMethod::PUBLISH_TRANSITION_ANIMATIONS_REMINDER, "PublishTransitionAnimationsReminder");
+    if (!func) {
+        HILOG_ERROR("get PublishTransitionAnimationsReminder func failed");
+        return 0;
     }
     return func();
 }
@@ -795,20 +725,15 @@ void ExtendManagerServiceProxy::TransitionAnimationsCancelNotification()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using TransitionAnimationsCancelNotification = void(*)();
-    static TransitionAnimationsCancelNotification func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::TRANSITION_ANIMATIONS_CANCEL_NOTIFICATION) == readyFunc_.end()) {
-        func = (TransitionAnimationsCancelNotification)GetFunc("TransitionAnimationsCancelNotification");
-        if (func) {
-            readyFunc_.insert(ExtMethod::TRANSITION_ANIMATIONS_CANCEL_NOTIFICATION);
-            return func();
-        } else {
-            HILOG_ERROR("get TransitionAnimationsCancelNotification func failed");
-            return;
-        }
+    TransitionAnimationsCancelNotification func = GetExtFunc<TransitionAnimationsCancelNotification>(
+        ExtMethod::TRANSITION_ANIMATIONS_CANCEL_NOTIFICATION, "TransitionAnimationsCancelNotification");
+    if (!func) {
+        HILOG_ERROR("get TransitionAnimationsCancelNotification func failed");
+        return;
     }
     return func();
 }
@@ -817,20 +742,15 @@ int32_t ExtendManagerServiceProxy::TransitionAnimationsRegisterTimers(uint64_t b
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using TransitionAnimationsRegisterTimers = int32_t(*)(uint64_t beginTime);
-    static TransitionAnimationsRegisterTimers func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return 0;
     }
-    if (!func || readyFunc_.find(ExtMethod::TRANSITION_ANIMATIONS_REGISTER_TIMERS) == readyFunc_.end()) {
-        func = (TransitionAnimationsRegisterTimers)GetFunc("TransitionAnimationsRegisterTimers");
-        if (func) {
-            readyFunc_.insert(ExtMethod::TRANSITION_ANIMATIONS_REGISTER_TIMERS);
-            return func(beginTime);
-        } else {
-            HILOG_ERROR("get TransitionAnimationsRegisterTimers func failed");
-            return 0;
-        }
+    TransitionAnimationsRegisterTimers func = GetExtFunc<TransitionAnimationsRegisterTimers>(
+        ExtMethod::TRANSITION_ANIMATIONS_REGISTER_TIMERS, "TransitionAnimationsRegisterTimers");
+    if (!func) {
+        HILOG_ERROR("get TransitionAnimationsRegisterTimers func failed");
+        return 0;
     }
     return func(beginTime);
 }
@@ -839,20 +759,15 @@ void ExtendManagerServiceProxy::TransitionAnimationsDestroyTimers()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using TransitionAnimationsDestroyTimers = void(*)();
-    static TransitionAnimationsDestroyTimers func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::TRANSITION_ANIMATIONS_DESTROY_TIMERS) == readyFunc_.end()) {
-        func = (TransitionAnimationsDestroyTimers)GetFunc("TransitionAnimationsDestroyTimers");
-        if (func) {
-            readyFunc_.insert(ExtMethod::TRANSITION_ANIMATIONS_DESTROY_TIMERS);
-            return func();
-        } else {
-            HILOG_ERROR("get TransitionAnimationsDestroyTimers func failed");
-            return;
-        }
+    TransitionAnimationsDestroyTimers func = GetExtFunc<TransitionAnimationsDestroyTimers>(
+        ExtMethod::TRANSITION_ANIMATIONS_DESTROY_TIMERS, "TransitionAnimationsDestroyTimers");
+    if (!func) {
+        HILOG_ERROR("get TransitionAnimationsDestroyTimers func failed");
+        return;
     }
     return func();
 }
@@ -860,20 +775,15 @@ void ExtendManagerServiceProxy::TransitionAnimationsDestroyTimers()
 void ExtendManagerServiceProxy::OnScreenMagnificationTriggerMethodChanged(int32_t screenMagnificationTriggerMethod)
 {
     using OnScreenMagnificationTriggerMethodChanged = void(*)(int32_t screenMagnificationTriggerMethod);
-    static OnScreenMagnificationTriggerMethodChanged func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::ON_SCREEN_MAGNIFICATION_TRIGGER_METHOD_CHANGE) == readyFunc_.end()) {
-        func = (OnScreenMagnificationTriggerMethodChanged)GetFunc("OnScreenMagnificationTriggerMethodChanged");
-        if (func) {
-            readyFunc_.insert(ExtMethod::ON_SCREEN_MAGNIFICATION_TRIGGER_METHOD_CHANGE);
-            return func(screenMagnificationTriggerMethod);
-        } else {
-            HILOG_ERROR("get OnScreenMagnificationTriggerMethodChanged func failed");
-            return;
-        }
+    OnScreenMagnificationTriggerMethodChanged func = GetExtFunc<OnScreenMagnificationTriggerMethodChanged>(
+        ExtMethod::ON_SCREEN_MAGNIFICATION_TRIGGER_METHOD_CHANGE, "OnScreenMagnificationTriggerMethodChanged");
+    if (!func) {
+        HILOG_ERROR("get OnScreenMagnificationTriggerMethodChanged func failed");
+        return;
     }
     return func(screenMagnificationTriggerMethod);
 }
@@ -881,20 +791,15 @@ void ExtendManagerServiceProxy::OnScreenMagnificationTriggerMethodChanged(int32_
 void ExtendManagerServiceProxy::OnScreenMagnificationTypeChanged(uint32_t screenMagnificationType)
 {
     using OnScreenMagnificationTypeChanged = void(*)(uint32_t screenMagnificationType);
-    static OnScreenMagnificationTypeChanged func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::ON_SCREEN_MAGNIFICATION_TYPE_CHANGED) == readyFunc_.end()) {
-        func = (OnScreenMagnificationTypeChanged)GetFunc("OnScreenMagnificationTypeChanged");
-        if (func) {
-            readyFunc_.insert(ExtMethod::ON_SCREEN_MAGNIFICATION_TYPE_CHANGED);
-            return func(screenMagnificationType);
-        } else {
-            HILOG_ERROR("get OnScreenMagnificationTypeChanged func failed");
-            return;
-        }
+    OnScreenMagnificationTypeChanged func = GetExtFunc<OnScreenMagnificationTypeChanged>(
+        ExtMethod::ON_SCREEN_MAGNIFICATION_TYPE_CHANGED, "OnScreenMagnificationTypeChanged");
+    if (!func) {
+        HILOG_ERROR("get OnScreenMagnificationTypeChanged func failed");
+        return;
     }
     return func(screenMagnificationType);
 }
@@ -902,21 +807,15 @@ void ExtendManagerServiceProxy::OnScreenMagnificationTypeChanged(uint32_t screen
 void ExtendManagerServiceProxy::OnScreenMagnificationStateChanged()
 {
     using OnScreenMagnificationStateChanged = void(*)();
-    static OnScreenMagnificationStateChanged func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-
-    if (!func || readyFunc_.find(ExtMethod::ON_SCREEN_MAGNIFICATION_STATE_CHANGED) == readyFunc_.end()) {
-        func = (OnScreenMagnificationStateChanged)GetFunc("OnScreenMagnificationStateChanged");
-        if (func) {
-            readyFunc_.insert(ExtMethod::ON_SCREEN_MAGNIFICATION_STATE_CHANGED);
-            return func();
-        } else {
-            HILOG_ERROR("get OnScreenMagnificationStateChanged func failed");
-            return;
-        }
+    OnScreenMagnificationStateChanged func = GetExtFunc<OnScreenMagnificationStateChanged>(
+        ExtMethod::ON_SCREEN_MAGNIFICATION_STATE_CHANGED, "OnScreenMagnificationStateChanged");
+    if (!func) {
+        HILOG_ERROR("get OnScreenMagnificationStateChanged func failed");
+        return;
     }
     return func();
 }
@@ -925,20 +824,15 @@ void ExtendManagerServiceProxy::UnregisterDisplayListener()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using UnregisterDisplayListener = void(*)();
-    static UnregisterDisplayListener func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::UNREGISTER_DISPLAY_LISTENER) == readyFunc_.end()) {
-        func = (UnregisterDisplayListener)GetFunc("UnregisterDisplayListener");
-        if (func) {
-            readyFunc_.insert(ExtMethod::UNREGISTER_DISPLAY_LISTENER);
-            func();
-        } else {
-            HILOG_ERROR("UnregisterDisplayListener func failed");
-            return;
-        }
+    UnregisterDisplayListener func = GetExtFunc<UnregisterDisplayListener>(
+        ExtMethod::UNREGISTER_DISPLAY_LISTENER, "UnregisterDisplayListener");
+    if (!func) {
+        HILOG_ERROR("UnregisterDisplayListener func failed");
+        return;
     }
     func();
 }
@@ -947,28 +841,24 @@ void ExtendManagerServiceProxy::GetClickPosition(int32_t &xPos, int32_t &yPos)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using GetClickPosition = void(*)(int32_t &xPos, int32_t &yPos);
-    static GetClickPosition func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::GET_CLICK_POSITION) == readyFunc_.end()) {
-        func = (GetClickPosition)GetFunc("GetClickPosition");
-        if (func) {
-            readyFunc_.insert(ExtMethod::GET_CLICK_POSITION);
-            func(xPos, yPos);
-        } else {
-            HILOG_ERROR("GetClickPosition func failed");
-            return;
-        }
+    GetClickPosition func = GetExtFunc<GetClickPosition>(ExtMethod::GET_CLICK_POSITION, "GetClickPosition");
+    if (!func) {
+        HILOG_ERROR("GetClickPosition func failed");
+        return;
     }
     func(xPos, yPos);
 }
 
 bool ExtendManagerServiceProxy::CheckExtProxyStatus()
 {
+    std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     if (!handle_) {
-        HILOG_ERROR("Extension Proxy is not load");
+        // the extension is only loaded once a feature needs it
+        HILOG_DEBUG("Extension Proxy is not load");
         return false;
     }
     return true;
@@ -978,21 +868,15 @@ bool ExtendManagerServiceProxy::IsMagnificationWindowActivate()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using IsMagnificationWindowActivate = bool (*)();
-    static IsMagnificationWindowActivate func = nullptr;
- 
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return false;
     }
- 
-    if (!func || readyFunc_.find(ExtMethod::IS_MAGNIFICATION_WINDOW_ACTIVATE) == readyFunc_.end()) {
-        func = (IsMagnificationWindowActivate)GetFunc("IsMagnificationWindowActivate");
-        if (func) {
-            readyFunc_.insert(ExtMethod::IS_MAGNIFICATION_WINDOW_ACTIVATE);
-        } else {
-            HILOG_ERROR("IsMagnificationWindowActivate func failed");
-            return false;
-        }
+    IsMagnificationWindowActivate func = GetExtFunc<IsMagnificationWindowActivate>(
+        ExtMethod::IS_MAGNIFICATION_WINDOW_ACTIVATE, "IsMagnificationWindowActivate");
+    if (!func) {
+        HILOG_ERROR("IsMagnificationWindowActivate func failed");
+        return false;
     }
     return func();
 }
@@ -1116,20 +1000,14 @@ bool ExtendManagerServiceProxy::DiscountBrightness(const float discount)
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using DiscountBrightness = bool(*)(const float discount);
-    static DiscountBrightness func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return false;
     }
-    if (!func || readyFunc_.find(ExtMethod::DISCOUNT_BRIGHTNESS) == readyFunc_.end()) {
-        func = (DiscountBrightness)GetFunc("DiscountBrightness");
-        if (func) {
-            readyFunc_.insert(ExtMethod::DISCOUNT_BRIGHTNESS);
-            return func(discount);
-        } else {
-            HILOG_ERROR("get DiscountBrightness func failed");
-            return false;
-        }
+    DiscountBrightness func = GetExtFunc<DiscountBrightness>(ExtMethod::DISCOUNT_BRIGHTNESS, "DiscountBrightness");
+    if (!func) {
+        HILOG_ERROR("get DiscountBrightness func failed");
+        return false;
     }
     return func(discount);
 }
@@ -1171,20 +1049,14 @@ void ExtendManagerServiceProxy::FollowFocuseElement(const int32_t centerX, const
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using FollowFocuseElement = void(*)(const int32_t centerX, const int32_t centerY);
-    static FollowFocuseElement func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::FOLLOW_FOCUSE_ELEMENT) == readyFunc_.end()) {
-        func = (FollowFocuseElement)GetFunc("FollowFocuseElement");
-        if (func) {
-            readyFunc_.insert(ExtMethod::FOLLOW_FOCUSE_ELEMENT);
-            return func(centerX, centerY);
-        } else {
-            HILOG_ERROR("get FollowFocuseElement func failed");
-            return;
-        }
+    FollowFocuseElement func = GetExtFunc<FollowFocuseElement>(ExtMethod::FOLLOW_FOCUSE_ELEMENT, "FollowFocuseElement");
+    if (!func) {
+        HILOG_ERROR("get FollowFocuseElement func failed");
+        return;
     }
     return func(centerX, centerY);
 }
@@ -1193,20 +1065,14 @@ void ExtendManagerServiceProxy::OffZoomGesture()
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using OffZoomGesture = void(*)();
-    static OffZoomGesture func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::OFF_ZOOM_GESTURE) == readyFunc_.end()) {
-        func = (OffZoomGesture)GetFunc("OffZoomGesture");
-        if (func) {
-            readyFunc_.insert(ExtMethod::OFF_ZOOM_GESTURE);
-            return func();
-        } else {
-            HILOG_ERROR("get OffZoomGesture func failed");
-            return;
-        }
+    OffZoomGesture func = GetExtFunc<OffZoomGesture>(ExtMethod::OFF_ZOOM_GESTURE, "OffZoomGesture");
+    if (!func) {
+        HILOG_ERROR("get OffZoomGesture func failed");
+        return;
     }
     return func();
 }
@@ -1231,20 +1097,15 @@ void ExtendManagerServiceProxy::SetMagnificationState(const bool state, const ui
 {
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetMagnificationState = void(*)(const bool state, const uint32_t type, const uint32_t mode);
-    static SetMagnificationState func;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_MAGNIFICATION_STATE) == readyFunc_.end()) {
-        func = (SetMagnificationState)GetFunc("SetMagnificationState");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_MAGNIFICATION_STATE);
-            return func(state, type, mode);
-        } else {
-            HILOG_ERROR("get SetMagnificationState func failed");
-            return;
-        }
+    SetMagnificationState func = GetExtFunc<SetMagnificationState>(
+        ExtMethod::SET_MAGNIFICATION_STATE, "SetMagnificationState");
+    if (!func) {
+        HILOG_ERROR("get SetMagnificationState func failed");
+        return;
     }
     return func(state, type, mode);
 }
@@ -1254,23 +1115,87 @@ void ExtendManagerServiceProxy::SetCurrentAccountId(int32_t accountId)
     HILOG_DEBUG();
     std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
     using SetCurrentAccountIdFunc = void(*)(int32_t accountId);
-    static SetCurrentAccountIdFunc func = nullptr;
     if (!handle_) {
         HILOG_ERROR("handle is null");
         return;
     }
-    if (!func || readyFunc_.find(ExtMethod::SET_CURRENT_ACCOUNT_ID) == readyFunc_.end()) {
-        func = (SetCurrentAccountIdFunc)GetFunc("SetCurrentAccountId");
-        if (func) {
-            readyFunc_.insert(ExtMethod::SET_CURRENT_ACCOUNT_ID);
-            return func(accountId);
-        } else {
-            HILOG_ERROR("get SetCurrentAccountId func failed");
-            return;
-        }
+    SetCurrentAccountIdFunc func = GetExtFunc<SetCurrentAccountIdFunc>(
+        ExtMethod::SET_CURRENT_ACCOUNT_ID, "SetCurrentAccountId");
+    if (!func) {
+        HILOG_ERROR("get SetCurrentAccountId func failed");
+        return;
     }
     return func(accountId);
 }
+
+bool ExtendManagerServiceProxy::DumpInputStatistics(std::string &dumpInfo)
+{
+    std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
+    using DumpInputStatisticsFunc = void(*)(std::string &dumpInfo);
+    if (!handle_) {
+        HILOG_ERROR("handle is null");
+        return false;
+    }
+    DumpInputStatisticsFunc func = GetExtFunc<DumpInputStatisticsFunc>(
+        ExtMethod::DUMP_INPUT_STATISTICS, "DumpInputStatistics");
+    if (!func) {
+        HILOG_ERROR("get DumpInputStatistics func failed");
+        return false;
+    }
+    func(dumpInfo);
+    return true;
+}
+
+bool ExtendManagerServiceProxy::ResetInputStatistics()
+{
+    std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
+    using ResetInputStatisticsFunc = void(*)();
+    if (!handle_) {
+        HILOG_ERROR("handle is null");
+        return false;
+    }
+    ResetInputStatisticsFunc func = GetExtFunc<ResetInputStatisticsFunc>(
+        ExtMethod::RESET_INPUT_STATISTICS, "ResetInputStatistics");
+    if (!func) {
+        HILOG_ERROR("get ResetInputStatistics func failed");
+        return false;
+    }
+    func();
+    return true;
+}
+
+bool ExtendManagerServiceProxy::StartInputRecord()
+{
+    std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
+    using StartInputRecordFunc = bool(*)();
+    if (!handle_) {
+        HILOG_ERROR("handle is null");
+        return false;
+    }
+    StartInputRecordFunc func = GetExtFunc<StartInputRecordFunc>(ExtMethod::START_INPUT_RECORD, "StartInputRecord");
+    if (!func) {
+        HILOG_ERROR("get StartInputRecord func failed");
+        return false;
+    }
+    return func();
+}
+
+bool ExtendManagerServiceProxy::StopInputRecord(std::string &records)
+{
+    std::shared_lock<ffrt::shared_mutex> rLock(rwLock_);
+    using StopInputRecordFunc = void(*)(std::string &records);
+    if (!handle_) {
+        HILOG_ERROR("handle is null");
+        return false;
+    }
+    StopInputRecordFunc func = GetExtFunc<StopInputRecordFunc>(ExtMethod::STOP_INPUT_RECORD, "StopInputRecord");
+    if (!func) {
+        HILOG_ERROR("get StopInputRecord func failed");
+        return false;
+    }
+    func(records);
+    return true;
+}
 } // namespace Accessibility
 } // namespace OHOS
 // LCOV_EXCL_STOP
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include "accessibility_cow_table.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    // the system account and the users of a few displays
+    constexpr int32_t ACCOUNT_IDS[] = {0, 100, 101, 102};
+    constexpr int32_t MAX_THREADS = 16;
+
+    // the account table before the copy on write one, a map under a mutex
+    class LockedAccountMap {
+    public:
+        void Add(int32_t accountId, const std::shared_ptr<int32_t> &accountData)
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            accountDataMap_[accountId] = accountData;
+        }
+
+        std::shared_ptr<int32_t> Get(int32_t accountId)
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            auto iter = accountDataMap_.find(accountId);
+            return iter == accountDataMap_.end() ? nullptr : iter->second;
+        }
+
+    private:
+        std::map<int32_t, std::shared_ptr<int32_t>> accountDataMap_;
+        ffrt::mutex mutex_;
+    };
+
+    LockedAccountMap &GetLockedAccountMap()
+    {
+        static LockedAccountMap accountMap;
+        static bool isFilled = [] {
+            for (int32_t accountId : ACCOUNT_IDS) {
+                accountMap.Add(accountId, std::make_shared<int32_t>(accountId));
+            }
+            return true;
+        }();
+        (void)isFilled;
+        return accountMap;
+    }
+
+    AccessibilityCowTable<int32_t, std::shared_ptr<int32_t>> &GetCowAccountTable()
+    {
+        static AccessibilityCowTable<int32_t, std::shared_ptr<int32_t>> accountTable;
+        static bool isFilled = [] {
+            bool inserted = false;
+            for (int32_t accountId : ACCOUNT_IDS) {
+                accountTable.FindOrInsert(accountId, [accountId]() { return std::make_shared<int32_t>(accountId); },
+                    inserted);
+            }
+            return true;
+        }();
+        (void)isFilled;
+        return accountTable;
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForLockedAccountLookup
+     * @tc.desc: Testcase for looking up the caller's account in a map under a mutex from 1 to 16 threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForLockedAccountLookup(benchmark::State &state)
+    {
+        LockedAccountMap &accountMap = GetLockedAccountMap();
+        size_t index = static_cast<size_t>(state.thread_index());
+        for (auto _ : state) {
+            int32_t accountId = ACCOUNT_IDS[index++ % std::size(ACCOUNT_IDS)];
+            benchmark::DoNotOptimize(accountMap.Get(accountId));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForCowAccountLookup
+     * @tc.desc: Testcase for looking up the caller's account in the copy on write table from 1 to 16 threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForCowAccountLookup(benchmark::State &state)
+    {
+        auto &accountTable = GetCowAccountTable();
+        size_t index = static_cast<size_t>(state.thread_index());
+        for (auto _ : state) {
+            int32_t accountId = ACCOUNT_IDS[index++ % std::size(ACCOUNT_IDS)];
+            std::shared_ptr<int32_t> accountData = nullptr;
+            accountTable.Find(accountId, accountData);
+            benchmark::DoNotOptimize(accountData);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BenchmarkTestForLockedAccountLookup)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+    BENCHMARK(BenchmarkTestForCowAccountLookup)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <dlfcn.h>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+#include "accessibility_ext_symbol_table.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    const char *EXT_LIBRARY_NAME = "libaams_ext.z.so";
+
+    // the callbacks the service hands to the extension right after loading it
+    const char *CALLBACK_SETTERS[] = {
+        "SetSendAccessibilityEventToAACallback", "SetSendTouchGuideGestureToAACallback",
+        "SetFindFocusedElementCallback", "SetExecuteActionOnAccessibilityFocusedCallback",
+        "SetGetFocusedWindowIdCallback", "SetGetAccessibilityFocusedWindowIdCallback",
+        "SetGetAccessibilityWindowCallback", "SetSendPointerEventForHoverCallback", "SetGetDelayTimeCallback",
+        "SetGetMagnificationStateCallback", "ExtendGetMagnificationTriggerMethodCallback",
+        "ExtendGetMagnificationModeCallback", "ExtendGetMagnificationScaleCallback",
+        "ExtendUpdateInputFilterCallback", "SetMagnificationModeCallback", "GetMagnificationTypeCallback",
+        "ExtendAnnouncedForMagnificationCallback", "SetDispatchKeyEventCallback", "SetMagnificationScaleCallback",
+        "ExtendGetAccessibilityWindowsCallback", "ExtendSubscribeOsAccountCallback", "SetCheckDisplayIdCallback",
+        "SetNotifyZoomGesutureConflictDialogCallback", "SetGetNotifyZoomGestureConflictCallback",
+    };
+
+    // the entry points of the extension, in the order of ExtMethod
+    const char *ENTRY_POINTS[] = {
+        "InjectEvents", "SetServiceOnKeyEventResult", "SetMouseAutoClick", "SetClickConfig",
+        "SetMagnificationMode", "SetMagnificationType", "SetMagnificationScale", "UpdateInputFilter",
+        "SetCurtainScreenUsingStatus", "GetDefaultDisplayId", "PublishIgnoreRepeatClickReminder",
+        "CancelNotification", "RegisterTimers", "DestroyTimers", "GetWallTimeMs",
+        "PublishTransitionAnimationsReminder", "TransitionAnimationsCancelNotification",
+        "TransitionAnimationsRegisterTimers", "TransitionAnimationsDestroyTimers", "AddKeyEvent",
+        "DiscountBrightness", "UnregisterDisplayListener", "GetClickPosition", "FollowFocuseElement",
+        "OnScreenMagnificationTypeChanged", "OnScreenMagnificationTriggerMethodChanged",
+        "OnScreenMagnificationStateChanged", "OffZoomGesture", "SetMagnificationState",
+        "IsMagnificationWindowActivate", "SetCurrentAccountId", "DumpInputStatistics", "ResetInputStatistics",
+        "StartInputRecord", "StopInputRecord",
+    };
+    constexpr size_t ENTRY_POINT_COUNT = std::size(ENTRY_POINTS);
+    constexpr size_t UPDATE_INPUT_FILTER_SLOT = 7;
+    constexpr size_t SET_CURRENT_ACCOUNT_ID_SLOT = 30;
+    constexpr int64_t KILOBYTE = 1024;
+
+    int64_t GetResidentKilobytes()
+    {
+        std::ifstream statm("/proc/self/statm");
+        int64_t size = 0;
+        int64_t resident = 0;
+        if (!(statm >> size >> resident)) {
+            return 0;
+        }
+        return resident * sysconf(_SC_PAGESIZE) / KILOBYTE;
+    }
+
+    size_t ResolveCallbackSetters(void *handle)
+    {
+        size_t count = 0;
+        for (const char *name : CALLBACK_SETTERS) {
+            count += dlsym(handle, name) != nullptr ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForEagerExtStartup
+     * @tc.desc: Testcase for getting ready the way the service did before, loading the extension at startup
+     *           and resolving all of its entry points, with the resident memory the extension adds.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForEagerExtStartup(benchmark::State &state)
+    {
+        int64_t residentBefore = GetResidentKilobytes();
+        int64_t residentLoaded = residentBefore;
+        size_t symbolCount = 0;
+        for (auto _ : state) {
+            AccessibilityExtSymbolTable<ENTRY_POINT_COUNT> extFuncs;
+            void *handle = dlopen(EXT_LIBRARY_NAME, RTLD_LAZY);
+            if (handle == nullptr) {
+                state.SkipWithError("the extension is not installed");
+                break;
+            }
+            symbolCount = ResolveCallbackSetters(handle);
+            for (size_t slot = 0; slot < ENTRY_POINT_COUNT; slot++) {
+                benchmark::DoNotOptimize(extFuncs.Get(slot, ENTRY_POINTS[slot],
+                    [handle](const char *name) { return dlsym(handle, name); }));
+            }
+            symbolCount += extFuncs.GetResolvedCount();
+            state.PauseTiming();
+            residentLoaded = GetResidentKilobytes();
+            dlclose(handle);
+            state.ResumeTiming();
+        }
+        state.counters["symbols"] = static_cast<double>(symbolCount);
+        state.counters["residentKB"] = static_cast<double>(residentLoaded - residentBefore);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForLazyExtStartup
+     * @tc.desc: Testcase for getting ready with no accessibility feature on, the extension is never loaded.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForLazyExtStartup(benchmark::State &state)
+    {
+        int64_t residentBefore = GetResidentKilobytes();
+        size_t symbolCount = 0;
+        for (auto _ : state) {
+            AccessibilityExtSymbolTable<ENTRY_POINT_COUNT> extFuncs;
+            // UpdateInputFilter(0) and the setting observers only reach the extension once it is loaded
+            symbolCount = extFuncs.GetResolvedCount();
+            benchmark::DoNotOptimize(symbolCount);
+        }
+        state.counters["symbols"] = static_cast<double>(symbolCount);
+        state.counters["residentKB"] = static_cast<double>(GetResidentKilobytes() - residentBefore);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForLazyExtFirstUse
+     * @tc.desc: Testcase for the first feature turned on, loading the extension and resolving only the entry
+     *           points the input filter update uses.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForLazyExtFirstUse(benchmark::State &state)
+    {
+        size_t symbolCount = 0;
+        for (auto _ : state) {
+            AccessibilityExtSymbolTable<ENTRY_POINT_COUNT> extFuncs;
+            void *handle = dlopen(EXT_LIBRARY_NAME, RTLD_LAZY);
+            if (handle == nullptr) {
+                state.SkipWithError("the extension is not installed");
+                break;
+            }
+            auto resolve = [handle](const char *name) { return dlsym(handle, name); };
+            symbolCount = ResolveCallbackSetters(handle);
+            benchmark::DoNotOptimize(extFuncs.Get(SET_CURRENT_ACCOUNT_ID_SLOT,
+                ENTRY_POINTS[SET_CURRENT_ACCOUNT_ID_SLOT], resolve));
+            benchmark::DoNotOptimize(extFuncs.Get(UPDATE_INPUT_FILTER_SLOT,
+                ENTRY_POINTS[UPDATE_INPUT_FILTER_SLOT], resolve));
+            symbolCount += extFuncs.GetResolvedCount();
+            state.PauseTiming();
+            dlclose(handle);
+            state.ResumeTiming();
+        }
+        state.counters["symbols"] = static_cast<double>(symbolCount);
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForResolvedExtLookup
+     * @tc.desc: Testcase for calling an entry point already resolved, from 1 to 8 threads.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForResolvedExtLookup(benchmark::State &state)
+    {
+        static AccessibilityExtSymbolTable<ENTRY_POINT_COUNT> extFuncs;
+        static int32_t symbol = 0;
+        auto resolve = [](const char *) -> void * { return &symbol; };
+        size_t slot = static_cast<size_t>(state.thread_index()) % ENTRY_POINT_COUNT;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(extFuncs.Get(slot, ENTRY_POINTS[slot], resolve));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BenchmarkTestForEagerExtStartup)->Iterations(100);
+    BENCHMARK(BenchmarkTestForLazyExtStartup);
+    BENCHMARK(BenchmarkTestForLazyExtFirstUse)->Iterations(100);
+    BENCHMARK(BenchmarkTestForResolvedExtLookup)->ThreadRange(1, 8)->UseRealTime();
+}
+
+BENCHMARK_MAIN();
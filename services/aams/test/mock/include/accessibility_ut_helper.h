@@ -482,6 +482,23 @@ public:
     {
         return isMenuMove_;
     }
+
+    // the mock bundle manager answers the query of extension abilities with one ability per bundle
+    void SetExtensionAbilityQuery(bool result, const std::vector<std::string> &bundleNames)
+    {
+        extensionAbilityQueryResult_ = result;
+        extensionAbilityBundles_ = bundleNames;
+    }
+
+    bool GetExtensionAbilityQueryResult() const
+    {
+        return extensionAbilityQueryResult_;
+    }
+
+    const std::vector<std::string> &GetExtensionAbilityBundles() const
+    {
+        return extensionAbilityBundles_;
+    }
 public:
     static const int32_t accountId_ = 100;
 
@@ -524,6 +541,8 @@ private:
     bool tapOnHotArea_ = false;
     bool isMove_ = false;
     bool isMenuMove_ = false;
+    bool extensionAbilityQueryResult_ = true;
+    std::vector<std::string> extensionAbilityBundles_;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -31,13 +31,13 @@ public:
     MOCK_METHOD3(SetServiceOnKeyEventResult,
         void(int32_t connectionId, bool isHandled, uint32_t sequenceNum));
     MOCK_METHOD0(DestroyEvents, void());
-    MOCK_METHOD1(RemoveProcessingEvent, bool(std::shared_ptr<ProcessingEvent> event));
+    MOCK_METHOD0(ProcessTimeoutEvents, void());
 };
 
 class MockKeyEventFilterEventHandler : public KeyEventFilterEventHandler {
 public:
     MockKeyEventFilterEventHandler(
-        const std::shared_ptr<AppExecFwk::EventRunner>& runner, KeyEventFilter& keyEventFilter);
+        const std::shared_ptr<GestureTimerWheel>& wheel, KeyEventFilter& keyEventFilter);
     virtual ~MockKeyEventFilterEventHandler() = default;
 
     MOCK_METHOD1(ProcessEvent, void(const AppExecFwk::InnerEvent::Pointer& event));
@@ -245,6 +245,25 @@ bool AccessibilityAccountData::GetInstalledAbilitiesFromBMS()
     return true;
 }
 
+bool AccessibilityAccountData::RevalidateInstalledAbilities(
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> &changes)
+{
+    HILOG_DEBUG("start.");
+    (void)changes;
+    return false;
+}
+
+void AccessibilityAccountData::RemoveInstalledAbilityIndex()
+{
+    HILOG_DEBUG("start.");
+}
+
+void AccessibilityAccountData::RemoveInstalledAbilityIndexFile(int32_t accountId)
+{
+    HILOG_DEBUG("start.");
+    (void)accountId;
+}
+
 void AccessibilityAccountData::SetScreenReaderState(const std::string &name, const std::string &state)
 {
     HILOG_DEBUG("start.");
@@ -400,76 +419,55 @@ void AccessibilityAccountData::UpdateAutoStartEnabledAbilities()
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::AddAccountData(
     int32_t accountId)
 {
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
+    bool inserted = false;
+    sptr<AccessibilityAccountData> accountData = accountDataTable_.FindOrInsert(accountId,
+        [accountId]() -> sptr<AccessibilityAccountData> {
+            sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
+            if (accountData == nullptr) {
+                return nullptr;
+            }
+            accountData->Init();
+            return accountData;
+        }, inserted);
+    if (!inserted) {
         HILOG_DEBUG("accountId is existed");
-        return iter->second;
-    }
-
-    sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
-    if (accountData == nullptr) {
-        return nullptr;
     }
-
-    accountData->Init();
-    accountDataMap_[accountId] = accountData;
     return accountData;
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::GetCurrentAccountData(
     int32_t accountId)
 {
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        return iter->second;
-    }
-
-    sptr<AccessibilityAccountData> accountData = new(std::nothrow) AccessibilityAccountData(accountId);
-    if (!accountData) {
-        return nullptr;
-    }
-
-    accountDataMap_[accountId] = accountData;
-    return accountData;
+    bool inserted = false;
+    return accountDataTable_.FindOrInsert(accountId, [accountId]() -> sptr<AccessibilityAccountData> {
+        return new(std::nothrow) AccessibilityAccountData(accountId);
+    }, inserted);
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::GetAccountData(
     int32_t accountId)
 {
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        return iter->second;
-    }
-
-    return nullptr;
+    sptr<AccessibilityAccountData> accountData = nullptr;
+    accountDataTable_.Find(accountId, accountData);
+    return accountData;
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::RemoveAccountData(
     int32_t accountId)
 {
     sptr<AccessibilityAccountData> accountData = nullptr;
-    auto iter = accountDataMap_.find(accountId);
-    if (iter != accountDataMap_.end()) {
-        accountData = iter->second;
-        accountDataMap_.erase(iter);
-    }
-
+    accountDataTable_.Erase(accountId, accountData);
     return accountData;
 }
 
 std::vector<int32_t> AccessibilityAccountDataMap::GetAllAccountIds()
 {
-    std::lock_guard<ffrt::mutex> lock(accountDataMutex_);
-    std::vector<int32_t> accountIds;
-    for (auto it = accountDataMap_.begin(); it != accountDataMap_.end(); it++) {
-        accountIds.push_back(it->first);
-    }
-    return accountIds;
+    return accountDataTable_.GetKeys();
 }
 
 void AccessibilityAccountDataMap::Clear()
 {
-    accountDataMap_.clear();
+    accountDataTable_.Clear();
 }
 
 AccountSA::OsAccountType AccessibilityAccountData::GetAccountType()
@@ -55,15 +55,27 @@ void AccessibilityCircleDrawingManager::UpdatePointerVisible(bool state)
     (void)state;
 }
 
-void AccessibilityCircleDrawingManager::DrawPointer(int32_t physicalX, int32_t physicalY, int32_t angle,
-    uint64_t screenId, int32_t startAngle)
+void AccessibilityCircleDrawingManager::BeginProgress(int32_t physicalX, int32_t physicalY, uint64_t screenId,
+    int32_t startAngle)
 {
     HILOG_DEBUG();
     (void)physicalX;
     (void)physicalY;
-    (void)angle;
     (void)screenId;
     (void)startAngle;
 }
+
+void AccessibilityCircleDrawingManager::UpdateProgress(int32_t physicalX, int32_t physicalY, int32_t angle)
+{
+    HILOG_DEBUG();
+    (void)physicalX;
+    (void)physicalY;
+    (void)angle;
+}
+
+void AccessibilityCircleDrawingManager::EndProgress()
+{
+    HILOG_DEBUG();
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
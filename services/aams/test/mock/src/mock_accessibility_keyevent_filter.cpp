@@ -46,19 +46,8 @@ void KeyEventFilter::DispatchKeyEvent(MMI::KeyEvent& event)
     sequenceNum_ = 0;
 }
 
-bool KeyEventFilter::RemoveProcessingEvent(std::shared_ptr<ProcessingEvent> event)
-{
-    (void)event;
-    return true;
-}
-
-std::shared_ptr<KeyEventFilter::ProcessingEvent> KeyEventFilter::FindProcessingEvent(
-    int32_t connectionId, uint32_t sequenceNum)
-{
-    (void)connectionId;
-    (void)sequenceNum;
-    return nullptr;
-}
+void KeyEventFilter::ProcessTimeoutEvents()
+{}
 
 void KeyEventFilter::DestroyEvents()
 {}
@@ -68,20 +57,5 @@ void KeyEventFilter::SendEventToNext(MMI::KeyEvent& event)
     (void)event;
 }
 
-KeyEventFilterEventHandler::KeyEventFilterEventHandler(
-    const std::shared_ptr<AppExecFwk::EventRunner>& runner, KeyEventFilter& keyEventFilter)
-    : AppExecFwk::EventHandler(runner), keyEventFilter_(keyEventFilter)
-{
-    (void)runner;
-    (void)keyEventFilter;
-    HILOG_DEBUG("KeyEventFilterEventHandler is created");
-}
-
-void KeyEventFilterEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
-{
-    (void)event;
-    auto processingEvent = event->GetSharedObject<KeyEventFilter::ProcessingEvent>();
-    keyEventFilter_.RemoveProcessingEvent(processingEvent);
-}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
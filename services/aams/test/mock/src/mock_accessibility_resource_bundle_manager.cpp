@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_resource_bundle_manager.h"
+#include "accessibility_ut_helper.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityResourceBundleManager::AccessibilityResourceBundleManager()
+{
+}
+
+AccessibilityResourceBundleManager::~AccessibilityResourceBundleManager()
+{
+}
+
+sptr<AppExecFwk::IBundleMgr> AccessibilityResourceBundleManager::GetBundleMgrProxy()
+{
+    HILOG_DEBUG();
+    return nullptr;
+}
+
+ErrCode AccessibilityResourceBundleManager::GetBundleInfoV9(const std::string& bundleName, int32_t flags,
+    AppExecFwk::BundleInfo& bundleInfo, int32_t userId)
+{
+    (void)bundleName;
+    (void)flags;
+    (void)bundleInfo;
+    (void)userId;
+    return ERR_INVALID_VALUE;
+}
+
+bool AccessibilityResourceBundleManager::GetBundleNameByUid(const int uid, std::string &bundleName)
+{
+    (void)uid;
+    (void)bundleName;
+    return false;
+}
+
+int AccessibilityResourceBundleManager::GetUidByBundleName(const std::string &bundleName,
+    const std::string &abilityName, const int userId)
+{
+    (void)bundleName;
+    (void)abilityName;
+    (void)userId;
+    return ERR_INVALID_VALUE;
+}
+
+bool AccessibilityResourceBundleManager::QueryExtensionAbilityInfos(
+    const AppExecFwk::ExtensionAbilityType &extensionType, const int32_t &userId,
+    std::vector<AppExecFwk::ExtensionAbilityInfo> &extensionInfos)
+{
+    (void)extensionType;
+    (void)userId;
+    AccessibilityAbilityHelper &helper = AccessibilityAbilityHelper::GetInstance();
+    if (!helper.GetExtensionAbilityQueryResult()) {
+        HILOG_ERROR("QueryExtensionAbilityInfos failed");
+        return false;
+    }
+    for (const auto &bundleName : helper.GetExtensionAbilityBundles()) {
+        AppExecFwk::ExtensionAbilityInfo info;
+        info.bundleName = bundleName;
+        info.moduleName = "entry";
+        info.name = "AccessibilityExtAbility";
+        extensionInfos.push_back(info);
+    }
+    return true;
+}
+
+void AccessibilityResourceBundleManager::BundleManagerDeathRecipient::OnRemoteDied(
+    const wptr<IRemoteObject> &remote)
+{
+    (void)remote;
+}
+
+void AccessibilityResourceBundleManager::OnBundleManagerDied(const wptr<IRemoteObject> &remote)
+{
+    (void)remote;
+}
+} // namespace Accessibility
+} // namespace OHOS
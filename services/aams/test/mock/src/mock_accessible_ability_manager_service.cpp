@@ -82,6 +82,17 @@ int AccessibleAbilityManagerService::Dump(int fd, const std::vector<std::u16stri
     return 0;
 }
 
+int32_t AccessibleAbilityManagerService::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    return AccessibleAbilityManagerServiceStub::OnRemoteRequest(code, data, reply, option);
+}
+
+void AccessibleAbilityManagerService::GetRunnerQueueDepths(std::map<std::string, uint64_t> &queueDepths)
+{
+    (void)queueDepths;
+}
+
 ErrCode AccessibleAbilityManagerService::SendEvent(const AccessibilityEventInfoParcel& eventInfoParce,
     int32_t flag)
 {
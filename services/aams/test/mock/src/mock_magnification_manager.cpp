@@ -37,6 +37,26 @@ std::shared_ptr<MagnificationMenuManager> MagnificationManager::GetMenuManager()
     return nullptr;
 }
 
+std::shared_ptr<MagnificationUpdateScheduler> MagnificationManager::GetUpdateScheduler()
+{
+    return nullptr;
+}
+
+std::shared_ptr<MagnificationUpdateScheduler> MagnificationManager::FindUpdateScheduler()
+{
+    return nullptr;
+}
+
+std::shared_ptr<MagnificationFocusFollower> MagnificationManager::GetFocusFollower()
+{
+    return nullptr;
+}
+
+std::shared_ptr<MagnificationFocusFollower> MagnificationManager::FindFocusFollower()
+{
+    return nullptr;
+}
+
 void MagnificationManager::OnMagnificationTypeChanged(uint32_t magnificationType)
 {
     (void)magnificationType;
@@ -1851,6 +1851,71 @@ HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_AddAbil
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_AddAbility001 end";
 }
 
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_AddAbility002
+ * @tc.name: AddAbility
+ * @tc.desc: Check a failed query of the bundle manager leaves the installed abilities and the index alone.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_AddAbility002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_AddAbility002 start";
+    const int32_t accountId = 1;
+    const std::string bundleName = "com.example.reader";
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(true, {bundleName});
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    accountData->RemoveInstalledAbilityIndex();
+    EXPECT_TRUE(accountData->GetInstalledAbilitiesFromBMS());
+    EXPECT_EQ(1, static_cast<int>(accountData->GetInstalledAbilities().size()));
+
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(false, {});
+    accountData->AddAbility(bundleName);
+    EXPECT_EQ(1, static_cast<int>(accountData->GetInstalledAbilities().size()));
+
+    // the next startup reads the bundle back from the index without the bundle manager
+    sptr<AccessibilityAccountData> restarted = new AccessibilityAccountData(accountId);
+    EXPECT_TRUE(restarted->GetInstalledAbilitiesFromBMS());
+    EXPECT_EQ(1, static_cast<int>(restarted->GetInstalledAbilities().size()));
+
+    restarted->RemoveInstalledAbilityIndex();
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(true, {});
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_AddAbility002 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_RevalidateInstalledAbilities001
+ * @tc.name: RevalidateInstalledAbilities
+ * @tc.desc: Check the packages changed while the index was not updated are found once after a startup.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_RevalidateInstalledAbilities001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_RevalidateInstalledAbilities001 start";
+    const int32_t accountId = 1;
+    const std::string removedBundle = "com.example.reader";
+    const std::string addedBundle = "com.example.switch";
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(true, {removedBundle});
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    accountData->RemoveInstalledAbilityIndex();
+    EXPECT_TRUE(accountData->GetInstalledAbilitiesFromBMS());
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> changes;
+    EXPECT_FALSE(accountData->RevalidateInstalledAbilities(changes));
+
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(true, {addedBundle});
+    sptr<AccessibilityAccountData> restarted = new AccessibilityAccountData(accountId);
+    EXPECT_TRUE(restarted->GetInstalledAbilitiesFromBMS());
+    EXPECT_TRUE(restarted->RevalidateInstalledAbilities(changes));
+    EXPECT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[removedBundle], AccessibilityInstalledAbilityIndex::BundleChange::REMOVED);
+    EXPECT_EQ(changes[addedBundle], AccessibilityInstalledAbilityIndex::BundleChange::ADDED);
+    changes.clear();
+    EXPECT_FALSE(restarted->RevalidateInstalledAbilities(changes));
+
+    restarted->RemoveInstalledAbilityIndex();
+    AccessibilityAbilityHelper::GetInstance().SetExtensionAbilityQuery(true, {});
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_RevalidateInstalledAbilities001 end";
+}
+
 /**
  * @tc.number: AccessibilityAccountData_Unittest_GetAbilityAutoStartStateKey001
  * @tc.name: GetAbilityAutoStartStateKey
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "accessibility_cow_table.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t STABLE_ACCOUNT_ID = 100;
+    constexpr int32_t CHURN_ACCOUNT_ID = 101;
+    constexpr int32_t READER_COUNT = 4;
+    constexpr int32_t WRITE_COUNT = 2000;
+} // namespace
+
+using AccountTable = AccessibilityCowTable<int32_t, std::shared_ptr<int32_t>>;
+
+class AccessibilityCowTableUnitTest : public ::testing::Test {
+public:
+    AccessibilityCowTableUnitTest()
+    {}
+    ~AccessibilityCowTableUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void AccessibilityCowTableUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityCowTableUnitTest Start ######################";
+}
+
+void AccessibilityCowTableUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityCowTableUnitTest End ######################";
+}
+
+void AccessibilityCowTableUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+}
+
+void AccessibilityCowTableUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+/**
+ * @tc.number: AccessibilityCowTable_Unittest_FindOrInsert_001
+ * @tc.name: FindOrInsert
+ * @tc.desc: Test the factory only runs for a missing key and a null value is not inserted.
+ */
+HWTEST_F(AccessibilityCowTableUnitTest, AccessibilityCowTable_Unittest_FindOrInsert_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_FindOrInsert_001 start";
+    AccountTable table;
+    int32_t factoryCount = 0;
+    bool inserted = false;
+    auto first = table.FindOrInsert(STABLE_ACCOUNT_ID, [&factoryCount]() {
+        factoryCount++;
+        return std::make_shared<int32_t>(STABLE_ACCOUNT_ID);
+    }, inserted);
+    EXPECT_TRUE(inserted);
+    auto second = table.FindOrInsert(STABLE_ACCOUNT_ID, [&factoryCount]() {
+        factoryCount++;
+        return std::make_shared<int32_t>(0);
+    }, inserted);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(factoryCount, 1);
+
+    auto missing = table.FindOrInsert(CHURN_ACCOUNT_ID, []() { return std::shared_ptr<int32_t>(); }, inserted);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(missing, nullptr);
+    std::shared_ptr<int32_t> value = nullptr;
+    EXPECT_FALSE(table.Find(CHURN_ACCOUNT_ID, value));
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_FindOrInsert_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityCowTable_Unittest_Erase_001
+ * @tc.name: Erase
+ * @tc.desc: Test the keys stay sorted, and erase and clear drop the table's references to the values.
+ */
+HWTEST_F(AccessibilityCowTableUnitTest, AccessibilityCowTable_Unittest_Erase_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_Erase_001 start";
+    AccountTable table;
+    bool inserted = false;
+    for (int32_t accountId : {CHURN_ACCOUNT_ID, 0, STABLE_ACCOUNT_ID}) {
+        table.FindOrInsert(accountId, [accountId]() { return std::make_shared<int32_t>(accountId); }, inserted);
+    }
+    EXPECT_EQ(table.GetKeys(), std::vector<int32_t>({0, STABLE_ACCOUNT_ID, CHURN_ACCOUNT_ID}));
+
+    std::shared_ptr<int32_t> removed = nullptr;
+    EXPECT_TRUE(table.Erase(CHURN_ACCOUNT_ID, removed));
+    ASSERT_NE(removed, nullptr);
+    EXPECT_EQ(*removed, CHURN_ACCOUNT_ID);
+    EXPECT_EQ(removed.use_count(), 1);
+    EXPECT_FALSE(table.Erase(CHURN_ACCOUNT_ID, removed));
+    EXPECT_EQ(table.GetKeys(), std::vector<int32_t>({0, STABLE_ACCOUNT_ID}));
+
+    std::shared_ptr<int32_t> stable = nullptr;
+    EXPECT_TRUE(table.Find(STABLE_ACCOUNT_ID, stable));
+    table.Clear();
+    EXPECT_EQ(stable.use_count(), 1);
+    EXPECT_TRUE(table.GetKeys().empty());
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_Erase_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityCowTable_Unittest_Concurrent_001
+ * @tc.name: Find
+ * @tc.desc: Test readers always see a stable account while a writer adds and removes another one.
+ */
+HWTEST_F(AccessibilityCowTableUnitTest, AccessibilityCowTable_Unittest_Concurrent_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_Concurrent_001 start";
+    AccountTable table;
+    bool inserted = false;
+    table.FindOrInsert(STABLE_ACCOUNT_ID, []() { return std::make_shared<int32_t>(STABLE_ACCOUNT_ID); }, inserted);
+
+    std::atomic<bool> stop = false;
+    std::atomic<int32_t> failures = 0;
+    std::vector<std::thread> readers;
+    for (int32_t i = 0; i < READER_COUNT; i++) {
+        readers.emplace_back([&table, &stop, &failures]() {
+            while (!stop.load()) {
+                std::shared_ptr<int32_t> value = nullptr;
+                if (!table.Find(STABLE_ACCOUNT_ID, value) || *value != STABLE_ACCOUNT_ID) {
+                    failures++;
+                }
+                if (table.Find(CHURN_ACCOUNT_ID, value) && *value != CHURN_ACCOUNT_ID) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (int32_t i = 0; i < WRITE_COUNT; i++) {
+        table.FindOrInsert(CHURN_ACCOUNT_ID, []() { return std::make_shared<int32_t>(CHURN_ACCOUNT_ID); },
+            inserted);
+        std::shared_ptr<int32_t> removed = nullptr;
+        table.Erase(CHURN_ACCOUNT_ID, removed);
+    }
+    stop.store(true);
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+    GTEST_LOG_(INFO) << "AccessibilityCowTable_Unittest_Concurrent_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
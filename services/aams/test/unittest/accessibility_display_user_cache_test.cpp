@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include "accessibility_display_user_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr uint64_t MAIN_DISPLAY_ID = 0;
+    constexpr uint64_t SECOND_DISPLAY_ID = 12;
+    constexpr int32_t MAIN_USER_ID = 100;
+    constexpr int32_t SECOND_USER_ID = 101;
+} // namespace
+
+class AccessibilityDisplayUserCacheTest : public ::testing::Test {
+public:
+    AccessibilityDisplayUserCacheTest()
+    {}
+    ~AccessibilityDisplayUserCacheTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    int64_t now_ = 0;
+    int32_t resolveCount_ = 0;
+    bool isServiceReady_ = true;
+    std::map<uint64_t, int32_t> foregroundUsers_ {};
+    std::unique_ptr<AccessibilityDisplayUserCache> cache_ = nullptr;
+};
+
+void AccessibilityDisplayUserCacheTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityDisplayUserCacheTest Start ######################";
+}
+
+void AccessibilityDisplayUserCacheTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityDisplayUserCacheTest End ######################";
+}
+
+void AccessibilityDisplayUserCacheTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    now_ = 0;
+    resolveCount_ = 0;
+    isServiceReady_ = true;
+    foregroundUsers_ = {{MAIN_DISPLAY_ID, MAIN_USER_ID}, {SECOND_DISPLAY_ID, SECOND_USER_ID}};
+    cache_ = std::make_unique<AccessibilityDisplayUserCache>(
+        [this](uint64_t displayId, int32_t &userId) {
+            resolveCount_++;
+            auto iter = foregroundUsers_.find(displayId);
+            if (!isServiceReady_ || iter == foregroundUsers_.end()) {
+                return false;
+            }
+            userId = iter->second;
+            return true;
+        },
+        [this]() { return now_; });
+}
+
+void AccessibilityDisplayUserCacheTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    cache_ = nullptr;
+}
+
+/**
+ * @tc.number: AccessibilityDisplayUserCache_Unittest_GetUserId_001
+ * @tc.name: GetUserId
+ * @tc.desc: Test only the first lookup of every display calls the account service.
+ */
+HWTEST_F(AccessibilityDisplayUserCacheTest, AccessibilityDisplayUserCache_Unittest_GetUserId_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_GetUserId_001 start";
+    constexpr int32_t lookupCount = 100;
+    int32_t userId = -1;
+    for (int32_t i = 0; i < lookupCount; i++) {
+        EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+        EXPECT_EQ(userId, MAIN_USER_ID);
+        EXPECT_TRUE(cache_->GetUserId(SECOND_DISPLAY_ID, userId));
+        EXPECT_EQ(userId, SECOND_USER_ID);
+    }
+    EXPECT_EQ(resolveCount_, 2);
+    EXPECT_TRUE(cache_->IsForegroundUser(SECOND_USER_ID));
+    EXPECT_FALSE(cache_->IsForegroundUser(SECOND_USER_ID + 1));
+
+    // an unknown display is not cached
+    EXPECT_FALSE(cache_->GetUserId(SECOND_DISPLAY_ID + 1, userId));
+    EXPECT_FALSE(cache_->GetUserId(SECOND_DISPLAY_ID + 1, userId));
+    EXPECT_EQ(resolveCount_, 4);
+
+    DisplayUserCacheStatistics statistics = cache_->GetStatistics();
+    EXPECT_EQ(statistics.hitCount, 2 * lookupCount - 2);
+    EXPECT_EQ(statistics.missCount, 2);
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_GetUserId_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityDisplayUserCache_Unittest_SetUserId_001
+ * @tc.name: SetUserId
+ * @tc.desc: Test the account events replace, remove and invalidate the cached users.
+ */
+HWTEST_F(AccessibilityDisplayUserCacheTest, AccessibilityDisplayUserCache_Unittest_SetUserId_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_SetUserId_001 start";
+    int32_t userId = -1;
+    cache_->SetUserId(MAIN_DISPLAY_ID, SECOND_USER_ID);
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, SECOND_USER_ID);
+    EXPECT_EQ(resolveCount_, 0);
+
+    cache_->RemoveUser(SECOND_USER_ID);
+    EXPECT_FALSE(cache_->IsForegroundUser(SECOND_USER_ID));
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, MAIN_USER_ID);
+    EXPECT_EQ(resolveCount_, 1);
+
+    cache_->Invalidate();
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(resolveCount_, 2);
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_SetUserId_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityDisplayUserCache_Unittest_Check_001
+ * @tc.name: GetUserId
+ * @tc.desc: Test the periodic check corrects a user changed without account event.
+ */
+HWTEST_F(AccessibilityDisplayUserCacheTest, AccessibilityDisplayUserCache_Unittest_Check_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_Check_001 start";
+    int32_t userId = -1;
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    foregroundUsers_[MAIN_DISPLAY_ID] = SECOND_USER_ID;
+
+    now_ = AccessibilityDisplayUserCache::CHECK_INTERVAL_MS - 1;
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, MAIN_USER_ID);
+    now_ = AccessibilityDisplayUserCache::CHECK_INTERVAL_MS;
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, SECOND_USER_ID);
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, SECOND_USER_ID);
+    EXPECT_EQ(resolveCount_, 2);
+
+    // the cached user is kept while the account service is not reachable
+    isServiceReady_ = false;
+    now_ += AccessibilityDisplayUserCache::CHECK_INTERVAL_MS;
+    EXPECT_TRUE(cache_->GetUserId(MAIN_DISPLAY_ID, userId));
+    EXPECT_EQ(userId, SECOND_USER_ID);
+
+    DisplayUserCacheStatistics statistics = cache_->GetStatistics();
+    EXPECT_EQ(statistics.checkCount, 1);
+    EXPECT_EQ(statistics.mismatchCount, 1);
+    cache_->ResetStatistics();
+    EXPECT_EQ(cache_->GetStatistics().hitCount, 0);
+    GTEST_LOG_(INFO) << "AccessibilityDisplayUserCache_Unittest_Check_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
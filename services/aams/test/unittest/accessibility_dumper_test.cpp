@@ -296,5 +296,86 @@ HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_009, Tes
     }
     GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_009 end";
 }
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_010
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the input statistics arguments.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_010, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 start";
+    std::string cmdInput("-i");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdInput));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+
+    std::string cmdReset("-r");
+    args.clear();
+    args.emplace_back(Str8ToStr16(cmdReset));
+    ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 end";
+}
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_011
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the input record arguments.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_011, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_011 start";
+    std::string cmdStart("-p");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdStart));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+
+    std::string cmdStop("-e");
+    args.clear();
+    args.emplace_back(Str8ToStr16(cmdStop));
+    ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_011 end";
+}
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_012
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the runtime counters arguments.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_012, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_012 start";
+    std::string cmdCounters("-m");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdCounters));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+
+    std::string cmdDelta("-d");
+    args.emplace_back(Str8ToStr16(cmdDelta));
+    ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_012 end";
+}
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_013
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the display user cache argument.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_013, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_013 start";
+    std::string cmdCache("-k");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdCache));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_013 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
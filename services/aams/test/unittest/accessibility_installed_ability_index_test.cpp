@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "accessibility_installed_ability_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    const std::string INDEX_PATH = "/data/local/tmp/accessibility_installed_ability_index_test.json";
+    const std::string FINGERPRINT = "OpenHarmony 6.0.0.1";
+
+    AccessibilityAbilityInitParams MakeAbility(const std::string &bundleName, const std::string &name,
+        uint32_t staticCapabilities)
+    {
+        AccessibilityAbilityInitParams ability;
+        ability.bundleName = bundleName;
+        ability.name = name;
+        ability.moduleName = "entry";
+        ability.description = name + " description";
+        ability.label = name + " label";
+        ability.rationale = "reads the screen";
+        ability.settingsAbility = "SettingsAbility";
+        ability.staticCapabilities = staticCapabilities;
+        ability.abilityTypes = ACCESSIBILITY_ABILITY_TYPE_SPOKEN;
+        ability.isImportant = name == "ScreenReader";
+        ability.needHide = false;
+        ability.eventConfigure = {"click", "focus"};
+        ability.readableRules = "{}";
+        return ability;
+    }
+
+    std::string Describe(const AccessibilityAbilityInitParams &ability)
+    {
+        std::string description = ability.bundleName + "/" + ability.name + "|" + ability.moduleName + "|" +
+            ability.description + "|" + ability.label + "|" + ability.rationale + "|" + ability.settingsAbility +
+            "|" + std::to_string(ability.staticCapabilities) + "|" + std::to_string(ability.abilityTypes) + "|" +
+            std::to_string(ability.isImportant) + "|" + std::to_string(ability.needHide) + "|" +
+            ability.readableRules;
+        for (const auto &event : ability.eventConfigure) {
+            description += "|" + event;
+        }
+        return description;
+    }
+
+    std::vector<std::string> Describe(const std::vector<AccessibilityAbilityInitParams> &abilities)
+    {
+        std::vector<std::string> descriptions;
+        for (const auto &ability : abilities) {
+            descriptions.push_back(Describe(ability));
+        }
+        std::sort(descriptions.begin(), descriptions.end());
+        return descriptions;
+    }
+
+    /**
+     * The bundle manager of the test. It answers the full query and, like the account data on a package
+     * event, hands the abilities of one bundle to the index.
+     */
+    class FakeBundleManager {
+    public:
+        AccessibilityInstalledAbilityIndex::FullQuery GetQuery()
+        {
+            return [this](std::vector<AccessibilityAbilityInitParams> &abilities) {
+                queryCount_++;
+                if (!queryResult_) {
+                    return false;
+                }
+                for (const auto &bundle : bundles_) {
+                    abilities.insert(abilities.end(), bundle.second.begin(), bundle.second.end());
+                }
+                return true;
+            };
+        }
+
+        void Install(AccessibilityInstalledAbilityIndex &index, const std::string &bundleName,
+            const std::vector<AccessibilityAbilityInitParams> &abilities)
+        {
+            bundles_[bundleName] = abilities;
+            index.UpdateBundle(bundleName, abilities);
+        }
+
+        void Uninstall(AccessibilityInstalledAbilityIndex &index, const std::string &bundleName)
+        {
+            bundles_.erase(bundleName);
+            index.RemoveBundle(bundleName);
+        }
+
+        // a package event the service misses, as while it is not running
+        void InstallSilently(const std::string &bundleName,
+            const std::vector<AccessibilityAbilityInitParams> &abilities)
+        {
+            bundles_[bundleName] = abilities;
+        }
+
+        void UninstallSilently(const std::string &bundleName)
+        {
+            bundles_.erase(bundleName);
+        }
+
+        void SetQueryResult(bool result)
+        {
+            queryResult_ = result;
+        }
+
+        std::vector<AccessibilityAbilityInitParams> QueryAll()
+        {
+            std::vector<AccessibilityAbilityInitParams> abilities;
+            GetQuery()(abilities);
+            return abilities;
+        }
+
+        int32_t GetQueryCount() const
+        {
+            return queryCount_;
+        }
+
+    private:
+        std::map<std::string, std::vector<AccessibilityAbilityInitParams>> bundles_;
+        int32_t queryCount_ = 0;
+        bool queryResult_ = true;
+    };
+} // namespace
+
+class AccessibilityInstalledAbilityIndexTest : public ::testing::Test {
+public:
+    AccessibilityInstalledAbilityIndexTest() {}
+    ~AccessibilityInstalledAbilityIndexTest() {}
+
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndexTest Start";
+    }
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndexTest End";
+    }
+    void SetUp() override
+    {
+        std::remove(INDEX_PATH.c_str());
+        bundleManager_.Install(index_, "com.example.reader",
+            {MakeAbility("com.example.reader", "ScreenReader", 0x3)});
+        bundleManager_.Install(index_, "com.example.switch",
+            {MakeAbility("com.example.switch", "SwitchAccess", 0x1)});
+    }
+    void TearDown() override
+    {
+        std::remove(INDEX_PATH.c_str());
+    }
+
+    FakeBundleManager bundleManager_;
+    AccessibilityInstalledAbilityIndex index_ {INDEX_PATH, FINGERPRINT};
+};
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Load_001
+ * @tc.name: Load
+ * @tc.desc: The first load queries the bundle manager and writes the index, the next startup reads it back.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Load_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Load_001 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    EXPECT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_FALSE(index_.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), 1);
+    EXPECT_EQ(abilities.size(), 2u);
+
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    std::vector<AccessibilityAbilityInitParams> restartedAbilities;
+    EXPECT_TRUE(restarted.Load(bundleManager_.GetQuery(), restartedAbilities));
+    EXPECT_TRUE(restarted.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), 1);
+    EXPECT_EQ(Describe(restartedAbilities), Describe(abilities));
+
+    // a user switch back reads the index kept in memory
+    EXPECT_TRUE(restarted.Load(bundleManager_.GetQuery(), restartedAbilities));
+    EXPECT_EQ(bundleManager_.GetQueryCount(), 1);
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Load_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_PackageEvents_001
+ * @tc.name: UpdateBundle
+ * @tc.desc: After a series of package events the index read at the next startup matches a full query.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_PackageEvents_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_PackageEvents_001 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+
+    bundleManager_.Install(index_, "com.example.magnifier", {MakeAbility("com.example.magnifier", "Zoom", 0x10),
+        MakeAbility("com.example.magnifier", "Lens", 0x10)});
+    // an update which changes the capabilities of one ability and drops the other
+    bundleManager_.Install(index_, "com.example.magnifier", {MakeAbility("com.example.magnifier", "Zoom", 0x18)});
+    bundleManager_.Uninstall(index_, "com.example.switch");
+    bundleManager_.Install(index_, "com.example.captions",
+        {MakeAbility("com.example.captions", "LiveCaption", 0x2)});
+    // an update which no longer ships an accessibility ability
+    bundleManager_.Install(index_, "com.example.captions", {});
+    // the removal of a package the index never had
+    bundleManager_.Uninstall(index_, "com.example.unknown");
+    bundleManager_.Install(index_, "com.example.switch",
+        {MakeAbility("com.example.switch", "SwitchAccess", 0x5)});
+    int32_t queryCount = bundleManager_.GetQueryCount();
+
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    std::vector<AccessibilityAbilityInitParams> restartedAbilities;
+    EXPECT_TRUE(restarted.Load(bundleManager_.GetQuery(), restartedAbilities));
+    EXPECT_TRUE(restarted.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), queryCount);
+    EXPECT_EQ(Describe(restartedAbilities), Describe(bundleManager_.QueryAll()));
+    EXPECT_EQ(restartedAbilities.size(), 3u);
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_PackageEvents_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Fingerprint_001
+ * @tc.name: Load
+ * @tc.desc: An index written by another system version is rebuilt from a full query.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Fingerprint_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Fingerprint_001 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+
+    AccessibilityInstalledAbilityIndex upgraded(INDEX_PATH, "OpenHarmony 6.0.0.2");
+    EXPECT_TRUE(upgraded.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_FALSE(upgraded.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), 2);
+    EXPECT_EQ(Describe(abilities), Describe(bundleManager_.QueryAll()));
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Fingerprint_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Broken_001
+ * @tc.name: Load
+ * @tc.desc: A broken index is rebuilt from a full query, and package events before any load leave it alone.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Broken_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Broken_001 start";
+    {
+        std::ofstream file(INDEX_PATH, std::ios::trunc);
+        file << "{\"version\":1,\"fingerprint\":\"" << FINGERPRINT << "\",\"abilities\":[{\"name\":7}]}";
+    }
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    restarted.UpdateBundle("com.example.reader", {});
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    EXPECT_TRUE(restarted.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_FALSE(restarted.IsLoadedFromFile());
+    EXPECT_EQ(Describe(abilities), Describe(bundleManager_.QueryAll()));
+
+    AccessibilityInstalledAbilityIndex rebuilt(INDEX_PATH, FINGERPRINT);
+    EXPECT_TRUE(rebuilt.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_TRUE(rebuilt.IsLoadedFromFile());
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Broken_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Clear_001
+ * @tc.name: Clear
+ * @tc.desc: A removed user leaves no index behind.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Clear_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Clear_001 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+    index_.Clear();
+    EXPECT_FALSE(std::ifstream(INDEX_PATH).is_open());
+
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    EXPECT_TRUE(restarted.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_FALSE(restarted.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), 2);
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Clear_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Clear_002
+ * @tc.name: RemoveFile
+ * @tc.desc: The index of a user is removed by its path without loading it.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Clear_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Clear_002 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+    ASSERT_TRUE(std::ifstream(INDEX_PATH).is_open());
+    AccessibilityInstalledAbilityIndex::RemoveFile(INDEX_PATH);
+    EXPECT_FALSE(std::ifstream(INDEX_PATH).is_open());
+    AccessibilityInstalledAbilityIndex::RemoveFile(INDEX_PATH);
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Clear_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Revalidate_001
+ * @tc.name: Revalidate
+ * @tc.desc: Packages changed while the service was not running are found by revalidating the index read
+ *           from the file, and the index takes the full query.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Revalidate_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Revalidate_001 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> changes;
+    // an index answered by the query is not revalidated
+    EXPECT_FALSE(index_.Revalidate(bundleManager_.GetQuery(), changes));
+
+    bundleManager_.InstallSilently("com.example.reader", {MakeAbility("com.example.reader", "ScreenReader", 0x7)});
+    bundleManager_.UninstallSilently("com.example.switch");
+    bundleManager_.InstallSilently("com.example.magnifier", {MakeAbility("com.example.magnifier", "Zoom", 0x10)});
+
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    ASSERT_TRUE(restarted.Load(bundleManager_.GetQuery(), abilities));
+    ASSERT_TRUE(restarted.IsLoadedFromFile());
+    EXPECT_EQ(abilities.size(), 2u);
+    EXPECT_TRUE(restarted.Revalidate(bundleManager_.GetQuery(), changes));
+    EXPECT_FALSE(restarted.IsLoadedFromFile());
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> expected = {
+        {"com.example.reader", AccessibilityInstalledAbilityIndex::BundleChange::CHANGED},
+        {"com.example.switch", AccessibilityInstalledAbilityIndex::BundleChange::REMOVED},
+        {"com.example.magnifier", AccessibilityInstalledAbilityIndex::BundleChange::ADDED},
+    };
+    EXPECT_EQ(changes, expected);
+
+    AccessibilityInstalledAbilityIndex next(INDEX_PATH, FINGERPRINT);
+    int32_t queryCount = bundleManager_.GetQueryCount();
+    EXPECT_TRUE(next.Load(bundleManager_.GetQuery(), abilities));
+    EXPECT_TRUE(next.IsLoadedFromFile());
+    EXPECT_EQ(bundleManager_.GetQueryCount(), queryCount);
+    EXPECT_EQ(Describe(abilities), Describe(bundleManager_.QueryAll()));
+    changes.clear();
+    EXPECT_TRUE(next.Revalidate(bundleManager_.GetQuery(), changes));
+    EXPECT_TRUE(changes.empty());
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Revalidate_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInstalledAbilityIndex_Revalidate_002
+ * @tc.name: Revalidate
+ * @tc.desc: A failed query keeps the index read from the file, and a later revalidation still runs.
+ */
+HWTEST_F(AccessibilityInstalledAbilityIndexTest, AccessibilityInstalledAbilityIndex_Revalidate_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Revalidate_002 start";
+    std::vector<AccessibilityAbilityInitParams> abilities;
+    ASSERT_TRUE(index_.Load(bundleManager_.GetQuery(), abilities));
+    AccessibilityInstalledAbilityIndex restarted(INDEX_PATH, FINGERPRINT);
+    ASSERT_TRUE(restarted.Load(bundleManager_.GetQuery(), abilities));
+
+    bundleManager_.UninstallSilently("com.example.switch");
+    bundleManager_.SetQueryResult(false);
+    std::map<std::string, AccessibilityInstalledAbilityIndex::BundleChange> changes;
+    EXPECT_FALSE(restarted.Revalidate(bundleManager_.GetQuery(), changes));
+    EXPECT_TRUE(changes.empty());
+    EXPECT_TRUE(restarted.IsLoadedFromFile());
+
+    bundleManager_.SetQueryResult(true);
+    EXPECT_TRUE(restarted.Revalidate(bundleManager_.GetQuery(), changes));
+    EXPECT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes["com.example.switch"], AccessibilityInstalledAbilityIndex::BundleChange::REMOVED);
+    GTEST_LOG_(INFO) << "AccessibilityInstalledAbilityIndex_Revalidate_002 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "accessibility_def.h"
+#include "accessibility_runtime_counters.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr uint32_t IPC_CODE = 5;
+    constexpr size_t THREAD_COUNT = 8;
+    constexpr uint64_t RECORD_COUNT = 1000;
+    using Snapshot = AccessibilityRuntimeCounters::Snapshot;
+} // namespace
+
+class AccessibilityRuntimeCountersUnitTest : public ::testing::Test {
+public:
+    AccessibilityRuntimeCountersUnitTest()
+    {}
+    ~AccessibilityRuntimeCountersUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void AccessibilityRuntimeCountersUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityRuntimeCountersUnitTest Start ######################";
+}
+
+void AccessibilityRuntimeCountersUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityRuntimeCountersUnitTest End ######################";
+}
+
+void AccessibilityRuntimeCountersUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+}
+
+void AccessibilityRuntimeCountersUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_GetEventSlot_001
+ * @tc.name: GetEventSlot
+ * @tc.desc: Test every event type has its own slot and the unknown types share slot 0.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_GetEventSlot_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_GetEventSlot_001 start";
+    const uint32_t eventTypes[] = {
+        TYPE_VIEW_CLICKED_EVENT, TYPE_VIEW_HOVER_ENTER_EVENT, TYPE_ELEMENT_INFO_CHANGE,
+        TYPE_VIEW_ANNOUNCE_FOR_ACCESSIBILITY_NOT_INTERRUPT, TYPE_TOUCH_GUIDE_GESTURE,
+    };
+    std::vector<size_t> slots;
+    for (uint32_t eventType : eventTypes) {
+        size_t slot = AccessibilityRuntimeCounters::GetEventSlot(eventType);
+        EXPECT_GT(slot, 0);
+        EXPECT_LT(slot, AccessibilityRuntimeCounters::EVENT_SLOT_COUNT);
+        EXPECT_EQ(AccessibilityRuntimeCounters::GetEventType(slot), eventType);
+        EXPECT_EQ(std::find(slots.begin(), slots.end(), slot), slots.end());
+        slots.push_back(slot);
+    }
+    EXPECT_EQ(AccessibilityRuntimeCounters::GetEventSlot(TYPE_VIEW_INVALID), 0);
+    EXPECT_EQ(AccessibilityRuntimeCounters::GetEventSlot(TYPE_MAX_NUM), 0);
+    EXPECT_EQ(AccessibilityRuntimeCounters::GetEventSlot(TYPE_VIEW_CLICKED_EVENT | TYPE_VIEW_FOCUSED_EVENT), 0);
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_GetEventSlot_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_ParseQueueSize_001
+ * @tc.name: ParseQueueSize
+ * @tc.desc: Test the sizes of all priorities in the queue dump are summed.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_ParseQueueSize_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_ParseQueueSize_001 start";
+    EXPECT_EQ(AccessibilityRuntimeCounters::ParseQueueSize(
+        "Current queue size: IMMEDIATE = 1,HIGH = 2,LOW = 13,IDLE = 0 ; "), 16);
+    EXPECT_EQ(AccessibilityRuntimeCounters::ParseQueueSize("VIP=4,IMMEDIATE=0"), 4);
+    EXPECT_EQ(AccessibilityRuntimeCounters::ParseQueueSize(""), 0);
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_ParseQueueSize_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_FormatCounters_001
+ * @tc.name: FormatCounters
+ * @tc.desc: Test the totals are dumped one "name{labels} value" line each and empty counters are left out.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_FormatCounters_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_FormatCounters_001 start";
+    auto current = std::make_unique<Snapshot>();
+    current->timeMs = 5000;
+    size_t clickSlot = AccessibilityRuntimeCounters::GetEventSlot(TYPE_VIEW_CLICKED_EVENT);
+    current->eventsReceived[clickSlot] = 3;
+    current->eventsDropped[clickSlot] = 1;
+    // 9 calls within [4, 8) us and 1 within [512, 1024) us
+    current->ipcLatency[IPC_CODE][3] = 9;
+    current->ipcLatency[IPC_CODE][10] = 1;
+    current->queueDepths["AamsSendEventRunner"] = 2;
+    current->caches["displayUser"] = {9, 1};
+
+    std::string dumpInfo;
+    AccessibilityRuntimeCounters::FormatCounters(*current, nullptr, dumpInfo);
+    EXPECT_EQ(dumpInfo,
+        "# mode=total intervalMs=0\n"
+        "aams_events_received{type=\"0x00000001\"} 3\n"
+        "aams_events_dropped{type=\"0x00000001\"} 1\n"
+        "aams_ipc_calls{code=\"5\"} 10\n"
+        "aams_ipc_latency_us{code=\"5\",quantile=\"0.5\"} 7\n"
+        "aams_ipc_latency_us{code=\"5\",quantile=\"0.99\"} 1023\n"
+        "aams_queue_depth{runner=\"AamsSendEventRunner\"} 2\n"
+        "aams_cache_hits{cache=\"displayUser\"} 9\n"
+        "aams_cache_misses{cache=\"displayUser\"} 1\n"
+        "aams_cache_hit_rate{cache=\"displayUser\"} 0.9000\n");
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_FormatCounters_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_FormatCounters_002
+ * @tc.name: FormatCounters
+ * @tc.desc: Test the delta since the previous dump, with the gauges kept and a reset counter counting from zero.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_FormatCounters_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_FormatCounters_002 start";
+    size_t clickSlot = AccessibilityRuntimeCounters::GetEventSlot(TYPE_VIEW_CLICKED_EVENT);
+    size_t focusSlot = AccessibilityRuntimeCounters::GetEventSlot(TYPE_VIEW_FOCUSED_EVENT);
+    auto previous = std::make_unique<Snapshot>();
+    previous->timeMs = 1000;
+    previous->eventsReceived[clickSlot] = 5;
+    previous->eventsReceived[focusSlot] = 7;
+    previous->ipcLatency[IPC_CODE][1] = 100;
+    previous->ipcLatency[IPC_CODE][3] = 4;
+    previous->queueDepths["AamsChannelRunner"] = 9;
+    previous->caches["displayUser"] = {80, 20};
+
+    auto current = std::make_unique<Snapshot>(*previous);
+    current->timeMs = 3500;
+    current->eventsReceived[clickSlot] = 8;
+    current->eventsDropped[clickSlot] = 2;
+    current->ipcLatency[IPC_CODE][3] = 6;
+    current->queueDepths["AamsChannelRunner"] = 1;
+    // the cache statistics were reset since the previous dump
+    current->caches["displayUser"] = {3, 1};
+
+    std::string dumpInfo;
+    AccessibilityRuntimeCounters::FormatCounters(*current, previous.get(), dumpInfo);
+    EXPECT_EQ(dumpInfo,
+        "# mode=delta intervalMs=2500\n"
+        "aams_events_received{type=\"0x00000001\"} 3\n"
+        "aams_events_dropped{type=\"0x00000001\"} 2\n"
+        "aams_ipc_calls{code=\"5\"} 2\n"
+        "aams_ipc_latency_us{code=\"5\",quantile=\"0.5\"} 7\n"
+        "aams_ipc_latency_us{code=\"5\",quantile=\"0.99\"} 7\n"
+        "aams_queue_depth{runner=\"AamsChannelRunner\"} 1\n"
+        "aams_cache_hits{cache=\"displayUser\"} 3\n"
+        "aams_cache_misses{cache=\"displayUser\"} 1\n"
+        "aams_cache_hit_rate{cache=\"displayUser\"} 0.7500\n");
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_FormatCounters_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_Record_001
+ * @tc.name: RecordEventReceived
+ * @tc.desc: Test the records of many threads are all merged into the snapshot.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_Record_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_Record_001 start";
+    AccessibilityRuntimeCounters &counters = Singleton<AccessibilityRuntimeCounters>::GetInstance();
+    auto before = std::make_unique<Snapshot>();
+    counters.GetSnapshot(*before);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        threads.emplace_back([&counters]() {
+            for (uint64_t j = 0; j < RECORD_COUNT; j++) {
+                counters.RecordEventReceived(TYPE_PAGE_STATE_UPDATE);
+                counters.RecordEventDropped(TYPE_PAGE_STATE_UPDATE);
+                counters.RecordIpcCall(AccessibilityRuntimeCounters::IPC_SLOT_COUNT + IPC_CODE, 1);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto after = std::make_unique<Snapshot>();
+    counters.GetSnapshot(*after);
+    size_t slot = AccessibilityRuntimeCounters::GetEventSlot(TYPE_PAGE_STATE_UPDATE);
+    size_t lastCode = AccessibilityRuntimeCounters::IPC_SLOT_COUNT - 1;
+    EXPECT_EQ(after->eventsReceived[slot] - before->eventsReceived[slot], THREAD_COUNT * RECORD_COUNT);
+    EXPECT_EQ(after->eventsDropped[slot] - before->eventsDropped[slot], THREAD_COUNT * RECORD_COUNT);
+    EXPECT_EQ(after->ipcLatency[lastCode][1] - before->ipcLatency[lastCode][1], THREAD_COUNT * RECORD_COUNT);
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_Record_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityRuntimeCounters_Unittest_Dump_001
+ * @tc.name: Dump
+ * @tc.desc: Test a delta dump shows only what was recorded since the last dump.
+ */
+HWTEST_F(AccessibilityRuntimeCountersUnitTest, AccessibilityRuntimeCounters_Unittest_Dump_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_Dump_001 start";
+    AccessibilityRuntimeCounters &counters = Singleton<AccessibilityRuntimeCounters>::GetInstance();
+    auto snapshot = std::make_unique<Snapshot>();
+    counters.GetSnapshot(*snapshot);
+    std::string dumpInfo;
+    counters.Dump(*snapshot, false, dumpInfo);
+    EXPECT_EQ(dumpInfo.find("# mode=total"), 0);
+
+    counters.RecordEventReceived(TYPE_WINDOW_UPDATE);
+    counters.RecordEventReceived(TYPE_WINDOW_UPDATE);
+    counters.GetSnapshot(*snapshot);
+    dumpInfo.clear();
+    counters.Dump(*snapshot, true, dumpInfo);
+    EXPECT_EQ(dumpInfo.find("# mode=delta"), 0);
+    EXPECT_NE(dumpInfo.find("aams_events_received{type=\"0x00400000\"} 2\n"), std::string::npos);
+    EXPECT_EQ(dumpInfo.find("aams_events_received{type=\"0x00000020\"}"), std::string::npos);
+
+    counters.GetSnapshot(*snapshot);
+    dumpInfo.clear();
+    counters.Dump(*snapshot, true, dumpInfo);
+    EXPECT_EQ(dumpInfo.find("aams_events_received"), std::string::npos);
+    GTEST_LOG_(INFO) << "AccessibilityRuntimeCounters_Unittest_Dump_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "accessibility_startup_graph.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t ACCOUNT_SA_ID = 200;
+    constexpr int32_t COMMON_EVENT_SA_ID = 3299;
+    constexpr int32_t BUNDLE_SA_ID = 401;
+    constexpr int32_t KV_SA_ID = 1301;
+    constexpr int32_t UNKNOWN_SA_ID = 9999;
+    constexpr int64_t QUERY_COST_MS = 300;
+    constexpr int64_t SUBSCRIBE_COST_MS = 20;
+    constexpr int64_t INIT_COST_MS = 100;
+    constexpr int64_t REGISTER_COST_MS = 40;
+    constexpr int64_t SA_INTERVAL_MS = 50;
+
+    using StepRunner = AccessibilityStartupGraph::StepRunner;
+
+    /**
+     * The system ability manager of the test: it adds the system abilities one by one and runs the tasks of the
+     * graph, every task moving the clock on by the cost of its step. The concurrent tasks started together take
+     * as long as the longest of them.
+     */
+    class FakeSystemAbilityManager {
+    public:
+        FakeSystemAbilityManager()
+        {
+            graph_ = std::make_shared<AccessibilityStartupGraph>(
+                [this](const std::string &name, std::function<void()> task) {
+                    serialTasks_.push_back(std::move(task));
+                },
+                [this](const std::string &name, std::function<void()> task) {
+                    concurrentTasks_.push_back(std::move(task));
+                },
+                [this]() { return now_; });
+        }
+
+        void AddStep(const std::string &name, const std::vector<int32_t> &systemAbilities,
+            const std::vector<std::string> &predecessors, StepRunner runner, int64_t cost, bool succeeded = true)
+        {
+            EXPECT_TRUE(graph_->AddStep(name, systemAbilities, predecessors, runner, [this, name, cost, succeeded]() {
+                ranSteps_.push_back(name);
+                if (runner_ == StepRunner::CONCURRENT) {
+                    concurrentCost_ = std::max(concurrentCost_, cost);
+                }
+                now_ += cost;
+                return succeeded || failuresLeft_-- <= 0;
+            }));
+        }
+
+        void AddSystemAbility(int32_t systemAbilityId)
+        {
+            now_ += SA_INTERVAL_MS;
+            graph_->OnSystemAbilityAdded(systemAbilityId);
+            RunTasks();
+        }
+
+        void RunTasks()
+        {
+            while (!serialTasks_.empty() || !concurrentTasks_.empty()) {
+                if (!concurrentTasks_.empty()) {
+                    // start every concurrent task at the same time, the clock moves on once they are all done
+                    std::vector<std::function<void()>> tasks;
+                    tasks.swap(concurrentTasks_);
+                    int64_t start = now_;
+                    concurrentCost_ = 0;
+                    runner_ = StepRunner::CONCURRENT;
+                    for (auto &task : tasks) {
+                        now_ = start;
+                        task();
+                    }
+                    runner_ = StepRunner::SERIAL;
+                    now_ = start + concurrentCost_;
+                    continue;
+                }
+                std::function<void()> task = std::move(serialTasks_.front());
+                serialTasks_.pop_front();
+                task();
+            }
+        }
+
+        StartupPhaseRecord GetRecord(const std::string &name)
+        {
+            for (const auto &record : graph_->GetRecords()) {
+                if (record.name == name) {
+                    return record;
+                }
+            }
+            return StartupPhaseRecord();
+        }
+
+        std::shared_ptr<AccessibilityStartupGraph> graph_ = nullptr;
+        std::deque<std::function<void()>> serialTasks_;
+        std::vector<std::function<void()>> concurrentTasks_;
+        std::vector<std::string> ranSteps_;
+        int64_t now_ = 0;
+        int64_t concurrentCost_ = 0;
+        int32_t failuresLeft_ = 1;
+        StepRunner runner_ = StepRunner::SERIAL;
+    };
+} // namespace
+
+class AccessibilityStartupGraphTest : public ::testing::Test {
+public:
+    AccessibilityStartupGraphTest()
+    {}
+    ~AccessibilityStartupGraphTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    // the startup of the service: the account query and the common event only need their own services
+    void AddServiceSteps()
+    {
+        manager_->AddStep("SubscribeCommonEvent", {COMMON_EVENT_SA_ID}, {}, StepRunner::SERIAL, SUBSCRIBE_COST_MS);
+        manager_->AddStep("QueryForegroundAccounts", {ACCOUNT_SA_ID}, {}, StepRunner::CONCURRENT, QUERY_COST_MS);
+        manager_->AddStep("InitForegroundAccounts", {BUNDLE_SA_ID, KV_SA_ID},
+            {"SubscribeCommonEvent", "QueryForegroundAccounts"}, StepRunner::SERIAL, INIT_COST_MS);
+        manager_->AddStep("RegisterScreenMagnification", {KV_SA_ID}, {"InitForegroundAccounts"},
+            StepRunner::CONCURRENT, REGISTER_COST_MS);
+        manager_->AddStep("RegisterFlashReminder", {KV_SA_ID}, {"InitForegroundAccounts"},
+            StepRunner::CONCURRENT, REGISTER_COST_MS);
+        manager_->AddStep("ServiceReady", {}, {"RegisterScreenMagnification", "RegisterFlashReminder"},
+            StepRunner::SERIAL, 0);
+    }
+
+    std::unique_ptr<FakeSystemAbilityManager> manager_ = nullptr;
+};
+
+void AccessibilityStartupGraphTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityStartupGraphTest Start ######################";
+}
+
+void AccessibilityStartupGraphTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityStartupGraphTest End ######################";
+}
+
+void AccessibilityStartupGraphTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    manager_ = std::make_unique<FakeSystemAbilityManager>();
+}
+
+void AccessibilityStartupGraphTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    manager_ = nullptr;
+}
+
+/**
+ * @tc.number: AccessibilityStartupGraph_Unittest_AddStep_001
+ * @tc.name: AddStep
+ * @tc.desc: Test a step is refused if its name is taken or it comes after an unknown step.
+ */
+HWTEST_F(AccessibilityStartupGraphTest, AccessibilityStartupGraph_Unittest_AddStep_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_AddStep_001 start";
+    auto graph = manager_->graph_;
+    EXPECT_TRUE(graph->AddStep("First", {ACCOUNT_SA_ID}, {}, StepRunner::SERIAL, []() { return true; }));
+    EXPECT_FALSE(graph->AddStep("First", {}, {}, StepRunner::SERIAL, []() { return true; }));
+    EXPECT_FALSE(graph->AddStep("Second", {}, {"Unknown"}, StepRunner::SERIAL, []() { return true; }));
+    EXPECT_FALSE(graph->AddStep("Third", {}, {}, StepRunner::SERIAL, nullptr));
+    EXPECT_FALSE(graph->OnSystemAbilityAdded(UNKNOWN_SA_ID));
+    EXPECT_FALSE(graph->OnSystemAbilityRemoved(UNKNOWN_SA_ID));
+    EXPECT_EQ(graph->GetRecords().size(), 1);
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_AddStep_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_001
+ * @tc.name: OnSystemAbilityAdded
+ * @tc.desc: Test a step starts as soon as its own system abilities are added, before the others are.
+ */
+HWTEST_F(AccessibilityStartupGraphTest, AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_001 start";
+    AddServiceSteps();
+    manager_->AddSystemAbility(ACCOUNT_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("QueryForegroundAccounts"));
+    EXPECT_FALSE(manager_->graph_->IsFinished("SubscribeCommonEvent"));
+
+    manager_->AddSystemAbility(COMMON_EVENT_SA_ID);
+    manager_->AddSystemAbility(BUNDLE_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("SubscribeCommonEvent"));
+    EXPECT_FALSE(manager_->graph_->IsFinished("InitForegroundAccounts"));
+    EXPECT_EQ(manager_->GetRecord("InitForegroundAccounts").readyTime, -1);
+
+    manager_->AddSystemAbility(KV_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("ServiceReady"));
+    std::vector<std::string> expected = {"QueryForegroundAccounts", "SubscribeCommonEvent",
+        "InitForegroundAccounts", "RegisterScreenMagnification", "RegisterFlashReminder", "ServiceReady"};
+    EXPECT_EQ(manager_->ranSteps_, expected);
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityStartupGraph_Unittest_GetRecords_001
+ * @tc.name: GetRecords
+ * @tc.desc: Test the timing of every phase, the account query runs while the other services come up and the
+ *           registrations run side by side.
+ */
+HWTEST_F(AccessibilityStartupGraphTest, AccessibilityStartupGraph_Unittest_GetRecords_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_GetRecords_001 start";
+    AddServiceSteps();
+    manager_->AddSystemAbility(ACCOUNT_SA_ID);
+    manager_->AddSystemAbility(COMMON_EVENT_SA_ID);
+    manager_->AddSystemAbility(BUNDLE_SA_ID);
+    manager_->AddSystemAbility(KV_SA_ID);
+
+    StartupPhaseRecord query = manager_->GetRecord("QueryForegroundAccounts");
+    EXPECT_EQ(query.readyTime, SA_INTERVAL_MS);
+    EXPECT_EQ(query.endTime - query.startTime, QUERY_COST_MS);
+    EXPECT_TRUE(query.succeeded);
+
+    // the last service comes after the query is done, the init does not wait for it any longer
+    StartupPhaseRecord init = manager_->GetRecord("InitForegroundAccounts");
+    int64_t lastServiceTime = QUERY_COST_MS + SUBSCRIBE_COST_MS + SA_INTERVAL_MS * 4;
+    EXPECT_EQ(init.readyTime, lastServiceTime);
+    EXPECT_EQ(init.startTime, init.readyTime);
+
+    StartupPhaseRecord magnification = manager_->GetRecord("RegisterScreenMagnification");
+    StartupPhaseRecord flashReminder = manager_->GetRecord("RegisterFlashReminder");
+    EXPECT_EQ(magnification.readyTime, init.endTime);
+    EXPECT_EQ(magnification.startTime, flashReminder.startTime);
+
+    StartupPhaseRecord ready = manager_->GetRecord("ServiceReady");
+    EXPECT_EQ(ready.readyTime, lastServiceTime + INIT_COST_MS + REGISTER_COST_MS);
+
+    std::string dumpInfo;
+    manager_->graph_->Dump(dumpInfo);
+    EXPECT_NE(dumpInfo.find("ServiceReady ready="), std::string::npos);
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_GetRecords_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_002
+ * @tc.name: OnSystemAbilityAdded
+ * @tc.desc: Test a failed step holds back the steps after it and runs again on the next system ability added.
+ */
+HWTEST_F(AccessibilityStartupGraphTest, AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_002 start";
+    manager_->AddStep("Publish", {ACCOUNT_SA_ID}, {}, StepRunner::SERIAL, 0, false);
+    manager_->AddStep("ServiceReady", {}, {"Publish"}, StepRunner::SERIAL, 0);
+    manager_->AddSystemAbility(ACCOUNT_SA_ID);
+    EXPECT_FALSE(manager_->graph_->IsFinished("Publish"));
+    EXPECT_FALSE(manager_->GetRecord("Publish").succeeded);
+    EXPECT_EQ(manager_->GetRecord("ServiceReady").readyTime, -1);
+
+    manager_->AddSystemAbility(ACCOUNT_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("ServiceReady"));
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityAdded_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityStartupGraph_Unittest_OnSystemAbilityRemoved_001
+ * @tc.name: OnSystemAbilityRemoved
+ * @tc.desc: Test every step runs again once a removed system ability is back, and a step started before the
+ *           removal does not count.
+ */
+HWTEST_F(AccessibilityStartupGraphTest, AccessibilityStartupGraph_Unittest_OnSystemAbilityRemoved_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityRemoved_001 start";
+    AddServiceSteps();
+    manager_->AddSystemAbility(ACCOUNT_SA_ID);
+    manager_->AddSystemAbility(COMMON_EVENT_SA_ID);
+    manager_->AddSystemAbility(BUNDLE_SA_ID);
+    manager_->AddSystemAbility(KV_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("ServiceReady"));
+
+    EXPECT_TRUE(manager_->graph_->OnSystemAbilityRemoved(KV_SA_ID));
+    EXPECT_FALSE(manager_->graph_->IsFinished("QueryForegroundAccounts"));
+    manager_->ranSteps_.clear();
+    manager_->AddSystemAbility(KV_SA_ID);
+    EXPECT_TRUE(manager_->graph_->IsFinished("ServiceReady"));
+    EXPECT_EQ(manager_->ranSteps_.size(), 6);
+
+    // the query handed to its task before the stop never runs
+    manager_->graph_->Clear();
+    manager_->graph_->OnSystemAbilityAdded(ACCOUNT_SA_ID);
+    manager_->graph_->OnSystemAbilityRemoved(ACCOUNT_SA_ID);
+    manager_->ranSteps_.clear();
+    manager_->RunTasks();
+    EXPECT_TRUE(manager_->ranSteps_.empty());
+    EXPECT_FALSE(manager_->graph_->IsFinished("QueryForegroundAccounts"));
+    GTEST_LOG_(INFO) << "AccessibilityStartupGraph_Unittest_OnSystemAbilityRemoved_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_INPUT_RECORDER_H
+#define ACCESSIBILITY_INPUT_RECORDER_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ffrt.h"
+#include "pointer_event.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct InputRecord {
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = nullptr;
+    int64_t actionTime = 0;
+};
+
+/**
+ * Records the pointer events which enter the interceptor as text, one event per line:
+ *   P <actionTime> <sourceType> <pointerAction> <pointerId> <itemCount> {<id> <downTime> <pressed> <x> <y>}
+ * Empty lines and lines starting with '#' are ignored when parsing. Key events are never recorded, so a
+ * recording cannot capture what the user types. Recording is a debugging aid, only allowed on a
+ * debuggable build with the debug.accessibility.input_record parameter set to true.
+ */
+class AccessibilityInputRecorder {
+    DECLARE_SINGLETON(AccessibilityInputRecorder)
+public:
+    static constexpr size_t MAX_RECORD_COUNT = 20000;
+
+    /**
+     * @brief Check the recording is allowed on this device.
+     * @return true on a debuggable build with debug.accessibility.input_record set to true.
+     */
+    static bool IsAllowed();
+
+    /**
+     * @brief Drop the previous records and start recording.
+     */
+    void Start();
+
+    /**
+     * @brief Stop recording and append the records to the string.
+     * @param records the string to append to.
+     */
+    void Stop(std::string &records);
+
+    inline bool IsRecording() const
+    {
+        return recording_.load(std::memory_order_relaxed);
+    }
+
+    void Record(const MMI::PointerEvent &event);
+
+    static std::string Serialize(const MMI::PointerEvent &event);
+    static bool Parse(const std::string &line, InputRecord &record);
+
+    /**
+     * @brief Parse all records of a recording.
+     * @param records the text produced by Stop.
+     * @param result the parsed records, in recording order.
+     * @return false if any line is malformed.
+     */
+    static bool ParseAll(const std::string &records, std::vector<InputRecord> &result);
+
+private:
+    void Append(std::string &&record);
+
+    std::atomic<bool> recording_ {false};
+    ffrt::mutex mutex_;
+    std::vector<std::string> records_ {};
+    size_t droppedCount_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_INPUT_RECORDER_H
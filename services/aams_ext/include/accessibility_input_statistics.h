@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_INPUT_STATISTICS_H
+#define ACCESSIBILITY_INPUT_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "accessibility_event_transmission.h"
+#include "accessibility_thread_shards.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct LatencySummary {
+    uint64_t count = 0;
+    int64_t totalUs = 0;
+    int64_t maxUs = 0;
+    int64_t p50Us = 0;
+    int64_t p99Us = 0;
+};
+
+/**
+ * Statistics of the input event transmission chain. Every recording thread owns a shard of
+ * histograms which it updates with relaxed atomics, so recording never takes a lock. The shards
+ * are merged only when the statistics are read.
+ */
+class AccessibilityInputStatistics {
+    DECLARE_SINGLETON(AccessibilityInputStatistics)
+public:
+    // bucket 0 holds 0us, bucket i holds [2^(i-1), 2^i) us, the last bucket holds everything above.
+    static constexpr size_t HISTOGRAM_BUCKET_COUNT = 24;
+    static constexpr size_t MAX_SHARD_COUNT = 8;
+
+    /**
+     * @brief Record the delay between the MMI action time and the moment the event enters the chain.
+     * @param actionTime the action time of the input event, in microseconds.
+     */
+    void RecordQueueDelay(int64_t actionTime);
+
+    /**
+     * @brief Record the latency between the MMI action time and the moment a node hands the event on.
+     * @param type the transmission node which outputs the event.
+     * @param actionTime the action time of the input event, in microseconds.
+     */
+    void RecordOutputLatency(TransmissionType type, int64_t actionTime);
+
+    /**
+     * @brief Record one call of a node and the time spent in it, excluding the nodes after it.
+     * @param type the transmission node which processed the event.
+     * @param processUs the processing time, in microseconds.
+     */
+    void RecordProcessTime(TransmissionType type, int64_t processUs);
+
+    LatencySummary GetQueueDelay() const;
+    LatencySummary GetOutputLatency(TransmissionType type) const;
+    LatencySummary GetProcessTime(TransmissionType type) const;
+
+    /**
+     * @brief Clear all statistics. Records which race with the reset may be partially kept.
+     */
+    void Reset();
+
+    /**
+     * @brief Append the statistics of all nodes in a human-readable form.
+     * @param dumpInfo the string to append to.
+     */
+    void Dump(std::string &dumpInfo) const;
+
+    static int64_t GetCurrentTimeUs();
+    static const char *GetTransmissionName(TransmissionType type);
+
+private:
+    class LatencyHistogram {
+    public:
+        void Add(int64_t latencyUs);
+        void MergeTo(std::array<uint64_t, HISTOGRAM_BUCKET_COUNT> &buckets, LatencySummary &summary) const;
+        void Clear();
+
+    private:
+        std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKET_COUNT> buckets_ {};
+        std::atomic<uint64_t> count_ {0};
+        std::atomic<int64_t> totalUs_ {0};
+        std::atomic<int64_t> maxUs_ {0};
+    };
+
+    static constexpr size_t TRANSMISSION_TYPE_COUNT = static_cast<size_t>(TransmissionType::TRANSMISSION_TYPE_MAX);
+
+    struct StatisticsShard {
+        LatencyHistogram queueDelay;
+        std::array<LatencyHistogram, TRANSMISSION_TYPE_COUNT> outputLatency;
+        std::array<LatencyHistogram, TRANSMISSION_TYPE_COUNT> processTime;
+    };
+
+    using HistogramSelector = const LatencyHistogram &(*)(const StatisticsShard &shard, size_t index);
+    LatencySummary Summarize(HistogramSelector selector, size_t index) const;
+
+    AccessibilityThreadShards<StatisticsShard, MAX_SHARD_COUNT> shards_;
+};
+
+/**
+ * Measures the time spent in one transmission node. Scopes nest along the chain on a thread, and
+ * the time of inner scopes is subtracted so each node is charged only for its own work.
+ */
+class InputProcessScope {
+public:
+    explicit InputProcessScope(TransmissionType type);
+    ~InputProcessScope();
+
+private:
+    TransmissionType type_;
+    int64_t startTime_ = 0;
+    int64_t outerChildTime_ = 0;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_INPUT_STATISTICS_H
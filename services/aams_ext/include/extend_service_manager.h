@@ -51,7 +51,9 @@ using UpdateInputFilterCallback = void(*)();
 using MagnificationModeCallback = void(*)(int32_t mode);   // set
 using MagnificationTypeCallback = uint32_t(*)();
 using AnnouncedForMagnificationCallback = void(*)(AnnounceType announceType);
-using DispatchKeyEventCallback =  std::vector<int32_t> (*) (MMI::KeyEvent &event, uint32_t sequenceNum);
+// dispatch to every connection but the skipped ones, return the connections the event is dispatched to
+using DispatchKeyEventCallback =  std::vector<int32_t> (*) (MMI::KeyEvent &event, uint32_t sequenceNum,
+    const std::vector<int32_t> &skippedConnectionIds);
 using MagnificationScaleCallback = void(*)(float scale);   // set
 using GetAccessibilityWindowsCallback = std::vector<AccessibilityWindowInfo>(*)(uint64_t displayId);    // get
 using SubscribeOsAccountCallback = void(*)();
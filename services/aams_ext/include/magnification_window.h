@@ -16,6 +16,8 @@
 #ifndef MAGNIFICATION_WINDOW_H
 #define MAGNIFICATION_WINDOW_H
 
+#include <atomic>
+
 #include "hilog_wrapper.h"
 #include "wm/window.h"
 #include "window_option.h"
@@ -32,6 +34,16 @@
 
 namespace OHOS {
 namespace Accessibility {
+struct MagnificationRenderStatistics {
+    // RS transactions flushed by the magnification window
+    uint64_t transactionCount = 0;
+    // times the frame overlay was recorded into the canvas node
+    uint64_t frameRecordCount = 0;
+    // vsync intervals in which at least one transaction was flushed
+    uint64_t activeFrameCount = 0;
+    uint64_t maxTransactionsPerFrame = 0;
+};
+
 class MagnificationWindow {
 
 public:
@@ -46,11 +58,17 @@ public:
     bool IsMagnificationWindowShow(uint32_t magnificationType);
     void FollowFocuseElement(uint32_t magnificationType, int32_t centerX, int32_t centerY);
     PointerPos GetSourceCenter();
+    MagnificationRect GetSourceRect();
     void ShowMagnification(uint32_t magnificationType);
     void RefreshWindowParam(uint32_t magnificationType, RotationType type);
     bool IsTapOnHotArea(int32_t posX, int32_t posY);
     bool IsTapOnMagnificationWindow(int32_t posX, int32_t posY);
     void FixSourceCenter(bool needFix);
+    MagnificationRenderStatistics GetRenderStatistics() const;
+    void ResetRenderStatistics();
+    void DumpRenderStatistics(std::string &dumpInfo) const;
+    // called on every vsync received by the magnification, timestamp in CLOCK_MONOTONIC nanoseconds
+    void OnVsync(int64_t timestamp);
     inline bool IsMagnificationWindowActivate() {
         return isMagnificationWindowActivate_;
     }
@@ -91,7 +109,11 @@ private:
     void GetWindowParam();
     PointerPos GetRectCenter(Rosen::Rect rect);
     void FlushImplicitTransaction();
+    int64_t GetFrameSlot(int64_t now) const;
     void DisableMagnification(bool needClear = false);
+    // the frame overlay is recorded once per window and size, pan and zoom only update properties
+    bool IsFrameRetained(uint32_t magnificationType, uint32_t width, uint32_t height) const;
+    void RetainFrame(uint32_t magnificationType, uint32_t width, uint32_t height);
     PointerPos TransferCenter(RotationType type, PointerPos center);
 
     // full magnification
@@ -139,6 +161,20 @@ private:
     bool isMagnificationShowPart_ = false;
     bool isMagnificationShowFull_ = false;
     bool isMagnificationWindowActivate_ = false;
+
+    // the frame overlay currently recorded in canvasNode_
+    uint32_t frameType_ = 0;
+    uint32_t frameWidth_ = 0;
+    uint32_t frameHeight_ = 0;
+
+    std::atomic<uint64_t> transactionCount_ {0};
+    std::atomic<uint64_t> frameRecordCount_ {0};
+    std::atomic<uint64_t> activeFrameCount_ {0};
+    std::atomic<uint64_t> maxTransactionsPerFrame_ {0};
+    // timestamp of the last vsync, 0 if none was received
+    std::atomic<int64_t> vsyncTimestamp_ {0};
+    int64_t lastFrameSlot_ = -1;
+    uint64_t lastFrameTransactionCount_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <cinttypes>
+
 #include "accessibility_circle_drawing_manager.h"
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
 #include "accessibility_display_manager.h"
@@ -120,6 +122,7 @@ AccessibilityCircleDrawingManager::~AccessibilityCircleDrawingManager()
     surfaceNode_->DetachToDisplay(screenId_);
     surfaceNode_ = nullptr;
     canvasNode_ = nullptr;
+    progressNode_ = nullptr;
     FlushImplicitTransaction();
 }
 
@@ -131,6 +134,10 @@ void AccessibilityCircleDrawingManager::UpdatePointerVisible(bool state)
         return;
     }
 
+    if (visible_ == state) {
+        return;
+    }
+    visible_ = state;
     surfaceNode_->SetVisible(state);
     FlushImplicitTransaction();
 }
@@ -161,27 +168,34 @@ void AccessibilityCircleDrawingManager::CreatePointerWindow(int32_t physicalX, i
     surfaceNode_->SetBounds(physicalX - half_, physicalY - half_, imageWidth_, imageHeight_);
     surfaceNode_->SetBackgroundColor(SK_ColorTRANSPARENT); // USE_ROSEN_DRAWING
     screenId_ = screenId;
+    locationX_ = physicalX;
+    locationY_ = physicalY;
     surfaceNode_->AttachToDisplay(screenId);
     surfaceNode_->SetRotation(0);
 
     canvasNode_ = Rosen::RSCanvasNode::Create(false, false, rsUiDirector_->GetRSUIContext());
-    if (canvasNode_ == nullptr) {
+    progressNode_ = Rosen::RSCanvasNode::Create(false, false, rsUiDirector_->GetRSUIContext());
+    if (canvasNode_ == nullptr || progressNode_ == nullptr) {
         HILOG_ERROR("create canvasNode_ fail");
         return;
     }
 
-    surfaceNode_->AddChild(canvasNode_, DEFAULT_VALUE);
-    canvasNode_->SetBounds(0, 0, imageWidth_, imageHeight_);
-    canvasNode_->SetFrame(0, 0, imageWidth_, imageHeight_);
-    canvasNode_->SetBackgroundColor(SK_ColorTRANSPARENT); // USE_ROSEN_DRAWING
-    canvasNode_->SetCornerRadius(1);
-    canvasNode_->SetPositionZ(Rosen::RSSurfaceNode::POINTER_WINDOW_POSITION_Z);
-    canvasNode_->SetRotation(0);
+    for (auto &node : {canvasNode_, progressNode_}) {
+        surfaceNode_->AddChild(node, DEFAULT_VALUE);
+        node->SetBounds(0, 0, imageWidth_, imageHeight_);
+        node->SetFrame(0, 0, imageWidth_, imageHeight_);
+        node->SetBackgroundColor(SK_ColorTRANSPARENT); // USE_ROSEN_DRAWING
+        node->SetCornerRadius(1);
+        node->SetPositionZ(Rosen::RSSurfaceNode::POINTER_WINDOW_POSITION_Z);
+        node->SetRotation(0);
+    }
+    DrawingBackground();
+    progressAngle_ = -1;
     FlushImplicitTransaction();
 }
 
 #ifndef USE_ROSEN_DRAWING
-void AccessibilityCircleDrawingManager::DrawingProgressByOpenSource(int32_t physicalX, int32_t physicalY, int32_t angle)
+void AccessibilityCircleDrawingManager::DrawingBackgroundByOpenSource()
 {
     HILOG_DEBUG();
     auto canvas = static_cast<Rosen::RSRecordingCanvas *>(canvasNode_->BeginRecording(imageWidth_, imageHeight_));
@@ -218,6 +232,14 @@ void AccessibilityCircleDrawingManager::DrawingProgressByOpenSource(int32_t phys
     progressCirclePaint.setStyle(SkPaint::kStroke_Style);
     canvas->drawCircle(half_, half_, dispalyDensity_ * PROGRESS_RADIUS, progressCirclePaint);
 
+    canvasNode_->FinishRecording();
+}
+
+void AccessibilityCircleDrawingManager::DrawingProgressByOpenSource(int32_t angle)
+{
+    HILOG_DEBUG();
+    auto canvas = static_cast<Rosen::RSRecordingCanvas *>(progressNode_->BeginRecording(imageWidth_, imageHeight_));
+
     // progress arc
     SkPaint progressArcPaint;
     progressArcPaint.setAntiAlias(true);
@@ -234,12 +256,10 @@ void AccessibilityCircleDrawingManager::DrawingProgressByOpenSource(int32_t phys
         half_ + dispalyDensity_ * PROGRESS_RADIUS);
     canvas->drawArc(arcRect, startAngle_, angle, false, progressArcPaint);
 
-    canvasNode_->FinishRecording();
-    FlushImplicitTransaction();
+    progressNode_->FinishRecording();
 }
 #else
-void AccessibilityCircleDrawingManager::DrawingProgressByRosenDrawing(int32_t physicalX, int32_t physicalY,
-    int32_t angle)
+void AccessibilityCircleDrawingManager::DrawingBackgroundByRosenDrawing()
 {
     HILOG_DEBUG();
     auto canvas = canvasNode_->BeginRecording(imageWidth_, imageHeight_);
@@ -281,6 +301,14 @@ void AccessibilityCircleDrawingManager::DrawingProgressByRosenDrawing(int32_t ph
     canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), dispalyDensity_ * PROGRESS_RADIUS);
     canvas->DetachPen();
 
+    canvasNode_->FinishRecording();
+}
+
+void AccessibilityCircleDrawingManager::DrawingProgressByRosenDrawing(int32_t angle)
+{
+    HILOG_DEBUG();
+    auto canvas = progressNode_->BeginRecording(imageWidth_, imageHeight_);
+
     // progress arc
     Rosen::Drawing::Pen progressArcPen;
     progressArcPen.SetAntiAlias(true);
@@ -298,67 +326,92 @@ void AccessibilityCircleDrawingManager::DrawingProgressByRosenDrawing(int32_t ph
     canvas->DrawArc(rect, startAngle_, angle);
     canvas->DetachPen();
 
-    canvasNode_->FinishRecording();
-    FlushImplicitTransaction();
+    progressNode_->FinishRecording();
 }
 #endif
 
-void AccessibilityCircleDrawingManager::DrawingProgress(int32_t physicalX, int32_t physicalY, int32_t angle)
+void AccessibilityCircleDrawingManager::DrawingBackground()
+{
+#ifndef USE_ROSEN_DRAWING
+    DrawingBackgroundByOpenSource();
+#else
+    DrawingBackgroundByRosenDrawing();
+#endif
+}
+
+void AccessibilityCircleDrawingManager::DrawingProgress(int32_t angle)
 {
+    if (progressNode_ == nullptr || angle == progressAngle_) {
+        return;
+    }
+    progressAngle_ = angle;
 #ifndef USE_ROSEN_DRAWING
-    DrawingProgressByOpenSource(physicalX, physicalY, angle);
+    DrawingProgressByOpenSource(angle);
 #else
-    DrawingProgressByRosenDrawing(physicalX, physicalY, angle);
+    DrawingProgressByRosenDrawing(angle);
 #endif
 }
 
 void AccessibilityCircleDrawingManager::SetPointerLocation(int32_t physicalX, int32_t physicalY, uint64_t screenId)
 {
-    HILOG_DEBUG("Pointer window move, x:%{public}d, y:%{public}d", physicalX, physicalY);
-    if (surfaceNode_ != nullptr) {
-        surfaceNode_->SetBounds(physicalX - half_,
-            physicalY - half_,
-            surfaceNode_->GetStagingProperties().GetBounds().z_,
-            surfaceNode_->GetStagingProperties().GetBounds().w_);
-        screenId_ = screenId;
+    if (surfaceNode_ == nullptr) {
+        return;
+    }
+    if (physicalX != locationX_ || physicalY != locationY_) {
+        HILOG_DEBUG("Pointer window move, x:%{public}d, y:%{public}d", physicalX, physicalY);
+        surfaceNode_->SetBounds(physicalX - half_, physicalY - half_, imageWidth_, imageHeight_);
+        locationX_ = physicalX;
+        locationY_ = physicalY;
+    }
+    if (screenId != screenId_) {
+        surfaceNode_->DetachToDisplay(screenId_);
         surfaceNode_->AttachToDisplay(screenId);
-        FlushImplicitTransaction();
+        screenId_ = screenId;
     }
+}
 
-    if (canvasNode_ != nullptr) {
-        canvasNode_->SetBounds(0,
-            0,
-            canvasNode_->GetStagingProperties().GetBounds().z_,
-            canvasNode_->GetStagingProperties().GetBounds().w_);
-        canvasNode_->SetFrame(0,
-            0,
-            canvasNode_->GetStagingProperties().GetBounds().z_,
-            canvasNode_->GetStagingProperties().GetBounds().w_);
-        FlushImplicitTransaction();
+void AccessibilityCircleDrawingManager::BeginProgress(int32_t physicalX, int32_t physicalY, uint64_t screenId,
+    int32_t startAngle)
+{
+    HILOG_DEBUG();
+    pressTransactionCount_ = 0;
+    if (surfaceNode_ == nullptr) {
+        CreatePointerWindow(physicalX, physicalY, screenId);
+        if (surfaceNode_ == nullptr) {
+            HILOG_ERROR("surfaceNode_ is nullptr");
+            return;
+        }
+    }
+
+    SetPointerLocation(physicalX, physicalY, screenId);
+    if (startAngle != startAngle_) {
+        // the arc starts somewhere else, so the empty arc below has to be recorded again
+        startAngle_ = startAngle;
+        progressAngle_ = -1;
     }
+    DrawingProgress(0);
+    visible_ = true;
+    surfaceNode_->SetVisible(true);
+    FlushImplicitTransaction();
 }
 
-void AccessibilityCircleDrawingManager::DrawPointer(int32_t physicalX, int32_t physicalY, int32_t angle,
-    uint64_t screenId, int32_t startAngle)
+void AccessibilityCircleDrawingManager::UpdateProgress(int32_t physicalX, int32_t physicalY, int32_t angle)
 {
-    HILOG_DEBUG();
-    startAngle_ = startAngle;
-    if (surfaceNode_ != nullptr) {
-        SetPointerLocation(physicalX, physicalY, screenId);
-        DrawingProgress(physicalX, physicalY, angle);
-        UpdatePointerVisible(true);
-        HILOG_DEBUG("surfaceNode_ is existed");
+    if (surfaceNode_ == nullptr || !visible_) {
         return;
     }
-
-    CreatePointerWindow(physicalX, physicalY, screenId);
-    if (surfaceNode_ == nullptr) {
-        HILOG_ERROR("surfaceNode_ is nullptr");
+    if (physicalX == locationX_ && physicalY == locationY_ && angle == progressAngle_) {
         return;
     }
+    SetPointerLocation(physicalX, physicalY, screenId_);
+    DrawingProgress(angle);
+    FlushImplicitTransaction();
+}
 
-    DrawingProgress(physicalX, physicalY, angle);
-    UpdatePointerVisible(true);
+void AccessibilityCircleDrawingManager::EndProgress()
+{
+    UpdatePointerVisible(false);
+    HILOG_DEBUG("the press took %{public}" PRIu64 " transactions", pressTransactionCount_);
 }
 
 int32_t AccessibilityCircleDrawingManager::ParseStringToInteger(const std::string& color)
@@ -419,11 +472,12 @@ std::vector<int32_t> AccessibilityCircleDrawingManager::ParseColorString(const s
 
 void AccessibilityCircleDrawingManager::FlushImplicitTransaction()
 {
-    
     if (rsUiDirector_ && rsUiDirector_->GetRSUIContext()) {
         auto rsUIContext = rsUiDirector_->GetRSUIContext();
         if (rsUIContext && rsUIContext->GetRSTransaction()) {
             rsUIContext->GetRSTransaction()->FlushImplicitTransaction();
+            transactionCount_++;
+            pressTransactionCount_++;
             return;
         }
     }
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_circle_progress.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t CIRCLE_ANGLE = 360;
+    constexpr int32_t QUARTER_TURN_PORTRAIT = 0;
+    constexpr int32_t QUARTER_TURN_LANDSCAPE = 1;
+    constexpr int32_t QUARTER_TURN_PORTRAIT_INVERTED = 2;
+    constexpr int32_t QUARTER_TURN_LANDSCAPE_INVERTED = 3;
+    constexpr int32_t START_ANGLE_PORTRAIT = -90;
+    constexpr int32_t START_ANGLE_LANDSCAPE = 180;
+    constexpr int32_t START_ANGLE_PORTRAIT_INVERTED = 90;
+    constexpr int32_t START_ANGLE_LANDSCAPE_INVERTED = 0;
+} // namespace
+
+CircleProgressTransform CircleProgressTransform::Create(int32_t quarterTurns, int32_t displayWidth,
+    int32_t displayHeight)
+{
+    CircleProgressTransform transform;
+    transform.valid_ = true;
+    switch (quarterTurns) {
+        case QUARTER_TURN_PORTRAIT:
+            transform.startAngle_ = START_ANGLE_PORTRAIT;
+            break;
+        case QUARTER_TURN_LANDSCAPE:
+            // x = y, y = width - x
+            transform.swapAxes_ = true;
+            transform.signY_ = -1;
+            transform.offsetY_ = displayWidth;
+            transform.startAngle_ = START_ANGLE_LANDSCAPE;
+            break;
+        case QUARTER_TURN_PORTRAIT_INVERTED:
+            // x = width - x, y = height - y
+            transform.signX_ = -1;
+            transform.offsetX_ = displayWidth;
+            transform.signY_ = -1;
+            transform.offsetY_ = displayHeight;
+            transform.startAngle_ = START_ANGLE_PORTRAIT_INVERTED;
+            break;
+        case QUARTER_TURN_LANDSCAPE_INVERTED:
+            // x = height - y, y = x
+            transform.swapAxes_ = true;
+            transform.signX_ = -1;
+            transform.offsetX_ = displayHeight;
+            transform.startAngle_ = START_ANGLE_LANDSCAPE_INVERTED;
+            break;
+        default:
+            transform.valid_ = false;
+            break;
+    }
+    return transform;
+}
+
+bool CircleProgressTransform::Apply(int32_t displayX, int32_t displayY, int32_t &physicalX,
+    int32_t &physicalY) const
+{
+    if (!valid_) {
+        return false;
+    }
+    int32_t sourceX = swapAxes_ ? displayY : displayX;
+    int32_t sourceY = swapAxes_ ? displayX : displayY;
+    physicalX = offsetX_ + signX_ * sourceX;
+    physicalY = offsetY_ + signY_ * sourceY;
+    return true;
+}
+
+int32_t GetCircleProgressAngle(int64_t elapsedMs, uint32_t durationMs)
+{
+    if (durationMs == 0 || elapsedMs >= static_cast<int64_t>(durationMs)) {
+        return CIRCLE_ANGLE;
+    }
+    if (elapsedMs <= 0) {
+        return 0;
+    }
+    return static_cast<int32_t>(elapsedMs * CIRCLE_ANGLE / durationMs);
+}
+} // namespace Accessibility
+} // namespace OHOS
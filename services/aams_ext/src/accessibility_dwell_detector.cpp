@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_dwell_detector.h"
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityDwellDetector::AccessibilityDwellDetector(const std::shared_ptr<GestureTimerWheel> &wheel,
+    DwellCallback callback)
+    : wheel_(wheel), callback_(std::move(callback)), timer_([this]() { OnTimer(); })
+{
+    HILOG_DEBUG();
+}
+
+AccessibilityDwellDetector::~AccessibilityDwellDetector()
+{
+    HILOG_DEBUG();
+    if (wheel_) {
+        wheel_->Cancel(timer_);
+    }
+}
+
+void AccessibilityDwellDetector::OnMove(int32_t posX, int32_t posY, int64_t delayMs)
+{
+    if (!wheel_) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    statistics_.moveCount++;
+    if (pending_) {
+        int64_t deltaX = static_cast<int64_t>(posX) - anchorX_;
+        int64_t deltaY = static_cast<int64_t>(posY) - anchorY_;
+        if (deltaX == 0 && deltaY == 0) {
+            return;
+        }
+        int64_t tolerance = tolerance_;
+        if (deltaX * deltaX + deltaY * deltaY <= tolerance * tolerance) {
+            statistics_.toleratedCount++;
+            return;
+        }
+    }
+
+    pending_ = true;
+    anchorX_ = posX;
+    anchorY_ = posY;
+    deadline_ = wheel_->GetCurrentTime() + delayMs;
+    // an armed timer fires no later than the new deadline, it re-arms itself for the rest
+    if (!timerArmed_) {
+        timerArmed_ = true;
+        statistics_.armCount++;
+        wheel_->Arm(timer_, delayMs);
+    }
+}
+
+void AccessibilityDwellDetector::Cancel()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    pending_ = false;
+}
+
+void AccessibilityDwellDetector::SetTolerance(int32_t radius)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    tolerance_ = radius > 0 ? radius : 0;
+}
+
+bool AccessibilityDwellDetector::IsPending()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return pending_;
+}
+
+DwellStatistics AccessibilityDwellDetector::GetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void AccessibilityDwellDetector::ResetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    statistics_ = {};
+}
+
+void AccessibilityDwellDetector::OnTimer()
+{
+    int32_t posX = 0;
+    int32_t posY = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        timerArmed_ = false;
+        if (!pending_) {
+            return;
+        }
+        int64_t remaining = deadline_ - wheel_->GetCurrentTime();
+        if (remaining > 0) {
+            timerArmed_ = true;
+            statistics_.rearmCount++;
+            wheel_->Arm(timer_, remaining);
+            return;
+        }
+        pending_ = false;
+        statistics_.dwellCount++;
+        posX = anchorX_;
+        posY = anchorY_;
+    }
+    if (callback_) {
+        callback_(posX, posY);
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 // LCOV_EXCL_START
 #include "accessibility_event_transmission.h"
+#include "accessibility_input_statistics.h"
 #include "hilog_wrapper.h"
 
 namespace OHOS {
@@ -25,6 +26,9 @@ bool EventTransmission::OnKeyEvent(MMI::KeyEvent &event)
 
     auto next = GetNext();
     if (next != nullptr) {
+        Singleton<AccessibilityInputStatistics>::GetInstance().RecordOutputLatency(GetTransmissionType(),
+            event.GetActionTime());
+        InputProcessScope processScope(next->GetTransmissionType());
         return next->OnKeyEvent(event);
     }
     return false;
@@ -36,6 +40,9 @@ bool EventTransmission::OnPointerEvent(MMI::PointerEvent &event)
 
     auto next = GetNext();
     if (next != nullptr) {
+        Singleton<AccessibilityInputStatistics>::GetInstance().RecordOutputLatency(GetTransmissionType(),
+            event.GetActionTime());
+        InputProcessScope processScope(next->GetTransmissionType());
         return next->OnPointerEvent(event);
     }
     return false;
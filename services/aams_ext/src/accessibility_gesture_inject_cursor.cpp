@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_gesture_inject_cursor.h"
+#include "hilog_wrapper.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t MS_TO_US = 1000;
+    constexpr size_t MOVE_GESTURE_MIN_PATH_COUNT = 2;
+    constexpr size_t TAP_EVENT_COUNT = 2;
+} // namespace
+
+AccessibilityGestureInjectCursor::AccessibilityGestureInjectCursor(
+    const std::shared_ptr<AccessibilityGestureInjectPath> &gesturePath, int64_t startTime)
+    : gesturePath_(gesturePath), startTime_(startTime)
+{
+    if (!gesturePath_) {
+        HILOG_ERROR("gesturePath is null.");
+        return;
+    }
+    const std::vector<AccessibilityGesturePosition> &positions = gesturePath_->GetPositions();
+    size_t positionSize = positions.size();
+    if (positionSize == 0) {
+        HILOG_ERROR("position size is 0.");
+        return;
+    }
+    int64_t durationTime = gesturePath_->GetDurationTime();
+    if (durationTime < 0) {
+        HILOG_WARN("DurationTime is wrong.");
+        return;
+    }
+    isTap_ = (positionSize == 1) || ((positions[0].positionX_ == positions[1].positionX_) &&
+        (positions[0].positionY_ == positions[1].positionY_));
+    if (isTap_) {
+        perDurationTime_ = static_cast<int64_t>(static_cast<uint64_t>(durationTime) / positionSize) * MS_TO_US;
+        eventCount_ = positionSize * TAP_EVENT_COUNT;
+        return;
+    }
+    if (positionSize < MOVE_GESTURE_MIN_PATH_COUNT) {
+        HILOG_WARN("PositionSize is wrong.");
+        return;
+    }
+    perDurationTime_ = static_cast<int64_t>(static_cast<uint64_t>(durationTime) / (positionSize - 1)) * MS_TO_US;
+    // a down, a move on each of the other positions and an up
+    eventCount_ = positionSize + 1;
+}
+
+bool AccessibilityGestureInjectCursor::Next(GestureInjectPoint &point)
+{
+    if (!HasNext()) {
+        return false;
+    }
+    const std::vector<AccessibilityGesturePosition> &positions = gesturePath_->GetPositions();
+    if (isTap_) {
+        NextTapEvent(positions[index_ / TAP_EVENT_COUNT], point);
+    } else {
+        NextMoveEvent(positions[index_ < positions.size() ? index_ : positions.size() - 1], point);
+    }
+    index_++;
+    return true;
+}
+
+void AccessibilityGestureInjectCursor::NextTapEvent(const AccessibilityGesturePosition &position,
+    GestureInjectPoint &point) const
+{
+    int64_t tap = static_cast<int64_t>(index_ / TAP_EVENT_COUNT);
+    point.displayX = static_cast<int32_t>(position.positionX_);
+    point.displayY = static_cast<int32_t>(position.positionY_);
+    point.downTime = startTime_ + tap * (perDurationTime_ + DOUBLE_TAP_MIN_TIME);
+    if (index_ % TAP_EVENT_COUNT == 0) {
+        point.action = MMI::PointerEvent::POINTER_ACTION_DOWN;
+        point.actionTime = point.downTime;
+    } else {
+        point.action = MMI::PointerEvent::POINTER_ACTION_UP;
+        point.actionTime = point.downTime + perDurationTime_;
+    }
+}
+
+void AccessibilityGestureInjectCursor::NextMoveEvent(const AccessibilityGesturePosition &position,
+    GestureInjectPoint &point) const
+{
+    point.displayX = static_cast<int32_t>(position.positionX_);
+    point.displayY = static_cast<int32_t>(position.positionY_);
+    point.downTime = startTime_;
+    if (index_ == 0) {
+        point.action = MMI::PointerEvent::POINTER_ACTION_DOWN;
+        point.actionTime = startTime_;
+        return;
+    }
+    // the up is at the same time and position as the last move
+    size_t step = index_ < eventCount_ - 1 ? index_ : index_ - 1;
+    point.action = index_ < eventCount_ - 1 ? MMI::PointerEvent::POINTER_ACTION_MOVE :
+        MMI::PointerEvent::POINTER_ACTION_UP;
+    point.actionTime = startTime_ + static_cast<int64_t>(step) * perDurationTime_;
+}
+} // namespace Accessibility
+} // namespace OHOS
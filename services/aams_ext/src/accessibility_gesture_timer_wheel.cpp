@@ -0,0 +1,408 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_gesture_timer_wheel.h"
+
+#include <algorithm>
+#include <ctime>
+#include <numeric>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    const char* WAKE_UP_TASK_NAME = "GestureTimerWheelWakeUp";
+    constexpr int64_t SEC_TO_MS = 1000;
+    constexpr int64_t NS_TO_MS = 1000000;
+    constexpr int64_t LEVEL0_MASK = (1 << GestureTimerWheel::LEVEL0_BITS) - 1;
+    constexpr int64_t LEVELN_MASK = (1 << GestureTimerWheel::LEVELN_BITS) - 1;
+
+    uint32_t GetLevelShift(uint32_t level)
+    {
+        return GestureTimerWheel::LEVEL0_BITS + GestureTimerWheel::LEVELN_BITS * (level - 1);
+    }
+} // namespace
+
+GestureTimerWheel::GestureTimerWheel(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
+    ffrt::mutex *fireMutex) : clock_(&GestureTimerWheel::GetMonotonicTime), fireMutex_(fireMutex)
+{
+    HILOG_DEBUG();
+    if (runner) {
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    InitListHeads();
+}
+
+GestureTimerWheel::GestureTimerWheel(Clock clock, ffrt::mutex *fireMutex)
+    : clock_(std::move(clock)), fireMutex_(fireMutex)
+{
+    HILOG_DEBUG();
+    InitListHeads();
+}
+
+void GestureTimerWheel::InitListHeads()
+{
+    for (auto &head : level0_) {
+        InitHead(head);
+    }
+    for (auto &slots : levelN_) {
+        for (auto &head : slots) {
+            InitHead(head);
+        }
+    }
+    InitHead(expired_);
+    currentTick_ = GetCurrentTime();
+}
+
+GestureTimerWheel::~GestureTimerWheel()
+{
+    HILOG_DEBUG();
+    if (handler_) {
+        handler_->RemoveTask(WAKE_UP_TASK_NAME);
+    }
+}
+
+int64_t GestureTimerWheel::GetMonotonicTime()
+{
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    return static_cast<int64_t>(times.tv_sec) * SEC_TO_MS + static_cast<int64_t>(times.tv_nsec) / NS_TO_MS;
+}
+
+int64_t GestureTimerWheel::GetCurrentTime() const
+{
+    return clock_ ? clock_() : GetMonotonicTime();
+}
+
+void GestureTimerWheel::Arm(Timer &timer, int64_t delayMs)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    int64_t now = GetCurrentTime();
+    AdvanceLocked(now);
+    if (timer.level_ >= 0) {
+        UnlinkLocked(timer);
+    }
+    timer.expireTime_ = now + std::max<int64_t>(delayMs, 0);
+    InsertLocked(timer);
+    ScheduleWakeUpLocked();
+}
+
+void GestureTimerWheel::Cancel(Timer &timer)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (timer.level_ >= 0) {
+        UnlinkLocked(timer);
+    }
+}
+
+bool GestureTimerWheel::IsArmed(const Timer &timer)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return timer.level_ >= 0;
+}
+
+size_t GestureTimerWheel::GetArmedCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return armedCount_;
+}
+
+void GestureTimerWheel::ProcessExpiredTimers()
+{
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    scheduledWakeUp_ = NO_WAKE_UP;
+    AdvanceLocked(GetCurrentTime());
+    // timers which expire while firing this batch are left to the next wake-up
+    Timer firing;
+    InitHead(firing);
+    if (!IsEmpty(expired_)) {
+        firing.next_ = expired_.next_;
+        firing.prev_ = expired_.prev_;
+        firing.next_->prev_ = &firing;
+        firing.prev_->next_ = &firing;
+        InitHead(expired_);
+    }
+    while (!IsEmpty(firing)) {
+        Timer *timer = firing.next_;
+        UnlinkLocked(*timer);
+        // the callback may arm or cancel timers, including the expired ones which are not fired yet
+        std::function<void()> callback = timer->callback_;
+        lock.unlock();
+        if (callback && fireMutex_) {
+            std::lock_guard<ffrt::mutex> fireLock(*fireMutex_);
+            callback();
+        } else if (callback) {
+            callback();
+        }
+        lock.lock();
+    }
+    ScheduleWakeUpLocked();
+}
+
+void GestureTimerWheel::InitHead(Timer &head)
+{
+    head.next_ = &head;
+    head.prev_ = &head;
+}
+
+bool GestureTimerWheel::IsEmpty(const Timer &head)
+{
+    return head.next_ == &head;
+}
+
+void GestureTimerWheel::PushBack(Timer &head, Timer &timer)
+{
+    timer.prev_ = head.prev_;
+    timer.next_ = &head;
+    head.prev_->next_ = &timer;
+    head.prev_ = &timer;
+}
+
+void GestureTimerWheel::InsertLocked(Timer &timer)
+{
+    if (timer.expireTime_ < currentTick_) {
+        timer.level_ = LEVEL_EXPIRED;
+        PushBack(expired_, timer);
+        armedCount_++;
+        return;
+    }
+    int64_t expire = timer.expireTime_;
+    int64_t delta = expire - currentTick_;
+    if (delta <= LEVEL0_MASK) {
+        timer.level_ = 0;
+        PushBack(level0_[expire & LEVEL0_MASK], timer);
+    } else {
+        uint32_t level = 1;
+        for (; level < LEVEL_COUNT; level++) {
+            if (delta < (static_cast<int64_t>(1) << (GetLevelShift(level) + LEVELN_BITS))) {
+                break;
+            }
+        }
+        if (level == LEVEL_COUNT) {
+            // beyond the span of the wheel, park it in the farthest slot and place it again on cascade
+            level = LEVEL_COUNT - 1;
+            expire = currentTick_ + (static_cast<int64_t>(1) << (GetLevelShift(level) + LEVELN_BITS)) - 1;
+        }
+        timer.level_ = static_cast<int32_t>(level);
+        PushBack(levelN_[level - 1][(expire >> GetLevelShift(level)) & LEVELN_MASK], timer);
+    }
+    levelCount_[timer.level_]++;
+    armedCount_++;
+}
+
+void GestureTimerWheel::Remove(Timer &timer)
+{
+    timer.prev_->next_ = timer.next_;
+    timer.next_->prev_ = timer.prev_;
+    timer.prev_ = nullptr;
+    timer.next_ = nullptr;
+}
+
+void GestureTimerWheel::UnlinkLocked(Timer &timer)
+{
+    Remove(timer);
+    if (timer.level_ < LEVEL_EXPIRED) {
+        levelCount_[timer.level_]--;
+    }
+    timer.level_ = -1;
+    armedCount_--;
+}
+
+void GestureTimerWheel::CascadeLocked(uint32_t level, int64_t tick)
+{
+    Timer &head = levelN_[level - 1][(tick >> GetLevelShift(level)) & LEVELN_MASK];
+    if (IsEmpty(head)) {
+        return;
+    }
+    // detach the whole slot first, as a timer may be placed back into the same slot
+    Timer pending;
+    InitHead(pending);
+    while (!IsEmpty(head)) {
+        Timer *timer = head.next_;
+        UnlinkLocked(*timer);
+        PushBack(pending, *timer);
+    }
+    while (!IsEmpty(pending)) {
+        Timer *timer = pending.next_;
+        Remove(*timer);
+        InsertLocked(*timer);
+    }
+}
+
+void GestureTimerWheel::AdvanceLocked(int64_t now)
+{
+    while (currentTick_ <= now) {
+        if (std::accumulate(levelCount_.begin(), levelCount_.end(), static_cast<size_t>(0)) == 0) {
+            currentTick_ = now + 1;
+            return;
+        }
+        int64_t tick = currentTick_;
+        if ((tick & LEVEL0_MASK) == 0) {
+            for (uint32_t level = LEVEL_COUNT - 1; level > 0; level--) {
+                if ((tick & ((static_cast<int64_t>(1) << GetLevelShift(level)) - 1)) == 0) {
+                    CascadeLocked(level, tick);
+                }
+            }
+        }
+        Timer &head = level0_[tick & LEVEL0_MASK];
+        while (!IsEmpty(head)) {
+            Timer *timer = head.next_;
+            Remove(*timer);
+            levelCount_[0]--;
+            timer->level_ = LEVEL_EXPIRED;
+            PushBack(expired_, *timer);
+        }
+        currentTick_++;
+        if (levelCount_[0] == 0) {
+            // nothing can expire before the next cascade
+            int64_t boundary = (currentTick_ + LEVEL0_MASK) & ~LEVEL0_MASK;
+            currentTick_ = std::min(boundary, now + 1);
+        }
+    }
+}
+
+int64_t GestureTimerWheel::GetNextWakeUpLocked() const
+{
+    if (armedCount_ == 0) {
+        return NO_WAKE_UP;
+    }
+    if (!IsEmpty(expired_)) {
+        return currentTick_;
+    }
+    int64_t next = NO_WAKE_UP;
+    if (levelCount_[0] > 0) {
+        for (int64_t tick = currentTick_; tick <= currentTick_ + LEVEL0_MASK; tick++) {
+            const Timer &head = level0_[tick & LEVEL0_MASK];
+            if (!IsEmpty(head)) {
+                next = tick;
+                break;
+            }
+        }
+    }
+    for (uint32_t level = 1; level < LEVEL_COUNT; level++) {
+        if (levelCount_[level] == 0) {
+            continue;
+        }
+        // timers of a higher level never expire before the cascade of their slot
+        uint32_t shift = GetLevelShift(level);
+        int64_t firstSlot = (currentTick_ + (static_cast<int64_t>(1) << shift) - 1) >> shift;
+        for (int64_t slot = firstSlot; slot <= firstSlot + LEVELN_MASK; slot++) {
+            const Timer &head = levelN_[level - 1][slot & LEVELN_MASK];
+            if (!IsEmpty(head)) {
+                int64_t cascadeTick = slot << shift;
+                next = (next == NO_WAKE_UP) ? cascadeTick : std::min(next, cascadeTick);
+                break;
+            }
+        }
+    }
+    return next;
+}
+
+void GestureTimerWheel::ScheduleWakeUpLocked()
+{
+    if (!handler_) {
+        return;
+    }
+    int64_t next = GetNextWakeUpLocked();
+    if (next == NO_WAKE_UP || (scheduledWakeUp_ != NO_WAKE_UP && scheduledWakeUp_ <= next)) {
+        return;
+    }
+    int64_t delayTime = std::max<int64_t>(next - GetCurrentTime(), 0);
+    std::weak_ptr<GestureTimerWheel> weakWheel = weak_from_this();
+    handler_->RemoveTask(WAKE_UP_TASK_NAME);
+    handler_->PostTask([weakWheel]() {
+        std::shared_ptr<GestureTimerWheel> wheel = weakWheel.lock();
+        if (wheel) {
+            wheel->ProcessExpiredTimers();
+        }
+        }, WAKE_UP_TASK_NAME, delayTime);
+    scheduledWakeUp_ = next;
+}
+
+GestureTimerHandler::GestureTimerHandler(const std::shared_ptr<GestureTimerWheel> &wheel) : wheel_(wheel)
+{
+}
+
+GestureTimerHandler::~GestureTimerHandler()
+{
+    RemoveAllEvents();
+}
+
+bool GestureTimerHandler::SendEvent(uint32_t innerEventId, int64_t param, int64_t delayTime)
+{
+    if (!wheel_) {
+        HILOG_ERROR("gesture timer wheel is nullptr");
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    std::unique_ptr<EventTimer> &eventTimer = timers_[innerEventId];
+    if (!eventTimer) {
+        std::weak_ptr<GestureTimerHandler> weakHandler = weak_from_this();
+        eventTimer = std::make_unique<EventTimer>([weakHandler, innerEventId]() {
+            std::shared_ptr<GestureTimerHandler> handler = weakHandler.lock();
+            if (handler) {
+                handler->OnTimerExpired(innerEventId);
+            }
+        });
+    }
+    eventTimer->param = param;
+    wheel_->Arm(eventTimer->timer, delayTime);
+    return true;
+}
+
+void GestureTimerHandler::RemoveEvent(uint32_t innerEventId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = timers_.find(innerEventId);
+    if (wheel_ && iter != timers_.end()) {
+        wheel_->Cancel(iter->second->timer);
+    }
+}
+
+bool GestureTimerHandler::HasInnerEvent(uint32_t innerEventId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = timers_.find(innerEventId);
+    return wheel_ && iter != timers_.end() && wheel_->IsArmed(iter->second->timer);
+}
+
+void GestureTimerHandler::RemoveAllEvents()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!wheel_) {
+        return;
+    }
+    for (auto &iter : timers_) {
+        wheel_->Cancel(iter.second->timer);
+    }
+}
+
+void GestureTimerHandler::OnTimerExpired(uint32_t innerEventId)
+{
+    int64_t param = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto iter = timers_.find(innerEventId);
+        if (iter == timers_.end()) {
+            return;
+        }
+        param = iter->second->param;
+    }
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(innerEventId, param);
+    ProcessEvent(event);
+}
+} // namespace Accessibility
+} // namespace OHOS
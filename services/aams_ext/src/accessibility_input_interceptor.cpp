@@ -14,6 +14,8 @@
  */
 
 #include "accessibility_input_interceptor.h"
+#include "accessibility_input_recorder.h"
+#include "accessibility_input_statistics.h"
 #include "accessibility_keyevent_filter.h"
 #include "accessibility_mouse_autoclick.h"
 #include "accessibility_short_key.h"
@@ -36,12 +38,14 @@
 #include "bundlemgr/bundle_mgr_interface.h"
 #include "if_system_ability_manager.h"
 #include "iservice_registry.h"
+#include "parameters.h"
 #include "system_ability_definition.h"
 
 namespace OHOS {
 namespace Accessibility {
 namespace {
     const char* AAMS_INPUT_MANAGER_RUNNER_NAME = "AamsInputManagerRunner";
+    const char* INPUT_INLINE_DISPATCH_PARAM = "const.accessibility.input_inline_dispatch";
 }
 sptr<AccessibilityInputInterceptor> AccessibilityInputInterceptor::instance_ = nullptr;
 ffrt::mutex AccessibilityInputInterceptor::instanceMutex_;
@@ -77,6 +81,7 @@ AccessibilityInputInterceptor::~AccessibilityInputInterceptor()
     inputManager_ = nullptr;
     inputEventConsumer_ = nullptr;
     eventHandler_ = nullptr;
+    gestureTimerWheel_ = nullptr;
     inputManagerRunner_.reset();
 }
 
@@ -95,12 +100,19 @@ void AccessibilityInputInterceptor::InitInputManagerHandler()
             return;
         }
     }
+
+    if (!gestureTimerWheel_) {
+        // events may run the chain inline on the MMI thread, so the timeouts are fired holding the same lock
+        gestureTimerWheel_ = std::make_shared<GestureTimerWheel>(inputManagerRunner_, &mutex_);
+    }
 }
 
 bool AccessibilityInputInterceptor::OnKeyEvent(MMI::KeyEvent &event)
 {
     HILOG_DEBUG();
 
+    Singleton<AccessibilityInputStatistics>::GetInstance().RecordOutputLatency(GetTransmissionType(),
+        event.GetActionTime());
     event.AddFlag(MMI::InputEvent::EVENT_FLAG_NO_INTERCEPT);
     std::shared_ptr<MMI::KeyEvent> keyEvent = std::make_shared<MMI::KeyEvent>(event);
     if (inputManager_) {
@@ -122,6 +134,8 @@ bool AccessibilityInputInterceptor::OnPointerEvent(MMI::PointerEvent &event)
             event.GetPointerAction(), event.GetSourceType(), event.GetPointerId());
     }
 
+    Singleton<AccessibilityInputStatistics>::GetInstance().RecordOutputLatency(GetTransmissionType(),
+        event.GetActionTime());
     event.AddFlag(MMI::InputEvent::EVENT_FLAG_NO_INTERCEPT);
     std::shared_ptr<MMI::PointerEvent> pointerEvent = std::make_shared<MMI::PointerEvent>(event);
     if (inputManager_) {
@@ -163,6 +177,23 @@ void AccessibilityInputInterceptor::SetAvailableFunctions(uint32_t availableFunc
     });
 }
 
+std::shared_ptr<GestureTimerWheel> AccessibilityInputInterceptor::RebuildTransmitters(uint32_t availableFunctions,
+    const std::shared_ptr<GestureTimerWheel> &wheel)
+{
+    std::lock_guard<ffrt::mutex> lock(eventHandlerMutex_);
+    // the chain is swapped on the calling thread, no event may run through it meanwhile
+    std::lock_guard<ffrt::mutex> processLock(mutex_);
+    HILOG_INFO("function[%{public}u].", availableFunctions);
+
+    // the filters take the wheel when they are created, so swap it before assembling the chain
+    std::shared_ptr<GestureTimerWheel> originWheel = gestureTimerWheel_;
+    gestureTimerWheel_ = wheel;
+    availableFunctions_ = availableFunctions;
+    DestroyTransmittersLocked();
+    CreateTransmitters();
+    return originWheel;
+}
+
 void AccessibilityInputInterceptor::CreateTransmitters()
 {
     HILOG_DEBUG("function[%{public}u].", availableFunctions_);
@@ -398,6 +429,11 @@ void AccessibilityInputInterceptor::DestroyInterceptor()
 void AccessibilityInputInterceptor::DestroyTransmitters()
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    DestroyTransmittersLocked();
+}
+
+void AccessibilityInputInterceptor::DestroyTransmittersLocked()
+{
     HILOG_DEBUG();
 
     if ((availableFunctions_ & FEATURE_MOUSE_KEY) != FEATURE_MOUSE_KEY) {
@@ -449,8 +485,11 @@ void AccessibilityInputInterceptor::ProcessPointerEvent(std::shared_ptr<MMI::Poi
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG();
+    Singleton<AccessibilityInputRecorder>::GetInstance().Record(*event);
+    Singleton<AccessibilityInputStatistics>::GetInstance().RecordQueueDelay(event->GetActionTime());
 
     if (mouseKey_) {
+        InputProcessScope processScope(mouseKey_->GetTransmissionType());
         mouseKey_->OnPointerEvent(*event);
     }
     if (event->GetCallingUid() > 0) {
@@ -475,6 +514,7 @@ void AccessibilityInputInterceptor::ProcessPointerEvent(std::shared_ptr<MMI::Poi
         return;
     }
 
+    InputProcessScope processScope(pointerEventTransmitters_->GetTransmissionType());
     pointerEventTransmitters_->OnPointerEvent(*event);
 }
 
@@ -482,8 +522,10 @@ void AccessibilityInputInterceptor::ProcessKeyEvent(std::shared_ptr<MMI::KeyEven
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG();
+    Singleton<AccessibilityInputStatistics>::GetInstance().RecordQueueDelay(event->GetActionTime());
 
     if (mouseKey_) {
+        InputProcessScope processScope(mouseKey_->GetTransmissionType());
         bool result = mouseKey_->OnKeyEvent(*event);
         if (result) {
             HILOG_DEBUG("The event is mouse key event.");
@@ -497,6 +539,7 @@ void AccessibilityInputInterceptor::ProcessKeyEvent(std::shared_ptr<MMI::KeyEven
         return;
     }
 
+    InputProcessScope processScope(keyEventTransmitters_->GetTransmissionType());
     keyEventTransmitters_->OnKeyEvent(*event);
 }
 
@@ -580,6 +623,8 @@ void AccessibilityInputInterceptor::SetServiceOnKeyEventResult(
 AccessibilityInputEventConsumer::AccessibilityInputEventConsumer()
 {
     HILOG_DEBUG();
+    inlineDispatch_ = system::GetBoolParameter(INPUT_INLINE_DISPATCH_PARAM, false);
+    HILOG_INFO("inlineDispatch: %{public}d", inlineDispatch_);
     eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(
         AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner());
 #ifdef ACCESSIBILITY_WATCH_FEATURE
@@ -622,6 +667,13 @@ void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::KeyEvent
         return;
     }
 
+    // In inline mode the filter chain runs on the MMI callback thread. Timer callbacks of the
+    // filters still run on inputManagerRunner_, serialized with the events by GetDispatchMutex.
+    if (inlineDispatch_) {
+        interceptor->ProcessKeyEvent(keyEvent);
+        return;
+    }
+
     if (!eventHandler_) {
         HILOG_ERROR("eventHandler is empty.");
         return;
@@ -652,6 +704,11 @@ void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::PointerE
         return;
     }
 
+    if (inlineDispatch_) {
+        interceptor->ProcessPointerEvent(pointerEvent);
+        return;
+    }
+
     if (!eventHandler_) {
         HILOG_ERROR("eventHandler is empty.");
         return;
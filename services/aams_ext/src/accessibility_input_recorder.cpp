@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_input_recorder.h"
+
+#include <sstream>
+
+#include "hilog_wrapper.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr char POINTER_RECORD_TAG = 'P';
+    constexpr char COMMENT_TAG = '#';
+    constexpr size_t MAX_ITEM_COUNT = 32;
+    const char* DEBUGGABLE_PARAM = "const.debuggable";
+    const char* INPUT_RECORD_PARAM = "debug.accessibility.input_record";
+
+    bool ParsePointerRecord(std::istringstream &iss, InputRecord &record)
+    {
+        int64_t actionTime = 0;
+        int32_t sourceType = 0;
+        int32_t pointerAction = 0;
+        int32_t pointerId = 0;
+        size_t itemCount = 0;
+        if (!(iss >> actionTime >> sourceType >> pointerAction >> pointerId >> itemCount) ||
+            itemCount > MAX_ITEM_COUNT) {
+            return false;
+        }
+        std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+        if (!event) {
+            return false;
+        }
+        for (size_t i = 0; i < itemCount; i++) {
+            int32_t id = 0;
+            int64_t downTime = 0;
+            int32_t pressed = 0;
+            int32_t displayX = 0;
+            int32_t displayY = 0;
+            if (!(iss >> id >> downTime >> pressed >> displayX >> displayY)) {
+                return false;
+            }
+            MMI::PointerEvent::PointerItem item;
+            item.SetPointerId(id);
+            item.SetDownTime(downTime);
+            item.SetPressed(pressed != 0);
+            item.SetDisplayX(displayX);
+            item.SetDisplayY(displayY);
+            event->AddPointerItem(item);
+        }
+        event->SetActionTime(actionTime);
+        event->SetSourceType(sourceType);
+        event->SetPointerAction(pointerAction);
+        event->SetPointerId(pointerId);
+        record.pointerEvent = event;
+        record.actionTime = actionTime;
+        return true;
+    }
+} // namespace
+
+AccessibilityInputRecorder::AccessibilityInputRecorder()
+{
+}
+
+AccessibilityInputRecorder::~AccessibilityInputRecorder()
+{
+}
+
+bool AccessibilityInputRecorder::IsAllowed()
+{
+    return system::GetBoolParameter(DEBUGGABLE_PARAM, false) && system::GetBoolParameter(INPUT_RECORD_PARAM, false);
+}
+
+void AccessibilityInputRecorder::Start()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    HILOG_INFO("start recording input events");
+    records_.clear();
+    droppedCount_ = 0;
+    recording_.store(true, std::memory_order_relaxed);
+}
+
+void AccessibilityInputRecorder::Stop(std::string &records)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    HILOG_INFO("stop recording input events, count: %{public}zu, dropped: %{public}zu", records_.size(),
+        droppedCount_);
+    recording_.store(false, std::memory_order_relaxed);
+    std::ostringstream oss;
+    oss << COMMENT_TAG << " count=" << records_.size() << " dropped=" << droppedCount_ << std::endl;
+    for (const auto &record : records_) {
+        oss << record << std::endl;
+    }
+    records.append(oss.str());
+    records_.clear();
+}
+
+void AccessibilityInputRecorder::Record(const MMI::PointerEvent &event)
+{
+    if (!IsRecording()) {
+        return;
+    }
+    Append(Serialize(event));
+}
+
+void AccessibilityInputRecorder::Append(std::string &&record)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!IsRecording()) {
+        return;
+    }
+    if (records_.size() >= MAX_RECORD_COUNT) {
+        droppedCount_++;
+        return;
+    }
+    records_.push_back(std::move(record));
+}
+
+std::string AccessibilityInputRecorder::Serialize(const MMI::PointerEvent &event)
+{
+    std::ostringstream oss;
+    std::vector<int32_t> pointerIds = event.GetPointerIds();
+    oss << POINTER_RECORD_TAG << " " << event.GetActionTime() << " " << event.GetSourceType() << " " <<
+        event.GetPointerAction() << " " << event.GetPointerId() << " " << pointerIds.size();
+    for (int32_t pointerId : pointerIds) {
+        MMI::PointerEvent::PointerItem item;
+        event.GetPointerItem(pointerId, item);
+        oss << " " << item.GetPointerId() << " " << item.GetDownTime() << " " << (item.IsPressed() ? 1 : 0) <<
+            " " << item.GetDisplayX() << " " << item.GetDisplayY();
+    }
+    return oss.str();
+}
+
+bool AccessibilityInputRecorder::Parse(const std::string &line, InputRecord &record)
+{
+    std::istringstream iss(line);
+    char tag = 0;
+    if (!(iss >> tag)) {
+        return false;
+    }
+    if (tag != POINTER_RECORD_TAG) {
+        return false;
+    }
+    return ParsePointerRecord(iss, record);
+}
+
+bool AccessibilityInputRecorder::ParseAll(const std::string &records, std::vector<InputRecord> &result)
+{
+    std::istringstream iss(records);
+    std::string line;
+    while (std::getline(iss, line)) {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == COMMENT_TAG) {
+            continue;
+        }
+        InputRecord record;
+        if (!Parse(line, record)) {
+            HILOG_ERROR("malformed input record: %{public}s", line.c_str());
+            return false;
+        }
+        result.push_back(record);
+    }
+    return true;
+}
+} // namespace Accessibility
+} // namespace OHOS
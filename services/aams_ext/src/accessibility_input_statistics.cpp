@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_input_statistics.h"
+
+#include <algorithm>
+#include <ctime>
+#include <sstream>
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t SEC_TO_US = 1000000;
+    constexpr int64_t NS_TO_US = 1000;
+    constexpr uint64_t PERCENT_50 = 50;
+    constexpr uint64_t PERCENT_99 = 99;
+    constexpr uint64_t PERCENT_100 = 100;
+    thread_local int64_t g_childProcessTime = 0;
+
+    size_t GetBucketIndex(int64_t latencyUs)
+    {
+        size_t index = 0;
+        uint64_t value = static_cast<uint64_t>(latencyUs);
+        while (value > 0 && index < AccessibilityInputStatistics::HISTOGRAM_BUCKET_COUNT - 1) {
+            value >>= 1;
+            index++;
+        }
+        return index;
+    }
+
+    int64_t GetBucketUpperBound(size_t index)
+    {
+        return (index == 0) ? 0 : (static_cast<int64_t>(1) << index) - 1;
+    }
+
+    int64_t GetPercentile(const std::array<uint64_t, AccessibilityInputStatistics::HISTOGRAM_BUCKET_COUNT> &buckets,
+        uint64_t count, uint64_t percent, int64_t maxUs)
+    {
+        if (count == 0) {
+            return 0;
+        }
+        uint64_t target = (count * percent + PERCENT_100 - 1) / PERCENT_100;
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            accumulated += buckets[i];
+            if (accumulated >= target) {
+                return std::min(GetBucketUpperBound(i), maxUs);
+            }
+        }
+        return maxUs;
+    }
+
+    void AppendSummary(std::ostringstream &oss, const LatencySummary &summary)
+    {
+        oss << "count=" << summary.count << " totalUs=" << summary.totalUs << " p50Us=" << summary.p50Us
+            << " p99Us=" << summary.p99Us << " maxUs=" << summary.maxUs;
+    }
+} // namespace
+
+AccessibilityInputStatistics::AccessibilityInputStatistics()
+{
+}
+
+AccessibilityInputStatistics::~AccessibilityInputStatistics()
+{
+}
+
+int64_t AccessibilityInputStatistics::GetCurrentTimeUs()
+{
+    // same clock as MMI::InputEvent::GetActionTime
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    return static_cast<int64_t>(times.tv_sec) * SEC_TO_US + static_cast<int64_t>(times.tv_nsec) / NS_TO_US;
+}
+
+const char *AccessibilityInputStatistics::GetTransmissionName(TransmissionType type)
+{
+    switch (type) {
+        case TransmissionType::TRANSMISSION_MOUSE_KEY:
+            return "MouseKey";
+        case TransmissionType::TRANSMISSION_MOUSE_AUTOCLICK:
+            return "MouseAutoclick";
+        case TransmissionType::TRANSMISSION_TOUCH_EVENT_INJECTOR:
+            return "TouchEventInjector";
+        case TransmissionType::TRANSMISSION_ZOOM_GESTURE:
+            return "ZoomGesture";
+        case TransmissionType::TRANSMISSION_WINDOW_MAGNIFICATION_GESTURE:
+            return "WindowMagnificationGesture";
+        case TransmissionType::TRANSMISSION_TOUCH_EXPLORATION:
+            return "TouchExploration";
+        case TransmissionType::TRANSMISSION_SCREEN_TOUCH:
+            return "ScreenTouch";
+        case TransmissionType::TRANSMISSION_KEY_EVENT_FILTER:
+            return "KeyEventFilter";
+        case TransmissionType::TRANSMISSION_INPUT_INTERCEPTOR:
+            return "InputInterceptor";
+        default:
+            return "Unknown";
+    }
+}
+
+void AccessibilityInputStatistics::LatencyHistogram::Add(int64_t latencyUs)
+{
+    if (latencyUs < 0) {
+        latencyUs = 0;
+    }
+    buckets_[GetBucketIndex(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    totalUs_.fetch_add(latencyUs, std::memory_order_relaxed);
+    int64_t curMax = maxUs_.load(std::memory_order_relaxed);
+    while (latencyUs > curMax) {
+        if (maxUs_.compare_exchange_weak(curMax, latencyUs, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+
+void AccessibilityInputStatistics::LatencyHistogram::MergeTo(std::array<uint64_t, HISTOGRAM_BUCKET_COUNT> &buckets,
+    LatencySummary &summary) const
+{
+    for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+        buckets[i] += buckets_[i].load(std::memory_order_relaxed);
+    }
+    summary.count += count_.load(std::memory_order_relaxed);
+    summary.totalUs += totalUs_.load(std::memory_order_relaxed);
+    summary.maxUs = std::max(summary.maxUs, maxUs_.load(std::memory_order_relaxed));
+}
+
+void AccessibilityInputStatistics::LatencyHistogram::Clear()
+{
+    for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    totalUs_.store(0, std::memory_order_relaxed);
+    maxUs_.store(0, std::memory_order_relaxed);
+}
+
+void AccessibilityInputStatistics::RecordQueueDelay(int64_t actionTime)
+{
+    shards_.Local().queueDelay.Add(GetCurrentTimeUs() - actionTime);
+}
+
+void AccessibilityInputStatistics::RecordOutputLatency(TransmissionType type, int64_t actionTime)
+{
+    size_t index = static_cast<size_t>(type);
+    if (index >= TRANSMISSION_TYPE_COUNT) {
+        return;
+    }
+    shards_.Local().outputLatency[index].Add(GetCurrentTimeUs() - actionTime);
+}
+
+void AccessibilityInputStatistics::RecordProcessTime(TransmissionType type, int64_t processUs)
+{
+    size_t index = static_cast<size_t>(type);
+    if (index >= TRANSMISSION_TYPE_COUNT) {
+        return;
+    }
+    shards_.Local().processTime[index].Add(processUs);
+}
+
+LatencySummary AccessibilityInputStatistics::Summarize(HistogramSelector selector, size_t index) const
+{
+    LatencySummary summary;
+    std::array<uint64_t, HISTOGRAM_BUCKET_COUNT> buckets {};
+    for (const auto &shard : shards_) {
+        selector(shard, index).MergeTo(buckets, summary);
+    }
+    summary.p50Us = GetPercentile(buckets, summary.count, PERCENT_50, summary.maxUs);
+    summary.p99Us = GetPercentile(buckets, summary.count, PERCENT_99, summary.maxUs);
+    return summary;
+}
+
+LatencySummary AccessibilityInputStatistics::GetQueueDelay() const
+{
+    return Summarize([](const StatisticsShard &shard, size_t i) -> const LatencyHistogram & {
+        (void)i;
+        return shard.queueDelay;
+    }, 0);
+}
+
+LatencySummary AccessibilityInputStatistics::GetOutputLatency(TransmissionType type) const
+{
+    size_t index = static_cast<size_t>(type);
+    if (index >= TRANSMISSION_TYPE_COUNT) {
+        return LatencySummary();
+    }
+    return Summarize([](const StatisticsShard &shard, size_t i) -> const LatencyHistogram & {
+        return shard.outputLatency[i];
+    }, index);
+}
+
+LatencySummary AccessibilityInputStatistics::GetProcessTime(TransmissionType type) const
+{
+    size_t index = static_cast<size_t>(type);
+    if (index >= TRANSMISSION_TYPE_COUNT) {
+        return LatencySummary();
+    }
+    return Summarize([](const StatisticsShard &shard, size_t i) -> const LatencyHistogram & {
+        return shard.processTime[i];
+    }, index);
+}
+
+void AccessibilityInputStatistics::Reset()
+{
+    for (auto &shard : shards_) {
+        shard.queueDelay.Clear();
+        for (auto &histogram : shard.outputLatency) {
+            histogram.Clear();
+        }
+        for (auto &histogram : shard.processTime) {
+            histogram.Clear();
+        }
+    }
+}
+
+void AccessibilityInputStatistics::Dump(std::string &dumpInfo) const
+{
+    std::ostringstream oss;
+    oss << "queueDelay:  ";
+    AppendSummary(oss, GetQueueDelay());
+    oss << std::endl;
+    for (size_t i = 0; i < TRANSMISSION_TYPE_COUNT; i++) {
+        TransmissionType type = static_cast<TransmissionType>(i);
+        LatencySummary processTime = GetProcessTime(type);
+        LatencySummary outputLatency = GetOutputLatency(type);
+        if (processTime.count == 0 && outputLatency.count == 0) {
+            continue;
+        }
+        oss << GetTransmissionName(type) << ":" << std::endl;
+        oss << "    processTime:  ";
+        AppendSummary(oss, processTime);
+        oss << std::endl << "    outputLatency:  ";
+        AppendSummary(oss, outputLatency);
+        oss << std::endl;
+    }
+    dumpInfo.append(oss.str());
+}
+
+InputProcessScope::InputProcessScope(TransmissionType type) : type_(type)
+{
+    outerChildTime_ = g_childProcessTime;
+    g_childProcessTime = 0;
+    startTime_ = AccessibilityInputStatistics::GetCurrentTimeUs();
+}
+
+InputProcessScope::~InputProcessScope()
+{
+    int64_t elapsed = AccessibilityInputStatistics::GetCurrentTimeUs() - startTime_;
+    Singleton<AccessibilityInputStatistics>::GetInstance().RecordProcessTime(type_, elapsed - g_childProcessTime);
+    g_childProcessTime = outerChildTime_ + elapsed;
+}
+} // namespace Accessibility
+} // namespace OHOS
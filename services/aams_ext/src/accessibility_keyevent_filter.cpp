@@ -14,6 +14,9 @@
  */
 
 #include "accessibility_keyevent_filter.h"
+
+#include <algorithm>
+
 #include "hilog_wrapper.h"
 #include "accessibility_input_interceptor.h"
 #include "extend_service_manager.h"
@@ -22,6 +25,7 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     int64_t g_taskTime = 500;
+    constexpr uint32_t KEY_EVENT_TIMEOUT_MSG = 1;
 } // namespace
 
 static bool IsWantedKeyEvent(MMI::KeyEvent &event)
@@ -35,17 +39,17 @@ static bool IsWantedKeyEvent(MMI::KeyEvent &event)
     return false;
 }
 
-KeyEventFilter::KeyEventFilter()
+KeyEventFilter::KeyEventFilter() : latencyTracker_(g_taskTime)
 {
     HILOG_DEBUG();
 
-    runner_ = AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner();
-    if (!runner_) {
-        HILOG_ERROR("get runner failed");
+    wheel_ = AccessibilityInputInterceptor::GetInstance()->GetGestureTimerWheel();
+    if (!wheel_) {
+        HILOG_ERROR("get gesture timer wheel failed");
         return;
     }
 
-    timeoutHandler_ = std::make_shared<KeyEventFilterEventHandler>(runner_, *this);
+    timeoutHandler_ = std::make_shared<KeyEventFilterEventHandler>(wheel_, *this);
     if (!timeoutHandler_) {
         HILOG_ERROR("create event handler failed");
         return;
@@ -57,7 +61,7 @@ KeyEventFilter::~KeyEventFilter()
     HILOG_DEBUG();
 
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    eventMaps_.clear();
+    pendingTable_.Clear();
 }
 
 // LCOV_EXCL_START
@@ -78,20 +82,26 @@ void KeyEventFilter::SetServiceOnKeyEventResult(int32_t connectionId, bool isHan
 {
     HILOG_DEBUG("isHandled[%{public}d], sequenceNum[%{public}u].", isHandled, sequenceNum);
 
-    std::shared_ptr<ProcessingEvent> processingEvent = FindProcessingEvent(connectionId, sequenceNum);
-    if (!processingEvent) {
-        HILOG_DEBUG("No event being processed.");
-        return;
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        KeyEventPendingTable::AckResult result =
+            pendingTable_.Acknowledge(connectionId, sequenceNum, isHandled, unhandledEvent);
+        if (result == KeyEventPendingTable::AckResult::NOT_FOUND) {
+            HILOG_DEBUG("No event being processed.");
+            return;
+        }
+        if (wheel_) {
+            latencyTracker_.RecordLatency(connectionId,
+                wheel_->GetCurrentTime() - dispatchTimes_[sequenceNum % KeyEventPendingTable::CAPACITY]);
+        }
+        if (pendingTable_.GetSize() == 0 && timeoutHandler_) {
+            timeoutHandler_->RemoveEvent(KEY_EVENT_TIMEOUT_MSG);
+        }
     }
 
-    if (!isHandled) {
-        if (!processingEvent->usedCount_) {
-            timeoutHandler_->RemoveEvent(processingEvent->seqNum_);
-            EventTransmission::OnKeyEvent(*processingEvent->event_);
-        }
-    } else {
-        timeoutHandler_->RemoveEvent(processingEvent->seqNum_);
-        RemoveProcessingEvent(processingEvent);
+    if (unhandledEvent) {
+        EventTransmission::OnKeyEvent(*unhandledEvent);
     }
 }
 
@@ -99,83 +109,94 @@ void KeyEventFilter::DispatchKeyEvent(MMI::KeyEvent &event)
 {
     HILOG_DEBUG();
 
-    std::shared_ptr<ProcessingEvent> processingEvent = std::make_shared<ProcessingEvent>();
+    if (!wheel_ || !timeoutHandler_) {
+        HILOG_ERROR("timeout handler is null.");
+        EventTransmission::OnKeyEvent(event);
+        return;
+    }
+
     std::shared_ptr<MMI::KeyEvent> copyEvent =  std::make_shared<MMI::KeyEvent>(event);
+    int64_t now = 0;
+    std::vector<int32_t> skippedConnectionIds;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        now = wheel_->GetCurrentTime();
+        // a connection which keeps missing its deadline does not get the key events for a while
+        latencyTracker_.GetSkippedConnections(now, skippedConnectionIds);
+    }
     sequenceNum_++;
-    processingEvent->event_ = copyEvent;
-    processingEvent->seqNum_ = sequenceNum_;
     std::vector<int32_t> connectionIds = Singleton<ExtendServiceManager>::GetInstance().dispatchKeyEventCallback(
-        event, sequenceNum_);
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (int32_t connectionId : connectionIds) {
-        processingEvent->usedCount_++;
-        if (eventMaps_.find(connectionId) == eventMaps_.end()) {
-            std::vector<std::shared_ptr<ProcessingEvent>> processingEvens;
-            eventMaps_.insert(std::make_pair(connectionId, processingEvens));
-        }
-        eventMaps_.at(connectionId).emplace_back(processingEvent);
-    }
-
+        event, sequenceNum_, skippedConnectionIds);
     if (connectionIds.size() == 0) {
         HILOG_DEBUG("No service handles the event.");
         sequenceNum_--;
         EventTransmission::OnKeyEvent(event);
         return;
     }
-    timeoutHandler_->SendEvent(sequenceNum_, processingEvent, g_taskTime);
-}
 
-bool KeyEventFilter::RemoveProcessingEvent(std::shared_ptr<ProcessingEvent> event)
-{
-    HILOG_DEBUG();
-
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    bool haveEvent = false;
-    for (auto iter = eventMaps_.begin(); iter != eventMaps_.end(); iter++) {
-        for (auto val = iter->second.begin(); val != iter->second.end(); val++) {
-            if (*val != event) {
-                continue;
-            }
-            (*val)->usedCount_--;
-            iter->second.erase(val);
-            haveEvent = true;
-            break;
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        int64_t deadline = GetDeadlineLocked(connectionIds, now);
+        dispatchTimes_[sequenceNum_ % KeyEventPendingTable::CAPACITY] = now;
+        pendingTable_.Insert(sequenceNum_, copyEvent, connectionIds, deadline, evictedEvent);
+        lastDeadline_ = deadline;
+        if (pendingTable_.GetSize() == 1) {
+            ScheduleTimeoutLocked();
         }
     }
 
-    return haveEvent;
+    if (evictedEvent) {
+        HILOG_WARN("too many pending key events, send the oldest one to the next node.");
+        EventTransmission::OnKeyEvent(*evictedEvent);
+    }
 }
 
-std::shared_ptr<KeyEventFilter::ProcessingEvent> KeyEventFilter::FindProcessingEvent(
-    int32_t connectionId, uint32_t sequenceNum)
+void KeyEventFilter::ProcessTimeoutEvents()
 {
     HILOG_DEBUG();
 
-    std::shared_ptr<ProcessingEvent> processingEvent = nullptr;
-
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto iter = eventMaps_.begin(); iter != eventMaps_.end(); iter++) {
-        if (iter->first != connectionId) {
-            continue;
+    std::vector<std::shared_ptr<MMI::KeyEvent>> timeoutEvents;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!wheel_) {
+            return;
         }
-
-        for (auto val = iter->second.begin(); val != iter->second.end(); val++) {
-            if ((*val) == nullptr) {
-                HILOG_ERROR("connection is null");
-                continue;
-            }
-            if ((*val)->seqNum_ != sequenceNum) {
-                continue;
-            }
-            processingEvent = *val;
-            iter->second.erase(val);
-            processingEvent->usedCount_--;
-            break;
+        int64_t now = wheel_->GetCurrentTime();
+        std::vector<int32_t> missedConnectionIds;
+        pendingTable_.PopExpired(now, timeoutEvents, missedConnectionIds);
+        for (int32_t connectionId : missedConnectionIds) {
+            latencyTracker_.RecordMiss(connectionId, now);
         }
-        break;
+        ScheduleTimeoutLocked();
     }
 
-    return processingEvent;
+    for (auto &event : timeoutEvents) {
+        SendEventToNext(*event);
+    }
+}
+
+void KeyEventFilter::ScheduleTimeoutLocked()
+{
+    int64_t deadline = 0;
+    if (!timeoutHandler_ || !pendingTable_.GetNextDeadline(deadline)) {
+        return;
+    }
+    timeoutHandler_->SendEvent(KEY_EVENT_TIMEOUT_MSG, 0, std::max<int64_t>(deadline - wheel_->GetCurrentTime(), 0));
+}
+
+int64_t KeyEventFilter::GetDeadlineLocked(const std::vector<int32_t> &connectionIds, int64_t now)
+{
+    int64_t timeout = 0;
+    for (int32_t connectionId : connectionIds) {
+        timeout = std::max(timeout, latencyTracker_.GetDeadline(connectionId));
+    }
+    int64_t deadline = now + timeout;
+    // the pending events time out in the order they are dispatched
+    if (pendingTable_.GetSize() > 0) {
+        deadline = std::max(deadline, lastDeadline_);
+    }
+    return deadline;
 }
 // LCOV_EXCL_STOP
 
@@ -184,8 +205,11 @@ void KeyEventFilter::DestroyEvents()
     HILOG_DEBUG();
 
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    timeoutHandler_->RemoveAllEvents();
-    eventMaps_.clear();
+    if (timeoutHandler_) {
+        timeoutHandler_->RemoveAllEvents();
+    }
+    pendingTable_.Clear();
+    latencyTracker_.Clear();
     EventTransmission::DestroyEvents();
 }
 
@@ -196,8 +220,8 @@ void KeyEventFilter::SendEventToNext(MMI::KeyEvent &event)
 }
 
 KeyEventFilterEventHandler::KeyEventFilterEventHandler(
-    const std::shared_ptr<AppExecFwk::EventRunner> &runner, KeyEventFilter &keyEventFilter)
-    : AppExecFwk::EventHandler(runner), keyEventFilter_(keyEventFilter)
+    const std::shared_ptr<GestureTimerWheel> &wheel, KeyEventFilter &keyEventFilter)
+    : GestureTimerHandler(wheel), keyEventFilter_(keyEventFilter)
 {
     HILOG_DEBUG();
 }
@@ -211,21 +235,12 @@ void KeyEventFilterEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Poin
         HILOG_ERROR("event is null.");
         return;
     }
-
-    auto processingEvent = event->GetSharedObject<KeyEventFilter::ProcessingEvent>();
-    if (processingEvent == nullptr) {
-        HILOG_ERROR("processingEvent is nullptr");
-        return;
-    }
-    if (processingEvent->seqNum_ != event->GetInnerEventId()) {
+    if (event->GetInnerEventId() != KEY_EVENT_TIMEOUT_MSG) {
         HILOG_ERROR("event is wrong.");
         return;
     }
 
-    bool haveEvent = keyEventFilter_.RemoveProcessingEvent(processingEvent);
-    if (haveEvent) {
-        keyEventFilter_.SendEventToNext(*processingEvent->event_);
-    }
+    keyEventFilter_.ProcessTimeoutEvents();
 }
 } // namespace Accessibility
 } // namespace OHOS} // namespace OHOS
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_keyevent_latency_tracker.h"
+
+#include <algorithm>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t DEADLINE_MARGIN = 2;
+    constexpr uint32_t PERCENT = 100;
+} // namespace
+
+KeyEventLatencyTracker::KeyEventLatencyTracker(int64_t maxTimeout) : maxTimeout_(maxTimeout)
+{
+}
+
+void KeyEventLatencyTracker::RecordLatency(int32_t connectionId, int64_t latency)
+{
+    ConnectionStats &stats = stats_[connectionId];
+    auto iter = std::lower_bound(BUCKET_BOUNDS.begin(), BUCKET_BOUNDS.end(), latency);
+    AddSample(stats, static_cast<size_t>(iter - BUCKET_BOUNDS.begin()));
+    stats.consecutiveMisses = 0;
+}
+
+void KeyEventLatencyTracker::RecordMiss(int32_t connectionId, int64_t now)
+{
+    ConnectionStats &stats = stats_[connectionId];
+    AddSample(stats, BUCKET_COUNT - 1);
+    stats.consecutiveMisses++;
+    if (stats.consecutiveMisses >= MAX_CONSECUTIVE_MISSES && !stats.isSkipped) {
+        HILOG_WARN("connection[%{public}d] missed %{public}u key events, skip it", connectionId,
+            stats.consecutiveMisses);
+        stats.isSkipped = true;
+        stats.skipUntil = now + SKIP_DURATION;
+    }
+}
+
+int64_t KeyEventLatencyTracker::GetDeadline(int32_t connectionId) const
+{
+    auto iter = stats_.find(connectionId);
+    if (iter == stats_.end() || iter->second.sampleCount < MIN_SAMPLE_COUNT) {
+        return maxTimeout_;
+    }
+    const ConnectionStats &stats = iter->second;
+    uint32_t target = (stats.sampleCount * PERCENTILE + PERCENT - 1) / PERCENT;
+    uint32_t count = 0;
+    size_t bucket = 0;
+    for (; bucket < BUCKET_COUNT - 1; bucket++) {
+        count += stats.buckets[bucket];
+        if (count >= target) {
+            break;
+        }
+    }
+    int64_t deadline = GetBucketBound(bucket) * DEADLINE_MARGIN;
+    return std::clamp(deadline, std::min(MIN_TIMEOUT, maxTimeout_), maxTimeout_);
+}
+
+void KeyEventLatencyTracker::GetSkippedConnections(int64_t now, std::vector<int32_t> &connectionIds)
+{
+    for (auto iter = stats_.begin(); iter != stats_.end();) {
+        if (!iter->second.isSkipped) {
+            ++iter;
+            continue;
+        }
+        if (now < iter->second.skipUntil) {
+            connectionIds.push_back(iter->first);
+            ++iter;
+            continue;
+        }
+        HILOG_INFO("connection[%{public}d] is tried again", iter->first);
+        iter = stats_.erase(iter);
+    }
+}
+
+void KeyEventLatencyTracker::Clear()
+{
+    stats_.clear();
+}
+
+void KeyEventLatencyTracker::AddSample(ConnectionStats &stats, size_t bucket)
+{
+    if (stats.sampleCount >= MAX_SAMPLE_COUNT) {
+        stats.sampleCount = 0;
+        for (auto &count : stats.buckets) {
+            count /= 2;
+            stats.sampleCount += count;
+        }
+    }
+    stats.buckets[bucket]++;
+    stats.sampleCount++;
+}
+
+int64_t KeyEventLatencyTracker::GetBucketBound(size_t bucket) const
+{
+    return bucket < BUCKET_BOUNDS.size() ? BUCKET_BOUNDS[bucket] : maxTimeout_;
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_keyevent_pending_table.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Accessibility {
+static_assert((KeyEventPendingTable::CAPACITY & (KeyEventPendingTable::CAPACITY - 1)) == 0,
+    "capacity must be a power of two");
+
+void KeyEventPendingTable::Insert(uint32_t sequenceNum, const std::shared_ptr<MMI::KeyEvent> &event,
+    const std::vector<int32_t> &connectionIds, int64_t deadline, std::shared_ptr<MMI::KeyEvent> &evictedEvent)
+{
+    Entry &entry = entries_[sequenceNum & MASK];
+    if (entry.used) {
+        evictedEvent = entry.event;
+        RemoveEntry(entry);
+    }
+    if (size_ == 0) {
+        oldestSequenceNum_ = sequenceNum;
+    }
+
+    entry.used = true;
+    entry.sequenceNum = sequenceNum;
+    entry.deadline = deadline;
+    entry.event = event;
+    entry.connectionIds.assign(connectionIds.begin(), connectionIds.end());
+    size_++;
+}
+
+KeyEventPendingTable::AckResult KeyEventPendingTable::Acknowledge(int32_t connectionId, uint32_t sequenceNum,
+    bool isHandled, std::shared_ptr<MMI::KeyEvent> &event)
+{
+    Entry *entry = FindEntry(sequenceNum);
+    if (entry == nullptr) {
+        return AckResult::NOT_FOUND;
+    }
+
+    auto iter = std::find(entry->connectionIds.begin(), entry->connectionIds.end(), connectionId);
+    if (iter == entry->connectionIds.end()) {
+        return AckResult::NOT_FOUND;
+    }
+    *iter = entry->connectionIds.back();
+    entry->connectionIds.pop_back();
+
+    if (isHandled) {
+        RemoveEntry(*entry);
+        return AckResult::HANDLED;
+    }
+    if (!entry->connectionIds.empty()) {
+        return AckResult::WAITING;
+    }
+    event = entry->event;
+    RemoveEntry(*entry);
+    return AckResult::UNHANDLED;
+}
+
+void KeyEventPendingTable::PopExpired(int64_t now, std::vector<std::shared_ptr<MMI::KeyEvent>> &events)
+{
+    Entry *entry = FindOldestEntry();
+    while (entry != nullptr && entry->deadline <= now) {
+        events.push_back(entry->event);
+        RemoveEntry(*entry);
+        entry = FindOldestEntry();
+    }
+}
+
+void KeyEventPendingTable::PopExpired(int64_t now, std::vector<std::shared_ptr<MMI::KeyEvent>> &events,
+    std::vector<int32_t> &missedConnectionIds)
+{
+    Entry *entry = FindOldestEntry();
+    while (entry != nullptr && entry->deadline <= now) {
+        events.push_back(entry->event);
+        missedConnectionIds.insert(missedConnectionIds.end(), entry->connectionIds.begin(),
+            entry->connectionIds.end());
+        RemoveEntry(*entry);
+        entry = FindOldestEntry();
+    }
+}
+
+bool KeyEventPendingTable::GetNextDeadline(int64_t &deadline)
+{
+    Entry *entry = FindOldestEntry();
+    if (entry == nullptr) {
+        return false;
+    }
+    deadline = entry->deadline;
+    return true;
+}
+
+void KeyEventPendingTable::Clear()
+{
+    for (auto &entry : entries_) {
+        entry.used = false;
+        entry.event = nullptr;
+        entry.connectionIds.clear();
+    }
+    size_ = 0;
+}
+
+KeyEventPendingTable::Entry *KeyEventPendingTable::FindEntry(uint32_t sequenceNum)
+{
+    Entry &entry = entries_[sequenceNum & MASK];
+    if (!entry.used || entry.sequenceNum != sequenceNum) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+KeyEventPendingTable::Entry *KeyEventPendingTable::FindOldestEntry()
+{
+    if (size_ == 0) {
+        return nullptr;
+    }
+    // sequence numbers are inserted in increasing order, every step skips an answered event for good
+    while (true) {
+        Entry *entry = FindEntry(oldestSequenceNum_);
+        if (entry != nullptr) {
+            return entry;
+        }
+        oldestSequenceNum_++;
+    }
+}
+
+void KeyEventPendingTable::RemoveEntry(Entry &entry)
+{
+    entry.used = false;
+    entry.event = nullptr;
+    entry.connectionIds.clear();
+    size_--;
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -13,9 +13,12 @@
  * limitations under the License.
  */
 
+#include <cinttypes>
+
 #include "accessibility_mouse_autoclick.h"
 #include "hilog_wrapper.h"
 #include "ext_utils.h"
+#include "parameters.h"
 #include "accessibility_input_interceptor.h"
 #include "extend_service_manager.h"
 
@@ -23,32 +26,41 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr size_t POINTER_COUNT_1 = 1;
-    constexpr uint32_t AUTOCLICK_TIMEOUT_MSG = 1;
+    // the radius in px the pointer may jitter within without restarting the dwell
+    const char* AUTOCLICK_TOLERANCE_PARAM = "const.accessibility.autoclick_tolerance";
+    constexpr int64_t STATISTICS_LOG_INTERVAL_MS = 10 * 60 * 1000;
 } // namespace
 
 AccessibilityMouseAutoclick::AccessibilityMouseAutoclick()
 {
     HILOG_DEBUG();
 
-    std::shared_ptr<AppExecFwk::EventRunner> runner =
-        AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner();
-    if (!runner) {
-        HILOG_ERROR("get runner failed");
+    std::shared_ptr<GestureTimerWheel> wheel = AccessibilityInputInterceptor::GetInstance()->GetGestureTimerWheel();
+    if (!wheel) {
+        HILOG_ERROR("get gesture timer wheel failed");
         return;
     }
 
-    timeoutHandler_ = std::make_shared<MouseAutoclickEventHandler>(runner, *this);
-    if (!timeoutHandler_) {
-        HILOG_ERROR("create event handler failed");
-    }
+    dwellDetector_ = std::make_unique<AccessibilityDwellDetector>(wheel, [this](int32_t, int32_t) {
+        SendMouseClickEvent();
+        ResetAutoclickInfo();
+        // the statistics are logged at most once an interval, and when the autoclick is destroyed
+        int64_t nowMs = ExtUtils::GetSystemTime();
+        if (nowMs - lastStatisticsLogTime_ >= STATISTICS_LOG_INTERVAL_MS) {
+            lastStatisticsLogTime_ = nowMs;
+            LogStatistics();
+        }
+    });
+    dwellDetector_->SetTolerance(system::GetIntParameter(AUTOCLICK_TOLERANCE_PARAM, 0));
+    lastStatisticsLogTime_ = ExtUtils::GetSystemTime();
 }
 
 AccessibilityMouseAutoclick::~AccessibilityMouseAutoclick()
 {
     HILOG_DEBUG();
 
-    timeoutHandler_ = nullptr;
-    lastMouseEvent_ = nullptr;
+    LogStatistics();
+    dwellDetector_ = nullptr;
 }
 
 bool AccessibilityMouseAutoclick::OnPointerEvent(MMI::PointerEvent &event)
@@ -75,40 +87,48 @@ void AccessibilityMouseAutoclick::SendMouseClickEvent()
 {
     HILOG_DEBUG();
 
-    if (!lastMouseEvent_) {
+    if (!hasLastMove_) {
         HILOG_DEBUG("No mouse event to be sent.");
         return;
     }
 
+    std::shared_ptr<MMI::PointerEvent> clickEvent = MMI::PointerEvent::Create();
+    if (!clickEvent) {
+        HILOG_ERROR("create click event failed");
+        return;
+    }
+
     int64_t nowTime = GetSystemTime();
-    // Update event information.
-    lastMouseEvent_->SetActionTime(nowTime);
-    lastMouseEvent_->SetActionStartTime(nowTime);
-    lastMouseEvent_->SetButtonId(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
-    lastMouseEvent_->SetButtonPressed(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
-
-    // Update pointer item information.
-    int32_t pointerId = lastMouseEvent_->GetPointerId();
-    MMI::PointerEvent::PointerItem item;
-    lastMouseEvent_->GetPointerItem(pointerId, item);
+    clickEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    clickEvent->SetPointerId(lastPointerId_);
+    clickEvent->SetDeviceId(lastDeviceId_);
+    clickEvent->SetTargetDisplayId(lastTargetDisplayId_);
+    clickEvent->SetTargetWindowId(lastTargetWindowId_);
+    clickEvent->SetAgentWindowId(lastAgentWindowId_);
+    clickEvent->SetActionTime(nowTime);
+    clickEvent->SetActionStartTime(nowTime);
+    clickEvent->SetButtonId(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+    clickEvent->SetButtonPressed(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+
+    MMI::PointerEvent::PointerItem item = lastPointerItem_;
     item.SetDownTime(nowTime);
     item.SetPressed(true);
-    lastMouseEvent_->UpdatePointerItem(pointerId, item);
+    clickEvent->AddPointerItem(item);
 
     // Send mouse left button down event.
-    lastMouseEvent_->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN);
-    EventTransmission::OnPointerEvent(*lastMouseEvent_);
+    clickEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+    EventTransmission::OnPointerEvent(*clickEvent);
 
     // Send mouse left button up event.
-    lastMouseEvent_->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_BUTTON_UP);
-    EventTransmission::OnPointerEvent(*lastMouseEvent_);
+    clickEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_BUTTON_UP);
+    EventTransmission::OnPointerEvent(*clickEvent);
 }
 
 void AccessibilityMouseAutoclick::ResetAutoclickInfo()
 {
     HILOG_DEBUG();
 
-    lastMouseEvent_ = nullptr;
+    hasLastMove_ = false;
 }
 
 void AccessibilityMouseAutoclick::DestroyEvents()
@@ -123,48 +143,37 @@ void AccessibilityMouseAutoclick::RecognizeAutoclick(MMI::PointerEvent &event)
 {
     HILOG_DEBUG();
 
-    bool isMove = IsMouseMovement(event);
-    if (!isMove) {
-        HILOG_DEBUG("Mouse is not moving.");
+    int32_t pointerId = event.GetPointerId();
+    MMI::PointerEvent::PointerItem item;
+    if (!event.GetPointerItem(pointerId, item)) {
+        HILOG_ERROR("get pointer item failed!");
         return;
     }
-
-    lastMouseEvent_ = std::make_shared<MMI::PointerEvent>(event);
-    if (!timeoutHandler_) {
-        HILOG_ERROR("handler is null.");
+    if (!dwellDetector_) {
+        HILOG_ERROR("dwell detector is null.");
         return;
     }
-    int64_t delayTime = GetDelayTime();
-    timeoutHandler_->RemoveEvent(AUTOCLICK_TIMEOUT_MSG);
-    timeoutHandler_->SendEvent(AUTOCLICK_TIMEOUT_MSG, 0, delayTime);
+
+    // the click lands where the pointer rests, moves within the tolerance still update it
+    hasLastMove_ = true;
+    lastPointerId_ = pointerId;
+    lastDeviceId_ = event.GetDeviceId();
+    lastTargetDisplayId_ = event.GetTargetDisplayId();
+    lastTargetWindowId_ = event.GetTargetWindowId();
+    lastAgentWindowId_ = event.GetAgentWindowId();
+    lastPointerItem_ = item;
+    dwellDetector_->OnMove(item.GetDisplayX(), item.GetDisplayY(), GetDelayTime());
 }
 
-bool AccessibilityMouseAutoclick::IsMouseMovement(MMI::PointerEvent &event)
+void AccessibilityMouseAutoclick::LogStatistics()
 {
-    HILOG_DEBUG();
-
-    if (!lastMouseEvent_) {
-        return true;
-    }
-
-    int32_t pointerId = event.GetPointerId();
-    MMI::PointerEvent::PointerItem item;
-    if (!event.GetPointerItem(pointerId, item)) {
-        HILOG_ERROR("get pointer item failed!");
-        return false;
-    }
-    int32_t newX = item.GetDisplayX();
-    int32_t newY = item.GetDisplayY();
-
-    pointerId = lastMouseEvent_->GetPointerId();
-    lastMouseEvent_->GetPointerItem(pointerId, item);
-    int32_t oldX = item.GetDisplayX();
-    int32_t oldY = item.GetDisplayY();
-    if ((newX != oldX) || (newY != oldY)) {
-        HILOG_DEBUG("Mouse is moving.");
-        return true;
+    if (!dwellDetector_) {
+        return;
     }
-    return false;
+    DwellStatistics statistics = dwellDetector_->GetStatistics();
+    HILOG_INFO("autoclick moves: %{public}" PRIu64 ", tolerated: %{public}" PRIu64 ", arms: %{public}" PRIu64
+        ", rearms: %{public}" PRIu64 ", dwells: %{public}" PRIu64, statistics.moveCount, statistics.toleratedCount,
+        statistics.armCount, statistics.rearmCount, statistics.dwellCount);
 }
 
 void AccessibilityMouseAutoclick::CancelAutoclick()
@@ -172,7 +181,9 @@ void AccessibilityMouseAutoclick::CancelAutoclick()
     HILOG_DEBUG();
 
     ResetAutoclickInfo();
-    timeoutHandler_->RemoveEvent(AUTOCLICK_TIMEOUT_MSG);
+    if (dwellDetector_) {
+        dwellDetector_->Cancel();
+    }
 }
 
 int64_t AccessibilityMouseAutoclick::GetSystemTime()
@@ -188,28 +199,5 @@ int64_t AccessibilityMouseAutoclick::GetDelayTime()
     HILOG_DEBUG();
     return Singleton<ExtendServiceManager>::GetInstance().getDelayTime();
 }
-
-AccessibilityMouseAutoclick::MouseAutoclickEventHandler::MouseAutoclickEventHandler(
-    const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-    AccessibilityMouseAutoclick &mouseAutoclick)
-    : AppExecFwk::EventHandler(runner), mouseAutoclick_(mouseAutoclick)
-{
-    HILOG_DEBUG();
-}
-
-void AccessibilityMouseAutoclick::MouseAutoclickEventHandler::ProcessEvent(
-    const AppExecFwk::InnerEvent::Pointer &event)
-{
-    HILOG_DEBUG();
-
-    switch (event->GetInnerEventId()) {
-        case AUTOCLICK_TIMEOUT_MSG:
-            mouseAutoclick_.SendMouseClickEvent();
-            mouseAutoclick_.ResetAutoclickInfo();
-            break;
-        default:
-            break;
-    }
-}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
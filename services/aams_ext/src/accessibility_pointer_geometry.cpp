@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_pointer_geometry.h"
+
+#include <cmath>
+#include <vector>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+size_t PointerGeometry::Load(const MMI::PointerEvent &event, int32_t excludePointerId)
+{
+    Clear();
+    std::vector<int32_t> pointerIds = event.GetPointerIds();
+    for (int32_t pointerId : pointerIds) {
+        if (pointerId == excludePointerId) {
+            continue;
+        }
+        MMI::PointerEvent::PointerItem item;
+        if (!event.GetPointerItem(pointerId, item)) {
+            HILOG_WARN("get pointer item %{public}d failed", pointerId);
+            continue;
+        }
+        if (!Add(pointerId, item.GetDisplayX(), item.GetDisplayY(), item.GetRawDisplayX(), item.GetRawDisplayY())) {
+            HILOG_WARN("more than %{public}zu pointers", MAX_POINTER_COUNT);
+            break;
+        }
+    }
+    return count_;
+}
+
+bool PointerGeometry::Add(int32_t pointerId, int32_t displayX, int32_t displayY, int32_t rawDisplayX,
+    int32_t rawDisplayY)
+{
+    if (count_ >= MAX_POINTER_COUNT) {
+        return false;
+    }
+    pointerIds_[count_] = pointerId;
+    x_[count_] = static_cast<float>(displayX);
+    y_[count_] = static_cast<float>(displayY);
+    rawX_[count_] = static_cast<float>(rawDisplayX);
+    rawY_[count_] = static_cast<float>(rawDisplayY);
+    weight_[count_] = 1.0f;
+    count_++;
+    return true;
+}
+
+void PointerGeometry::Clear()
+{
+    // the kernels rely on the unused lanes being zero
+    for (size_t i = 0; i < count_; i++) {
+        x_[i] = 0.0f;
+        y_[i] = 0.0f;
+        rawX_[i] = 0.0f;
+        rawY_[i] = 0.0f;
+        weight_[i] = 0.0f;
+    }
+    count_ = 0;
+}
+
+float PointerGeometry::GetX(size_t index, PointerCoordinate coordinate) const
+{
+    return index < count_ ? GetXLanes(coordinate)[index] : 0.0f;
+}
+
+float PointerGeometry::GetY(size_t index, PointerCoordinate coordinate) const
+{
+    return index < count_ ? GetYLanes(coordinate)[index] : 0.0f;
+}
+
+bool PointerGeometry::GetCentroid(float &centerX, float &centerY, PointerCoordinate coordinate) const
+{
+    if (count_ == 0) {
+        return false;
+    }
+    const Lanes &xs = GetXLanes(coordinate);
+    const Lanes &ys = GetYLanes(coordinate);
+    std::array<float, LANE_COUNT> sumX {};
+    std::array<float, LANE_COUNT> sumY {};
+    for (size_t block = 0; block < PADDED_COUNT; block += LANE_COUNT) {
+        for (size_t lane = 0; lane < LANE_COUNT; lane++) {
+            sumX[lane] += xs[block + lane];
+            sumY[lane] += ys[block + lane];
+        }
+    }
+    float count = static_cast<float>(count_);
+    centerX = (sumX[0] + sumX[1] + sumX[2] + sumX[3]) / count;
+    centerY = (sumY[0] + sumY[1] + sumY[2] + sumY[3]) / count;
+    return true;
+}
+
+bool PointerGeometry::GetMeanDeviation(float centerX, float centerY, float &deviationX, float &deviationY,
+    PointerCoordinate coordinate) const
+{
+    if (count_ == 0) {
+        return false;
+    }
+    const Lanes &xs = GetXLanes(coordinate);
+    const Lanes &ys = GetYLanes(coordinate);
+    std::array<float, LANE_COUNT> sumX {};
+    std::array<float, LANE_COUNT> sumY {};
+    for (size_t block = 0; block < PADDED_COUNT; block += LANE_COUNT) {
+        for (size_t lane = 0; lane < LANE_COUNT; lane++) {
+            size_t i = block + lane;
+            sumX[lane] += std::fabs(xs[i] - centerX) * weight_[i];
+            sumY[lane] += std::fabs(ys[i] - centerY) * weight_[i];
+        }
+    }
+    float count = static_cast<float>(count_);
+    deviationX = (sumX[0] + sumX[1] + sumX[2] + sumX[3]) / count;
+    deviationY = (sumY[0] + sumY[1] + sumY[2] + sumY[3]) / count;
+    return true;
+}
+
+float PointerGeometry::GetSeparation(size_t first, size_t second, PointerCoordinate coordinate) const
+{
+    if (first >= count_ || second >= count_) {
+        return 0.0f;
+    }
+    const Lanes &xs = GetXLanes(coordinate);
+    const Lanes &ys = GetYLanes(coordinate);
+    return static_cast<float>(std::hypot(static_cast<double>(xs[second] - xs[first]),
+        static_cast<double>(ys[second] - ys[first])));
+}
+
+size_t PointerGeometry::FindNearest(float posX, float posY, uint32_t excludeMask, float &distance,
+    PointerCoordinate coordinate) const
+{
+    Lanes distances {};
+    SquaredDistances(posX, posY, coordinate, distances);
+    size_t nearest = INVALID_INDEX;
+    for (size_t i = 0; i < count_; i++) {
+        if ((excludeMask & (1u << i)) != 0) {
+            continue;
+        }
+        if (nearest == INVALID_INDEX || distances[i] < distances[nearest]) {
+            nearest = i;
+        }
+    }
+    distance = nearest == INVALID_INDEX ? 0.0f : std::sqrt(distances[nearest]);
+    return nearest;
+}
+
+void PointerGeometry::SquaredDistances(float posX, float posY, PointerCoordinate coordinate,
+    Lanes &distances) const
+{
+    const Lanes &xs = GetXLanes(coordinate);
+    const Lanes &ys = GetYLanes(coordinate);
+    for (size_t i = 0; i < PADDED_COUNT; i++) {
+        float deltaX = xs[i] - posX;
+        float deltaY = ys[i] - posY;
+        distances[i] = deltaX * deltaX + deltaY * deltaY;
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -50,13 +50,15 @@ constexpr uint32_t IGNORE_REPEAT_CLICK_TIME_MEDIUM = 700; // ms
 constexpr uint32_t IGNORE_REPEAT_CLICK_TIME_LONG = 1000; // ms
 constexpr uint32_t IGNORE_REPEAT_CLICK_TIME_LONGEST = 1300; // ms
 
-constexpr uint32_t CIRCLE_ANGLE = 360;
-constexpr uint32_t START_ANGLE_PORTRAIT = -90;
-constexpr uint32_t START_ANGLE_LANDSCAPE = 180;
-constexpr uint32_t START_ANGLE_PORTRAIT_INVERTED = 90;
-constexpr uint32_t START_ANGLE_LANDSCAPE_INVERTED = 0;
-
-constexpr uint32_t NUMBER_10 = 10;
+constexpr int32_t CIRCLE_ANGLE = 360;
+constexpr int32_t QUARTER_TURN_PORTRAIT = 0;
+constexpr int32_t QUARTER_TURN_LANDSCAPE = 1;
+constexpr int32_t QUARTER_TURN_PORTRAIT_INVERTED = 2;
+constexpr int32_t QUARTER_TURN_LANDSCAPE_INVERTED = 3;
+constexpr int32_t QUARTER_TURN_UNKNOWN = -1;
+constexpr int64_t CIRCLE_PROGRESS_FRAME_INTERVAL = 16; // ms, a frame at 60Hz
+const std::string CIRCLE_PROGRESS_RUNNER_NAME = "AccessibilityCircleProgress";
+const std::string CIRCLE_PROGRESS_TASK = "CircleProgressFrame";
 
 constexpr float TOUCH_SLOP = 8.0f;
 
@@ -86,8 +88,35 @@ const std::map<uint32_t, uint32_t> IGNORE_REPEAT_CLICK_TIME_MAP = {
 
 int64_t AccessibilityScreenTouch::lastUpTime = 0; // global last up time
 
-ScreenTouchHandler::ScreenTouchHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-    AccessibilityScreenTouch &server) : AppExecFwk::EventHandler(runner), server_(server)
+namespace {
+    /**
+     * Sweep the arc to where the elapsed time puts it and post the next frame, the frames only hold the
+     * state of their press so they never touch a screen touch which is gone.
+     */
+    void DrawCircleProgressFrame(std::weak_ptr<AppExecFwk::EventHandler> weakHandler,
+        std::shared_ptr<CircleProgressState> state)
+    {
+        std::shared_ptr<AccessibilityCircleDrawingManager> drawingMgr =
+            AccessibilityCircleDrawingManager::GetInstance();
+        int32_t angle = GetCircleProgressAngle(ExtUtils::GetSystemTime() - state->startTime, state->duration);
+        if (state->isStopped || angle >= CIRCLE_ANGLE) {
+            drawingMgr->EndProgress();
+            return;
+        }
+
+        drawingMgr->UpdateProgress(state->centerX, state->centerY, angle);
+        std::shared_ptr<AppExecFwk::EventHandler> handler = weakHandler.lock();
+        if (handler == nullptr) {
+            drawingMgr->EndProgress();
+            return;
+        }
+        handler->PostTask([weakHandler, state]() { DrawCircleProgressFrame(weakHandler, state); },
+            CIRCLE_PROGRESS_TASK, CIRCLE_PROGRESS_FRAME_INTERVAL);
+    }
+} // namespace
+
+ScreenTouchHandler::ScreenTouchHandler(const std::shared_ptr<GestureTimerWheel> &wheel,
+    AccessibilityScreenTouch &server) : GestureTimerHandler(wheel), server_(server)
 {
 }
 
@@ -119,12 +148,12 @@ AccessibilityScreenTouch::AccessibilityScreenTouch()
 
     lastUpTime_ = lastUpTime;
 
-    runner_ = AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner();
-    if (!runner_) {
-        HILOG_ERROR("get runner failed");
+    std::shared_ptr<GestureTimerWheel> wheel = AccessibilityInputInterceptor::GetInstance()->GetGestureTimerWheel();
+    if (!wheel) {
+        HILOG_ERROR("get gesture timer wheel failed");
         return;
     }
-    handler_ = std::make_shared<ScreenTouchHandler>(runner_, *this);
+    handler_ = std::make_shared<ScreenTouchHandler>(wheel, *this);
     if (!handler_) {
         HILOG_ERROR("create event handler failed");
         return;
@@ -160,17 +189,22 @@ void ScreenTouchHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &eve
 AccessibilityScreenTouch::~AccessibilityScreenTouch()
 {
     lastUpTime = lastUpTime_;
-    if (drawCircleThread_ && drawCircleThread_->joinable()) {
-        drawCircleThread_->join();
+    if (circleState_ != nullptr) {
+        circleState_->isStopped = true;
+    }
+    if (circleHandler_ == nullptr) {
+        AccessibilityCircleDrawingManager::DeleteInstance();
+        return;
     }
-    drawCircleThread_ = nullptr;
-    AccessibilityCircleDrawingManager::DeleteInstance();
+    // the circle is only drawn on the runner, so it is also released there once the last frame is done
+    circleHandler_->RemoveTask(CIRCLE_PROGRESS_TASK);
+    circleHandler_->PostSyncTask([]() { AccessibilityCircleDrawingManager::DeleteInstance(); });
 }
 
 void AccessibilityScreenTouch::SendInterceptedEvent()
 {
     HILOG_DEBUG();
-    isStopDrawCircle_ = true;
+    StopCircleProgress();
 
     if (cachedDownPointerEvents_.empty()) {
         HILOG_ERROR("Cached down pointer event is empty!");
@@ -214,108 +248,134 @@ void AccessibilityScreenTouch::UpdateScreenId()
     SetTargetScreenId();
 }
 
-void AccessibilityScreenTouch::ConversionCoordinates(int32_t originalX, int32_t originalY)
+CircleProgressTransform AccessibilityScreenTouch::CreateRotationTransform()
 {
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
     AccessibilityDisplayManager &displayMgr = Singleton<AccessibilityDisplayManager>::GetInstance();
-    int32_t displayWidth = displayMgr.GetWidth();
-    int32_t displayHeight = displayMgr.GetHeight();
-
-    OHOS::Rosen::DisplayOrientation orientation = displayMgr.GetOrientation();
-    switch (orientation) {
+    int32_t quarterTurns = QUARTER_TURN_UNKNOWN;
+    switch (displayMgr.GetOrientation()) {
         case OHOS::Rosen::DisplayOrientation::PORTRAIT:
-            circleCenterPhysicalX_ = originalX;
-            circleCenterPhysicalY_ = originalY;
-            startAngle_ = START_ANGLE_PORTRAIT;
+            quarterTurns = QUARTER_TURN_PORTRAIT;
             break;
         case OHOS::Rosen::DisplayOrientation::LANDSCAPE:
-            circleCenterPhysicalX_ = originalY;
-            circleCenterPhysicalY_ = displayWidth - originalX;
-            startAngle_ = START_ANGLE_LANDSCAPE;
+            quarterTurns = QUARTER_TURN_LANDSCAPE;
             break;
         case OHOS::Rosen::DisplayOrientation::PORTRAIT_INVERTED:
-            circleCenterPhysicalX_ = displayWidth - originalX;
-            circleCenterPhysicalY_ = displayHeight - originalY;
-            startAngle_ = START_ANGLE_PORTRAIT_INVERTED;
+            quarterTurns = QUARTER_TURN_PORTRAIT_INVERTED;
             break;
         case OHOS::Rosen::DisplayOrientation::LANDSCAPE_INVERTED:
-            circleCenterPhysicalX_ = displayHeight - originalY;
-            circleCenterPhysicalY_ = originalX;
-            startAngle_ = START_ANGLE_LANDSCAPE_INVERTED;
+            quarterTurns = QUARTER_TURN_LANDSCAPE_INVERTED;
             break;
         default:
             break;
     }
+    return CircleProgressTransform::Create(quarterTurns, displayMgr.GetWidth(), displayMgr.GetHeight());
+#else
+    return CircleProgressTransform::Create(QUARTER_TURN_PORTRAIT, 0, 0);
 #endif
 }
 
-void AccessibilityScreenTouch::HandleCoordinates(MMI::PointerEvent::PointerItem &pointerItem)
+CircleProgressTransform AccessibilityScreenTouch::CreateCircleTransform()
 {
-    int32_t originalX = pointerItem.GetDisplayX();
-    int32_t originalY = pointerItem.GetDisplayY();
-
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
     AccessibilityDisplayManager &displayMgr = Singleton<AccessibilityDisplayManager>::GetInstance();
     switch (ROTATE_POLICY) {
         case WINDOW_ROTATE:
-            ConversionCoordinates(originalX, originalY);
-            break;
+            return CreateRotationTransform();
         case SCREEN_ROTATE:
-            circleCenterPhysicalX_ = originalX;
-            circleCenterPhysicalY_ = originalY;
-            startAngle_ = START_ANGLE_PORTRAIT;
-            break;
-        case FOLDABLE_DEVICE:
+            return CircleProgressTransform::Create(QUARTER_TURN_PORTRAIT, 0, 0);
+        case FOLDABLE_DEVICE: {
             if (FOLDABLE.length() < SUBSCRIPT_TWO) {
                 HILOG_ERROR("get foldable parameter failed");
-                ConversionCoordinates(originalX, originalY);
-                break;
+                return CreateRotationTransform();
             }
-            if ((displayMgr.GetFoldStatus() == Rosen::FoldStatus::EXPAND &&
-                FOLDABLE[SUBSCRIPT_TWO] == FOLDABLE_SCREEN_ROTATE) ||
-                (displayMgr.GetFoldStatus() == Rosen::FoldStatus::FOLDED &&
-                FOLDABLE[SUBSCRIPT_ZERO] == FOLDABLE_SCREEN_ROTATE) ||
-                (displayMgr.GetFoldStatus() == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND &&
+            Rosen::FoldStatus foldStatus = displayMgr.GetFoldStatus();
+            if ((foldStatus == Rosen::FoldStatus::EXPAND && FOLDABLE[SUBSCRIPT_TWO] == FOLDABLE_SCREEN_ROTATE) ||
+                (foldStatus == Rosen::FoldStatus::FOLDED && FOLDABLE[SUBSCRIPT_ZERO] == FOLDABLE_SCREEN_ROTATE) ||
+                (foldStatus == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND &&
                 FOLDABLE[SUBSCRIPT_TWO] == FOLDABLE_SCREEN_ROTATE)) {
-                circleCenterPhysicalX_ = originalX;
-                circleCenterPhysicalY_ = originalY;
-                startAngle_ = START_ANGLE_PORTRAIT;
-            } else {
-                ConversionCoordinates(originalX, originalY);
+                return CircleProgressTransform::Create(QUARTER_TURN_PORTRAIT, 0, 0);
             }
-            break;
+            return CreateRotationTransform();
+        }
         default:
             HILOG_WARN("unknown rotate policy");
-            ConversionCoordinates(originalX, originalY);
-            break;
+            return CreateRotationTransform();
     }
 #else
     HILOG_WARN("display manager is not enable");
-    circleCenterPhysicalX_ = originalX;
-    circleCenterPhysicalY_ = originalY;
-    startAngle_ = START_ANGLE_PORTRAIT;
+    return CircleProgressTransform::Create(QUARTER_TURN_PORTRAIT, 0, 0);
 #endif
 }
 
-void AccessibilityScreenTouch::DrawCircleProgress()
+void AccessibilityScreenTouch::HandleCoordinates(MMI::PointerEvent::PointerItem &pointerItem)
 {
-    HILOG_DEBUG();
+    if (circleState_ == nullptr) {
+        return;
+    }
+    int32_t physicalX = 0;
+    int32_t physicalY = 0;
+    if (circleTransform_.Apply(pointerItem.GetDisplayX(), pointerItem.GetDisplayY(), physicalX, physicalY)) {
+        circleState_->centerX = physicalX;
+        circleState_->centerY = physicalY;
+    }
+}
+
+bool AccessibilityScreenTouch::InitCircleProgressRunner()
+{
+    if (circleHandler_ != nullptr) {
+        return true;
+    }
+    circleRunner_ = AppExecFwk::EventRunner::Create(CIRCLE_PROGRESS_RUNNER_NAME, AppExecFwk::ThreadMode::FFRT);
+    if (circleRunner_ == nullptr) {
+        HILOG_ERROR("create circle progress runner failed");
+        return false;
+    }
+    circleHandler_ = std::make_shared<AppExecFwk::EventHandler>(circleRunner_);
+    if (circleHandler_ == nullptr) {
+        HILOG_ERROR("create circle progress handler failed");
+        return false;
+    }
+    return true;
+}
+
+void AccessibilityScreenTouch::StartCircleProgress(MMI::PointerEvent::PointerItem &pointerItem)
+{
+    HILOG_INFO("ROTATE_POLICY = %{public}d, FOLDABLE = %{public}s", ROTATE_POLICY, FOLDABLE.c_str());
+    if (circleState_ != nullptr) {
+        circleState_->isStopped = true;
+    }
+    isStopDrawCircle_ = false;
+    if (!InitCircleProgressRunner()) {
+        circleState_ = nullptr;
+        return;
+    }
 
-    AccessibilityCircleDrawingManager::GetInstance()->DrawPointer(circleCenterPhysicalX_,
-        circleCenterPhysicalY_, 0, screenId_, startAngle_);
-    AccessibilityCircleDrawingManager::GetInstance()->UpdatePointerVisible(true);
-    uint32_t times = GetRealClickResponseTime() / NUMBER_10;
-    uint32_t step = CIRCLE_ANGLE / times;
-    uint32_t time = 0;
-    while (time < times && isStopDrawCircle_ == false) {
-        AccessibilityCircleDrawingManager::GetInstance()->DrawPointer(circleCenterPhysicalX_,
-            circleCenterPhysicalY_, step * time, screenId_, startAngle_);
-        time++;
-        std::this_thread::yield();
-        std::this_thread::sleep_for(std::chrono::milliseconds(NUMBER_10));
-    }
-
-    AccessibilityCircleDrawingManager::GetInstance()->UpdatePointerVisible(false);
+    // the display is asked once a press, the moves of the press only map their position
+    circleTransform_ = CreateCircleTransform();
+    circleState_ = std::make_shared<CircleProgressState>();
+    circleState_->startTime = ExtUtils::GetSystemTime();
+    circleState_->duration = GetRealClickResponseTime();
+    circleState_->screenId = screenId_;
+    circleState_->startAngle = circleTransform_.GetStartAngle();
+    HandleCoordinates(pointerItem);
+
+    std::shared_ptr<CircleProgressState> state = circleState_;
+    std::weak_ptr<AppExecFwk::EventHandler> weakHandler = circleHandler_;
+    circleHandler_->RemoveTask(CIRCLE_PROGRESS_TASK);
+    circleHandler_->PostTask([weakHandler, state]() {
+        AccessibilityCircleDrawingManager::GetInstance()->BeginProgress(state->centerX, state->centerY,
+            state->screenId, state->startAngle);
+        DrawCircleProgressFrame(weakHandler, state);
+    }, CIRCLE_PROGRESS_TASK);
+}
+
+void AccessibilityScreenTouch::StopCircleProgress()
+{
+    isStopDrawCircle_ = true;
+    if (circleState_ != nullptr) {
+        circleState_->isStopped = true;
+    }
 }
 
 void AccessibilityScreenTouch::HandleResponseDelayStateInnerDown(MMI::PointerEvent &event)
@@ -334,18 +394,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerDown(MMI::PointerEve
     startPointer_ = std::make_shared<MMI::PointerEvent::PointerItem>(pointerItem);
     isMoveBeyondThreshold_ = false;
 
-    HILOG_INFO("ROTATE_POLICY = %{public}d, FOLDABLE = %{public}s", ROTATE_POLICY, FOLDABLE.c_str());
-    HandleCoordinates(pointerItem);
-    isStopDrawCircle_ = false;
-    if (drawCircleThread_ && drawCircleThread_->joinable()) {
-        drawCircleThread_->join();
-    }
-
-    drawCircleThread_ = nullptr;
-    drawCircleThread_ = std::make_shared<std::thread>([this] {this->DrawCircleProgress();});
-    if (drawCircleThread_ == nullptr) {
-        HILOG_ERROR("create draw circle progress fail");
-    }
+    StartCircleProgress(pointerItem);
 
     handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
     cachedDownPointerEvents_.clear();
@@ -393,7 +442,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerMove(MMI::PointerEve
         }
         EventTransmission::OnPointerEvent(event);
         isMoveBeyondThreshold_ = true;
-        isStopDrawCircle_ = true;
+        StopCircleProgress();
         return;
     }
 
@@ -412,7 +461,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerUp(MMI::PointerEvent
     if (cachedDownPointerEvents_.empty()) {
         HILOG_ERROR("cached down pointer event is empty!");
         handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
-        isStopDrawCircle_ = true;
+        StopCircleProgress();
         return;
     }
     if (startPointer_ != nullptr && event.GetPointerId() != startPointer_->GetPointerId()) {
@@ -434,7 +483,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerUp(MMI::PointerEvent
 
     if (startPointer_ != nullptr && event.GetPointerId() == startPointer_->GetPointerId()) {
         handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
-        isStopDrawCircle_ = true;
+        StopCircleProgress();
         cachedDownPointerEvents_.clear();
     } else {
         auto iter = std::find_if(cachedDownPointerEvents_.begin(), cachedDownPointerEvents_.end(),
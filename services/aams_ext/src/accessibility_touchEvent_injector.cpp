@@ -22,7 +22,6 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr int32_t MS_TO_US = 1000;
-    constexpr int32_t MOVE_GESTURE_MIN_PATH_COUNT = 2;
 } // namespace
 
 TouchInjectHandler::TouchInjectHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
@@ -48,7 +47,16 @@ void TouchInjectHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &eve
                 HILOG_WARN("pointer event is nullptr");
                 return;
             }
-            server_.SendPointerEvent(*parameters->event_);
+            // an event dequeued before its injection was cancelled or replaced is dropped
+            if (!server_.IsCurrentInjection(parameters->injectId_)) {
+                HILOG_DEBUG("drop the event of a stale injection");
+                return;
+            }
+            {
+                std::lock_guard<ffrt::mutex> lock(AccessibilityInputInterceptor::GetInstance()->GetDispatchMutex());
+                server_.SendPointerEvent(*parameters->event_);
+            }
+            server_.InjectNextEvent(parameters->injectId_);
             break;
         default:
             break;
@@ -126,8 +134,16 @@ void TouchEventInjector::CancelInjectedEvents()
         HILOG_ERROR("handler_ is nullptr");
         return;
     }
-    if (handler_->HasInnerEvent(SEND_TOUCH_EVENT_MSG)) {
-        handler_->RemoveEvent(SEND_TOUCH_EVENT_MSG);
+    bool hadCursor = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(injectMutex_);
+        hadCursor = injectCursor_ != nullptr;
+        injectCursor_ = nullptr;
+        injectId_++;
+    }
+    handler_->RemoveEvent(SEND_TOUCH_EVENT_MSG);
+    // the message of the next event may be running already, the gesture still needs its cancel
+    if (hadCursor) {
         CancelGesture();
     }
 }
@@ -169,183 +185,66 @@ void TouchEventInjector::InjectEvents(const std::shared_ptr<AccessibilityGesture
         HILOG_WARN("Inject gesture fail");
         return;
     }
+    if (handler_ == nullptr) {
+        HILOG_ERROR("handler_ is nullptr");
+        return;
+    }
     CancelInjectedEvents();
     CancelGesture();
 
-    ParseTouchEventsFromGesturePath(curTime, gesturePath);
-
-    if (injectedEvents_.empty()) {
+    std::lock_guard<ffrt::mutex> lock(injectMutex_);
+    injectCursor_ = std::make_unique<AccessibilityGestureInjectCursor>(gesturePath, curTime);
+    if (!PostNextEvent()) {
         HILOG_WARN("No injected events");
+        injectCursor_ = nullptr;
         return;
     }
-    for (size_t i = 0; i < injectedEvents_.size(); i++) {
-        std::shared_ptr<SendEventArgs> parameters = std::make_shared<SendEventArgs>();
-        parameters->event_ = injectedEvents_[i];
-        if (injectedEvents_[i]) {
-            int64_t timeout = (injectedEvents_[i]->GetActionTime() - curTime) / MS_TO_US;
-            if (timeout < 0) {
-                HILOG_WARN("timeout is error.%{public}" PRId64 "", timeout);
-            } else {
-                handler_->SendEvent(SEND_TOUCH_EVENT_MSG, parameters, timeout);
-            }
-        }
-    }
-    injectedEvents_.clear();
+    HILOG_DEBUG("inject %{public}zu events", injectCursor_->GetEventCount());
 }
 
-void TouchEventInjector::ParseTapsEvents(int64_t startTime,
-    const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath)
+bool TouchEventInjector::IsCurrentInjection(uint64_t injectId)
 {
-    HILOG_DEBUG();
-
-    if (!gesturePath) {
-        HILOG_ERROR("gesturePath is null.");
-        return;
-    }
-    const std::vector<AccessibilityGesturePosition> &positions = gesturePath->GetPositions();
-    size_t positionSize = positions.size();
-    if (!positionSize) {
-        HILOG_WARN("PositionSize is zero.");
-        return;
-    }
-    int64_t durationTime = gesturePath->GetDurationTime();
-    if (durationTime < 0) {
-        HILOG_WARN("DurationTime is wrong.");
-        return;
-    }
-    int64_t perDurationTime = static_cast<int64_t>(static_cast<uint64_t>(durationTime) / positionSize);
-    int64_t downTime = startTime;
-    for (size_t i = 0; i < positionSize; i++) {
-        std::shared_ptr<MMI::PointerEvent> event;
-        MMI::PointerEvent::PointerItem pointer = {};
-        pointer.SetPointerId(0);
-        // Append down event
-        int32_t px = static_cast<int32_t>(positions[i].positionX_);
-        int32_t py = static_cast<int32_t>(positions[i].positionY_);
-        pointer.SetDisplayX(px);
-        pointer.SetRawDisplayX(px);
-        pointer.SetDisplayY(py);
-        pointer.SetRawDisplayY(py);
-        pointer.SetDownTime(downTime);
-        event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, pointer, downTime);
-        if (event == nullptr) {
-            HILOG_ERROR("event is nullptr");
-            return;
-        }
-
-        HILOG_DEBUG("append down event");
-        injectedEvents_.push_back(event);
-
-        // Append up event
-        int64_t upTime = downTime + perDurationTime * MS_TO_US;
-        event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, pointer, upTime);
-        if (event == nullptr) {
-            HILOG_ERROR("event is nullptr");
-            return;
-        }
-
-        HILOG_DEBUG("append up event");
-        injectedEvents_.push_back(event);
-        downTime = upTime + DOUBLE_TAP_MIN_TIME;
-    }
+    std::lock_guard<ffrt::mutex> lock(injectMutex_);
+    return injectId == injectId_ && injectCursor_ != nullptr;
 }
 
-void TouchEventInjector::ParseMovesEvents(int64_t startTime,
-    const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath)
+void TouchEventInjector::InjectNextEvent(uint64_t injectId)
 {
-    HILOG_DEBUG();
-
-    if (!gesturePath) {
-        HILOG_ERROR("gesturePath is null.");
-        return;
-    }
-    std::vector<AccessibilityGesturePosition> positions = gesturePath->GetPositions();
-    size_t positionSize = positions.size();
-    if (positionSize < MOVE_GESTURE_MIN_PATH_COUNT) {
-        HILOG_WARN("PositionSize is wrong.");
+    std::lock_guard<ffrt::mutex> lock(injectMutex_);
+    if (injectId != injectId_ || injectCursor_ == nullptr) {
         return;
     }
-    int64_t durationTime = gesturePath->GetDurationTime();
-    if (durationTime < 0) {
-        HILOG_WARN("DurationTime is wrong.");
-        return;
-    }
-    int64_t perDurationTime = static_cast<int64_t>(static_cast<uint64_t>(durationTime) / (positionSize - 1));
-    int64_t downTime = startTime;
-    int64_t nowTime = startTime;
-    for (size_t i = 0; i < positionSize; i++) {
-        std::shared_ptr<MMI::PointerEvent> event;
-        MMI::PointerEvent::PointerItem pointer = {};
-        int32_t px = static_cast<int32_t>(positions[i].positionX_);
-        int32_t py = static_cast<int32_t>(positions[i].positionY_);
-        pointer.SetPointerId(0);
-        pointer.SetDisplayX(px);
-        pointer.SetRawDisplayX(px);
-        pointer.SetDisplayY(py);
-        pointer.SetRawDisplayY(py);
-        pointer.SetDownTime(downTime);
-        if (i == 0) { // Append down event
-            HILOG_DEBUG("append down event");
-            event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, pointer, downTime);
-            if (event == nullptr) {
-                HILOG_ERROR("event is nullptr");
-                return;
-            }
-
-            injectedEvents_.push_back(event);
-        } else if (i < (positionSize - 1)) { // Append move event
-            HILOG_DEBUG("append move event");
-            nowTime += perDurationTime * MS_TO_US;
-            event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, pointer, nowTime);
-            if (event == nullptr) {
-                HILOG_ERROR("event is nullptr");
-                return;
-            }
-
-            injectedEvents_.push_back(event);
-        } else { // Append up event
-            HILOG_DEBUG("append move event");
-            nowTime += perDurationTime * MS_TO_US;
-            event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, pointer, nowTime);
-            if (event == nullptr) {
-                HILOG_ERROR("event is nullptr");
-                return;
-            }
-
-            injectedEvents_.push_back(event);
-            
-            HILOG_DEBUG("append up event");
-            event = obtainTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, pointer, nowTime);
-            if (event == nullptr) {
-                HILOG_ERROR("event is nullptr");
-                return;
-            }
-            
-            injectedEvents_.push_back(event);
-        }
+    if (!PostNextEvent()) {
+        HILOG_DEBUG("injection finished");
+        injectCursor_ = nullptr;
     }
 }
 
-void TouchEventInjector::ParseTouchEventsFromGesturePath(int64_t startTime,
-    const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath)
+bool TouchEventInjector::PostNextEvent()
 {
-    HILOG_DEBUG();
-    if (!gesturePath) {
-        HILOG_ERROR("gesturePath is null.");
-        return;
-    }
-    const std::vector<AccessibilityGesturePosition> &positions = gesturePath->GetPositions();
-    if (positions.size() == 0) {
-        HILOG_ERROR("position size is 0.");
-        return;
+    GestureInjectPoint point;
+    if (injectCursor_ == nullptr || !injectCursor_->Next(point)) {
+        return false;
     }
-    if ((positions.size() == 1) ||
-        ((positions[0].positionX_ == positions[1].positionX_) &&
-        (positions[0].positionY_ == positions[1].positionY_))) {
-        ParseTapsEvents(startTime, gesturePath);
-    } else {
-        ParseMovesEvents(startTime, gesturePath);
+    MMI::PointerEvent::PointerItem pointer = {};
+    pointer.SetPointerId(0);
+    pointer.SetDisplayX(point.displayX);
+    pointer.SetRawDisplayX(point.displayX);
+    pointer.SetDisplayY(point.displayY);
+    pointer.SetRawDisplayY(point.displayY);
+    pointer.SetDownTime(point.downTime);
+    std::shared_ptr<SendEventArgs> parameters = std::make_shared<SendEventArgs>();
+    parameters->event_ = obtainTouchEvent(point.action, pointer, point.actionTime);
+    parameters->injectId_ = injectId_;
+    if (parameters->event_ == nullptr) {
+        HILOG_ERROR("event is nullptr");
+        return false;
     }
+
+    // an event already due, as the up at the time of the last move, is sent right after the previous one
+    int64_t timeout = (point.actionTime - GetSystemTime()) / MS_TO_US;
+    handler_->SendEvent(SEND_TOUCH_EVENT_MSG, parameters, timeout > 0 ? timeout : 0);
+    return true;
 }
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -65,7 +65,7 @@ AccessibilityZoomGesture::AccessibilityZoomGesture(
 {
     HILOG_DEBUG();
     zoomGestureEventHandler_ = std::make_shared<ZoomGestureEventHandler>(
-        AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner(), *this);
+        AccessibilityInputInterceptor::GetInstance()->GetGestureTimerWheel(), *this);
     magnificationMode_ = Singleton<ExtendServiceManager>::GetInstance().getMagnificationModeCallback();
     gestureMode_ = Singleton<ExtendServiceManager>::GetInstance().getMagnificationTriggerMethodCallback();
     scale_ = Singleton<ExtendServiceManager>::GetInstance().getMagnificationScaleCallback();
@@ -502,9 +502,16 @@ void AccessibilityZoomGesture::RecognizeScroll(ZOOM_FOCUS_COORDINATE &coordinate
 }
 
 bool AccessibilityZoomGesture::RecognizeScale(MMI::PointerEvent &event)
+{
+    PointerGeometry geometry;
+    geometry.Load(event);
+    return RecognizeScale(geometry);
+}
+
+bool AccessibilityZoomGesture::RecognizeScale(const PointerGeometry &geometry)
 {
     HILOG_DEBUG();
-    float curDistance = CalcSeparationDistance(event);
+    float curDistance = CalcSeparationDistance(geometry);
     if (abs(lastDistance_) < EPS) {
         HILOG_WARN("lastDistance_ is zero");
         lastDistance_ = curDistance;
@@ -534,7 +541,7 @@ bool AccessibilityZoomGesture::RecognizeScale(MMI::PointerEvent &event)
         } else {
             if (hasScaled_) {
                 hasScaled_ = false;
-                CalcFocusCoordinate(event, lastCenter);
+                CalcFocusCoordinate(geometry, lastCenter);
             }
             windowMagnificationManager_->FixSourceCenter(false);
             return false;
@@ -547,40 +554,23 @@ void AccessibilityZoomGesture::CalcFocusCoordinate(MMI::PointerEvent &event, ZOO
 {
     HILOG_DEBUG();
 
-    float sumX = 0.0f;
-    float sumY = 0.0f;
     int32_t upPointerId = -1;
-    int32_t action = event.GetPointerAction();
-    std::vector<int32_t> pointerIdList = event.GetPointerIds();
-    size_t count = pointerIdList.size();
-    if (!count) {
-        HILOG_DEBUG("The size of PointerIds is 0");
-        return;
-    }
-
-    if (action == MMI::PointerEvent::POINTER_ACTION_UP) {
+    if (event.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_UP) {
         upPointerId = event.GetPointerId();
         HILOG_DEBUG("The pointer id of up is %{public}d", upPointerId);
-        count--;
-            }
+    }
+    PointerGeometry geometry;
+    geometry.Load(event, upPointerId);
+    CalcFocusCoordinate(geometry, coordinate);
+}
 
-    if (!count) {
+void AccessibilityZoomGesture::CalcFocusCoordinate(const PointerGeometry &geometry,
+    ZOOM_FOCUS_COORDINATE &coordinate)
+{
+    if (!geometry.GetCentroid(coordinate.centerX, coordinate.centerY, PointerCoordinate::RAW_DISPLAY)) {
         HILOG_DEBUG("The size of PointerIds(down) is invalid");
         return;
-                }
-
-    for (int32_t pointerId : pointerIdList) {
-        if (pointerId == upPointerId) {
-            continue;
-            }
-        MMI::PointerEvent::PointerItem item;
-        event.GetPointerItem(pointerId, item);
-        sumX += static_cast<float>(item.GetRawDisplayX());
-        sumY += static_cast<float>(item.GetRawDisplayY());
     }
-
-    coordinate.centerX = sumX / count;
-    coordinate.centerY = sumY / count;
     HILOG_DEBUG("centerX:%{public}f, centerY:%{public}f", coordinate.centerX, coordinate.centerY);
 }
 
@@ -588,28 +578,22 @@ float AccessibilityZoomGesture::CalcScaleSpan(MMI::PointerEvent &event, ZOOM_FOC
 {
     HILOG_DEBUG();
 
-    float span = 0.0f;
-    float sumSpanX = 0.0f;
-    float sumSpanY = 0.0f;
-    int32_t upPointerId = -1;
-    int32_t action = event.GetPointerAction();
-    std::vector<int32_t> pointerIdList = event.GetPointerIds();
-    size_t count = pointerIdList.size();
-    if (!count) {
-        HILOG_DEBUG("The size of PointerIds is 0");
-        return span;
-    }
+    PointerGeometry geometry;
+    geometry.Load(event);
+    return CalcScaleSpan(geometry, coordinate);
+}
 
-    for (int32_t pointerId : pointerIdList) {
-        MMI::PointerEvent::PointerItem item;
-        event.GetPointerItem(pointerId, item);
-        sumSpanX += static_cast<float>(abs(item.GetRawDisplayX() - coordinate.centerX));
-        sumSpanY += static_cast<float>(abs(item.GetRawDisplayY() - coordinate.centerY));
+float AccessibilityZoomGesture::CalcScaleSpan(const PointerGeometry &geometry, ZOOM_FOCUS_COORDINATE coordinate)
+{
+    float spanX = 0.0f;
+    float spanY = 0.0f;
+    if (!geometry.GetMeanDeviation(coordinate.centerX, coordinate.centerY, spanX, spanY,
+        PointerCoordinate::RAW_DISPLAY)) {
+        HILOG_DEBUG("The size of PointerIds is 0");
+        return 0.0f;
     }
 
-    float spanX = sumSpanX / count;
-    float spanY = sumSpanY / count;
-    span = hypot(spanX, spanY) / HALF;
+    float span = hypot(spanX, spanY) / HALF;
     HILOG_DEBUG("The span is %{public}f", span);
     return span;
 }
@@ -633,19 +617,18 @@ bool AccessibilityZoomGesture::IsKnuckles(MMI::PointerEvent &event)
 
 float AccessibilityZoomGesture::CalcSeparationDistance(MMI::PointerEvent &event)
 {
-    std::vector<int32_t> pointerIdList = event.GetPointerIds();
-    size_t count = pointerIdList.size();
-    if (count != POINTER_COUNT_2) {
+    PointerGeometry geometry;
+    geometry.Load(event);
+    return CalcSeparationDistance(geometry);
+}
+
+float AccessibilityZoomGesture::CalcSeparationDistance(const PointerGeometry &geometry)
+{
+    if (geometry.GetCount() != POINTER_COUNT_2) {
         HILOG_ERROR("only two fingers can cal distance");
         return 0.0f;
     }
-    MMI::PointerEvent::PointerItem firstItem;
-    MMI::PointerEvent::PointerItem secondItem;
-    event.GetPointerItem(pointerIdList[POINTER_ID_0], firstItem);
-    event.GetPointerItem(pointerIdList[POINTER_ID_1], secondItem);
-    int32_t durationX = secondItem.GetDisplayX() - firstItem.GetDisplayX();
-    int32_t durationY = secondItem.GetDisplayY() - firstItem.GetDisplayY();
-    float distance = static_cast<float>(hypot(durationX, durationY));
+    float distance = geometry.GetSeparation(POINTER_ID_0, POINTER_ID_1);
     HILOG_DEBUG("distance:%{public}f", distance);
     return distance;
 }
@@ -666,8 +649,8 @@ float AccessibilityZoomGesture::CalcSeparationDistance(MMI::PointerEvent &firstE
 
 
 AccessibilityZoomGesture::ZoomGestureEventHandler::ZoomGestureEventHandler(
-    const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-    AccessibilityZoomGesture &zoomGesture): AppExecFwk::EventHandler(runner), zoomGesture_(zoomGesture)
+    const std::shared_ptr<GestureTimerWheel> &wheel,
+    AccessibilityZoomGesture &zoomGesture): GestureTimerHandler(wheel), zoomGesture_(zoomGesture)
 {
     HILOG_DEBUG();
 }
@@ -1171,17 +1154,19 @@ void AccessibilityZoomGesture::HandleZoomSlidingStateDown(MMI::PointerEvent &eve
 void AccessibilityZoomGesture::HandleZoomSlidingStateMove(MMI::PointerEvent &event)
 {
     HILOG_DEBUG();
-    size_t pointerCount = event.GetPointerIds().size();
+    // a move has no lifted pointer, so the focus and the scale share the pointers read once
+    PointerGeometry geometry;
+    size_t pointerCount = geometry.Load(event);
     ZOOM_FOCUS_COORDINATE coordinate = {0.0f, 0.0f};
-    CalcFocusCoordinate(event, coordinate);
+    CalcFocusCoordinate(geometry, coordinate);
     if (pointerCount != POINTER_COUNT_2) {
         RecognizeScroll(coordinate);
     } else {
         if (magnificationMode_ == FULL_SCREEN_MAGNIFICATION) {
             RecognizeScroll(coordinate);
-            RecognizeScale(event);
+            RecognizeScale(geometry);
         } else {
-            if (!RecognizeScale(event)) {
+            if (!RecognizeScale(geometry)) {
                 RecognizeScroll(coordinate);
             }
         }
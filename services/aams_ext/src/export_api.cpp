@@ -19,6 +19,9 @@
 #include "extend_service_manager.h"
 #include "accessibility_extend_power_manager.h"
 #include "magnification_manager.h"
+#include "magnification_window.h"
+#include "accessibility_input_statistics.h"
+#include "accessibility_input_recorder.h"
 
 OHOS::Accessibility::ExtendServiceManager &serviceManagerInstance =
   OHOS::Singleton<OHOS::Accessibility::ExtendServiceManager>::GetInstance();
@@ -283,5 +286,47 @@ API_EXPORT void SetCurrentAccountId(int32_t accountId)
     HILOG_DEBUG();
     serviceManagerInstance.SetCurrentAccountId(accountId);
 }
+API_EXPORT void DumpInputStatistics(std::string &dumpInfo)
+{
+    OHOS::Singleton<OHOS::Accessibility::AccessibilityInputStatistics>::GetInstance().Dump(dumpInfo);
+    OHOS::Accessibility::MagnificationWindow::GetInstance().DumpRenderStatistics(dumpInfo);
+    auto scheduler = OHOS::Accessibility::MagnificationManager::GetInstance()->FindUpdateScheduler();
+    if (scheduler != nullptr) {
+        scheduler->Dump(dumpInfo);
+    }
+    auto focusFollower = OHOS::Accessibility::MagnificationManager::GetInstance()->FindFocusFollower();
+    if (focusFollower != nullptr) {
+        focusFollower->Dump(dumpInfo);
+    }
+}
+API_EXPORT void ResetInputStatistics()
+{
+    HILOG_INFO();
+    OHOS::Singleton<OHOS::Accessibility::AccessibilityInputStatistics>::GetInstance().Reset();
+    OHOS::Accessibility::MagnificationWindow::GetInstance().ResetRenderStatistics();
+    auto scheduler = OHOS::Accessibility::MagnificationManager::GetInstance()->FindUpdateScheduler();
+    if (scheduler != nullptr) {
+        scheduler->ResetStatistics();
+    }
+    auto focusFollower = OHOS::Accessibility::MagnificationManager::GetInstance()->FindFocusFollower();
+    if (focusFollower != nullptr) {
+        focusFollower->ResetStatistics();
+    }
+}
+API_EXPORT bool StartInputRecord()
+{
+    HILOG_INFO();
+    if (!OHOS::Accessibility::AccessibilityInputRecorder::IsAllowed()) {
+        HILOG_WARN("input record is not allowed on this device");
+        return false;
+    }
+    OHOS::Singleton<OHOS::Accessibility::AccessibilityInputRecorder>::GetInstance().Start();
+    return true;
+}
+API_EXPORT void StopInputRecord(std::string &records)
+{
+    HILOG_INFO();
+    OHOS::Singleton<OHOS::Accessibility::AccessibilityInputRecorder>::GetInstance().Stop(records);
+}
 }
 // LCOV_EXCL_STOP
\ No newline at end of file
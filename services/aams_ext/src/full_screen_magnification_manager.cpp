@@ -19,22 +19,58 @@
 #include "ext_utils.h"
 #include "magnification_window.h"
 #include "extend_service_manager.h"
+#include "magnification_manager.h"
 
 namespace OHOS {
 namespace Accessibility {
 namespace {
-}
+    std::shared_ptr<MagnificationUpdateScheduler> GetUpdateScheduler()
+    {
+        return MagnificationManager::GetInstance()->GetUpdateScheduler();
+    }
+
+    // pan and zoom samples are coalesced per frame, apply them before anything else touches the window
+    void FlushMagnificationUpdates()
+    {
+        std::shared_ptr<MagnificationUpdateScheduler> scheduler =
+            MagnificationManager::GetInstance()->FindUpdateScheduler();
+        if (scheduler != nullptr) {
+            scheduler->Flush();
+        }
+    }
+
+    void ClearMagnificationUpdates()
+    {
+        std::shared_ptr<MagnificationUpdateScheduler> scheduler =
+            MagnificationManager::GetInstance()->FindUpdateScheduler();
+        if (scheduler != nullptr) {
+            scheduler->Clear();
+        }
+    }
+
+    // runs on every pan sample, cheap unless the region is following a focus
+    void StopFocusFollowing()
+    {
+        std::shared_ptr<MagnificationFocusFollower> focusFollower =
+            MagnificationManager::GetInstance()->FindFocusFollower();
+        if (focusFollower != nullptr && focusFollower->IsFollowing()) {
+            focusFollower->Cancel();
+        }
+    }
+} // namespace
 
 void FullScreenMagnificationManager::EnableMagnification(int32_t centerX, int32_t centerY)
 {
     HILOG_INFO("centerX = %{public}d, centerY = %{public}d.", centerX, centerY);
     float scale = Singleton<ExtendServiceManager>::GetInstance().getMagnificationScaleCallback();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().InitMagnificationParam(scale);
     MagnificationWindow::GetInstance().EnableMagnification(FULL_SCREEN_MAGNIFICATION, centerX, centerY);
 }
 
 void FullScreenMagnificationManager::ShowMagnification()
 {
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().ShowMagnification(FULL_SCREEN_MAGNIFICATION);
 }
 
@@ -50,6 +86,8 @@ void FullScreenMagnificationManager::ShowMagnificationWithPosition(PointerPos po
 void FullScreenMagnificationManager::DisableMagnification(bool needClear)
 {
     HILOG_INFO();
+    StopFocusFollowing();
+    ClearMagnificationUpdates();
     std::lock_guard<ffrt::mutex> lock(mutex_);
     MagnificationWindow::GetInstance().DisableMagnification(FULL_SCREEN_MAGNIFICATION, needClear);
 }
@@ -57,16 +95,29 @@ void FullScreenMagnificationManager::DisableMagnification(bool needClear)
 void FullScreenMagnificationManager::SetScale(float scaleSpan)
 {
     HILOG_DEBUG();
-    MagnificationWindow::GetInstance().SetScale(FULL_SCREEN_MAGNIFICATION, scaleSpan);
+    std::shared_ptr<MagnificationUpdateScheduler> scheduler = GetUpdateScheduler();
+    if (scheduler == nullptr) {
+        MagnificationWindow::GetInstance().SetScale(FULL_SCREEN_MAGNIFICATION, scaleSpan);
+        return;
+    }
+    scheduler->PostScale(FULL_SCREEN_MAGNIFICATION, scaleSpan);
 }
 
 void FullScreenMagnificationManager::MoveMagnification(int32_t deltaX, int32_t deltaY)
 {
-    MagnificationWindow::GetInstance().MoveMagnification(FULL_SCREEN_MAGNIFICATION, deltaX, deltaY);
+    // the user pans, stop moving the region to the focus
+    StopFocusFollowing();
+    std::shared_ptr<MagnificationUpdateScheduler> scheduler = GetUpdateScheduler();
+    if (scheduler == nullptr) {
+        MagnificationWindow::GetInstance().MoveMagnification(FULL_SCREEN_MAGNIFICATION, deltaX, deltaY);
+        return;
+    }
+    scheduler->PostMove(FULL_SCREEN_MAGNIFICATION, deltaX, deltaY);
 }
 
 void FullScreenMagnificationManager::PersistScale()
 {
+    FlushMagnificationUpdates();
     float scale = MagnificationWindow::GetInstance().GetScale();
     HILOG_DEBUG("scale = %{public}f", scale);
     Singleton<ExtendServiceManager>::GetInstance().magnificationScaleCallback(scale);
@@ -77,33 +128,39 @@ void FullScreenMagnificationManager::PersistScale()
 void FullScreenMagnificationManager::RefreshWindowParam(RotationType type)
 {
     HILOG_DEBUG();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().RefreshWindowParam(FULL_SCREEN_MAGNIFICATION, type);
 }
 
 PointerPos FullScreenMagnificationManager::ConvertCoordinates(int32_t posX, int32_t posY)
 {
+    FlushMagnificationUpdates();
     PointerPos pos = {posX, posY};
     return MagnificationWindow::GetInstance().ConvertCoordinates(posX, posY);
 }
 
 PointerPos FullScreenMagnificationManager::ConvertGesture(uint32_t type, PointerPos coordinates)
 {
+    FlushMagnificationUpdates();
     return MagnificationWindow::GetInstance().ConvertGesture(type, coordinates);
 }
 
 uint32_t FullScreenMagnificationManager::CheckTapOnHotArea(int32_t posX, int32_t posY)
 {
+    FlushMagnificationUpdates();
     return MagnificationWindow::GetInstance().CheckTapOnHotArea(posX, posY);
 }
 
 PointerPos FullScreenMagnificationManager::GetSourceCenter()
 {
+    FlushMagnificationUpdates();
     return MagnificationWindow::GetInstance().GetSourceCenter();
 }
 
 void FullScreenMagnificationManager::FollowFocuseElement(int32_t centerX, int32_t centerY)
 {
     HILOG_DEBUG();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().FollowFocuseElement(FULL_SCREEN_MAGNIFICATION, centerX, centerY);
 }
 
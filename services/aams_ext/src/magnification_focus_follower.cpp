@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "magnification_focus_follower.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+MagnificationFocusFollower::MagnificationFocusFollower(const std::shared_ptr<GestureTimerWheel> &wheel,
+    SourceRectGetter sourceRectGetter, Mover mover)
+    : wheel_(wheel), sourceRectGetter_(std::move(sourceRectGetter)), mover_(std::move(mover)),
+      debounceTimer_([this]() { Follow(); }), frameTimer_([this]() { OnFrame(); })
+{
+    HILOG_DEBUG();
+}
+
+MagnificationFocusFollower::~MagnificationFocusFollower()
+{
+    HILOG_DEBUG();
+    if (wheel_) {
+        wheel_->Cancel(debounceTimer_);
+        wheel_->Cancel(frameTimer_);
+    }
+}
+
+void MagnificationFocusFollower::OnFocus(uint32_t magnificationType, int32_t centerX, int32_t centerY)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        statistics_.focusCount++;
+        if (hasTarget_) {
+            statistics_.debouncedCount++;
+        }
+        hasTarget_ = true;
+        targetType_ = magnificationType;
+        target_ = {centerX, centerY};
+        UpdateFollowingLocked();
+
+        int64_t now = wheel_ ? wheel_->GetCurrentTime() : 0;
+        bool isQuiet = !wheel_ || !hasLastFocus_ || now - lastFocusTime_ >= DEBOUNCE_MS;
+        hasLastFocus_ = true;
+        lastFocusTime_ = now;
+        if (!isQuiet || animating_) {
+            wheel_->Arm(debounceTimer_, DEBOUNCE_MS);
+            return;
+        }
+    }
+    Follow();
+}
+
+void MagnificationFocusFollower::Cancel()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    hasTarget_ = false;
+    animating_ = false;
+    UpdateFollowingLocked();
+    if (wheel_) {
+        wheel_->Cancel(debounceTimer_);
+        wheel_->Cancel(frameTimer_);
+    }
+}
+
+bool MagnificationFocusFollower::IsAnimating()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return animating_;
+}
+
+bool MagnificationFocusFollower::IsFollowing() const
+{
+    return following_.load(std::memory_order_acquire);
+}
+
+MagnificationFocusStatistics MagnificationFocusFollower::GetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void MagnificationFocusFollower::ResetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    statistics_ = {};
+}
+
+void MagnificationFocusFollower::Dump(std::string &dumpInfo)
+{
+    MagnificationFocusStatistics statistics = GetStatistics();
+    dumpInfo.append("magnification focus: focus=").append(std::to_string(statistics.focusCount))
+        .append(" debounced=").append(std::to_string(statistics.debouncedCount))
+        .append(" insideMargin=").append(std::to_string(statistics.insideMarginCount))
+        .append(" jumpsAvoided=").append(std::to_string(statistics.debouncedCount + statistics.insideMarginCount))
+        .append(" follows=").append(std::to_string(statistics.followCount))
+        .append(" frames=").append(std::to_string(statistics.frameCount))
+        .append("\n");
+}
+
+void MagnificationFocusFollower::Follow()
+{
+    uint32_t magnificationType = 0;
+    PointerPos target = {0, 0};
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!hasTarget_) {
+            return;
+        }
+        hasTarget_ = false;
+        UpdateFollowingLocked();
+        magnificationType = targetType_;
+        target = target_;
+        if (wheel_) {
+            wheel_->Cancel(debounceTimer_);
+        }
+    }
+
+    MagnificationRect rect = {0, 0, 0, 0};
+    if (!sourceRectGetter_ || !sourceRectGetter_(magnificationType, rect)) {
+        HILOG_DEBUG("magnification is not shown.");
+        Cancel();
+        return;
+    }
+
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        // while animating the region is on its way to the previous target, just retarget from where it is
+        if (!animating_ && IsInsideComfortMargin(rect, target.posX, target.posY)) {
+            statistics_.insideMarginCount++;
+            return;
+        }
+        animationStart_ = animating_ ? GetFramePositionLocked() :
+            PointerPos {rect.posX + rect.width / DIVISOR_TWO, rect.posY + rect.height / DIVISOR_TWO};
+        animationEnd_ = target;
+        animationType_ = magnificationType;
+        frameIndex_ = 0;
+        frameTotal_ = wheel_ ? GetFrameCount(animationEnd_.posX - animationStart_.posX,
+            animationEnd_.posY - animationStart_.posY) : 1;
+        animating_ = true;
+        UpdateFollowingLocked();
+        statistics_.followCount++;
+        if (wheel_) {
+            wheel_->Cancel(frameTimer_);
+        }
+    }
+    OnFrame();
+}
+
+void MagnificationFocusFollower::OnFrame()
+{
+    uint32_t magnificationType = 0;
+    PointerPos position = {0, 0};
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!animating_) {
+            return;
+        }
+        frameIndex_++;
+        position = GetFramePositionLocked();
+        magnificationType = animationType_;
+        statistics_.frameCount++;
+        if (frameIndex_ >= frameTotal_) {
+            animating_ = false;
+            UpdateFollowingLocked();
+        } else {
+            wheel_->Arm(frameTimer_, FRAME_INTERVAL_MS);
+        }
+    }
+
+    if (mover_) {
+        mover_(magnificationType, position.posX, position.posY);
+    }
+}
+
+bool MagnificationFocusFollower::IsInsideComfortMargin(const MagnificationRect &rect, int32_t posX, int32_t posY)
+{
+    if (rect.width <= 0 || rect.height <= 0) {
+        return false;
+    }
+    int32_t marginX = static_cast<int32_t>(rect.width * COMFORT_MARGIN_RATIO);
+    int32_t marginY = static_cast<int32_t>(rect.height * COMFORT_MARGIN_RATIO);
+    return posX >= rect.posX + marginX && posX <= rect.posX + rect.width - marginX &&
+        posY >= rect.posY + marginY && posY <= rect.posY + rect.height - marginY;
+}
+
+int32_t MagnificationFocusFollower::GetFrameCount(int32_t deltaX, int32_t deltaY)
+{
+    float distance = std::hypot(static_cast<float>(deltaX), static_cast<float>(deltaY));
+    int32_t frames = static_cast<int32_t>(std::ceil(distance / MIN_FRAME_STEP));
+    return std::clamp(frames, 1, MAX_ANIMATION_FRAMES);
+}
+
+void MagnificationFocusFollower::UpdateFollowingLocked()
+{
+    following_.store(hasTarget_ || animating_, std::memory_order_release);
+}
+
+PointerPos MagnificationFocusFollower::GetFramePositionLocked() const
+{
+    if (frameTotal_ <= 0) {
+        return animationEnd_;
+    }
+    // ease out, the region starts fast toward the focus and settles on it
+    float progress = static_cast<float>(frameIndex_) / static_cast<float>(frameTotal_);
+    float eased = 1.0f - (1.0f - progress) * (1.0f - progress);
+    return {
+        animationStart_.posX + static_cast<int32_t>(std::lround((animationEnd_.posX - animationStart_.posX) * eased)),
+        animationStart_.posY + static_cast<int32_t>(std::lround((animationEnd_.posY - animationStart_.posY) * eased)),
+    };
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -20,9 +20,57 @@
 #include "magnification_menu_manager.h"
 #include "magnification_window.h"
 #include "extend_service_manager.h"
+#include "transaction/rs_interfaces.h"
+#include "vsync_receiver.h"
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    const std::string VSYNC_RECEIVER_NAME = "accessibility_magnification";
+
+    void ApplyMagnificationUpdate(const MagnificationUpdate &update)
+    {
+        if (update.hasScale) {
+            MagnificationWindow::GetInstance().SetScale(update.magnificationType, update.scaleSpan);
+        }
+        if (update.hasMove) {
+            MagnificationWindow::GetInstance().MoveMagnification(update.magnificationType, update.deltaX,
+                update.deltaY);
+        }
+    }
+
+    std::shared_ptr<Rosen::VSyncReceiver> CreateVsyncReceiver(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
+    {
+        if (runner == nullptr) {
+            return nullptr;
+        }
+        // vsync callbacks run on the input runner, like the gesture timers and the input events
+        std::shared_ptr<AppExecFwk::EventHandler> handler = std::make_shared<AppExecFwk::EventHandler>(runner);
+        std::shared_ptr<Rosen::VSyncReceiver> receiver =
+            Rosen::RSInterfaces::GetInstance().CreateVSyncReceiver(VSYNC_RECEIVER_NAME, handler);
+        if (receiver == nullptr || receiver->Init() != VSYNC_ERROR_OK) {
+            HILOG_WARN("no vsync receiver, magnification updates are paced by timer.");
+            return nullptr;
+        }
+        return receiver;
+    }
+
+    bool RequestNextVsync(const std::shared_ptr<Rosen::VSyncReceiver> &receiver, const std::function<void()> &callback)
+    {
+        if (receiver == nullptr) {
+            return false;
+        }
+        Rosen::VSyncReceiver::FrameCallback frameCallback = {
+            .userData_ = nullptr,
+            .callback_ = [callback](int64_t timestamp, void *) {
+                MagnificationWindow::GetInstance().OnVsync(timestamp);
+                callback();
+            },
+        };
+        return receiver->RequestNextVSync(frameCallback) == VSYNC_ERROR_OK;
+    }
+} // namespace
+
 std::shared_ptr<MagnificationManager> MagnificationManager::instance_ = nullptr;
 ffrt::mutex MagnificationManager::instanceMutex_;
 std::shared_ptr<MagnificationManager> MagnificationManager::GetInstance()
@@ -98,6 +146,60 @@ std::shared_ptr<MagnificationMenuManager> MagnificationManager::GetMenuManager()
     return menuManager_;
 }
 
+std::shared_ptr<MagnificationUpdateScheduler> MagnificationManager::GetUpdateScheduler()
+{
+    std::lock_guard<ffrt::mutex> lock(updateSchedulerMutex_);
+    if (updateScheduler_ == nullptr) {
+        auto interceptor = AccessibilityInputInterceptor::GetInstance();
+        if (interceptor == nullptr) {
+            HILOG_ERROR("interceptor is nullptr.");
+            return nullptr;
+        }
+        std::shared_ptr<Rosen::VSyncReceiver> receiver = CreateVsyncReceiver(interceptor->GetInputManagerRunner());
+        updateScheduler_ = std::make_shared<MagnificationUpdateScheduler>(interceptor->GetGestureTimerWheel(),
+            ApplyMagnificationUpdate, [receiver](const std::function<void()> &callback) {
+                return RequestNextVsync(receiver, callback);
+            });
+    }
+    return updateScheduler_;
+}
+
+std::shared_ptr<MagnificationUpdateScheduler> MagnificationManager::FindUpdateScheduler()
+{
+    std::lock_guard<ffrt::mutex> lock(updateSchedulerMutex_);
+    return updateScheduler_;
+}
+
+std::shared_ptr<MagnificationFocusFollower> MagnificationManager::GetFocusFollower()
+{
+    std::lock_guard<ffrt::mutex> lock(focusFollowerMutex_);
+    if (focusFollower_ == nullptr) {
+        auto interceptor = AccessibilityInputInterceptor::GetInstance();
+        if (interceptor == nullptr) {
+            HILOG_ERROR("interceptor is nullptr.");
+            return nullptr;
+        }
+        focusFollower_ = std::make_shared<MagnificationFocusFollower>(interceptor->GetGestureTimerWheel(),
+            [this](uint32_t magnificationType, MagnificationRect &rect) {
+                if (!IsMagnificationWindowShow(magnificationType)) {
+                    return false;
+                }
+                rect = MagnificationWindow::GetInstance().GetSourceRect();
+                return true;
+            },
+            [this](uint32_t magnificationType, int32_t centerX, int32_t centerY) {
+                MoveToFocus(magnificationType, centerX, centerY);
+            });
+    }
+    return focusFollower_;
+}
+
+std::shared_ptr<MagnificationFocusFollower> MagnificationManager::FindFocusFollower()
+{
+    std::lock_guard<ffrt::mutex> lock(focusFollowerMutex_);
+    return focusFollower_;
+}
+
 void MagnificationManager::OnMagnificationTypeChanged(uint32_t magnificationType)
 {
     HILOG_INFO("magnificationType = %{public}d, currentMode_ = %{public}d", magnificationType, currentMode_);
@@ -276,23 +378,45 @@ void MagnificationManager::RefreshWindowParam(RotationType type)
 void MagnificationManager::FollowFocuseElement(int32_t centerX, int32_t centerY)
 {
     currentMode_ = Singleton<ExtendServiceManager>::GetInstance().getMagnificationModeCallback();
-    HILOG_INFO("currentMode_ is %{public}d", currentMode_);
+    HILOG_DEBUG("currentMode_ is %{public}d", currentMode_);
     if (windowMagnificationManager_ == nullptr) {
         windowMagnificationManager_ = std::make_shared<WindowMagnificationManager>();
     }
     if (fullScreenMagnificationManager_ == nullptr) {
         fullScreenMagnificationManager_ = std::make_shared<FullScreenMagnificationManager>();
     }
-    if (currentMode_ == WINDOW_MAGNIFICATION && windowMagnificationManager_ != nullptr) {
-        if (windowMagnificationManager_->IsMagnificationWindowShow()) {
-            windowMagnificationManager_->FollowFocuseElement(centerX, centerY);
-        }
+    if (!IsMagnificationWindowShow(currentMode_)) {
+        return;
     }
+    std::shared_ptr<MagnificationFocusFollower> focusFollower = GetFocusFollower();
+    if (focusFollower == nullptr) {
+        MoveToFocus(currentMode_, centerX, centerY);
+        return;
+    }
+    focusFollower->OnFocus(currentMode_, centerX, centerY);
+}
 
-    if (currentMode_ == FULL_SCREEN_MAGNIFICATION && fullScreenMagnificationManager_ != nullptr) {
-        if (fullScreenMagnificationManager_->IsMagnificationWindowShow()) {
-            fullScreenMagnificationManager_->FollowFocuseElement(centerX, centerY);
-        }
+bool MagnificationManager::IsMagnificationWindowShow(uint32_t magnificationType)
+{
+    if (magnificationType == WINDOW_MAGNIFICATION && windowMagnificationManager_ != nullptr) {
+        return windowMagnificationManager_->IsMagnificationWindowShow();
+    }
+    if (magnificationType == FULL_SCREEN_MAGNIFICATION && fullScreenMagnificationManager_ != nullptr) {
+        return fullScreenMagnificationManager_->IsMagnificationWindowShow();
+    }
+    return false;
+}
+
+void MagnificationManager::MoveToFocus(uint32_t magnificationType, int32_t centerX, int32_t centerY)
+{
+    // the animation frames land asynchronously, the magnification may be gone or switched meanwhile
+    if (!IsMagnificationWindowShow(magnificationType)) {
+        return;
+    }
+    if (magnificationType == WINDOW_MAGNIFICATION) {
+        windowMagnificationManager_->FollowFocuseElement(centerX, centerY);
+    } else {
+        fullScreenMagnificationManager_->FollowFocuseElement(centerX, centerY);
     }
 }
 } // namespace Accessibility
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "magnification_update_scheduler.h"
+
+#include <algorithm>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+MagnificationUpdateScheduler::MagnificationUpdateScheduler(const std::shared_ptr<GestureTimerWheel> &wheel,
+    Applier applier, VsyncRequester vsyncRequester)
+    : wheel_(wheel), applier_(std::move(applier)), vsyncRequester_(std::move(vsyncRequester)),
+      fallbackTimer_([this]() { ApplyPending(ApplyReason::TIMER); })
+{
+    HILOG_DEBUG();
+}
+
+MagnificationUpdateScheduler::~MagnificationUpdateScheduler()
+{
+    HILOG_DEBUG();
+    if (wheel_) {
+        wheel_->Cancel(fallbackTimer_);
+    }
+}
+
+void MagnificationUpdateScheduler::PostScale(uint32_t magnificationType, float scaleSpan)
+{
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    if (!PrepareLocked(magnificationType)) {
+        lock.unlock();
+        ApplyPending(ApplyReason::FLUSH);
+        lock.lock();
+        PrepareLocked(magnificationType);
+    }
+    pending_.hasScale = true;
+    pending_.scaleSpan += scaleSpan;
+    statistics_.postCount++;
+    bool scheduled = frameRequested_;
+    lock.unlock();
+
+    if (!scheduled) {
+        ApplyPending(ApplyReason::FLUSH);
+    }
+}
+
+void MagnificationUpdateScheduler::PostMove(uint32_t magnificationType, int32_t deltaX, int32_t deltaY)
+{
+    std::unique_lock<ffrt::mutex> lock(mutex_);
+    if (!PrepareLocked(magnificationType)) {
+        lock.unlock();
+        ApplyPending(ApplyReason::FLUSH);
+        lock.lock();
+        PrepareLocked(magnificationType);
+    }
+    pending_.hasMove = true;
+    pending_.deltaX += deltaX;
+    pending_.deltaY += deltaY;
+    statistics_.postCount++;
+    bool scheduled = frameRequested_;
+    lock.unlock();
+
+    if (!scheduled) {
+        ApplyPending(ApplyReason::FLUSH);
+    }
+}
+
+void MagnificationUpdateScheduler::Flush()
+{
+    ApplyPending(ApplyReason::FLUSH);
+}
+
+void MagnificationUpdateScheduler::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    hasPending_ = false;
+    frameRequested_ = false;
+    if (wheel_) {
+        wheel_->Cancel(fallbackTimer_);
+    }
+}
+
+bool MagnificationUpdateScheduler::IsMovePending()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return hasPending_ && pending_.hasMove;
+}
+
+MagnificationUpdateStatistics MagnificationUpdateScheduler::GetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void MagnificationUpdateScheduler::ResetStatistics()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    statistics_ = {};
+}
+
+void MagnificationUpdateScheduler::Dump(std::string &dumpInfo)
+{
+    MagnificationUpdateStatistics statistics = GetStatistics();
+    int64_t avgLatencyMs = statistics.applyCount == 0 ? 0 :
+        statistics.totalLatencyMs / static_cast<int64_t>(statistics.applyCount);
+    dumpInfo.append("magnification updates: posts=").append(std::to_string(statistics.postCount))
+        .append(" applies=").append(std::to_string(statistics.applyCount))
+        .append(" vsync=").append(std::to_string(statistics.vsyncApplyCount))
+        .append(" timer=").append(std::to_string(statistics.timerApplyCount))
+        .append(" avgLatencyMs=").append(std::to_string(avgLatencyMs))
+        .append(" maxLatencyMs=").append(std::to_string(statistics.maxLatencyMs))
+        .append("\n");
+}
+
+bool MagnificationUpdateScheduler::PrepareLocked(uint32_t magnificationType)
+{
+    if (hasPending_) {
+        return pending_.magnificationType == magnificationType;
+    }
+    pending_ = {};
+    pending_.magnificationType = magnificationType;
+    pending_.postTime = wheel_ ? wheel_->GetCurrentTime() : 0;
+    hasPending_ = true;
+    ScheduleLocked();
+    return true;
+}
+
+void MagnificationUpdateScheduler::ScheduleLocked()
+{
+    if (frameRequested_) {
+        return;
+    }
+    // the requester only queues the callback, it never runs it under this lock
+    bool hasVsync = vsyncRequester_ && vsyncRequester_([this]() { ApplyPending(ApplyReason::VSYNC); });
+    if (!wheel_) {
+        frameRequested_ = hasVsync;
+        return;
+    }
+    frameRequested_ = true;
+    wheel_->Arm(fallbackTimer_, hasVsync ? VSYNC_TIMEOUT_MS : FRAME_INTERVAL_MS);
+}
+
+void MagnificationUpdateScheduler::ApplyPending(ApplyReason reason)
+{
+    MagnificationUpdate update;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (reason != ApplyReason::FLUSH) {
+            frameRequested_ = false;
+        }
+        if (!hasPending_) {
+            return;
+        }
+        update = pending_;
+        hasPending_ = false;
+        frameRequested_ = false;
+        if (wheel_) {
+            wheel_->Cancel(fallbackTimer_);
+        }
+
+        int64_t latencyMs = wheel_ ? std::max<int64_t>(wheel_->GetCurrentTime() - update.postTime, 0) : 0;
+        statistics_.applyCount++;
+        statistics_.totalLatencyMs += latencyMs;
+        statistics_.maxLatencyMs = std::max(statistics_.maxLatencyMs, latencyMs);
+        if (reason == ApplyReason::VSYNC) {
+            statistics_.vsyncApplyCount++;
+        } else if (reason == ApplyReason::TIMER) {
+            statistics_.timerApplyCount++;
+        }
+    }
+
+    if (applier_) {
+        applier_(update);
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 // LCOV_EXCL_START
 #include "magnification_window.h"
+#include <algorithm>
+#include <ctime>
 #include "visibility.h"
 
 namespace OHOS {
@@ -22,6 +24,9 @@ namespace Accessibility {
 
 namespace {
 const std::string WINDOW_NAME = "magnification_window";
+constexpr int64_t FRAME_RATE = 60;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int64_t FRAME_PERIOD_NS = NS_PER_SECOND / FRAME_RATE;
 }
 
 MagnificationWindow& MagnificationWindow::GetInstance()
@@ -39,6 +44,12 @@ PointerPos MagnificationWindow::GetSourceCenter()
     return point;
 }
 
+MagnificationRect MagnificationWindow::GetSourceRect()
+{
+    return {sourceRect_.posX_, sourceRect_.posY_, static_cast<int32_t>(sourceRect_.width_),
+        static_cast<int32_t>(sourceRect_.height_)};
+}
+
 PointerPos MagnificationWindow::ConvertCoordinates(int32_t posX, int32_t posY)
 {
     PointerPos sourcePoint = {0, 0};
@@ -108,12 +119,87 @@ void MagnificationWindow::GetWindowParam()
 
 void MagnificationWindow::FlushImplicitTransaction()
 {
-    if (rsUIContext_ != nullptr) {
-        auto rsTransaction = rsUIContext_->GetRSTransaction();
-        if (rsTransaction != nullptr) {
-            rsTransaction->FlushImplicitTransaction();
-        }
+    if (rsUIContext_ == nullptr) {
+        return;
+    }
+    auto rsTransaction = rsUIContext_->GetRSTransaction();
+    if (rsTransaction == nullptr) {
+        return;
+    }
+    rsTransaction->FlushImplicitTransaction();
+
+    transactionCount_.fetch_add(1, std::memory_order_relaxed);
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    int64_t frameSlot = GetFrameSlot(static_cast<int64_t>(times.tv_sec) * NS_PER_SECOND + times.tv_nsec);
+    if (frameSlot != lastFrameSlot_) {
+        lastFrameSlot_ = frameSlot;
+        lastFrameTransactionCount_ = 0;
+        activeFrameCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    lastFrameTransactionCount_++;
+    if (lastFrameTransactionCount_ > maxTransactionsPerFrame_.load(std::memory_order_relaxed)) {
+        maxTransactionsPerFrame_.store(lastFrameTransactionCount_, std::memory_order_relaxed);
+    }
+}
+
+int64_t MagnificationWindow::GetFrameSlot(int64_t now) const
+{
+    int64_t vsyncTimestamp = vsyncTimestamp_.load(std::memory_order_relaxed);
+    if (vsyncTimestamp <= 0) {
+        // no vsync source, the slots are only aligned to the clock
+        return now - now % FRAME_PERIOD_NS;
     }
+    // a slot starts at the vsync the transaction is flushed after, vsyncs are only requested while
+    // updates are pending so the intervals past the last one are extended from its timestamp
+    int64_t elapsed = std::max<int64_t>(now - vsyncTimestamp, 0);
+    return vsyncTimestamp + elapsed - elapsed % FRAME_PERIOD_NS;
+}
+
+void MagnificationWindow::OnVsync(int64_t timestamp)
+{
+    vsyncTimestamp_.store(timestamp, std::memory_order_relaxed);
+}
+
+bool MagnificationWindow::IsFrameRetained(uint32_t magnificationType, uint32_t width, uint32_t height) const
+{
+    return frameType_ == magnificationType && frameWidth_ == width && frameHeight_ == height;
+}
+
+void MagnificationWindow::RetainFrame(uint32_t magnificationType, uint32_t width, uint32_t height)
+{
+    frameType_ = magnificationType;
+    frameWidth_ = width;
+    frameHeight_ = height;
+    frameRecordCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+MagnificationRenderStatistics MagnificationWindow::GetRenderStatistics() const
+{
+    MagnificationRenderStatistics statistics;
+    statistics.transactionCount = transactionCount_.load(std::memory_order_relaxed);
+    statistics.frameRecordCount = frameRecordCount_.load(std::memory_order_relaxed);
+    statistics.activeFrameCount = activeFrameCount_.load(std::memory_order_relaxed);
+    statistics.maxTransactionsPerFrame = maxTransactionsPerFrame_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void MagnificationWindow::ResetRenderStatistics()
+{
+    transactionCount_.store(0, std::memory_order_relaxed);
+    frameRecordCount_.store(0, std::memory_order_relaxed);
+    activeFrameCount_.store(0, std::memory_order_relaxed);
+    maxTransactionsPerFrame_.store(0, std::memory_order_relaxed);
+}
+
+void MagnificationWindow::DumpRenderStatistics(std::string &dumpInfo) const
+{
+    MagnificationRenderStatistics statistics = GetRenderStatistics();
+    dumpInfo.append("magnification render: transactions=").append(std::to_string(statistics.transactionCount))
+        .append(" frameRecords=").append(std::to_string(statistics.frameRecordCount))
+        .append(" activeFrames=").append(std::to_string(statistics.activeFrameCount))
+        .append(" maxTransactionsPerFrame=").append(std::to_string(statistics.maxTransactionsPerFrame))
+        .append("\n");
 }
 
 PointerPos MagnificationWindow::GetRectCenter(Rosen::Rect rect)
@@ -169,6 +255,9 @@ void MagnificationWindow::DisableMagnification(bool needClear)
     surfaceNode_ = nullptr;
     canvasNode_ = nullptr;
     rsUIContext_ = nullptr;
+    frameType_ = 0;
+    frameWidth_ = 0;
+    frameHeight_ = 0;
 }
 
 // full magnification
@@ -246,6 +335,9 @@ void MagnificationWindow::UpdateAnchor()
 
 void MagnificationWindow::DrawRuoundRectFrameFull()
 {
+    if (IsFrameRetained(FULL_SCREEN_MAGNIFICATION, screenWidth_, screenHeight_)) {
+        return;
+    }
     if (surfaceNode_ == nullptr) {
         HILOG_ERROR("get surfaceNode_ failed.");
         return;
@@ -281,6 +373,7 @@ void MagnificationWindow::DrawRuoundRectFrameFull()
     canvas->DrawPath(path);
     canvas->DetachPen();
     canvasNode_->FinishRecording();
+    RetainFrame(FULL_SCREEN_MAGNIFICATION, screenWidth_, screenHeight_);
 }
 
 void MagnificationWindow::EnableMagnificationFull(int32_t centerX, int32_t centerY)
@@ -570,6 +663,9 @@ void MagnificationWindow::FixSourceCenter(bool needFix)
 
 void MagnificationWindow::DrawRuoundRectFramePart()
 {
+    if (IsFrameRetained(WINDOW_MAGNIFICATION, windowWidth_, windowHeight_)) {
+        return;
+    }
     if (surfaceNode_ == nullptr) {
         HILOG_ERROR("get surfaceNode_ failed.");
         return;
@@ -623,6 +719,7 @@ void MagnificationWindow::DrawRuoundRectFramePart()
     canvas->DrawCircle(p2, static_cast<float>(PEN_WIDTH / DIVISOR_TWO));
     canvas->DetachBrush();
     canvasNode_->FinishRecording();
+    RetainFrame(WINDOW_MAGNIFICATION, windowWidth_, windowHeight_);
 }
 
 void MagnificationWindow::EnableMagnificationPart(int32_t centerX, int32_t centerY)
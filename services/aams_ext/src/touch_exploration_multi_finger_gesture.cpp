@@ -14,6 +14,7 @@
  */
 
 #include "accessibility_touch_exploration.h"
+#include "accessibility_pointer_geometry.h"
 #include "accessibility_event_info.h"
 #include "hilog_wrapper.h"
 #include "securec.h"
@@ -488,17 +489,11 @@ void TouchExploration::HandleTwoFingersDragStateMove(MMI::PointerEvent &event)
     int32_t miniZoomPointerDistance = static_cast<int32_t>(MINI_POINTER_DISTANCE_DIP * 1);
 #endif
 
-    MMI::PointerEvent::PointerItem pointerF {};
-    MMI::PointerEvent::PointerItem pointerS {};
-    event.GetPointerItem(pIds[0], pointerF);
-    event.GetPointerItem(pIds[1], pointerS);
-    float xPointF = pointerF.GetDisplayX();
-    float xPointS = pointerS.GetDisplayX();
-    float yPointF = pointerF.GetDisplayY();
-    float yPointS = pointerS.GetDisplayY();
-    float offsetX = abs(xPointF - xPointS);
-    float offsetY = abs(yPointF - yPointS);
-    double duration = hypot(offsetX, offsetY);
+    PointerGeometry geometry;
+    geometry.Load(event);
+    float offsetX = abs(geometry.GetX(0) - geometry.GetX(1));
+    float offsetY = abs(geometry.GetY(0) - geometry.GetY(1));
+    double duration = geometry.GetSeparation(0, 1);
     if (duration > miniZoomPointerDistance) {
         // Adjust this event's location.
         MMI::PointerEvent::PointerItem pointer {};
@@ -553,38 +548,21 @@ bool TouchExploration::IsMultiFingerMultiTap(MMI::PointerEvent &event, const uin
         return false;
     }
 
-    std::vector<int32_t> excludePid(fingerNum, -1);
-    for (auto curPoint : curPoints) {
-        float moveDelta = FLT_MAX;
-        int32_t nearestPid = -1;
-        int32_t curX = curPoint.GetDisplayX();
-        int32_t curY = curPoint.GetDisplayY();
-        for (auto prePoint : prePoints) {
-            int32_t pId = prePoint.GetPointerId();
-            if (std::find(excludePid.begin(), excludePid.end(), pId) != excludePid.end()) {
-                continue;
-            }
-            int32_t preX = prePoint.GetDisplayX();
-            int32_t preY = prePoint.GetDisplayY();
-            int32_t offsetX = curX - preX;
-            int32_t offsetY = curY - preY;
-            if (offsetX == 0 && offsetY == 0) {
-                nearestPid = pId;
-                moveDelta = 0;
-                break;
-            }
+    PointerGeometry preGeometry;
+    for (auto &prePoint : prePoints) {
+        preGeometry.Add(prePoint.GetPointerId(), prePoint.GetDisplayX(), prePoint.GetDisplayY(), 0, 0);
+    }
 
-            float delta = hypot(offsetX, offsetY);
-            if (delta < moveDelta) {
-                moveDelta = delta;
-                nearestPid = pId;
-            }
-        }
-        if (moveDelta < multiTapOffsetThresh_ * fingerNum) {
-            excludePid.push_back(nearestPid);
-        } else {
+    // every finger has to land near a finger of the last tap which no other finger took
+    uint32_t excludeMask = 0;
+    for (auto &curPoint : curPoints) {
+        float moveDelta = FLT_MAX;
+        size_t nearest = preGeometry.FindNearest(static_cast<float>(curPoint.GetDisplayX()),
+            static_cast<float>(curPoint.GetDisplayY()), excludeMask, moveDelta);
+        if (nearest == PointerGeometry::INVALID_INDEX || moveDelta >= multiTapOffsetThresh_ * fingerNum) {
             return false;
         }
+        excludeMask |= 1u << nearest;
     }
 
     return true;
@@ -32,7 +32,6 @@
 namespace OHOS {
 namespace Accessibility {
 namespace {
-    const char* AAMS_GESTURE_RUNNER_NAME = "AamsGestureRunner";
 }
 
 void TouchExploration::InitOneFingerGestureFuncMap()
@@ -78,7 +77,7 @@ void TouchExploration::InitOneFingerGestureFuncMap()
 }
 
 TouchExplorationEventHandler::TouchExplorationEventHandler(
-    const std::shared_ptr<AppExecFwk::EventRunner> &runner, TouchExploration &server): AppExecFwk::EventHandler(runner),
+    const std::shared_ptr<GestureTimerWheel> &wheel, TouchExploration &server): GestureTimerHandler(wheel),
     server_(server)
 {
 }
@@ -162,28 +161,20 @@ TouchExploration::TouchExploration()
 
 void TouchExploration::StartUp()
 {
-    runner_ = AccessibilityInputInterceptor::GetInstance()->GetInputManagerRunner();
-    if (!runner_) {
-        HILOG_ERROR("get runner failed");
+    std::shared_ptr<GestureTimerWheel> wheel = AccessibilityInputInterceptor::GetInstance()->GetGestureTimerWheel();
+    if (!wheel) {
+        HILOG_ERROR("get gesture timer wheel failed");
         return;
     }
 
-    handler_ = std::make_shared<TouchExplorationEventHandler>(runner_, *this);
+    handler_ = std::make_shared<TouchExplorationEventHandler>(wheel, *this);
     if (!handler_) {
         HILOG_ERROR("create event handler failed");
         return;
     }
 
-    if (!gestureRunner_) {
-        gestureRunner_ = AppExecFwk::EventRunner::Create(AAMS_GESTURE_RUNNER_NAME, AppExecFwk::ThreadMode::FFRT);
-        if (!gestureRunner_) {
-            HILOG_ERROR("TouchExploration::StartUp failed:create AAMS gesture runner failed");
-            return;
-        }
-    }
-
     gestureHandler_ = std::make_shared<AppExecFwk::EventHandler>(
-        Singleton<ExtendServiceManager>::GetInstance().GetGestureRunner()); // runner没释放 gestureRunner_.reset();
+        Singleton<ExtendServiceManager>::GetInstance().GetGestureRunner());
 }
 
 bool TouchExploration::OnPointerEvent(MMI::PointerEvent &event)
@@ -106,6 +106,7 @@ MagnificationGestureEventHandler::MagnificationGestureEventHandler(
 void MagnificationGestureEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
 {
     HILOG_DEBUG();
+    std::lock_guard<ffrt::mutex> lock(AccessibilityInputInterceptor::GetInstance()->GetDispatchMutex());
 
     MagnificationGestureMsg msg = static_cast<MagnificationGestureMsg>(event->GetInnerEventId());
     int64_t param = event->GetParam();
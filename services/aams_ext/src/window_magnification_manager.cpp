@@ -21,20 +21,58 @@
 #include "magnification_def.h"
 #include "magnification_window.h"
 #include "extend_service_manager.h"
+#include "magnification_manager.h"
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    std::shared_ptr<MagnificationUpdateScheduler> GetUpdateScheduler()
+    {
+        return MagnificationManager::GetInstance()->GetUpdateScheduler();
+    }
+
+    // pan and zoom samples are coalesced per frame, apply them before anything else touches the window
+    void FlushMagnificationUpdates()
+    {
+        std::shared_ptr<MagnificationUpdateScheduler> scheduler =
+            MagnificationManager::GetInstance()->FindUpdateScheduler();
+        if (scheduler != nullptr) {
+            scheduler->Flush();
+        }
+    }
+
+    void ClearMagnificationUpdates()
+    {
+        std::shared_ptr<MagnificationUpdateScheduler> scheduler =
+            MagnificationManager::GetInstance()->FindUpdateScheduler();
+        if (scheduler != nullptr) {
+            scheduler->Clear();
+        }
+    }
+
+    // runs on every pan sample, cheap unless the region is following a focus
+    void StopFocusFollowing()
+    {
+        std::shared_ptr<MagnificationFocusFollower> focusFollower =
+            MagnificationManager::GetInstance()->FindFocusFollower();
+        if (focusFollower != nullptr && focusFollower->IsFollowing()) {
+            focusFollower->Cancel();
+        }
+    }
+} // namespace
 
 void WindowMagnificationManager::EnableWindowMagnification(int32_t centerX, int32_t centerY)
 {
     HILOG_INFO("centerX = %{public}d, centerY = %{public}d.", centerX, centerY);
     float scale = Singleton<ExtendServiceManager>::GetInstance().getMagnificationScaleCallback();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().InitMagnificationParam(scale);
     MagnificationWindow::GetInstance().EnableMagnification(WINDOW_MAGNIFICATION, centerX, centerY);
 }
 
 void WindowMagnificationManager::ShowWindowMagnification()
 {
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().ShowMagnification(WINDOW_MAGNIFICATION);
 }
 
@@ -50,6 +88,8 @@ void WindowMagnificationManager::ShowWindowMagnificationWithPosition(PointerPos
 void WindowMagnificationManager::DisableWindowMagnification(bool needClear)
 {
     HILOG_INFO();
+    StopFocusFollowing();
+    ClearMagnificationUpdates();
     std::lock_guard<ffrt::mutex> lock(mutex_);
     MagnificationWindow::GetInstance().DisableMagnification(WINDOW_MAGNIFICATION, needClear);
 }
@@ -57,43 +97,66 @@ void WindowMagnificationManager::DisableWindowMagnification(bool needClear)
 void WindowMagnificationManager::SetScale(float deltaSpan)
 {
     HILOG_DEBUG();
-    MagnificationWindow::GetInstance().SetScale(WINDOW_MAGNIFICATION, deltaSpan);
+    std::shared_ptr<MagnificationUpdateScheduler> scheduler = GetUpdateScheduler();
+    if (scheduler == nullptr) {
+        MagnificationWindow::GetInstance().SetScale(WINDOW_MAGNIFICATION, deltaSpan);
+        return;
+    }
+    scheduler->PostScale(WINDOW_MAGNIFICATION, deltaSpan);
 }
 
 void WindowMagnificationManager::MoveMagnificationWindow(int32_t deltaX, int32_t deltaY)
 {
-    MagnificationWindow::GetInstance().MoveMagnification(WINDOW_MAGNIFICATION, deltaX, deltaY);
+    // the user pans, stop moving the region to the focus
+    StopFocusFollowing();
+    std::shared_ptr<MagnificationUpdateScheduler> scheduler = GetUpdateScheduler();
+    if (scheduler == nullptr) {
+        MagnificationWindow::GetInstance().MoveMagnification(WINDOW_MAGNIFICATION, deltaX, deltaY);
+        return;
+    }
+    scheduler->PostMove(WINDOW_MAGNIFICATION, deltaX, deltaY);
 }
 
 bool WindowMagnificationManager::IsTapOnHotArea(int32_t posX, int32_t posY)
 {
+    FlushMagnificationUpdates();
     return MagnificationWindow::GetInstance().IsTapOnHotArea(posX, posY);
 }
 
 void WindowMagnificationManager::RefreshWindowParam(RotationType type)
 {
     HILOG_DEBUG();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().RefreshWindowParam(WINDOW_MAGNIFICATION, type);
 }
 
 bool WindowMagnificationManager::IsTapOnMagnificationWindow(int32_t posX, int32_t posY)
 {
+    FlushMagnificationUpdates();
     return MagnificationWindow::GetInstance().IsTapOnMagnificationWindow(posX, posY);
 }
 
 PointerPos WindowMagnificationManager::ConvertCoordinates(int32_t posX, int32_t posY)
 {
+    FlushMagnificationUpdates();
     PointerPos pos = {posX, posY};
     return MagnificationWindow::GetInstance().ConvertCoordinates(posX, posY);
 }
 
 void WindowMagnificationManager::FixSourceCenter(bool needFix)
 {
+    // a pending scale keeps coalescing around the fixed center, anything else has to land first
+    std::shared_ptr<MagnificationUpdateScheduler> scheduler =
+        MagnificationManager::GetInstance()->FindUpdateScheduler();
+    if (scheduler != nullptr && (!needFix || scheduler->IsMovePending())) {
+        scheduler->Flush();
+    }
     MagnificationWindow::GetInstance().FixSourceCenter(needFix);
 }
 
 void WindowMagnificationManager::PersistScale()
 {
+    FlushMagnificationUpdates();
     float scale = MagnificationWindow::GetInstance().GetScale();
     HILOG_DEBUG("scale = %{public}f", scale);
     Singleton<ExtendServiceManager>::GetInstance().magnificationScaleCallback(scale);
@@ -103,6 +166,7 @@ void WindowMagnificationManager::PersistScale()
 
 PointerPos WindowMagnificationManager::GetSourceCenter()
 {
+    FlushMagnificationUpdates();
     PointerPos pos = {0, 0};
     return MagnificationWindow::GetInstance().GetSourceCenter();
 }
@@ -110,6 +174,7 @@ PointerPos WindowMagnificationManager::GetSourceCenter()
 void WindowMagnificationManager::FollowFocuseElement(int32_t centerX, int32_t centerY)
 {
     HILOG_DEBUG();
+    FlushMagnificationUpdates();
     MagnificationWindow::GetInstance().FollowFocuseElement(WINDOW_MAGNIFICATION, centerX, centerY);
 }
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "accessibility_dwell_detector.h"
+#include "pointer_event.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr double MS_PER_SECOND = 1000.0;
+    constexpr int64_t DWELL_DELAY_MS = 1000;
+    constexpr int64_t GLIDE_DURATION_MS = 500;
+    constexpr int64_t REST_DURATION_MS = 1500;
+    constexpr int32_t GLIDE_COUNT = 5;
+    constexpr int32_t JITTER_PERIOD = 4;
+    constexpr int32_t JITTER_PX = 2;
+    constexpr int32_t TOLERANCE_PX = 3;
+    constexpr uint32_t AUTOCLICK_TIMEOUT_MSG = 1;
+
+    struct MouseSample {
+        int64_t timeMs = 0;
+        int32_t posX = 0;
+        int32_t posY = 0;
+    };
+
+    /**
+     * A mouse which glides across the screen and then rests on a target with a little hand jitter,
+     * sampled once a millisecond like a high rate gaming mouse.
+     */
+    std::vector<MouseSample> CreateMouseTrace()
+    {
+        std::vector<MouseSample> samples;
+        int64_t timeMs = 0;
+        int32_t posX = 0;
+        int32_t posY = 0;
+        for (int32_t glide = 0; glide < GLIDE_COUNT; glide++) {
+            for (int64_t i = 0; i < GLIDE_DURATION_MS; i++) {
+                posX++;
+                posY++;
+                samples.push_back({timeMs++, posX, posY});
+            }
+            for (int64_t i = 0; i < REST_DURATION_MS; i++) {
+                int32_t jitter = (i % JITTER_PERIOD < JITTER_PERIOD / 2) ? JITTER_PX : 0;
+                samples.push_back({timeMs++, posX + jitter, posY});
+            }
+        }
+        return samples;
+    }
+
+    /**
+     * The autoclick before the dwell detector, which copied every move and rescheduled its timeout.
+     */
+    class PerMoveAutoclick : public GestureTimerHandler {
+    public:
+        explicit PerMoveAutoclick(const std::shared_ptr<GestureTimerWheel> &wheel) : GestureTimerHandler(wheel) {}
+
+        void OnMove(const OHOS::MMI::PointerEvent &event, int32_t posX, int32_t posY)
+        {
+            if (lastEvent_ && posX == lastX_ && posY == lastY_) {
+                return;
+            }
+            lastEvent_ = std::make_shared<OHOS::MMI::PointerEvent>(event);
+            lastX_ = posX;
+            lastY_ = posY;
+            RemoveEvent(AUTOCLICK_TIMEOUT_MSG);
+            SendEvent(AUTOCLICK_TIMEOUT_MSG, 0, DWELL_DELAY_MS);
+            armCount++;
+        }
+
+        void ProcessEvent(const OHOS::AppExecFwk::InnerEvent::Pointer &event) override
+        {
+            lastEvent_ = nullptr;
+            dwellCount++;
+        }
+
+        uint64_t armCount = 0;
+        uint64_t dwellCount = 0;
+
+    private:
+        std::shared_ptr<OHOS::MMI::PointerEvent> lastEvent_ = nullptr;
+        int32_t lastX_ = 0;
+        int32_t lastY_ = 0;
+    };
+
+    /**
+     * @tc.name: BenchmarkTestForMouseTraceReplay
+     * @tc.desc: Testcase for replaying a 1000Hz mouse trace through the per move rescheduling autoclick and the
+     *           dwell detector with and without tolerance, reporting the timer arms per second and the dwells.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForMouseTraceReplay(benchmark::State &state)
+    {
+        std::vector<MouseSample> samples = CreateMouseTrace();
+        bool useDetector = state.range(0) != 0;
+        int32_t tolerance = static_cast<int32_t>(state.range(1));
+        std::shared_ptr<OHOS::MMI::PointerEvent> event = OHOS::MMI::PointerEvent::Create();
+        uint64_t armCount = 0;
+        uint64_t dwellCount = 0;
+
+        for (auto _ : state) {
+            int64_t nowMs = 0;
+            auto wheel = std::make_shared<GestureTimerWheel>([&nowMs]() { return nowMs; });
+            auto perMove = std::make_shared<PerMoveAutoclick>(wheel);
+            AccessibilityDwellDetector detector(wheel, [](int32_t posX, int32_t posY) {
+                benchmark::DoNotOptimize(posX + posY);
+            });
+            detector.SetTolerance(tolerance);
+
+            for (const auto &sample : samples) {
+                nowMs = sample.timeMs;
+                wheel->ProcessExpiredTimers();
+                if (useDetector) {
+                    detector.OnMove(sample.posX, sample.posY, DWELL_DELAY_MS);
+                } else {
+                    perMove->OnMove(*event, sample.posX, sample.posY);
+                }
+            }
+            nowMs += DWELL_DELAY_MS;
+            wheel->ProcessExpiredTimers();
+
+            DwellStatistics statistics = detector.GetStatistics();
+            armCount = useDetector ? statistics.armCount + statistics.rearmCount : perMove->armCount;
+            dwellCount = useDetector ? statistics.dwellCount : perMove->dwellCount;
+        }
+
+        double traceSeconds = static_cast<double>(samples.back().timeMs + DWELL_DELAY_MS) / MS_PER_SECOND;
+        state.counters["armsPerSecond"] = static_cast<double>(armCount) / traceSeconds;
+        state.counters["dwells"] = static_cast<double>(dwellCount);
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(samples.size()));
+    }
+
+    BENCHMARK(BenchmarkTestForMouseTraceReplay)
+        ->Args({0, 0})
+        ->Args({1, 0})
+        ->Args({1, TOLERANCE_PX})
+        ->ArgNames({"detector", "tolerance"})
+        ->ReportAggregatesOnly();
+}
+
+BENCHMARK_MAIN();
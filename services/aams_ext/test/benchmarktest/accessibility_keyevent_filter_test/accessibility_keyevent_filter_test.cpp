@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "accessibility_keyevent_pending_table.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int64_t TIMEOUT = 500;
+
+    void ApplyExtensionAndKeyCounts(benchmark::internal::Benchmark *benchmark)
+    {
+        for (int64_t extensionCount : {1, 4, 16}) {
+            for (int64_t keyCount : {16, 64, 256}) {
+                benchmark->Args({extensionCount, keyCount});
+            }
+        }
+    }
+
+    void CreatePendingEvents(KeyEventPendingTable &table, uint32_t &sequenceNum,
+        const std::vector<std::shared_ptr<OHOS::MMI::KeyEvent>> &events, const std::vector<int32_t> &connectionIds)
+    {
+        std::shared_ptr<OHOS::MMI::KeyEvent> evictedEvent = nullptr;
+        for (const auto &event : events) {
+            table.Insert(++sequenceNum, event, connectionIds, TIMEOUT, evictedEvent);
+        }
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForAcknowledge
+     * @tc.desc: Testcase for N extensions answering M in-flight key events which none of them handles.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForAcknowledge(benchmark::State &state)
+    {
+        std::vector<int32_t> connectionIds;
+        for (int32_t connectionId = 0; connectionId < state.range(0); connectionId++) {
+            connectionIds.push_back(connectionId);
+        }
+        std::vector<std::shared_ptr<OHOS::MMI::KeyEvent>> events;
+        for (int64_t i = 0; i < state.range(1); i++) {
+            events.push_back(OHOS::MMI::KeyEvent::Create());
+        }
+        KeyEventPendingTable table;
+        uint32_t sequenceNum = 0;
+        std::shared_ptr<OHOS::MMI::KeyEvent> unhandledEvent = nullptr;
+
+        for (auto _ : state) {
+            /* @tc.steps: step1.dispatch M key events to N extensions */
+            uint32_t firstSequenceNum = sequenceNum + 1;
+            CreatePendingEvents(table, sequenceNum, events, connectionIds);
+            /* @tc.steps: step2.every extension answers every key event in sequence order */
+            for (int32_t connectionId : connectionIds) {
+                for (uint32_t seq = firstSequenceNum; seq <= sequenceNum; seq++) {
+                    benchmark::DoNotOptimize(table.Acknowledge(connectionId, seq, false, unhandledEvent));
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForTimeout
+     * @tc.desc: Testcase for M in-flight key events to N extensions which all time out together.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForTimeout(benchmark::State &state)
+    {
+        std::vector<int32_t> connectionIds;
+        for (int32_t connectionId = 0; connectionId < state.range(0); connectionId++) {
+            connectionIds.push_back(connectionId);
+        }
+        std::vector<std::shared_ptr<OHOS::MMI::KeyEvent>> events;
+        for (int64_t i = 0; i < state.range(1); i++) {
+            events.push_back(OHOS::MMI::KeyEvent::Create());
+        }
+        KeyEventPendingTable table;
+        uint32_t sequenceNum = 0;
+        std::vector<std::shared_ptr<OHOS::MMI::KeyEvent>> expired;
+        expired.reserve(events.size());
+
+        for (auto _ : state) {
+            /* @tc.steps: step1.dispatch M key events to N extensions */
+            CreatePendingEvents(table, sequenceNum, events, connectionIds);
+            /* @tc.steps: step2.the single timer expires all of them */
+            expired.clear();
+            table.PopExpired(TIMEOUT, expired);
+            benchmark::DoNotOptimize(expired.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+
+    BENCHMARK(BenchmarkTestForAcknowledge)->Apply(ApplyExtensionAndKeyCounts)->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForTimeout)->Apply(ApplyExtensionAndKeyCounts)->ReportAggregatesOnly();
+}
+
+BENCHMARK_MAIN();
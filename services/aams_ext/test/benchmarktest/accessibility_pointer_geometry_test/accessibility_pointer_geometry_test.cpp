@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "accessibility_pointer_geometry.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int32_t CENTER = 1000;
+    constexpr int32_t RADIUS = 300;
+    constexpr int32_t EVENT_COUNT = 64;
+    constexpr int32_t MIN_POINTER_COUNT = 2;
+    constexpr int32_t MAX_POINTER_COUNT = 10;
+    constexpr float PI = 3.14159265f;
+
+    /**
+     * Pointers spread on a circle which grows a pixel per event, like the fingers of a pinch.
+     */
+    std::vector<std::shared_ptr<OHOS::MMI::PointerEvent>> CreatePinchEvents(int32_t pointerCount)
+    {
+        std::vector<std::shared_ptr<OHOS::MMI::PointerEvent>> events;
+        for (int32_t i = 0; i < EVENT_COUNT; i++) {
+            auto event = OHOS::MMI::PointerEvent::Create();
+            for (int32_t pointerId = 0; pointerId < pointerCount; pointerId++) {
+                float angle = 2.0f * PI * pointerId / pointerCount;
+                int32_t posX = CENTER + static_cast<int32_t>((RADIUS + i) * std::cos(angle));
+                int32_t posY = CENTER + static_cast<int32_t>((RADIUS + i) * std::sin(angle));
+                OHOS::MMI::PointerEvent::PointerItem item;
+                item.SetPointerId(pointerId);
+                item.SetDisplayX(posX);
+                item.SetDisplayY(posY);
+                item.SetRawDisplayX(posX);
+                item.SetRawDisplayY(posY);
+                event->AddPointerItem(item);
+            }
+            event->SetPointerAction(OHOS::MMI::PointerEvent::POINTER_ACTION_MOVE);
+            events.push_back(event);
+        }
+        return events;
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForPerPointerItemKernels
+     * @tc.desc: Testcase for the centroid, span and separation of a move the way the zoom gesture did it
+     *           before, every kernel fetching the pointer ids and copying every pointer item of the event.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForPerPointerItemKernels(benchmark::State &state)
+    {
+        auto events = CreatePinchEvents(static_cast<int32_t>(state.range(0)));
+        size_t index = 0;
+        for (auto _ : state) {
+            OHOS::MMI::PointerEvent &event = *events[index++ % events.size()];
+            float sumX = 0.0f;
+            float sumY = 0.0f;
+            std::vector<int32_t> pointerIds = event.GetPointerIds();
+            for (int32_t pointerId : pointerIds) {
+                OHOS::MMI::PointerEvent::PointerItem item;
+                event.GetPointerItem(pointerId, item);
+                sumX += static_cast<float>(item.GetRawDisplayX());
+                sumY += static_cast<float>(item.GetRawDisplayY());
+            }
+            float centerX = sumX / pointerIds.size();
+            float centerY = sumY / pointerIds.size();
+
+            float spanX = 0.0f;
+            float spanY = 0.0f;
+            pointerIds = event.GetPointerIds();
+            for (int32_t pointerId : pointerIds) {
+                OHOS::MMI::PointerEvent::PointerItem item;
+                event.GetPointerItem(pointerId, item);
+                spanX += std::fabs(item.GetRawDisplayX() - centerX);
+                spanY += std::fabs(item.GetRawDisplayY() - centerY);
+            }
+            benchmark::DoNotOptimize(std::hypot(spanX / pointerIds.size(), spanY / pointerIds.size()));
+
+            pointerIds = event.GetPointerIds();
+            OHOS::MMI::PointerEvent::PointerItem first;
+            OHOS::MMI::PointerEvent::PointerItem second;
+            event.GetPointerItem(pointerIds[0], first);
+            event.GetPointerItem(pointerIds[1], second);
+            benchmark::DoNotOptimize(std::hypot(second.GetDisplayX() - first.GetDisplayX(),
+                second.GetDisplayY() - first.GetDisplayY()));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForPointerGeometryKernels
+     * @tc.desc: Testcase for the same three kernels on a PointerGeometry loaded once per event.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForPointerGeometryKernels(benchmark::State &state)
+    {
+        auto events = CreatePinchEvents(static_cast<int32_t>(state.range(0)));
+        size_t index = 0;
+        PointerGeometry geometry;
+        for (auto _ : state) {
+            geometry.Load(*events[index++ % events.size()]);
+            float centerX = 0.0f;
+            float centerY = 0.0f;
+            geometry.GetCentroid(centerX, centerY, PointerCoordinate::RAW_DISPLAY);
+            float spanX = 0.0f;
+            float spanY = 0.0f;
+            geometry.GetMeanDeviation(centerX, centerY, spanX, spanY, PointerCoordinate::RAW_DISPLAY);
+            benchmark::DoNotOptimize(std::hypot(spanX, spanY));
+            benchmark::DoNotOptimize(geometry.GetSeparation(0, 1));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForPointerGeometryOnly
+     * @tc.desc: Testcase for the three kernels alone, without reading the event.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForPointerGeometryOnly(benchmark::State &state)
+    {
+        auto events = CreatePinchEvents(static_cast<int32_t>(state.range(0)));
+        PointerGeometry geometry;
+        geometry.Load(*events[0]);
+        for (auto _ : state) {
+            float centerX = 0.0f;
+            float centerY = 0.0f;
+            geometry.GetCentroid(centerX, centerY, PointerCoordinate::RAW_DISPLAY);
+            float spanX = 0.0f;
+            float spanY = 0.0f;
+            geometry.GetMeanDeviation(centerX, centerY, spanX, spanY, PointerCoordinate::RAW_DISPLAY);
+            benchmark::DoNotOptimize(std::hypot(spanX, spanY));
+            benchmark::DoNotOptimize(geometry.GetSeparation(0, 1));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BenchmarkTestForPerPointerItemKernels)
+        ->DenseRange(MIN_POINTER_COUNT, MAX_POINTER_COUNT, MIN_POINTER_COUNT)
+        ->ArgName("pointers")
+        ->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForPointerGeometryKernels)
+        ->DenseRange(MIN_POINTER_COUNT, MAX_POINTER_COUNT, MIN_POINTER_COUNT)
+        ->ArgName("pointers")
+        ->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForPointerGeometryOnly)
+        ->DenseRange(MIN_POINTER_COUNT, MAX_POINTER_COUNT, MIN_POINTER_COUNT)
+        ->ArgName("pointers")
+        ->ReportAggregatesOnly();
+}
+
+BENCHMARK_MAIN();
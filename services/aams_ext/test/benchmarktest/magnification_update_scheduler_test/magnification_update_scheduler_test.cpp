@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "accessibility_input_recorder.h"
+#include "magnification_def.h"
+#include "magnification_update_scheduler.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int64_t US_PER_MS = 1000;
+    constexpr int64_t US_PER_SECOND = 1000000;
+    constexpr double MS_PER_SECOND = 1000.0;
+    constexpr int64_t VSYNC_PERIOD_US = 16667;
+    constexpr int64_t TRACE_DURATION_MS = 1000;
+    constexpr int64_t DRAIN_TIME_US = 100 * US_PER_MS;
+    constexpr int32_t CENTER_X = 600;
+    constexpr int32_t CENTER_Y = 1200;
+    constexpr int32_t START_HALF_SPAN = 100;
+    constexpr int32_t SPAN_STEP_PER_MS = 1;
+
+    /**
+     * A two finger pinch out in the text format of AccessibilityInputRecorder, as dumped by
+     * 'hidumper -s 801 -a -e' after recording a gesture.
+     */
+    std::string CreatePinchRecords(int64_t sampleRateHz)
+    {
+        std::string records;
+        int64_t intervalUs = US_PER_SECOND / sampleRateHz;
+        for (int64_t timeUs = 0; timeUs <= TRACE_DURATION_MS * US_PER_MS; timeUs += intervalUs) {
+            int32_t halfSpan = START_HALF_SPAN + static_cast<int32_t>(timeUs / US_PER_MS) * SPAN_STEP_PER_MS;
+            int32_t action = (timeUs == 0) ? OHOS::MMI::PointerEvent::POINTER_ACTION_DOWN :
+                OHOS::MMI::PointerEvent::POINTER_ACTION_MOVE;
+            records.append("P ").append(std::to_string(timeUs)).append(" ")
+                .append(std::to_string(OHOS::MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN)).append(" ")
+                .append(std::to_string(action)).append(" 1 2")
+                .append(" 0 0 1 ").append(std::to_string(CENTER_X - halfSpan)).append(" ")
+                .append(std::to_string(CENTER_Y))
+                .append(" 1 0 1 ").append(std::to_string(CENTER_X + halfSpan)).append(" ")
+                .append(std::to_string(CENTER_Y)).append("\n");
+        }
+        return records;
+    }
+
+    float GetSeparation(const OHOS::MMI::PointerEvent &event)
+    {
+        OHOS::MMI::PointerEvent::PointerItem first;
+        OHOS::MMI::PointerEvent::PointerItem second;
+        event.GetPointerItem(0, first);
+        event.GetPointerItem(1, second);
+        return std::hypot(static_cast<float>(first.GetDisplayX() - second.GetDisplayX()),
+            static_cast<float>(first.GetDisplayY() - second.GetDisplayY()));
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForPinchReplay
+     * @tc.desc: Testcase for replaying a recorded pinch at the given input rate with and without vsync source,
+     *           reporting the window updates per second and the input to applied latency in virtual time.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForPinchReplay(benchmark::State &state)
+    {
+        std::vector<InputRecord> records;
+        if (!AccessibilityInputRecorder::ParseAll(CreatePinchRecords(state.range(0)), records) || records.empty()) {
+            state.SkipWithError("parse pinch records failed");
+            return;
+        }
+        bool hasVsync = state.range(1) != 0;
+        MagnificationUpdateStatistics statistics;
+
+        for (auto _ : state) {
+            int64_t nowUs = 0;
+            std::vector<std::function<void()>> vsyncCallbacks;
+            auto wheel = std::make_shared<GestureTimerWheel>([&nowUs]() { return nowUs / US_PER_MS; });
+            MagnificationUpdateScheduler scheduler(wheel,
+                [](const MagnificationUpdate &update) { benchmark::DoNotOptimize(update.scaleSpan); },
+                [&vsyncCallbacks, hasVsync](const std::function<void()> &callback) {
+                    if (hasVsync) {
+                        vsyncCallbacks.push_back(callback);
+                    }
+                    return hasVsync;
+                });
+            int64_t nextVsyncUs = VSYNC_PERIOD_US;
+            auto advanceTo = [&](int64_t timeUs) {
+                while (nextVsyncUs <= timeUs) {
+                    nowUs = nextVsyncUs;
+                    wheel->ProcessExpiredTimers();
+                    std::vector<std::function<void()>> callbacks;
+                    callbacks.swap(vsyncCallbacks);
+                    for (auto &callback : callbacks) {
+                        callback();
+                    }
+                    nextVsyncUs += VSYNC_PERIOD_US;
+                }
+                nowUs = timeUs;
+                wheel->ProcessExpiredTimers();
+            };
+
+            /* @tc.steps: step1.post the separation change of every sample like the zoom gesture */
+            float lastSeparation = 0.0f;
+            for (const auto &record : records) {
+                advanceTo(record.actionTime);
+                float separation = GetSeparation(*record.pointerEvent);
+                if (lastSeparation > 0.0f) {
+                    scheduler.PostScale(FULL_SCREEN_MAGNIFICATION, separation - lastSeparation);
+                }
+                lastSeparation = separation;
+            }
+            /* @tc.steps: step2.let the last coalesced update land */
+            advanceTo(records.back().actionTime + DRAIN_TIME_US);
+            statistics = scheduler.GetStatistics();
+        }
+
+        double traceSeconds = static_cast<double>(TRACE_DURATION_MS) / MS_PER_SECOND;
+        state.counters["postsPerSecond"] = static_cast<double>(statistics.postCount) / traceSeconds;
+        state.counters["updatesPerSecond"] = static_cast<double>(statistics.applyCount) / traceSeconds;
+        state.counters["avgLatencyMs"] = statistics.applyCount == 0 ? 0.0 :
+            static_cast<double>(statistics.totalLatencyMs) / statistics.applyCount;
+        state.counters["maxLatencyMs"] = static_cast<double>(statistics.maxLatencyMs);
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+    }
+
+    BENCHMARK(BenchmarkTestForPinchReplay)
+        ->ArgsProduct({{120, 240}, {1, 0}})
+        ->ArgNames({"inputHz", "vsync"})
+        ->ReportAggregatesOnly();
+}
+
+BENCHMARK_MAIN();
@@ -80,10 +80,12 @@ static int64_t MockGetDelayTime()
 {
     return 0;
 }
-static std::vector<int32_t> MockDispatchKeyEventCallback(MMI::KeyEvent &event, uint32_t sequenceNum)
+static std::vector<int32_t> MockDispatchKeyEventCallback(MMI::KeyEvent &event, uint32_t sequenceNum,
+    const std::vector<int32_t> &skippedConnectionIds)
 {
     (void) event;
     (void) sequenceNum;
+    (void) skippedConnectionIds;
     std::vector<int32_t> result = {0};
     return result;
 }
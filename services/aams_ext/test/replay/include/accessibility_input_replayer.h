@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_INPUT_REPLAYER_H
+#define ACCESSIBILITY_INPUT_REPLAYER_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "accessibility_def.h"
+#include "accessibility_gesture_timer_wheel.h"
+#include "accessibility_input_recorder.h"
+
+namespace OHOS {
+namespace Accessibility {
+struct ReplayReport {
+    size_t eventCount = 0;
+    int64_t totalCostUs = 0;
+    int64_t maxCostUs = 0;
+    // the gestures and touch events the chain sent to the accessibility abilities, in order
+    std::vector<std::pair<EventType, GestureType>> accessibilityEvents {};
+    // the pointer actions the chain injected back into the multimodal input, in order
+    std::vector<int32_t> injectedPointerActions {};
+
+    std::string ToString() const;
+};
+
+/**
+ * Replays a recording of AccessibilityInputRecorder through the filter chain assembled by the
+ * input interceptor. The gesture timeouts run on a wheel driven by the action time of the
+ * records, so a replay gives the same output on every run and host, whatever its speed.
+ */
+class AccessibilityInputReplayer {
+public:
+    // virtual time replayed after the last record, long enough for every gesture timeout
+    static constexpr int64_t TAIL_DURATION_MS = 2000;
+
+    explicit AccessibilityInputReplayer(uint32_t availableFunctions);
+    ~AccessibilityInputReplayer() = default;
+
+    /**
+     * @brief Replay the records through a freshly assembled filter chain.
+     * @param records the text produced by AccessibilityInputRecorder::Stop.
+     * @param report the output of the chain and the cost of the replayed events.
+     * @return false if the records are malformed or empty.
+     */
+    bool Replay(const std::string &records, ReplayReport &report);
+
+private:
+    void InstallChain(int64_t startTimeMs);
+    void UninstallChain();
+    void AdvanceTo(int64_t timeMs);
+
+    uint32_t availableFunctions_ = 0;
+    int64_t virtualTime_ = 0;
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    std::shared_ptr<GestureTimerWheel> originWheel_ = nullptr;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_INPUT_REPLAYER_H
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_input_replayer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+
+#include "accessibility_input_interceptor.h"
+#include "extend_service_manager.h"
+#include "hilog_wrapper.h"
+#include "mock_input_manager.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t US_TO_MS = 1000;
+    std::mutex g_outputMutex;
+    std::vector<std::pair<EventType, GestureType>> g_accessibilityEvents;
+
+    void CaptureAccessibilityEvent(EventType eventType, GestureType gestureId, uint64_t displayId)
+    {
+        (void)displayId;
+        std::lock_guard<std::mutex> lock(g_outputMutex);
+        g_accessibilityEvents.emplace_back(eventType, gestureId);
+    }
+} // namespace
+
+std::string ReplayReport::ToString() const
+{
+    std::ostringstream oss;
+    oss << "events: " << eventCount << ", total cost: " << totalCostUs << "us, max cost: " << maxCostUs <<
+        "us, average cost: " << (eventCount == 0 ? 0 : totalCostUs / static_cast<int64_t>(eventCount)) <<
+        "us, accessibility events: " << accessibilityEvents.size() << ", injected pointer events: " <<
+        injectedPointerActions.size();
+    return oss.str();
+}
+
+AccessibilityInputReplayer::AccessibilityInputReplayer(uint32_t availableFunctions)
+    : availableFunctions_(availableFunctions)
+{
+}
+
+bool AccessibilityInputReplayer::Replay(const std::string &records, ReplayReport &report)
+{
+    std::vector<InputRecord> inputRecords;
+    if (!AccessibilityInputRecorder::ParseAll(records, inputRecords) || inputRecords.empty()) {
+        HILOG_ERROR("no input record to replay");
+        return false;
+    }
+
+    ExtendServiceManager &serviceManager = Singleton<ExtendServiceManager>::GetInstance();
+    SendAccessibilityEventToAACallback originCallback = serviceManager.sendAccessibilityEventToAACallback;
+    serviceManager.sendAccessibilityEventToAACallback = CaptureAccessibilityEvent;
+    {
+        std::lock_guard<std::mutex> lock(g_outputMutex);
+        g_accessibilityEvents.clear();
+    }
+    MMI::MockInputManager::ClearTouchActions();
+
+    InstallChain(inputRecords.front().actionTime / US_TO_MS);
+    sptr<AccessibilityInputInterceptor> interceptor = AccessibilityInputInterceptor::GetInstance();
+    for (const auto &record : inputRecords) {
+        AdvanceTo(record.actionTime / US_TO_MS);
+        auto begin = std::chrono::steady_clock::now();
+        interceptor->ProcessPointerEvent(record.pointerEvent);
+        int64_t cost = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        report.eventCount++;
+        report.totalCostUs += cost;
+        report.maxCostUs = std::max(report.maxCostUs, cost);
+    }
+    AdvanceTo(virtualTime_ + TAIL_DURATION_MS);
+    UninstallChain();
+
+    serviceManager.sendAccessibilityEventToAACallback = originCallback;
+    {
+        std::lock_guard<std::mutex> lock(g_outputMutex);
+        report.accessibilityEvents = g_accessibilityEvents;
+    }
+    report.injectedPointerActions = MMI::MockInputManager::GetTouchActions();
+    HILOG_INFO("replay finished, %{public}s", report.ToString().c_str());
+    return true;
+}
+
+void AccessibilityInputReplayer::InstallChain(int64_t startTimeMs)
+{
+    virtualTime_ = startTimeMs;
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return virtualTime_; });
+    originWheel_ = AccessibilityInputInterceptor::GetInstance()->RebuildTransmitters(availableFunctions_, wheel_);
+}
+
+void AccessibilityInputReplayer::UninstallChain()
+{
+    AccessibilityInputInterceptor::GetInstance()->RebuildTransmitters(0, originWheel_);
+    originWheel_ = nullptr;
+    wheel_ = nullptr;
+}
+
+void AccessibilityInputReplayer::AdvanceTo(int64_t timeMs)
+{
+    // fire the timeouts one deadline at a time, the way the runner would between two input events
+    while (virtualTime_ < timeMs) {
+        virtualTime_++;
+        wheel_->ProcessExpiredTimers();
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
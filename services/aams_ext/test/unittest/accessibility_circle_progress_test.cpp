@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "accessibility_circle_progress.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t DISPLAY_WIDTH = 1080;
+    constexpr int32_t DISPLAY_HEIGHT = 2340;
+    constexpr uint32_t CLICK_RESPONSE_TIME = 600; // ms
+} // namespace
+
+class AccessibilityCircleProgressUnitTest : public ::testing::Test {
+public:
+    AccessibilityCircleProgressUnitTest()
+    {}
+    ~AccessibilityCircleProgressUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void AccessibilityCircleProgressUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityCircleProgressUnitTest Start ######################";
+}
+
+void AccessibilityCircleProgressUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityCircleProgressUnitTest End ######################";
+}
+
+void AccessibilityCircleProgressUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+}
+
+void AccessibilityCircleProgressUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+/**
+ * @tc.number: AccessibilityCircleProgress_Unittest_Transform_001
+ * @tc.name: Create
+ * @tc.desc: Test the circle center and the start angle of every rotation of the display.
+ */
+HWTEST_F(AccessibilityCircleProgressUnitTest, AccessibilityCircleProgress_Unittest_Transform_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Transform_001 start";
+    int32_t physicalX = 0;
+    int32_t physicalY = 0;
+    CircleProgressTransform portrait = CircleProgressTransform::Create(0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    EXPECT_TRUE(portrait.Apply(100, 200, physicalX, physicalY));
+    EXPECT_EQ(physicalX, 100);
+    EXPECT_EQ(physicalY, 200);
+    EXPECT_EQ(portrait.GetStartAngle(), -90);
+
+    CircleProgressTransform landscape = CircleProgressTransform::Create(1, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    EXPECT_TRUE(landscape.Apply(100, 200, physicalX, physicalY));
+    EXPECT_EQ(physicalX, 200);
+    EXPECT_EQ(physicalY, DISPLAY_WIDTH - 100);
+    EXPECT_EQ(landscape.GetStartAngle(), 180);
+
+    CircleProgressTransform portraitInverted = CircleProgressTransform::Create(2, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    EXPECT_TRUE(portraitInverted.Apply(100, 200, physicalX, physicalY));
+    EXPECT_EQ(physicalX, DISPLAY_WIDTH - 100);
+    EXPECT_EQ(physicalY, DISPLAY_HEIGHT - 200);
+    EXPECT_EQ(portraitInverted.GetStartAngle(), 90);
+
+    CircleProgressTransform landscapeInverted = CircleProgressTransform::Create(3, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    EXPECT_TRUE(landscapeInverted.Apply(100, 200, physicalX, physicalY));
+    EXPECT_EQ(physicalX, DISPLAY_HEIGHT - 200);
+    EXPECT_EQ(physicalY, 100);
+    EXPECT_EQ(landscapeInverted.GetStartAngle(), 0);
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Transform_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityCircleProgress_Unittest_Transform_002
+ * @tc.name: Apply
+ * @tc.desc: Test an unknown rotation leaves the circle center where it was.
+ */
+HWTEST_F(AccessibilityCircleProgressUnitTest, AccessibilityCircleProgress_Unittest_Transform_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Transform_002 start";
+    int32_t physicalX = 7;
+    int32_t physicalY = 8;
+    CircleProgressTransform unknown = CircleProgressTransform::Create(-1, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    EXPECT_FALSE(unknown.IsValid());
+    EXPECT_FALSE(unknown.Apply(100, 200, physicalX, physicalY));
+    EXPECT_EQ(physicalX, 7);
+    EXPECT_EQ(physicalY, 8);
+    EXPECT_FALSE(CircleProgressTransform().IsValid());
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Transform_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityCircleProgress_Unittest_Angle_001
+ * @tc.name: GetCircleProgressAngle
+ * @tc.desc: Test the sweep follows the elapsed time and a late frame catches up.
+ */
+HWTEST_F(AccessibilityCircleProgressUnitTest, AccessibilityCircleProgress_Unittest_Angle_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Angle_001 start";
+    EXPECT_EQ(GetCircleProgressAngle(-5, CLICK_RESPONSE_TIME), 0);
+    EXPECT_EQ(GetCircleProgressAngle(0, CLICK_RESPONSE_TIME), 0);
+    EXPECT_EQ(GetCircleProgressAngle(16, CLICK_RESPONSE_TIME), 9);
+    EXPECT_EQ(GetCircleProgressAngle(300, CLICK_RESPONSE_TIME), 180);
+    EXPECT_EQ(GetCircleProgressAngle(599, CLICK_RESPONSE_TIME), 359);
+    EXPECT_EQ(GetCircleProgressAngle(600, CLICK_RESPONSE_TIME), 360);
+    EXPECT_EQ(GetCircleProgressAngle(5000, CLICK_RESPONSE_TIME), 360);
+    EXPECT_EQ(GetCircleProgressAngle(0, 0), 360);
+    GTEST_LOG_(INFO) << "AccessibilityCircleProgress_Unittest_Angle_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "accessibility_dwell_detector.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t DWELL_DELAY_MS = 1000;
+    constexpr int32_t START_POS = 100;
+    constexpr int32_t TOLERANCE = 5;
+} // namespace
+
+class AccessibilityDwellDetectorUnitTest : public ::testing::Test {
+public:
+    AccessibilityDwellDetectorUnitTest()
+    {}
+    ~AccessibilityDwellDetectorUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    void AdvanceTime(int64_t deltaMs);
+
+    int64_t now_ = 0;
+    std::vector<std::pair<int32_t, int32_t>> dwells_ {};
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    std::unique_ptr<AccessibilityDwellDetector> detector_ = nullptr;
+};
+
+void AccessibilityDwellDetectorUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityDwellDetectorUnitTest Start ######################";
+}
+
+void AccessibilityDwellDetectorUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityDwellDetectorUnitTest End ######################";
+}
+
+void AccessibilityDwellDetectorUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    now_ = 0;
+    dwells_.clear();
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return now_; });
+    detector_ = std::make_unique<AccessibilityDwellDetector>(wheel_, [this](int32_t posX, int32_t posY) {
+        dwells_.emplace_back(posX, posY);
+    });
+}
+
+void AccessibilityDwellDetectorUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    detector_ = nullptr;
+    wheel_ = nullptr;
+}
+
+void AccessibilityDwellDetectorUnitTest::AdvanceTime(int64_t deltaMs)
+{
+    for (int64_t i = 0; i < deltaMs; i++) {
+        now_++;
+        wheel_->ProcessExpiredTimers();
+    }
+}
+
+/**
+ * @tc.number: AccessibilityDwellDetector_Unittest_OnMove_001
+ * @tc.name: OnMove
+ * @tc.desc: Test a stream of moves arms the timer once and the dwell fires a delay after the last move.
+ */
+HWTEST_F(AccessibilityDwellDetectorUnitTest, AccessibilityDwellDetector_Unittest_OnMove_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_OnMove_001 start";
+    constexpr int32_t moveCount = 500;
+    for (int32_t i = 0; i < moveCount; i++) {
+        detector_->OnMove(START_POS + i, START_POS, DWELL_DELAY_MS);
+        AdvanceTime(1);
+    }
+    AdvanceTime(DWELL_DELAY_MS - 2);
+    EXPECT_TRUE(dwells_.empty());
+    EXPECT_TRUE(detector_->IsPending());
+    AdvanceTime(1);
+    ASSERT_EQ(dwells_.size(), 1);
+    EXPECT_EQ(dwells_[0].first, START_POS + moveCount - 1);
+    EXPECT_FALSE(detector_->IsPending());
+
+    DwellStatistics statistics = detector_->GetStatistics();
+    EXPECT_EQ(statistics.moveCount, moveCount);
+    EXPECT_EQ(statistics.armCount, 1);
+    EXPECT_EQ(statistics.rearmCount, 1);
+    EXPECT_EQ(statistics.dwellCount, 1);
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_OnMove_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityDwellDetector_Unittest_Tolerance_001
+ * @tc.name: SetTolerance
+ * @tc.desc: Test jitter within the tolerance does not restart the dwell while a larger move does.
+ */
+HWTEST_F(AccessibilityDwellDetectorUnitTest, AccessibilityDwellDetector_Unittest_Tolerance_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_Tolerance_001 start";
+    detector_->SetTolerance(TOLERANCE);
+    detector_->OnMove(START_POS, START_POS, DWELL_DELAY_MS);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    detector_->OnMove(START_POS + 3, START_POS + 4, DWELL_DELAY_MS);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    ASSERT_EQ(dwells_.size(), 1);
+    EXPECT_EQ(dwells_[0], std::make_pair(START_POS, START_POS));
+    EXPECT_EQ(detector_->GetStatistics().toleratedCount, 1);
+
+    detector_->OnMove(START_POS, START_POS, DWELL_DELAY_MS);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    detector_->OnMove(START_POS + TOLERANCE + 1, START_POS, DWELL_DELAY_MS);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    EXPECT_EQ(dwells_.size(), 1);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    ASSERT_EQ(dwells_.size(), 2);
+    EXPECT_EQ(dwells_[1], std::make_pair(START_POS + TOLERANCE + 1, START_POS));
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_Tolerance_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityDwellDetector_Unittest_Cancel_001
+ * @tc.name: Cancel
+ * @tc.desc: Test a cancelled dwell does not fire, and a move at the same position starts a new one.
+ */
+HWTEST_F(AccessibilityDwellDetectorUnitTest, AccessibilityDwellDetector_Unittest_Cancel_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_Cancel_001 start";
+    detector_->OnMove(START_POS, START_POS, DWELL_DELAY_MS);
+    AdvanceTime(DWELL_DELAY_MS / 2);
+    detector_->Cancel();
+    EXPECT_FALSE(detector_->IsPending());
+    AdvanceTime(DWELL_DELAY_MS);
+    EXPECT_TRUE(dwells_.empty());
+
+    detector_->OnMove(START_POS, START_POS, DWELL_DELAY_MS);
+    EXPECT_TRUE(detector_->IsPending());
+    AdvanceTime(DWELL_DELAY_MS);
+    EXPECT_EQ(dwells_.size(), 1);
+    EXPECT_EQ(detector_->GetStatistics().armCount, 2);
+    GTEST_LOG_(INFO) << "AccessibilityDwellDetector_Unittest_Cancel_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
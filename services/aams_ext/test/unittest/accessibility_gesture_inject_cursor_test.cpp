@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include "accessibility_gesture_inject_cursor.h"
+#include "pointer_event.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t START_TIME = 1000000; // microsecond
+    constexpr int64_t MS_TO_US = 1000;
+    constexpr size_t LONG_PATH_POSITION_COUNT = 100000;
+} // namespace
+
+class AccessibilityGestureInjectCursorUnitTest : public ::testing::Test {
+public:
+    AccessibilityGestureInjectCursorUnitTest()
+    {}
+    ~AccessibilityGestureInjectCursorUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<AccessibilityGestureInjectPath> CreatePath(
+        const std::vector<AccessibilityGesturePosition> &positions, int64_t durationTime);
+};
+
+void AccessibilityGestureInjectCursorUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGestureInjectCursorUnitTest Start ######################";
+}
+
+void AccessibilityGestureInjectCursorUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGestureInjectCursorUnitTest End ######################";
+}
+
+void AccessibilityGestureInjectCursorUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+}
+
+void AccessibilityGestureInjectCursorUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+std::shared_ptr<AccessibilityGestureInjectPath> AccessibilityGestureInjectCursorUnitTest::CreatePath(
+    const std::vector<AccessibilityGesturePosition> &positions, int64_t durationTime)
+{
+    std::shared_ptr<AccessibilityGestureInjectPath> gesturePath = std::make_shared<AccessibilityGestureInjectPath>();
+    for (auto position : positions) {
+        gesturePath->AddPosition(position);
+    }
+    gesturePath->SetDurationTime(durationTime);
+    return gesturePath;
+}
+
+/**
+ * @tc.number: AccessibilityGestureInjectCursor_Unittest_Tap_001
+ * @tc.name: Next
+ * @tc.desc: Test the down and the up of each tap, and the pause between the taps.
+ */
+HWTEST_F(AccessibilityGestureInjectCursorUnitTest, AccessibilityGestureInjectCursor_Unittest_Tap_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Tap_001 start";
+    AccessibilityGestureInjectCursor cursor(CreatePath({{10.0f, 20.0f}, {10.0f, 20.0f}}, 100), START_TIME);
+    EXPECT_EQ(cursor.GetEventCount(), 4);
+
+    GestureInjectPoint point;
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(point.displayX, 10);
+    EXPECT_EQ(point.displayY, 20);
+    EXPECT_EQ(point.actionTime, START_TIME);
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_UP);
+    EXPECT_EQ(point.actionTime, START_TIME + 50 * MS_TO_US);
+
+    // the second tap goes down after the double tap pause
+    int64_t secondDownTime = START_TIME + 50 * MS_TO_US + DOUBLE_TAP_MIN_TIME;
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(point.downTime, secondDownTime);
+    EXPECT_EQ(point.actionTime, secondDownTime);
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_UP);
+    EXPECT_EQ(point.downTime, secondDownTime);
+    EXPECT_FALSE(cursor.HasNext());
+    EXPECT_FALSE(cursor.Next(point));
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Tap_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureInjectCursor_Unittest_Move_001
+ * @tc.name: Next
+ * @tc.desc: Test the down, the moves and the up of a stroke.
+ */
+HWTEST_F(AccessibilityGestureInjectCursorUnitTest, AccessibilityGestureInjectCursor_Unittest_Move_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Move_001 start";
+    AccessibilityGestureInjectCursor cursor(CreatePath({{10.0f, 10.0f}, {10.0f, 20.0f}, {20.0f, 20.0f}}, 200),
+        START_TIME);
+    EXPECT_EQ(cursor.GetEventCount(), 4);
+
+    GestureInjectPoint point;
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(point.actionTime, START_TIME);
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(point.displayY, 20);
+    EXPECT_EQ(point.actionTime, START_TIME + 100 * MS_TO_US);
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(point.displayX, 20);
+    EXPECT_EQ(point.actionTime, START_TIME + 200 * MS_TO_US);
+    EXPECT_TRUE(cursor.Next(point));
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_UP);
+    EXPECT_EQ(point.displayX, 20);
+    EXPECT_EQ(point.displayY, 20);
+    EXPECT_EQ(point.downTime, START_TIME);
+    EXPECT_EQ(point.actionTime, START_TIME + 200 * MS_TO_US);
+    EXPECT_FALSE(cursor.Next(point));
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Move_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureInjectCursor_Unittest_Invalid_001
+ * @tc.name: GetEventCount
+ * @tc.desc: Test that no event comes out of a path that can not be injected.
+ */
+HWTEST_F(AccessibilityGestureInjectCursorUnitTest, AccessibilityGestureInjectCursor_Unittest_Invalid_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Invalid_001 start";
+    GestureInjectPoint point;
+    AccessibilityGestureInjectCursor nullCursor(nullptr, START_TIME);
+    EXPECT_EQ(nullCursor.GetEventCount(), 0);
+    EXPECT_FALSE(nullCursor.Next(point));
+
+    AccessibilityGestureInjectCursor emptyCursor(CreatePath({}, 100), START_TIME);
+    EXPECT_EQ(emptyCursor.GetEventCount(), 0);
+
+    AccessibilityGestureInjectCursor negativeCursor(CreatePath({{10.0f, 10.0f}, {20.0f, 20.0f}}, -1), START_TIME);
+    EXPECT_EQ(negativeCursor.GetEventCount(), 0);
+    EXPECT_FALSE(negativeCursor.Next(point));
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_Invalid_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureInjectCursor_Unittest_LongPath_001
+ * @tc.name: Next
+ * @tc.desc: Test a stroke of 100000 positions, every event comes out in order while the cursor only
+ *           shares the path and builds nothing ahead.
+ */
+HWTEST_F(AccessibilityGestureInjectCursorUnitTest, AccessibilityGestureInjectCursor_Unittest_LongPath_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_LongPath_001 start";
+    std::vector<AccessibilityGesturePosition> positions(LONG_PATH_POSITION_COUNT);
+    for (size_t i = 0; i < LONG_PATH_POSITION_COUNT; i++) {
+        positions[i].positionX_ = static_cast<float>(i % 1000);
+        positions[i].positionY_ = static_cast<float>(i / 1000);
+    }
+    std::shared_ptr<AccessibilityGestureInjectPath> gesturePath =
+        CreatePath(positions, static_cast<int64_t>(LONG_PATH_POSITION_COUNT - 1));
+    const AccessibilityGesturePosition *pathData = gesturePath->GetPositions().data();
+
+    AccessibilityGestureInjectCursor cursor(gesturePath, START_TIME);
+    EXPECT_EQ(cursor.GetEventCount(), LONG_PATH_POSITION_COUNT + 1);
+    // the cursor holds the path itself, not a copy of its positions
+    EXPECT_EQ(gesturePath.use_count(), 2);
+
+    GestureInjectPoint point;
+    size_t count = 0;
+    size_t moveCount = 0;
+    int64_t lastActionTime = START_TIME;
+    while (cursor.Next(point)) {
+        EXPECT_GE(point.actionTime, lastActionTime);
+        lastActionTime = point.actionTime;
+        if (count == 0) {
+            EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_DOWN);
+        } else if (point.action == MMI::PointerEvent::POINTER_ACTION_MOVE) {
+            moveCount++;
+        }
+        count++;
+    }
+    EXPECT_EQ(count, LONG_PATH_POSITION_COUNT + 1);
+    EXPECT_EQ(moveCount, LONG_PATH_POSITION_COUNT - 1);
+    EXPECT_EQ(point.action, MMI::PointerEvent::POINTER_ACTION_UP);
+    EXPECT_EQ(point.displayX, 999);
+    EXPECT_EQ(point.displayY, 99);
+    EXPECT_EQ(point.actionTime, START_TIME + static_cast<int64_t>(LONG_PATH_POSITION_COUNT - 1) * MS_TO_US);
+    EXPECT_EQ(gesturePath->GetPositions().data(), pathData);
+    EXPECT_EQ(gesturePath.use_count(), 2);
+    GTEST_LOG_(INFO) << "AccessibilityGestureInjectCursor_Unittest_LongPath_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "accessibility_gesture_timer_wheel.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t START_TIME = 1000;
+    constexpr uint32_t LONG_PRESS_MSG = 1;
+    constexpr uint32_t DOUBLE_TAP_MSG = 2;
+} // namespace
+
+class TestGestureTimerHandler : public GestureTimerHandler {
+public:
+    explicit TestGestureTimerHandler(const std::shared_ptr<GestureTimerWheel> &wheel) : GestureTimerHandler(wheel) {}
+    ~TestGestureTimerHandler() = default;
+
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override
+    {
+        processedEvents_.push_back(event->GetInnerEventId());
+    }
+
+    std::vector<uint32_t> processedEvents_;
+};
+
+class AccessibilityGestureTimerWheelUnitTest : public ::testing::Test {
+public:
+    AccessibilityGestureTimerWheelUnitTest()
+    {}
+    ~AccessibilityGestureTimerWheelUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+    void AdvanceTime(int64_t durationMs);
+
+    int64_t virtualTime_ = START_TIME;
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+};
+
+void AccessibilityGestureTimerWheelUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGestureTimerWheelUnitTest Start ######################";
+}
+
+void AccessibilityGestureTimerWheelUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGestureTimerWheelUnitTest End ######################";
+}
+
+void AccessibilityGestureTimerWheelUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    virtualTime_ = START_TIME;
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return virtualTime_; });
+}
+
+void AccessibilityGestureTimerWheelUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    wheel_ = nullptr;
+}
+
+void AccessibilityGestureTimerWheelUnitTest::AdvanceTime(int64_t durationMs)
+{
+    virtualTime_ += durationMs;
+    wheel_->ProcessExpiredTimers();
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Arm_001
+ * @tc.name: Arm
+ * @tc.desc: Test a timer fires exactly at its deadline in virtual time.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Arm_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Arm_001 start";
+    int32_t fireCount = 0;
+    GestureTimerWheel::Timer timer([&fireCount]() { fireCount++; });
+    wheel_->Arm(timer, 300);
+    EXPECT_TRUE(wheel_->IsArmed(timer));
+    EXPECT_EQ(wheel_->GetArmedCount(), 1);
+
+    AdvanceTime(299);
+    EXPECT_EQ(fireCount, 0);
+    AdvanceTime(1);
+    EXPECT_EQ(fireCount, 1);
+    EXPECT_FALSE(wheel_->IsArmed(timer));
+    EXPECT_EQ(wheel_->GetArmedCount(), 0);
+
+    AdvanceTime(1000);
+    EXPECT_EQ(fireCount, 1);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Arm_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Arm_002
+ * @tc.name: Arm
+ * @tc.desc: Test timers beyond the first level cascade down and fire in deadline order.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Arm_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Arm_002 start";
+    std::vector<int32_t> fired;
+    GestureTimerWheel::Timer shortTimer([&fired]() { fired.push_back(1); });
+    GestureTimerWheel::Timer middleTimer([&fired]() { fired.push_back(2); });
+    GestureTimerWheel::Timer longTimer([&fired]() { fired.push_back(3); });
+    GestureTimerWheel::Timer farTimer([&fired]() { fired.push_back(4); });
+    wheel_->Arm(farTimer, 5000000);
+    wheel_->Arm(longTimer, 20000);
+    wheel_->Arm(middleTimer, 1500);
+    wheel_->Arm(shortTimer, 100);
+
+    AdvanceTime(1499);
+    ASSERT_EQ(fired.size(), 1);
+    AdvanceTime(1);
+    ASSERT_EQ(fired.size(), 2);
+    AdvanceTime(18499);
+    ASSERT_EQ(fired.size(), 2);
+    AdvanceTime(1);
+    ASSERT_EQ(fired.size(), 3);
+    AdvanceTime(4979999);
+    ASSERT_EQ(fired.size(), 3);
+    AdvanceTime(1);
+    ASSERT_EQ(fired.size(), 4);
+    EXPECT_EQ(fired, std::vector<int32_t>({1, 2, 3, 4}));
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Arm_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Cancel_001
+ * @tc.name: Cancel
+ * @tc.desc: Test cancelled and re-armed timers.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Cancel_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Cancel_001 start";
+    int32_t fireCount = 0;
+    GestureTimerWheel::Timer timer([&fireCount]() { fireCount++; });
+    wheel_->Arm(timer, 100);
+    wheel_->Cancel(timer);
+    EXPECT_FALSE(wheel_->IsArmed(timer));
+    AdvanceTime(200);
+    EXPECT_EQ(fireCount, 0);
+
+    // re-arming moves the deadline instead of adding a second expiry
+    wheel_->Arm(timer, 100);
+    AdvanceTime(50);
+    wheel_->Arm(timer, 100);
+    AdvanceTime(99);
+    EXPECT_EQ(fireCount, 0);
+    AdvanceTime(1);
+    EXPECT_EQ(fireCount, 1);
+    AdvanceTime(500);
+    EXPECT_EQ(fireCount, 1);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Cancel_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Cancel_002
+ * @tc.name: Cancel
+ * @tc.desc: Test a callback cancels a timer which expired in the same batch.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Cancel_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Cancel_002 start";
+    int32_t secondFireCount = 0;
+    GestureTimerWheel::Timer second([&secondFireCount]() { secondFireCount++; });
+    GestureTimerWheel::Timer first([this, &second]() { wheel_->Cancel(second); });
+    wheel_->Arm(first, 10);
+    wheel_->Arm(second, 10);
+    AdvanceTime(10);
+    EXPECT_EQ(secondFireCount, 0);
+    EXPECT_EQ(wheel_->GetArmedCount(), 0);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Cancel_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_FireMutex_001
+ * @tc.name: ProcessExpiredTimers
+ * @tc.desc: Test the callbacks wait for the fire mutex held by a thread running the filters inline.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_FireMutex_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_FireMutex_001 start";
+    ffrt::mutex fireMutex;
+    std::shared_ptr<GestureTimerWheel> wheel =
+        std::make_shared<GestureTimerWheel>([this]() { return virtualTime_; }, &fireMutex);
+    std::atomic<int32_t> fireCount = 0;
+    GestureTimerWheel::Timer timer([&fireCount]() { fireCount++; });
+    wheel->Arm(timer, 10);
+    virtualTime_ += 10;
+
+    std::unique_lock<ffrt::mutex> inlineLock(fireMutex);
+    std::thread runner([wheel]() { wheel->ProcessExpiredTimers(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(fireCount, 0);
+    inlineLock.unlock();
+    runner.join();
+    EXPECT_EQ(fireCount, 1);
+    EXPECT_EQ(wheel->GetArmedCount(), 0);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_FireMutex_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Handler_001
+ * @tc.name: SendEvent
+ * @tc.desc: Test the handler delivers expired events to ProcessEvent by event id.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Handler_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Handler_001 start";
+    std::shared_ptr<TestGestureTimerHandler> handler = std::make_shared<TestGestureTimerHandler>(wheel_);
+    EXPECT_TRUE(handler->SendEvent(LONG_PRESS_MSG, 0, 500));
+    EXPECT_TRUE(handler->SendEvent(DOUBLE_TAP_MSG, 0, 300));
+    EXPECT_TRUE(handler->HasInnerEvent(LONG_PRESS_MSG));
+
+    handler->RemoveEvent(LONG_PRESS_MSG);
+    EXPECT_FALSE(handler->HasInnerEvent(LONG_PRESS_MSG));
+    AdvanceTime(300);
+    EXPECT_EQ(handler->processedEvents_, std::vector<uint32_t>({DOUBLE_TAP_MSG}));
+
+    handler->SendEvent(LONG_PRESS_MSG, 0, 500);
+    handler->RemoveAllEvents();
+    AdvanceTime(1000);
+    EXPECT_EQ(handler->processedEvents_.size(), 1);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Handler_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTimerWheel_Unittest_Handler_002
+ * @tc.name: SendEvent
+ * @tc.desc: Test pending events of a released handler are dropped.
+ */
+HWTEST_F(AccessibilityGestureTimerWheelUnitTest, AccessibilityGestureTimerWheel_Unittest_Handler_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Handler_002 start";
+    std::shared_ptr<TestGestureTimerHandler> handler = std::make_shared<TestGestureTimerHandler>(wheel_);
+    handler->SendEvent(LONG_PRESS_MSG, 0, 100);
+    handler = nullptr;
+    EXPECT_EQ(wheel_->GetArmedCount(), 0);
+    AdvanceTime(200);
+    EXPECT_EQ(wheel_->GetArmedCount(), 0);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTimerWheel_Unittest_Handler_002 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
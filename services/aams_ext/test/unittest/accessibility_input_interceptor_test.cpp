@@ -14,8 +14,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "accessibility_common_helper.h"
 #include "accessibility_input_interceptor.h"
+#include "accessibility_input_statistics.h"
 #include "accessibility_ut_helper.h"
 #include "iservice_registry.h"
 #include "mock_bundle_manager.h"
@@ -475,5 +477,95 @@ HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Un
     inputInterceptor_->ProcessKeyEvent(event);
     GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_ProcessKeyEvent001 end";
 }
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_InputStatistics001
+ * @tc.name: ProcessPointerEvent
+ * @tc.desc: Check the queue delay and output latency are recorded for the pointer event.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_InputStatistics001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics001 start";
+    AccessibilityInputStatistics &statistics = Singleton<AccessibilityInputStatistics>::GetInstance();
+    statistics.Reset();
+    inputInterceptor_->SetAvailableFunctions(0);
+    sleep(SLEEP_TIME_3);
+
+    std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+    event->SetActionTime(AccessibilityInputStatistics::GetCurrentTimeUs());
+    inputInterceptor_->ProcessPointerEvent(event);
+
+    EXPECT_EQ(statistics.GetQueueDelay().count, 1);
+    LatencySummary output = statistics.GetOutputLatency(TransmissionType::TRANSMISSION_INPUT_INTERCEPTOR);
+    EXPECT_EQ(output.count, 1);
+    EXPECT_GE(output.maxUs, 0);
+
+    statistics.Reset();
+    EXPECT_EQ(statistics.GetQueueDelay().count, 0);
+    EXPECT_EQ(statistics.GetOutputLatency(TransmissionType::TRANSMISSION_INPUT_INTERCEPTOR).count, 0);
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_InputStatistics002
+ * @tc.name: InputProcessScope
+ * @tc.desc: Check the processing time of nested nodes is charged to each node separately.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_InputStatistics002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics002 start";
+    AccessibilityInputStatistics &statistics = Singleton<AccessibilityInputStatistics>::GetInstance();
+    statistics.Reset();
+    constexpr useconds_t innerSleepUs = 20000;
+    {
+        InputProcessScope outer(TransmissionType::TRANSMISSION_ZOOM_GESTURE);
+        {
+            InputProcessScope inner(TransmissionType::TRANSMISSION_TOUCH_EXPLORATION);
+            usleep(innerSleepUs);
+        }
+    }
+    LatencySummary outer = statistics.GetProcessTime(TransmissionType::TRANSMISSION_ZOOM_GESTURE);
+    LatencySummary inner = statistics.GetProcessTime(TransmissionType::TRANSMISSION_TOUCH_EXPLORATION);
+    EXPECT_EQ(outer.count, 1);
+    EXPECT_EQ(inner.count, 1);
+    EXPECT_GE(inner.totalUs, static_cast<int64_t>(innerSleepUs));
+    EXPECT_LT(outer.totalUs, inner.totalUs);
+
+    std::string dumpInfo;
+    statistics.Dump(dumpInfo);
+    EXPECT_NE(dumpInfo.find("TouchExploration"), std::string::npos);
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics002 end";
+}
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_InputStatistics003
+ * @tc.name: RecordProcessTime
+ * @tc.desc: Check the percentiles are taken from the merged histogram.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_InputStatistics003,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics003 start";
+    AccessibilityInputStatistics &statistics = Singleton<AccessibilityInputStatistics>::GetInstance();
+    statistics.Reset();
+    constexpr int32_t sampleCount = 100;
+    constexpr int64_t slowSampleUs = 5000;
+    for (int32_t i = 0; i < sampleCount - 1; i++) {
+        statistics.RecordProcessTime(TransmissionType::TRANSMISSION_SCREEN_TOUCH, 1);
+    }
+    std::thread slowThread([&statistics]() {
+        statistics.RecordProcessTime(TransmissionType::TRANSMISSION_SCREEN_TOUCH, slowSampleUs);
+    });
+    slowThread.join();
+
+    LatencySummary summary = statistics.GetProcessTime(TransmissionType::TRANSMISSION_SCREEN_TOUCH);
+    EXPECT_EQ(summary.count, static_cast<uint64_t>(sampleCount));
+    EXPECT_EQ(summary.p50Us, 1);
+    EXPECT_EQ(summary.p99Us, 1);
+    EXPECT_EQ(summary.maxUs, slowSampleUs);
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputStatistics003 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
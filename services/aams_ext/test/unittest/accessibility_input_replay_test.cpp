@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "accessibility_input_interceptor.h"
+#include "accessibility_input_recorder.h"
+#include "accessibility_input_replayer.h"
+#include "mock_input_manager.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int64_t START_TIME_US = 1000000;
+    constexpr int64_t MS_TO_US = 1000;
+    constexpr int32_t POINT_X = 500;
+    constexpr int32_t POINT_Y = 500;
+} // namespace
+
+class AccessibilityInputReplayTest : public testing::Test {
+public:
+    AccessibilityInputReplayTest()
+    {}
+    ~AccessibilityInputReplayTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+    std::shared_ptr<MMI::PointerEvent> CreateTouchEvent(int32_t action, int64_t actionTime);
+    std::string CreateSingleTapRecords(int64_t tapDurationMs);
+};
+
+void AccessibilityInputReplayTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest SetUpTestCase";
+}
+
+void AccessibilityInputReplayTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest TearDownTestCase";
+}
+
+void AccessibilityInputReplayTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest SetUp";
+    MMI::MockInputManager::ClearTouchActions();
+}
+
+void AccessibilityInputReplayTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest TearDown";
+}
+
+std::shared_ptr<MMI::PointerEvent> AccessibilityInputReplayTest::CreateTouchEvent(int32_t action,
+    int64_t actionTime)
+{
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    MMI::PointerEvent::PointerItem item = {};
+    item.SetPointerId(0);
+    item.SetDownTime(START_TIME_US);
+    item.SetDisplayX(POINT_X);
+    item.SetDisplayY(POINT_Y);
+    item.SetPressed(action != MMI::PointerEvent::POINTER_ACTION_UP);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(action);
+    pointerEvent->SetActionTime(actionTime);
+    return pointerEvent;
+}
+
+std::string AccessibilityInputReplayTest::CreateSingleTapRecords(int64_t tapDurationMs)
+{
+    AccessibilityInputRecorder &recorder = Singleton<AccessibilityInputRecorder>::GetInstance();
+    recorder.Start();
+    recorder.Record(*CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, START_TIME_US));
+    recorder.Record(*CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP,
+        START_TIME_US + tapDurationMs * MS_TO_US));
+    std::string records;
+    recorder.Stop(records);
+    return records;
+}
+
+/**
+ * @tc.number: AccessibilityInputReplayTest_Unittest_Record_001
+ * @tc.name: Record
+ * @tc.desc: Test recorded events are parsed back unchanged and key records are rejected.
+ */
+HWTEST_F(AccessibilityInputReplayTest, AccessibilityInputReplayTest_Unittest_Record_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Record_001 start";
+    AccessibilityInputRecorder &recorder = Singleton<AccessibilityInputRecorder>::GetInstance();
+    std::shared_ptr<MMI::PointerEvent> pointerEvent =
+        CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, START_TIME_US);
+
+    // events are only recorded between Start and Stop
+    recorder.Record(*pointerEvent);
+    recorder.Start();
+    EXPECT_TRUE(recorder.IsRecording());
+    recorder.Record(*pointerEvent);
+    std::string records;
+    recorder.Stop(records);
+    EXPECT_FALSE(recorder.IsRecording());
+    recorder.Record(*pointerEvent);
+
+    std::vector<InputRecord> inputRecords;
+    ASSERT_TRUE(AccessibilityInputRecorder::ParseAll(records, inputRecords));
+    ASSERT_EQ(inputRecords.size(), 1);
+    ASSERT_TRUE(inputRecords[0].pointerEvent != nullptr);
+    EXPECT_EQ(AccessibilityInputRecorder::Serialize(*inputRecords[0].pointerEvent),
+        AccessibilityInputRecorder::Serialize(*pointerEvent));
+    EXPECT_EQ(inputRecords[0].actionTime, START_TIME_US);
+
+    EXPECT_FALSE(AccessibilityInputRecorder::ParseAll("P 1 2 3", inputRecords));
+    EXPECT_FALSE(AccessibilityInputRecorder::ParseAll("K 1 24 2 0", inputRecords));
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Record_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInputReplayTest_Unittest_Replay_001
+ * @tc.name: Replay
+ * @tc.desc: Test a single tap replayed through touch exploration becomes a hover once the double tap
+ *           timeout expires in virtual time.
+ */
+HWTEST_F(AccessibilityInputReplayTest, AccessibilityInputReplayTest_Unittest_Replay_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Replay_001 start";
+    AccessibilityInputReplayer replayer(AccessibilityInputInterceptor::FEATURE_TOUCH_EXPLORATION);
+    ReplayReport report;
+    ASSERT_TRUE(replayer.Replay(CreateSingleTapRecords(50), report));
+    GTEST_LOG_(INFO) << report.ToString();
+
+    EXPECT_EQ(report.eventCount, 2);
+    EXPECT_EQ(report.injectedPointerActions, std::vector<int32_t>({MMI::PointerEvent::POINTER_ACTION_HOVER_ENTER,
+        MMI::PointerEvent::POINTER_ACTION_HOVER_EXIT}));
+    ASSERT_EQ(report.accessibilityEvents.size(), 2);
+    EXPECT_EQ(report.accessibilityEvents[0].first, EventType::TYPE_TOUCH_BEGIN);
+    EXPECT_EQ(report.accessibilityEvents[1].first, EventType::TYPE_TOUCH_END);
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Replay_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInputReplayTest_Unittest_Replay_002
+ * @tc.name: Replay
+ * @tc.desc: Test replaying the same recording twice gives the same output.
+ */
+HWTEST_F(AccessibilityInputReplayTest, AccessibilityInputReplayTest_Unittest_Replay_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Replay_002 start";
+    // held past the long press timeout, so the hover enter is injected before the finger is lifted
+    std::string records = CreateSingleTapRecords(250);
+    AccessibilityInputReplayer replayer(AccessibilityInputInterceptor::FEATURE_TOUCH_EXPLORATION);
+    ReplayReport first;
+    ReplayReport second;
+    ASSERT_TRUE(replayer.Replay(records, first));
+    ASSERT_TRUE(replayer.Replay(records, second));
+
+    ASSERT_FALSE(first.injectedPointerActions.empty());
+    EXPECT_EQ(first.injectedPointerActions.front(), MMI::PointerEvent::POINTER_ACTION_HOVER_ENTER);
+    EXPECT_EQ(first.injectedPointerActions, second.injectedPointerActions);
+    EXPECT_EQ(first.accessibilityEvents, second.accessibilityEvents);
+    EXPECT_FALSE(replayer.Replay("# count=0 dropped=0\n", first));
+    GTEST_LOG_(INFO) << "AccessibilityInputReplayTest_Unittest_Replay_002 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "accessibility_input_interceptor.h"
+#include "accessibility_keyevent_filter.h"
+#include "extend_service_manager.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t CONNECTION_ID_1 = 1;
+    constexpr int32_t CONNECTION_ID_2 = 2;
+    constexpr int32_t CONNECTION_ID_3 = 3;
+    // the fixed timeout of the key event filter
+    constexpr int64_t TIMEOUT = 500;
+    constexpr int64_t START_TIME = 1000;
+    constexpr int64_t KEY_INTERVAL = 1000;
+    constexpr int64_t NEVER_ANSWERS = -1;
+    constexpr uint32_t KEY_EVENT_COUNT = 20;
+
+    // an accessibility extension answering every key event after a fixed delay, without handling it
+    struct FakeConnection {
+        int32_t connectionId;
+        int64_t delay;
+    };
+
+    std::vector<FakeConnection> g_connections;
+    uint32_t g_lastSequenceNum = 0;
+    // the connections the last key event was dispatched to
+    std::vector<int32_t> g_lastDispatched;
+
+    std::vector<int32_t> DispatchToFakeConnections(MMI::KeyEvent &event, uint32_t sequenceNum,
+        const std::vector<int32_t> &skippedConnectionIds)
+    {
+        (void)event;
+        g_lastSequenceNum = sequenceNum;
+        g_lastDispatched.clear();
+        for (const auto &connection : g_connections) {
+            if (std::find(skippedConnectionIds.begin(), skippedConnectionIds.end(), connection.connectionId) ==
+                skippedConnectionIds.end()) {
+                g_lastDispatched.push_back(connection.connectionId);
+            }
+        }
+        return g_lastDispatched;
+    }
+
+    // the node after the filter, notes the time every key event is sent on
+    class KeyEventSink : public EventTransmission {
+    public:
+        explicit KeyEventSink(const int64_t &now) : now_(now) {}
+        bool OnKeyEvent(MMI::KeyEvent &event) override
+        {
+            (void)event;
+            outputTimes_.push_back(now_);
+            return true;
+        }
+
+        std::vector<int64_t> outputTimes_ {};
+
+    private:
+        const int64_t &now_;
+    };
+} // namespace
+
+class KeyEventFilterLatencyTest : public ::testing::Test {
+public:
+    KeyEventFilterLatencyTest()
+    {}
+    ~KeyEventFilterLatencyTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    // send key events through the filter to the fake connections, returns the total time they are held
+    int64_t DispatchKeyEvents(uint32_t count);
+    void AdvanceTo(int64_t time);
+
+    int64_t now_ = 0;
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    std::shared_ptr<GestureTimerWheel> originWheel_ = nullptr;
+    DispatchKeyEventCallback originCallback_ = nullptr;
+    sptr<KeyEventFilter> filter_ = nullptr;
+    sptr<KeyEventSink> sink_ = nullptr;
+};
+
+void KeyEventFilterLatencyTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventFilterLatencyTest Start ######################";
+}
+
+void KeyEventFilterLatencyTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventFilterLatencyTest End ######################";
+}
+
+void KeyEventFilterLatencyTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    now_ = START_TIME;
+    // the filter takes the wheel of the interceptor when it is created
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return now_; });
+    originWheel_ = AccessibilityInputInterceptor::GetInstance()->RebuildTransmitters(0, wheel_);
+    ExtendServiceManager &serviceManager = Singleton<ExtendServiceManager>::GetInstance();
+    originCallback_ = serviceManager.dispatchKeyEventCallback;
+    serviceManager.dispatchKeyEventCallback = DispatchToFakeConnections;
+    g_connections.clear();
+    g_lastDispatched.clear();
+
+    filter_ = new KeyEventFilter();
+    sink_ = new KeyEventSink(now_);
+    filter_->SetNext(sink_);
+}
+
+void KeyEventFilterLatencyTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    filter_ = nullptr;
+    sink_ = nullptr;
+    Singleton<ExtendServiceManager>::GetInstance().dispatchKeyEventCallback = originCallback_;
+    AccessibilityInputInterceptor::GetInstance()->RebuildTransmitters(0, originWheel_);
+    originWheel_ = nullptr;
+    wheel_ = nullptr;
+}
+
+void KeyEventFilterLatencyTest::AdvanceTo(int64_t time)
+{
+    while (now_ < time) {
+        now_++;
+        wheel_->ProcessExpiredTimers();
+    }
+}
+
+int64_t KeyEventFilterLatencyTest::DispatchKeyEvents(uint32_t count)
+{
+    int64_t totalWait = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        std::shared_ptr<MMI::KeyEvent> event = MMI::KeyEvent::Create();
+        event->SetKeyCode(MMI::KeyEvent::KEYCODE_VOLUME_UP);
+        int64_t dispatchTime = now_;
+        size_t outputCount = sink_->outputTimes_.size();
+        g_lastDispatched.clear();
+        EXPECT_TRUE(filter_->OnKeyEvent(*event));
+
+        // the connections answer in virtual time until the event leaves the filter
+        while (sink_->outputTimes_.size() == outputCount && now_ - dispatchTime <= TIMEOUT) {
+            for (const auto &connection : g_connections) {
+                bool isDispatched = std::find(g_lastDispatched.begin(), g_lastDispatched.end(),
+                    connection.connectionId) != g_lastDispatched.end();
+                if (isDispatched && connection.delay == now_ - dispatchTime) {
+                    filter_->SetServiceOnKeyEventResult(connection.connectionId, false, g_lastSequenceNum);
+                }
+            }
+            if (sink_->outputTimes_.size() != outputCount) {
+                break;
+            }
+            AdvanceTo(now_ + 1);
+        }
+        // every key event is sent on exactly once
+        EXPECT_EQ(sink_->outputTimes_.size(), outputCount + 1);
+        if (sink_->outputTimes_.size() > outputCount) {
+            totalWait += sink_->outputTimes_.back() - dispatchTime;
+        }
+        AdvanceTo(dispatchTime + KEY_INTERVAL);
+    }
+    return totalWait;
+}
+
+/**
+ * @tc.number: KeyEventFilterLatency_Unittest_Dispatch_001
+ * @tc.name: Dispatch
+ * @tc.desc: Test key events wait for the slowest answering connection instead of the timeout, and a
+ *           connection which never answers stops getting them.
+ */
+HWTEST_F(KeyEventFilterLatencyTest, KeyEventFilterLatency_Unittest_Dispatch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_001 start";
+    g_connections = {{CONNECTION_ID_1, 8}, {CONNECTION_ID_2, 40}, {CONNECTION_ID_3, NEVER_ANSWERS}};
+    // the timeout is waited until the hung connection is skipped
+    int64_t wait = DispatchKeyEvents(KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES);
+    EXPECT_EQ(wait, TIMEOUT * KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES);
+
+    wait = DispatchKeyEvents(KEY_EVENT_COUNT);
+    EXPECT_EQ(wait, 40 * KEY_EVENT_COUNT);
+    EXPECT_EQ(g_lastDispatched, std::vector<int32_t>({CONNECTION_ID_1, CONNECTION_ID_2}));
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_001 end";
+}
+
+/**
+ * @tc.number: KeyEventFilterLatency_Unittest_Dispatch_002
+ * @tc.name: Dispatch
+ * @tc.desc: Test a skipped connection gets the key events again once it is tried again and answers.
+ */
+HWTEST_F(KeyEventFilterLatencyTest, KeyEventFilterLatency_Unittest_Dispatch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_002 start";
+    g_connections = {{CONNECTION_ID_1, 8}, {CONNECTION_ID_2, NEVER_ANSWERS}};
+    DispatchKeyEvents(KEY_EVENT_COUNT);
+    EXPECT_EQ(g_lastDispatched, std::vector<int32_t>({CONNECTION_ID_1}));
+
+    AdvanceTo(now_ + KeyEventLatencyTracker::SKIP_DURATION);
+    g_connections[1].delay = 200;
+    int64_t wait = DispatchKeyEvents(1);
+    EXPECT_EQ(wait, 200);
+    EXPECT_EQ(g_lastDispatched, std::vector<int32_t>({CONNECTION_ID_1, CONNECTION_ID_2}));
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_002 end";
+}
+
+/**
+ * @tc.number: KeyEventFilterLatency_Unittest_Dispatch_003
+ * @tc.name: Dispatch
+ * @tc.desc: Test a key event is only sent to the next node when every connection is skipped.
+ */
+HWTEST_F(KeyEventFilterLatencyTest, KeyEventFilterLatency_Unittest_Dispatch_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_003 start";
+    g_connections = {{CONNECTION_ID_1, NEVER_ANSWERS}};
+    DispatchKeyEvents(KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES);
+
+    int64_t wait = DispatchKeyEvents(1);
+    EXPECT_EQ(wait, 0);
+    EXPECT_TRUE(g_lastDispatched.empty());
+    EXPECT_EQ(sink_->outputTimes_.size(), KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES + 1);
+    GTEST_LOG_(INFO) << "KeyEventFilterLatency_Unittest_Dispatch_003 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "accessibility_keyevent_latency_tracker.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t CONNECTION_ID_1 = 1;
+    constexpr int32_t CONNECTION_ID_2 = 2;
+    constexpr int64_t TIMEOUT = 500;
+} // namespace
+
+class KeyEventLatencyTrackerUnitTest : public ::testing::Test {
+public:
+    KeyEventLatencyTrackerUnitTest()
+    {}
+    ~KeyEventLatencyTrackerUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    // whether the connection is among the skipped ones at the time
+    bool IsSkipped(int32_t connectionId, int64_t now);
+
+    std::unique_ptr<KeyEventLatencyTracker> tracker_ = nullptr;
+    int64_t now_ = 0;
+};
+
+void KeyEventLatencyTrackerUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventLatencyTrackerUnitTest Start ######################";
+}
+
+void KeyEventLatencyTrackerUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventLatencyTrackerUnitTest End ######################";
+}
+
+void KeyEventLatencyTrackerUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    tracker_ = std::make_unique<KeyEventLatencyTracker>(TIMEOUT);
+    now_ = 0;
+}
+
+void KeyEventLatencyTrackerUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    tracker_ = nullptr;
+}
+
+bool KeyEventLatencyTrackerUnitTest::IsSkipped(int32_t connectionId, int64_t now)
+{
+    std::vector<int32_t> connectionIds;
+    tracker_->GetSkippedConnections(now, connectionIds);
+    return std::find(connectionIds.begin(), connectionIds.end(), connectionId) != connectionIds.end();
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_GetDeadline_001
+ * @tc.name: GetDeadline
+ * @tc.desc: Test the deadline is the fixed timeout until enough answers are seen.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_GetDeadline_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_001 start";
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+    for (uint32_t i = 1; i < KeyEventLatencyTracker::MIN_SAMPLE_COUNT; i++) {
+        tracker_->RecordLatency(CONNECTION_ID_1, 1);
+    }
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+    tracker_->RecordLatency(CONNECTION_ID_1, 1);
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), KeyEventLatencyTracker::MIN_TIMEOUT);
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_2), TIMEOUT);
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_001 end";
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_GetDeadline_002
+ * @tc.name: GetDeadline
+ * @tc.desc: Test the deadline follows the latency most answers come within and never passes the timeout.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_GetDeadline_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_002 start";
+    constexpr int64_t latency = 40;
+    constexpr int64_t slowLatency = 450;
+    for (uint32_t i = 0; i < KeyEventLatencyTracker::MAX_SAMPLE_COUNT; i++) {
+        tracker_->RecordLatency(CONNECTION_ID_1, latency);
+        tracker_->RecordLatency(CONNECTION_ID_2, slowLatency);
+    }
+    // one slow answer in a hundred does not move the deadline
+    tracker_->RecordLatency(CONNECTION_ID_1, slowLatency);
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), 100);
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_2), TIMEOUT);
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_002 end";
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_GetDeadline_003
+ * @tc.name: GetDeadline
+ * @tc.desc: Test the deadline follows a connection which gets faster.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_GetDeadline_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_003 start";
+    for (uint32_t i = 0; i < KeyEventLatencyTracker::MAX_SAMPLE_COUNT; i++) {
+        tracker_->RecordLatency(CONNECTION_ID_1, 300);
+    }
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+    for (uint32_t i = 0; i < KeyEventLatencyTracker::MAX_SAMPLE_COUNT * 4; i++) {
+        tracker_->RecordLatency(CONNECTION_ID_1, 8);
+    }
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), KeyEventLatencyTracker::MIN_TIMEOUT);
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetDeadline_003 end";
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_RecordMiss_001
+ * @tc.name: RecordMiss
+ * @tc.desc: Test a connection missing several times in a row is skipped for a while, then tried again.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_RecordMiss_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_RecordMiss_001 start";
+    for (uint32_t i = 1; i < KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES; i++) {
+        tracker_->RecordMiss(CONNECTION_ID_1, now_);
+    }
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_1, now_));
+    tracker_->RecordMiss(CONNECTION_ID_1, now_);
+    EXPECT_TRUE(IsSkipped(CONNECTION_ID_1, now_));
+    EXPECT_TRUE(IsSkipped(CONNECTION_ID_1, now_ + KeyEventLatencyTracker::SKIP_DURATION - 1));
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_2, now_));
+
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_1, now_ + KeyEventLatencyTracker::SKIP_DURATION));
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+    tracker_->RecordMiss(CONNECTION_ID_1, now_);
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_1, now_));
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_RecordMiss_001 end";
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_RecordMiss_002
+ * @tc.name: RecordMiss
+ * @tc.desc: Test a connection which answers between its misses is not skipped.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_RecordMiss_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_RecordMiss_002 start";
+    for (uint32_t i = 0; i < KeyEventLatencyTracker::MAX_SAMPLE_COUNT; i++) {
+        tracker_->RecordMiss(CONNECTION_ID_1, now_);
+        tracker_->RecordLatency(CONNECTION_ID_1, 10);
+    }
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_1, now_));
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+
+    tracker_->Clear();
+    EXPECT_EQ(tracker_->GetDeadline(CONNECTION_ID_1), TIMEOUT);
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_RecordMiss_002 end";
+}
+
+/**
+ * @tc.number: KeyEventLatencyTracker_Unittest_GetSkippedConnections_001
+ * @tc.name: GetSkippedConnections
+ * @tc.desc: Test only the connections skipped at the time are returned, and those skipped long enough are
+ *           tried again.
+ */
+HWTEST_F(KeyEventLatencyTrackerUnitTest, KeyEventLatencyTracker_Unittest_GetSkippedConnections_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetSkippedConnections_001 start";
+    for (uint32_t i = 0; i < KeyEventLatencyTracker::MAX_CONSECUTIVE_MISSES; i++) {
+        tracker_->RecordMiss(CONNECTION_ID_1, now_);
+    }
+    tracker_->RecordMiss(CONNECTION_ID_2, now_);
+    std::vector<int32_t> connectionIds;
+    tracker_->GetSkippedConnections(now_, connectionIds);
+    EXPECT_EQ(connectionIds, std::vector<int32_t>({CONNECTION_ID_1}));
+
+    connectionIds.clear();
+    tracker_->GetSkippedConnections(now_ + KeyEventLatencyTracker::SKIP_DURATION, connectionIds);
+    EXPECT_TRUE(connectionIds.empty());
+    EXPECT_FALSE(IsSkipped(CONNECTION_ID_1, now_));
+    GTEST_LOG_(INFO) << "KeyEventLatencyTracker_Unittest_GetSkippedConnections_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
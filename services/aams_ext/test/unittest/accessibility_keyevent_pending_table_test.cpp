@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "accessibility_keyevent_pending_table.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t CONNECTION_ID_1 = 1;
+    constexpr int32_t CONNECTION_ID_2 = 2;
+    constexpr int64_t TIMEOUT = 500;
+    // more connections than an event used to wait for
+    constexpr int32_t MANY_CONNECTION_COUNT = 40;
+} // namespace
+
+class KeyEventPendingTableUnitTest : public ::testing::Test {
+public:
+    KeyEventPendingTableUnitTest()
+    {}
+    ~KeyEventPendingTableUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<MMI::KeyEvent> CreateKeyEvent(int32_t keyCode);
+
+    std::unique_ptr<KeyEventPendingTable> table_ = nullptr;
+};
+
+void KeyEventPendingTableUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventPendingTableUnitTest Start ######################";
+}
+
+void KeyEventPendingTableUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### KeyEventPendingTableUnitTest End ######################";
+}
+
+void KeyEventPendingTableUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    table_ = std::make_unique<KeyEventPendingTable>();
+}
+
+void KeyEventPendingTableUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    table_ = nullptr;
+}
+
+std::shared_ptr<MMI::KeyEvent> KeyEventPendingTableUnitTest::CreateKeyEvent(int32_t keyCode)
+{
+    std::shared_ptr<MMI::KeyEvent> event = MMI::KeyEvent::Create();
+    event->SetKeyCode(keyCode);
+    return event;
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_Acknowledge_001
+ * @tc.name: Acknowledge
+ * @tc.desc: Test the event is returned once every connection answers it is not handled.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_Acknowledge_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Acknowledge_001 start";
+    std::shared_ptr<MMI::KeyEvent> event = CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP);
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    table_->Insert(1, event, {CONNECTION_ID_1, CONNECTION_ID_2}, TIMEOUT, evictedEvent);
+    EXPECT_EQ(evictedEvent, nullptr);
+
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, 2, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::NOT_FOUND);
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, 1, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::WAITING);
+    // a connection answers each event once
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, 1, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::NOT_FOUND);
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_2, 1, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::UNHANDLED);
+    EXPECT_EQ(unhandledEvent, event);
+    EXPECT_EQ(table_->GetSize(), 0);
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Acknowledge_001 end";
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_Acknowledge_002
+ * @tc.name: Acknowledge
+ * @tc.desc: Test the event is consumed as soon as one connection handles it.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_Acknowledge_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Acknowledge_002 start";
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    table_->Insert(1, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), {CONNECTION_ID_1, CONNECTION_ID_2}, TIMEOUT,
+        evictedEvent);
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_2, 1, true, unhandledEvent),
+        KeyEventPendingTable::AckResult::HANDLED);
+    EXPECT_EQ(unhandledEvent, nullptr);
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, 1, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::NOT_FOUND);
+    int64_t deadline = 0;
+    EXPECT_FALSE(table_->GetNextDeadline(deadline));
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Acknowledge_002 end";
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_PopExpired_001
+ * @tc.name: PopExpired
+ * @tc.desc: Test the events time out oldest first and answered events are skipped.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_PopExpired_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_PopExpired_001 start";
+    std::vector<std::shared_ptr<MMI::KeyEvent>> events;
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    for (uint32_t sequenceNum = 1; sequenceNum <= 3; sequenceNum++) {
+        events.push_back(CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_DOWN));
+        table_->Insert(sequenceNum, events.back(), {CONNECTION_ID_1}, sequenceNum * TIMEOUT, evictedEvent);
+    }
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    table_->Acknowledge(CONNECTION_ID_1, 1, true, unhandledEvent);
+
+    int64_t deadline = 0;
+    EXPECT_TRUE(table_->GetNextDeadline(deadline));
+    EXPECT_EQ(deadline, 2 * TIMEOUT);
+    std::vector<std::shared_ptr<MMI::KeyEvent>> expired;
+    table_->PopExpired(2 * TIMEOUT - 1, expired);
+    EXPECT_TRUE(expired.empty());
+    table_->PopExpired(3 * TIMEOUT, expired);
+    EXPECT_EQ(expired, std::vector<std::shared_ptr<MMI::KeyEvent>>({events[1], events[2]}));
+    EXPECT_EQ(table_->GetSize(), 0);
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_PopExpired_001 end";
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_PopExpired_002
+ * @tc.name: PopExpired
+ * @tc.desc: Test the connections which did not answer the expired events are returned once per event.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_PopExpired_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_PopExpired_002 start";
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    table_->Insert(1, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), {CONNECTION_ID_1, CONNECTION_ID_2},
+        TIMEOUT, evictedEvent);
+    table_->Insert(2, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), {CONNECTION_ID_1, CONNECTION_ID_2},
+        TIMEOUT, evictedEvent);
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, 1, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::WAITING);
+
+    std::vector<std::shared_ptr<MMI::KeyEvent>> expired;
+    std::vector<int32_t> missedConnectionIds;
+    table_->PopExpired(TIMEOUT, expired, missedConnectionIds);
+    EXPECT_EQ(expired.size(), 2);
+    EXPECT_EQ(missedConnectionIds, std::vector<int32_t>({CONNECTION_ID_2, CONNECTION_ID_1, CONNECTION_ID_2}));
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_PopExpired_002 end";
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_Insert_001
+ * @tc.name: Insert
+ * @tc.desc: Test the oldest event is evicted when the table is full and sequence numbers wrap around.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_Insert_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Insert_001 start";
+    uint32_t firstSequenceNum = UINT32_MAX - KeyEventPendingTable::CAPACITY / 2;
+    std::shared_ptr<MMI::KeyEvent> firstEvent = CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP);
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    table_->Insert(firstSequenceNum, firstEvent, {CONNECTION_ID_1}, TIMEOUT, evictedEvent);
+    for (uint32_t i = 1; i < KeyEventPendingTable::CAPACITY; i++) {
+        table_->Insert(firstSequenceNum + i, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), {CONNECTION_ID_1},
+            TIMEOUT, evictedEvent);
+    }
+    EXPECT_EQ(evictedEvent, nullptr);
+    EXPECT_EQ(table_->GetSize(), KeyEventPendingTable::CAPACITY);
+
+    uint32_t nextSequenceNum = firstSequenceNum + KeyEventPendingTable::CAPACITY;
+    table_->Insert(nextSequenceNum, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), {CONNECTION_ID_1}, TIMEOUT,
+        evictedEvent);
+    EXPECT_EQ(evictedEvent, firstEvent);
+    EXPECT_EQ(table_->GetSize(), KeyEventPendingTable::CAPACITY);
+
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, firstSequenceNum, true, unhandledEvent),
+        KeyEventPendingTable::AckResult::NOT_FOUND);
+    for (uint32_t i = 1; i <= KeyEventPendingTable::CAPACITY; i++) {
+        EXPECT_EQ(table_->Acknowledge(CONNECTION_ID_1, firstSequenceNum + i, true, unhandledEvent),
+            KeyEventPendingTable::AckResult::HANDLED);
+    }
+    EXPECT_EQ(table_->GetSize(), 0);
+    int64_t deadline = 0;
+    EXPECT_FALSE(table_->GetNextDeadline(deadline));
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Insert_001 end";
+}
+
+/**
+ * @tc.number: KeyEventPendingTable_Unittest_Insert_002
+ * @tc.name: Insert
+ * @tc.desc: Test an event dispatched to many connections waits for every one of them.
+ */
+HWTEST_F(KeyEventPendingTableUnitTest, KeyEventPendingTable_Unittest_Insert_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Insert_002 start";
+    std::vector<int32_t> connectionIds;
+    for (int32_t i = 0; i < MANY_CONNECTION_COUNT; i++) {
+        connectionIds.push_back(i);
+    }
+    std::shared_ptr<MMI::KeyEvent> evictedEvent = nullptr;
+    table_->Insert(1, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), connectionIds, TIMEOUT, evictedEvent);
+    table_->Insert(2, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_DOWN), connectionIds, TIMEOUT, evictedEvent);
+
+    // the last connection handles the first event
+    std::shared_ptr<MMI::KeyEvent> unhandledEvent = nullptr;
+    EXPECT_EQ(table_->Acknowledge(connectionIds.back(), 1, true, unhandledEvent),
+        KeyEventPendingTable::AckResult::HANDLED);
+    EXPECT_EQ(unhandledEvent, nullptr);
+
+    // nobody handles the second one, it is returned once the last connection answers
+    for (int32_t i = 0; i < MANY_CONNECTION_COUNT - 1; i++) {
+        EXPECT_EQ(table_->Acknowledge(connectionIds[i], 2, false, unhandledEvent),
+            KeyEventPendingTable::AckResult::WAITING);
+    }
+    EXPECT_EQ(table_->Acknowledge(connectionIds.back(), 2, false, unhandledEvent),
+        KeyEventPendingTable::AckResult::UNHANDLED);
+    EXPECT_NE(unhandledEvent, nullptr);
+    EXPECT_EQ(table_->GetSize(), 0);
+
+    table_->Insert(3, CreateKeyEvent(MMI::KeyEvent::KEYCODE_VOLUME_UP), connectionIds, TIMEOUT, evictedEvent);
+    std::vector<std::shared_ptr<MMI::KeyEvent>> events;
+    std::vector<int32_t> missedConnectionIds;
+    table_->PopExpired(TIMEOUT, events, missedConnectionIds);
+    EXPECT_EQ(events.size(), 1);
+    EXPECT_EQ(missedConnectionIds.size(), static_cast<size_t>(MANY_CONNECTION_COUNT));
+    GTEST_LOG_(INFO) << "KeyEventPendingTable_Unittest_Insert_002 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
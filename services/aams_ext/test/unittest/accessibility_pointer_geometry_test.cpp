@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include "accessibility_pointer_geometry.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr float EPS = 1e-3f;
+    constexpr int32_t RAW_OFFSET = 1000;
+} // namespace
+
+class AccessibilityPointerGeometryUnitTest : public ::testing::Test {
+public:
+    AccessibilityPointerGeometryUnitTest()
+    {}
+    ~AccessibilityPointerGeometryUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<MMI::PointerEvent> CreateEvent(int32_t pointerCount);
+};
+
+void AccessibilityPointerGeometryUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityPointerGeometryUnitTest Start ######################";
+}
+
+void AccessibilityPointerGeometryUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityPointerGeometryUnitTest End ######################";
+}
+
+void AccessibilityPointerGeometryUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+}
+
+void AccessibilityPointerGeometryUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+std::shared_ptr<MMI::PointerEvent> AccessibilityPointerGeometryUnitTest::CreateEvent(int32_t pointerCount)
+{
+    std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+    for (int32_t i = 0; i < pointerCount; i++) {
+        MMI::PointerEvent::PointerItem item;
+        item.SetPointerId(i);
+        // the pointers sit on a diagonal, 100 apart along each axis
+        item.SetDisplayX(i * 100);
+        item.SetDisplayY(i * 100);
+        item.SetRawDisplayX(i * 100 + RAW_OFFSET);
+        item.SetRawDisplayY(i * 100 + RAW_OFFSET);
+        event->AddPointerItem(item);
+    }
+    event->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    return event;
+}
+
+/**
+ * @tc.number: AccessibilityPointerGeometry_Unittest_Load_001
+ * @tc.name: Load
+ * @tc.desc: Test the centroid and the mean deviation of the loaded pointers, leaving one pointer out.
+ */
+HWTEST_F(AccessibilityPointerGeometryUnitTest, AccessibilityPointerGeometry_Unittest_Load_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_Load_001 start";
+    std::shared_ptr<MMI::PointerEvent> event = CreateEvent(5);
+    PointerGeometry geometry;
+    EXPECT_EQ(geometry.Load(*event), 5);
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    EXPECT_TRUE(geometry.GetCentroid(centerX, centerY));
+    EXPECT_NEAR(centerX, 200.0f, EPS);
+    EXPECT_NEAR(centerY, 200.0f, EPS);
+    EXPECT_TRUE(geometry.GetCentroid(centerX, centerY, PointerCoordinate::RAW_DISPLAY));
+    EXPECT_NEAR(centerX, 200.0f + RAW_OFFSET, EPS);
+
+    float deviationX = 0.0f;
+    float deviationY = 0.0f;
+    EXPECT_TRUE(geometry.GetMeanDeviation(200.0f, 200.0f, deviationX, deviationY));
+    EXPECT_NEAR(deviationX, 120.0f, EPS);
+    EXPECT_NEAR(deviationY, 120.0f, EPS);
+
+    // a reload drops the pointers of the last event and leaves out the lifted one
+    EXPECT_EQ(geometry.Load(*event, 4), 4);
+    EXPECT_TRUE(geometry.GetCentroid(centerX, centerY));
+    EXPECT_NEAR(centerX, 150.0f, EPS);
+    EXPECT_EQ(geometry.GetPointerId(3), 3);
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_Load_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityPointerGeometry_Unittest_Separation_001
+ * @tc.name: GetSeparation
+ * @tc.desc: Test the pair separation, and that no pointer past the limit is read.
+ */
+HWTEST_F(AccessibilityPointerGeometryUnitTest, AccessibilityPointerGeometry_Unittest_Separation_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_Separation_001 start";
+    std::shared_ptr<MMI::PointerEvent> event = CreateEvent(PointerGeometry::MAX_POINTER_COUNT + 2);
+    PointerGeometry geometry;
+    EXPECT_EQ(geometry.Load(*event), PointerGeometry::MAX_POINTER_COUNT);
+    EXPECT_NEAR(geometry.GetSeparation(0, 1), std::hypot(100.0f, 100.0f), EPS);
+    EXPECT_EQ(geometry.GetSeparation(0, PointerGeometry::MAX_POINTER_COUNT), 0.0f);
+
+    PointerGeometry empty;
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    EXPECT_FALSE(empty.GetCentroid(centerX, centerY));
+    EXPECT_EQ(empty.GetSeparation(0, 1), 0.0f);
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_Separation_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityPointerGeometry_Unittest_FindNearest_001
+ * @tc.name: FindNearest
+ * @tc.desc: Test the nearest pointer is found among the pointers not yet taken.
+ */
+HWTEST_F(AccessibilityPointerGeometryUnitTest, AccessibilityPointerGeometry_Unittest_FindNearest_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_FindNearest_001 start";
+    PointerGeometry geometry;
+    EXPECT_TRUE(geometry.Add(7, 0, 0, 0, 0));
+    EXPECT_TRUE(geometry.Add(8, 300, 400, 0, 0));
+    float distance = 0.0f;
+    size_t nearest = geometry.FindNearest(10.0f, 0.0f, 0, distance);
+    EXPECT_EQ(nearest, 0);
+    EXPECT_NEAR(distance, 10.0f, EPS);
+
+    nearest = geometry.FindNearest(0.0f, 0.0f, 1u << 0, distance);
+    EXPECT_EQ(nearest, 1);
+    EXPECT_EQ(geometry.GetPointerId(nearest), 8);
+    EXPECT_NEAR(distance, 500.0f, EPS);
+
+    nearest = geometry.FindNearest(0.0f, 0.0f, (1u << 0) | (1u << 1), distance);
+    EXPECT_EQ(nearest, PointerGeometry::INVALID_INDEX);
+    GTEST_LOG_(INFO) << "AccessibilityPointerGeometry_Unittest_FindNearest_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -29,6 +29,7 @@ namespace Accessibility {
 namespace {
     constexpr uint32_t SLEEP_TIME_1 = 1;
     constexpr uint32_t SLEEP_TIME_2 = 2;
+    constexpr size_t LONG_PATH_POSITION_COUNT = 100000;
 } // namespace
 
 class TouchEventInjectorTest : public testing::Test {
@@ -209,5 +210,39 @@ HWTEST_F(TouchEventInjectorTest, TouchEventInjector_Unittest_TouchEventInjector_
 
     GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_006 end";
 }
+
+/**
+ * @tc.number: TouchEventInjector007
+ * @tc.name:TouchEventInjector
+ * @tc.desc: Check a move path of 100000 positions is injected one event after another and can be cancelled.
+ */
+HWTEST_F(TouchEventInjectorTest, TouchEventInjector_Unittest_TouchEventInjector_007, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_007 start";
+
+    touchEventInjector_->SetNext(inputInterceptor_);
+
+    std::shared_ptr<AccessibilityGestureInjectPath> gesturePath = std::make_shared<AccessibilityGestureInjectPath>();
+    for (size_t i = 0; i < LONG_PATH_POSITION_COUNT; i++) {
+        AccessibilityGesturePosition point {static_cast<float>(i % 1000), static_cast<float>(i / 1000)};
+        gesturePath->AddPosition(point);
+    }
+    gesturePath->SetDurationTime(static_cast<int64_t>(LONG_PATH_POSITION_COUNT) * 10);
+
+    touchEventInjector_->InjectEvents(gesturePath);
+    sleep(SLEEP_TIME_1);
+    int32_t touchAction = AccessibilityAbilityHelper::GetInstance().GetTouchEventActionOfTargetIndex(0);
+    EXPECT_EQ(touchAction, MMI::PointerEvent::POINTER_ACTION_DOWN);
+    touchAction = AccessibilityAbilityHelper::GetInstance().GetTouchEventActionOfTargetIndex(1);
+    EXPECT_EQ(touchAction, MMI::PointerEvent::POINTER_ACTION_MOVE);
+
+    // the path is shared with the pending injection, not expanded into events
+    EXPECT_EQ(gesturePath.use_count(), 2);
+    touchEventInjector_->DestroyEvents();
+    EXPECT_EQ(gesturePath.use_count(), 1);
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+
+    GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_007 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
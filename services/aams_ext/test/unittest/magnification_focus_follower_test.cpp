@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "magnification_def.h"
+#include "magnification_focus_follower.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t SOURCE_SIZE = 400;
+    constexpr int32_t START_CENTER = 500;
+} // namespace
+
+class MagnificationFocusFollowerUnitTest : public ::testing::Test {
+public:
+    MagnificationFocusFollowerUnitTest()
+    {}
+    ~MagnificationFocusFollowerUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    void AdvanceTime(int64_t deltaMs);
+
+    int64_t now_ = 0;
+    bool isShown_ = true;
+    PointerPos center_ = {START_CENTER, START_CENTER};
+    std::vector<PointerPos> moves_ {};
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    std::unique_ptr<MagnificationFocusFollower> follower_ = nullptr;
+};
+
+void MagnificationFocusFollowerUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### MagnificationFocusFollowerUnitTest Start ######################";
+}
+
+void MagnificationFocusFollowerUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### MagnificationFocusFollowerUnitTest End ######################";
+}
+
+void MagnificationFocusFollowerUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    now_ = 0;
+    isShown_ = true;
+    center_ = {START_CENTER, START_CENTER};
+    moves_.clear();
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return now_; });
+    follower_ = std::make_unique<MagnificationFocusFollower>(wheel_,
+        [this](uint32_t magnificationType, MagnificationRect &rect) {
+            rect = {center_.posX - SOURCE_SIZE / DIVISOR_TWO, center_.posY - SOURCE_SIZE / DIVISOR_TWO,
+                SOURCE_SIZE, SOURCE_SIZE};
+            return isShown_;
+        },
+        [this](uint32_t magnificationType, int32_t centerX, int32_t centerY) {
+            center_ = {centerX, centerY};
+            moves_.push_back(center_);
+        });
+}
+
+void MagnificationFocusFollowerUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    follower_ = nullptr;
+    wheel_ = nullptr;
+}
+
+void MagnificationFocusFollowerUnitTest::AdvanceTime(int64_t deltaMs)
+{
+    for (int64_t i = 0; i < deltaMs; i++) {
+        now_++;
+        wheel_->ProcessExpiredTimers();
+    }
+}
+
+/**
+ * @tc.number: MagnificationFocusFollower_Unittest_Follow_001
+ * @tc.name: OnFocus
+ * @tc.desc: Test a single focus outside the region is reached by a bounded ease out animation.
+ */
+HWTEST_F(MagnificationFocusFollowerUnitTest, MagnificationFocusFollower_Unittest_Follow_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Follow_001 start";
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 1500, START_CENTER);
+    // the first frame lands at once
+    ASSERT_EQ(moves_.size(), 1);
+    EXPECT_GT(moves_[0].posX, START_CENTER);
+    EXPECT_TRUE(follower_->IsAnimating());
+
+    AdvanceTime(MagnificationFocusFollower::FRAME_INTERVAL_MS * MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    EXPECT_FALSE(follower_->IsAnimating());
+    ASSERT_EQ(moves_.size(), MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    for (size_t i = 1; i < moves_.size(); i++) {
+        EXPECT_GT(moves_[i].posX, moves_[i - 1].posX);
+        EXPECT_LE(moves_[i].posX - moves_[i - 1].posX, moves_[i - 1].posX - (i == 1 ? START_CENTER :
+            moves_[i - 2].posX));
+    }
+    EXPECT_EQ(moves_.back().posX, 1500);
+    EXPECT_EQ(moves_.back().posY, START_CENTER);
+
+    MagnificationFocusStatistics statistics = follower_->GetStatistics();
+    EXPECT_EQ(statistics.focusCount, 1);
+    EXPECT_EQ(statistics.followCount, 1);
+    EXPECT_EQ(statistics.frameCount, MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Follow_001 end";
+}
+
+/**
+ * @tc.number: MagnificationFocusFollower_Unittest_Debounce_001
+ * @tc.name: OnFocus
+ * @tc.desc: Test the first focus of a burst is followed at once and the rest once to the last target.
+ */
+HWTEST_F(MagnificationFocusFollowerUnitTest, MagnificationFocusFollower_Unittest_Debounce_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Debounce_001 start";
+    constexpr int32_t burstSize = 5;
+    constexpr int32_t burstStep = 300;
+    follower_->OnFocus(WINDOW_MAGNIFICATION, START_CENTER, START_CENTER + burstStep);
+    ASSERT_EQ(moves_.size(), 1);
+    for (int32_t i = 2; i <= burstSize; i++) {
+        AdvanceTime(10);
+        follower_->OnFocus(WINDOW_MAGNIFICATION, START_CENTER, START_CENTER + i * burstStep);
+    }
+    // the animation to the first target goes on while the burst settles
+    AdvanceTime(MagnificationFocusFollower::DEBOUNCE_MS - 1);
+    EXPECT_LE(moves_.back().posY, START_CENTER + burstStep);
+    AdvanceTime(1 + MagnificationFocusFollower::FRAME_INTERVAL_MS * MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    EXPECT_EQ(moves_.back().posY, START_CENTER + burstSize * burstStep);
+    EXPECT_FALSE(follower_->IsAnimating());
+
+    MagnificationFocusStatistics statistics = follower_->GetStatistics();
+    EXPECT_EQ(statistics.focusCount, burstSize);
+    EXPECT_EQ(statistics.debouncedCount, burstSize - 2);
+    EXPECT_EQ(statistics.followCount, 2);
+    EXPECT_LE(statistics.frameCount, 2 * MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Debounce_001 end";
+}
+
+/**
+ * @tc.number: MagnificationFocusFollower_Unittest_Margin_001
+ * @tc.name: OnFocus
+ * @tc.desc: Test a focus inside the comfort margin of the region does not move it.
+ */
+HWTEST_F(MagnificationFocusFollowerUnitTest, MagnificationFocusFollower_Unittest_Margin_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Margin_001 start";
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, START_CENTER + 50, START_CENTER - 50);
+    AdvanceTime(MagnificationFocusFollower::DEBOUNCE_MS);
+    EXPECT_TRUE(moves_.empty());
+
+    // close to the edge of the region is outside the margin
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, START_CENTER + SOURCE_SIZE / DIVISOR_TWO - 10, START_CENTER);
+    EXPECT_FALSE(moves_.empty());
+
+    MagnificationFocusStatistics statistics = follower_->GetStatistics();
+    EXPECT_EQ(statistics.insideMarginCount, 1);
+    EXPECT_EQ(statistics.followCount, 1);
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Margin_001 end";
+}
+
+/**
+ * @tc.number: MagnificationFocusFollower_Unittest_Cancel_001
+ * @tc.name: Cancel
+ * @tc.desc: Test cancel stops the animation and drops the pending focus, and a hidden region is not moved.
+ */
+HWTEST_F(MagnificationFocusFollowerUnitTest, MagnificationFocusFollower_Unittest_Cancel_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Cancel_001 start";
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 1500, 1500);
+    AdvanceTime(MagnificationFocusFollower::FRAME_INTERVAL_MS);
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 0, 0);
+    follower_->Cancel();
+    size_t moves = moves_.size();
+    AdvanceTime(MagnificationFocusFollower::DEBOUNCE_MS * DIVISOR_TWO);
+    EXPECT_EQ(moves_.size(), moves);
+    EXPECT_FALSE(follower_->IsAnimating());
+
+    isShown_ = false;
+    AdvanceTime(MagnificationFocusFollower::DEBOUNCE_MS);
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 1500, 0);
+    EXPECT_EQ(moves_.size(), moves);
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Cancel_001 end";
+}
+
+/**
+ * @tc.number: MagnificationFocusFollower_Unittest_Following_001
+ * @tc.name: IsFollowing
+ * @tc.desc: Test the follower is following from the focus until the animation ends or it is canceled.
+ */
+HWTEST_F(MagnificationFocusFollowerUnitTest, MagnificationFocusFollower_Unittest_Following_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Following_001 start";
+    EXPECT_FALSE(follower_->IsFollowing());
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 1500, START_CENTER);
+    EXPECT_TRUE(follower_->IsFollowing());
+    AdvanceTime(MagnificationFocusFollower::FRAME_INTERVAL_MS * MagnificationFocusFollower::MAX_ANIMATION_FRAMES);
+    EXPECT_FALSE(follower_->IsAnimating());
+    EXPECT_FALSE(follower_->IsFollowing());
+
+    // a focus inside the margin is not followed
+    AdvanceTime(MagnificationFocusFollower::DEBOUNCE_MS);
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, center_.posX, center_.posY);
+    EXPECT_FALSE(follower_->IsFollowing());
+
+    follower_->OnFocus(FULL_SCREEN_MAGNIFICATION, 0, 0);
+    EXPECT_TRUE(follower_->IsFollowing());
+    follower_->Cancel();
+    EXPECT_FALSE(follower_->IsFollowing());
+    GTEST_LOG_(INFO) << "MagnificationFocusFollower_Unittest_Following_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "magnification_def.h"
+#include "magnification_update_scheduler.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+class MagnificationUpdateSchedulerUnitTest : public ::testing::Test {
+public:
+    MagnificationUpdateSchedulerUnitTest()
+    {}
+    ~MagnificationUpdateSchedulerUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    void CreateScheduler(bool hasVsync);
+    void FireVsync();
+    void AdvanceTime(int64_t deltaMs);
+
+    int64_t now_ = 0;
+    std::shared_ptr<GestureTimerWheel> wheel_ = nullptr;
+    std::unique_ptr<MagnificationUpdateScheduler> scheduler_ = nullptr;
+    std::vector<std::function<void()>> vsyncCallbacks_ {};
+    std::vector<MagnificationUpdate> updates_ {};
+};
+
+void MagnificationUpdateSchedulerUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### MagnificationUpdateSchedulerUnitTest Start ######################";
+}
+
+void MagnificationUpdateSchedulerUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### MagnificationUpdateSchedulerUnitTest End ######################";
+}
+
+void MagnificationUpdateSchedulerUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    now_ = 0;
+    wheel_ = std::make_shared<GestureTimerWheel>([this]() { return now_; });
+    vsyncCallbacks_.clear();
+    updates_.clear();
+}
+
+void MagnificationUpdateSchedulerUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    scheduler_ = nullptr;
+    wheel_ = nullptr;
+}
+
+void MagnificationUpdateSchedulerUnitTest::CreateScheduler(bool hasVsync)
+{
+    scheduler_ = std::make_unique<MagnificationUpdateScheduler>(wheel_,
+        [this](const MagnificationUpdate &update) { updates_.push_back(update); },
+        [this, hasVsync](const std::function<void()> &callback) {
+            if (hasVsync) {
+                vsyncCallbacks_.push_back(callback);
+            }
+            return hasVsync;
+        });
+}
+
+void MagnificationUpdateSchedulerUnitTest::FireVsync()
+{
+    std::vector<std::function<void()>> callbacks;
+    callbacks.swap(vsyncCallbacks_);
+    for (auto &callback : callbacks) {
+        callback();
+    }
+}
+
+void MagnificationUpdateSchedulerUnitTest::AdvanceTime(int64_t deltaMs)
+{
+    now_ += deltaMs;
+    wheel_->ProcessExpiredTimers();
+}
+
+/**
+ * @tc.number: MagnificationUpdateScheduler_Unittest_Coalesce_001
+ * @tc.name: PostMove
+ * @tc.desc: Test the samples posted between two vsyncs are applied as one update.
+ */
+HWTEST_F(MagnificationUpdateSchedulerUnitTest, MagnificationUpdateScheduler_Unittest_Coalesce_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Coalesce_001 start";
+    CreateScheduler(true);
+    scheduler_->PostMove(FULL_SCREEN_MAGNIFICATION, 1, 2);
+    AdvanceTime(4);
+    scheduler_->PostScale(FULL_SCREEN_MAGNIFICATION, 10.0f);
+    scheduler_->PostMove(FULL_SCREEN_MAGNIFICATION, 3, -5);
+    AdvanceTime(4);
+    scheduler_->PostScale(FULL_SCREEN_MAGNIFICATION, 5.0f);
+    EXPECT_TRUE(updates_.empty());
+    EXPECT_EQ(vsyncCallbacks_.size(), 1);
+
+    AdvanceTime(4);
+    FireVsync();
+    ASSERT_EQ(updates_.size(), 1);
+    EXPECT_EQ(updates_[0].magnificationType, FULL_SCREEN_MAGNIFICATION);
+    EXPECT_TRUE(updates_[0].hasMove);
+    EXPECT_EQ(updates_[0].deltaX, 4);
+    EXPECT_EQ(updates_[0].deltaY, -3);
+    EXPECT_TRUE(updates_[0].hasScale);
+    EXPECT_FLOAT_EQ(updates_[0].scaleSpan, 15.0f);
+
+    // the fallback timer is cancelled once the vsync applied the update
+    AdvanceTime(MagnificationUpdateScheduler::VSYNC_TIMEOUT_MS);
+    EXPECT_EQ(updates_.size(), 1);
+    MagnificationUpdateStatistics statistics = scheduler_->GetStatistics();
+    EXPECT_EQ(statistics.postCount, 4);
+    EXPECT_EQ(statistics.applyCount, 1);
+    EXPECT_EQ(statistics.vsyncApplyCount, 1);
+    EXPECT_EQ(statistics.maxLatencyMs, 12);
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Coalesce_001 end";
+}
+
+/**
+ * @tc.number: MagnificationUpdateScheduler_Unittest_Fallback_001
+ * @tc.name: PostScale
+ * @tc.desc: Test the update is applied by the timer once a frame interval passed without vsync source.
+ */
+HWTEST_F(MagnificationUpdateSchedulerUnitTest, MagnificationUpdateScheduler_Unittest_Fallback_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Fallback_001 start";
+    CreateScheduler(false);
+    scheduler_->PostScale(WINDOW_MAGNIFICATION, 1.0f);
+    AdvanceTime(MagnificationUpdateScheduler::FRAME_INTERVAL_MS - 1);
+    scheduler_->PostScale(WINDOW_MAGNIFICATION, 2.0f);
+    EXPECT_TRUE(updates_.empty());
+    AdvanceTime(1);
+    ASSERT_EQ(updates_.size(), 1);
+    EXPECT_FLOAT_EQ(updates_[0].scaleSpan, 3.0f);
+    EXPECT_FALSE(updates_[0].hasMove);
+    EXPECT_EQ(scheduler_->GetStatistics().timerApplyCount, 1);
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Fallback_001 end";
+}
+
+/**
+ * @tc.number: MagnificationUpdateScheduler_Unittest_Fallback_002
+ * @tc.name: PostMove
+ * @tc.desc: Test the timer applies the update when the requested vsync does not arrive.
+ */
+HWTEST_F(MagnificationUpdateSchedulerUnitTest, MagnificationUpdateScheduler_Unittest_Fallback_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Fallback_002 start";
+    CreateScheduler(true);
+    scheduler_->PostMove(WINDOW_MAGNIFICATION, 1, 1);
+    AdvanceTime(MagnificationUpdateScheduler::VSYNC_TIMEOUT_MS);
+    ASSERT_EQ(updates_.size(), 1);
+
+    // the late vsync finds nothing to apply
+    FireVsync();
+    EXPECT_EQ(updates_.size(), 1);
+    EXPECT_EQ(scheduler_->GetStatistics().timerApplyCount, 1);
+    EXPECT_EQ(scheduler_->GetStatistics().vsyncApplyCount, 0);
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Fallback_002 end";
+}
+
+/**
+ * @tc.number: MagnificationUpdateScheduler_Unittest_Flush_001
+ * @tc.name: Flush
+ * @tc.desc: Test flush, clear and a change of the magnification type apply or drop the pending update.
+ */
+HWTEST_F(MagnificationUpdateSchedulerUnitTest, MagnificationUpdateScheduler_Unittest_Flush_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Flush_001 start";
+    CreateScheduler(true);
+    scheduler_->PostMove(FULL_SCREEN_MAGNIFICATION, 1, 1);
+    EXPECT_TRUE(scheduler_->IsMovePending());
+    scheduler_->PostMove(WINDOW_MAGNIFICATION, 2, 2);
+    ASSERT_EQ(updates_.size(), 1);
+    EXPECT_EQ(updates_[0].magnificationType, FULL_SCREEN_MAGNIFICATION);
+
+    scheduler_->Flush();
+    ASSERT_EQ(updates_.size(), 2);
+    EXPECT_EQ(updates_[1].magnificationType, WINDOW_MAGNIFICATION);
+    EXPECT_EQ(updates_[1].deltaX, 2);
+    EXPECT_FALSE(scheduler_->IsMovePending());
+
+    scheduler_->PostScale(WINDOW_MAGNIFICATION, 1.0f);
+    scheduler_->Clear();
+    FireVsync();
+    AdvanceTime(MagnificationUpdateScheduler::VSYNC_TIMEOUT_MS);
+    EXPECT_EQ(updates_.size(), 2);
+    GTEST_LOG_(INFO) << "MagnificationUpdateScheduler_Unittest_Flush_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -17,15 +17,15 @@
 #define ACCESSIBLE_BLINKING_REMINDER_MANAGER_H
 
 #include <atomic>
-#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <set>
 #include <memory>
 #include <string>
-#include <thread>
 #include "singleton.h"
 #include "accessibility_def.h"
+#include "event_handler.h"
+#include "event_runner.h"
 #ifdef OHOS_BUILD_ENABLE_SENSOR
 #include "sensor_agent.h"
 #endif
@@ -87,13 +87,20 @@ private:
         bool pausedByProximity = false;
         bool proximityNear = false;
         bool originalFlashlightState = false;
+        // the next step of the blinking, steps alternate on and off
+        int32_t stepIndex = 0;
+        // changed by every start and stop, a scheduled step of an older blinking does nothing
+        uint64_t generation = 0;
         std::map<int32_t, ScenarioState> scenarioStates;
     };
 
     BlinkState state_;
+    // guards state_, never held across a device call or a wait
     std::mutex mutex_;
-    std::condition_variable cv_;
-    std::unique_ptr<std::thread> blinkingThread_;
+    // serializes the torch and brightness calls of the blink steps, the cleanup and the listeners
+    std::mutex deviceMutex_;
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_;
 
     bool flashlightSupported_ = false;
     bool flashlightSupportChecked_ = false;
@@ -120,6 +127,7 @@ private:
     static bool IsFlashlightEnabled(int32_t mode);
     static int64_t GetCurrentTimeMs();
     static ScenarioState MakeScenarioState(int32_t scenario, int32_t mode, bool displayBlocked);
+    static int64_t GetNextExpiryDelayMs(const BlinkState &state, int64_t nowMs);
 
     bool IsScreenLocked();
     bool IsScenarioEnabled(int32_t scenario);
@@ -128,15 +136,19 @@ private:
 
     static int32_t ComputeEffectiveMode(const BlinkState &state);
 
-    void JoinFinishedThread(std::unique_lock<std::mutex> &lock);
     void ForceStopBlinkingInternal(std::unique_lock<std::mutex> &lock, int32_t cleanupMode);
     void ForceStopAll();
     void ResetRuntimeState();
 
-    void BlinkingWorkSingle();
-    void BlinkingWorkContinuous();
-    void ExecuteBlinkCycle(std::unique_lock<std::mutex> &lock, int32_t mode, bool isOn);
-    void CleanupBlinking(int32_t flashReminderMode);
+    bool InitHandler();
+    bool StartBlinkingLocked();
+    void FinishBlinkingLocked();
+    void ScheduleBlinkStepLocked(int64_t delayMs);
+    void ScheduleScenarioExpiryLocked();
+    void OnBlinkStep(uint64_t generation);
+    void OnScenarioExpiry(uint64_t generation);
+    void ExecuteBlinkCycle(uint64_t generation, int32_t mode, bool isOn);
+    void CleanupBlinking(int32_t flashReminderMode, bool originalFlashlightState);
     void RemoveExpiredScenarios();
 
     bool SetFlashlightMode(bool isOn);
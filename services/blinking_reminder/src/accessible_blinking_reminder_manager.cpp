@@ -15,9 +15,9 @@
 
 #include "accessible_blinking_reminder_manager.h"
 #include "hilog_wrapper.h"
+#include <algorithm>
 #include <chrono>
 #include <memory>
-#include <thread>
 #include <vector>
 #ifdef OHOS_BUILD_ENABLE_CAMERA
 #include "input/camera_manager.h"
@@ -80,20 +80,19 @@ constexpr int64_t PROXIMITY_SENSOR_SAMPLING_PERIOD_NS = 100000000;
 constexpr float PROXIMITY_THRESHOLD = 1.0f;
 constexpr int64_t DISPLAY_BUSY_THRESHOLD_MS = 1000;
 constexpr int32_t BLINK_CYCLE_STEP = 2;
+constexpr int64_t NO_EXPIRY = -1;
+const std::string BLINKING_RUNNER_NAME = "AccessibilityBlinkingReminder";
+const std::string BLINK_STEP_TASK = "BlinkStep";
+const std::string SCENARIO_EXPIRY_TASK = "BlinkScenarioExpiry";
 
 AccessibleBlinkingReminderManager::AccessibleBlinkingReminderManager() {}
 
 AccessibleBlinkingReminderManager::~AccessibleBlinkingReminderManager()
 {
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-        state_.isRunning = false;
-    }
-    cv_.notify_all();
-    if (blinkingThread_ && blinkingThread_->joinable()) {
-        blinkingThread_->join();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (state_.isRunning) {
+        FinishBlinkingLocked();
     }
-    blinkingThread_.reset();
 }
 
 bool AccessibleBlinkingReminderManager::IsDisplayEnabled(int32_t mode)
@@ -126,6 +125,28 @@ AccessibleBlinkingReminderManager::ScenarioState AccessibleBlinkingReminderManag
     return scenarioState;
 }
 
+int64_t AccessibleBlinkingReminderManager::GetNextExpiryDelayMs(const BlinkState &state, int64_t nowMs)
+{
+    int64_t nextExpiryMs = NO_EXPIRY;
+    auto updateNextExpiry = [&nextExpiryMs](int64_t expiryMs) {
+        if (nextExpiryMs == NO_EXPIRY || expiryMs < nextExpiryMs) {
+            nextExpiryMs = expiryMs;
+        }
+    };
+    for (const auto &[_, scenarioState] : state.scenarioStates) {
+        if (!scenarioState.displayExpired && scenarioState.displayStartTimeMs > 0) {
+            updateNextExpiry(scenarioState.displayStartTimeMs + DISPLAY_BLINK_MAX_DURATION_MS);
+        }
+        if (!scenarioState.flashlightExpired) {
+            updateNextExpiry(scenarioState.joinTimeMs + FLASH_BLINK_MAX_DURATION_MS);
+        }
+    }
+    if (nextExpiryMs == NO_EXPIRY) {
+        return NO_EXPIRY;
+    }
+    return std::max<int64_t>(nextExpiryMs - nowMs, 0);
+}
+
 bool AccessibleBlinkingReminderManager::IsScreenLocked()
 {
 #ifdef OHOS_BUILD_ENABLE_SCREENLOCK_MANAGER
@@ -212,31 +233,19 @@ void AccessibleBlinkingReminderManager::ResetRuntimeState()
     state_.pausedByProximity = false;
 }
 
-void AccessibleBlinkingReminderManager::JoinFinishedThread(std::unique_lock<std::mutex> &lock)
-{
-    if (!state_.isRunning && blinkingThread_ && blinkingThread_->joinable()) {
-        lock.unlock();
-        blinkingThread_->join();
-        lock.lock();
-        blinkingThread_.reset();
-        ResetRuntimeState();
-    }
-}
-
 void AccessibleBlinkingReminderManager::ForceStopBlinkingInternal(
     std::unique_lock<std::mutex> &lock, int32_t cleanupMode)
 {
     HILOG_INFO("cleanupMode=%{public}d", cleanupMode);
-    state_.isRunning = false;
-    cv_.notify_all();
+    bool originalFlashlightState = state_.originalFlashlightState;
+    FinishBlinkingLocked();
     lock.unlock();
-    if (blinkingThread_ && blinkingThread_->joinable()) {
-        blinkingThread_->join();
+    {
+        // a step which is already at the device finishes first, later ones see the stop
+        std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+        CleanupBlinking(cleanupMode, originalFlashlightState);
     }
-    blinkingThread_.reset();
     lock.lock();
-    CleanupBlinking(cleanupMode);
-    ResetRuntimeState();
 }
 
 void AccessibleBlinkingReminderManager::ForceStopAll()
@@ -249,19 +258,141 @@ void AccessibleBlinkingReminderManager::ForceStopAll()
     ForceStopBlinkingInternal(lock, state_.flashReminderMode);
 }
 
-void AccessibleBlinkingReminderManager::ExecuteBlinkCycle(
-    std::unique_lock<std::mutex> &lock, int32_t mode, bool isOn)
+bool AccessibleBlinkingReminderManager::InitHandler()
+{
+    if (!runner_) {
+        // an ffrt runner has no thread of its own, the steps run on the shared ffrt workers
+        runner_ = AppExecFwk::EventRunner::Create(BLINKING_RUNNER_NAME, AppExecFwk::ThreadMode::FFRT);
+        if (!runner_) {
+            HILOG_ERROR("create blinking runner failed");
+            return false;
+        }
+    }
+    if (!handler_) {
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner_);
+        if (!handler_) {
+            HILOG_ERROR("create blinking handler failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AccessibleBlinkingReminderManager::StartBlinkingLocked()
+{
+    if (!InitHandler()) {
+        ResetRuntimeState();
+        return false;
+    }
+    state_.isRunning = true;
+    state_.stepIndex = 0;
+    state_.generation++;
+    ScheduleBlinkStepLocked(0);
+    if (state_.currentMode == BlinkingMode::CONTINUOUS_BLINK) {
+        ScheduleScenarioExpiryLocked();
+    }
+    return true;
+}
+
+void AccessibleBlinkingReminderManager::FinishBlinkingLocked()
+{
+    state_.isRunning = false;
+    state_.generation++;
+    if (handler_) {
+        handler_->RemoveTask(BLINK_STEP_TASK);
+        handler_->RemoveTask(SCENARIO_EXPIRY_TASK);
+    }
+    ResetRuntimeState();
+}
+
+void AccessibleBlinkingReminderManager::ScheduleBlinkStepLocked(int64_t delayMs)
+{
+    if (!handler_) {
+        return;
+    }
+    uint64_t generation = state_.generation;
+    handler_->PostTask([this, generation]() { OnBlinkStep(generation); }, BLINK_STEP_TASK, delayMs);
+}
+
+void AccessibleBlinkingReminderManager::ScheduleScenarioExpiryLocked()
+{
+    if (!handler_) {
+        return;
+    }
+    handler_->RemoveTask(SCENARIO_EXPIRY_TASK);
+    int64_t delayMs = GetNextExpiryDelayMs(state_, GetCurrentTimeMs());
+    if (delayMs == NO_EXPIRY) {
+        return;
+    }
+    uint64_t generation = state_.generation;
+    handler_->PostTask([this, generation]() { OnScenarioExpiry(generation); }, SCENARIO_EXPIRY_TASK, delayMs);
+}
+
+void AccessibleBlinkingReminderManager::OnBlinkStep(uint64_t generation)
 {
-    bool doFlash = IsFlashlightEnabled(mode);
-    bool doDisplay = !state_.pausedByProximity && IsDisplayEnabled(mode);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!state_.isRunning || state_.generation != generation) {
+        return;
+    }
+    int32_t effectiveMode = ComputeEffectiveMode(state_);
+    bool isFinished = (state_.currentMode == BlinkingMode::SINGLE_BLINK) ?
+        state_.stepIndex >= SINGLE_BLINK_PHASE_COUNT :
+        (effectiveMode == FlashReminderMode::NONE || state_.scenarioStates.empty());
+    if (isFinished) {
+        HILOG_INFO("blinking finished, mode=%{public}d", state_.currentMode);
+        ForceStopBlinkingInternal(lock, state_.flashReminderMode);
+        return;
+    }
+    bool isOn = state_.stepIndex % BLINK_CYCLE_STEP == 0;
+    state_.stepIndex++;
+    ScheduleBlinkStepLocked(BLINK_INTERVAL_MS);
+    lock.unlock();
+    ExecuteBlinkCycle(generation, effectiveMode, isOn);
+}
+
+void AccessibleBlinkingReminderManager::OnScenarioExpiry(uint64_t generation)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!state_.isRunning || state_.generation != generation) {
+        return;
+    }
+    int32_t activeMode = ComputeEffectiveMode(state_);
+    RemoveExpiredScenarios();
+    int32_t effectiveMode = ComputeEffectiveMode(state_);
+    if (effectiveMode == FlashReminderMode::NONE || state_.scenarioStates.empty()) {
+        ForceStopBlinkingInternal(lock, state_.flashReminderMode);
+        return;
+    }
+    ScheduleScenarioExpiryLocked();
+
+    // the blink steps leave an expired component alone, put it back the way it was before blinking
+    int32_t expiredMode = activeMode & ~effectiveMode;
+    if (expiredMode == FlashReminderMode::NONE) {
+        return;
+    }
+    bool originalFlashlightState = state_.originalFlashlightState;
     lock.unlock();
-    if (doFlash) {
+    std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+    CleanupBlinking(expiredMode, originalFlashlightState);
+}
+
+void AccessibleBlinkingReminderManager::ExecuteBlinkCycle(uint64_t generation, int32_t mode, bool isOn)
+{
+    std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+    bool doDisplay = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!state_.isRunning || state_.generation != generation) {
+            return;
+        }
+        doDisplay = !state_.pausedByProximity && IsDisplayEnabled(mode);
+    }
+    if (IsFlashlightEnabled(mode)) {
         SetFlashlightMode(isOn);
     }
     if (doDisplay) {
         SetDisplayBlinkMode(isOn);
     }
-    lock.lock();
 }
 
 void AccessibleBlinkingReminderManager::RemoveExpiredScenarios()
@@ -287,66 +418,16 @@ void AccessibleBlinkingReminderManager::RemoveExpiredScenarios()
     }
 }
 
-void AccessibleBlinkingReminderManager::CleanupBlinking(int32_t flashReminderMode)
+void AccessibleBlinkingReminderManager::CleanupBlinking(int32_t flashReminderMode, bool originalFlashlightState)
 {
     if (IsDisplayEnabled(flashReminderMode)) {
         SetDisplayBlinkMode(false);
     }
     if (IsFlashlightEnabled(flashReminderMode)) {
-        SetFlashlightMode(state_.originalFlashlightState);
+        SetFlashlightMode(originalFlashlightState);
     }
 }
 
-void AccessibleBlinkingReminderManager::BlinkingWorkSingle()
-{
-    HILOG_INFO("Single blinking work start");
-    std::unique_lock<std::mutex> lock(mutex_);
-    for (int32_t i = 0; i < SINGLE_BLINK_PHASE_COUNT; ++i) {
-        if (!state_.isRunning) {
-            return;
-        }
-        int32_t effectiveMode = ComputeEffectiveMode(state_);
-        ExecuteBlinkCycle(lock, effectiveMode, i % BLINK_CYCLE_STEP == 0);
-        if (cv_.wait_for(lock, std::chrono::milliseconds(BLINK_INTERVAL_MS),
-            [this] { return !state_.isRunning; })) {
-            return;
-        }
-    }
-    int32_t cleanupMode = state_.flashReminderMode;
-    state_.isRunning = false;
-    ResetRuntimeState();
-    lock.unlock();
-    CleanupBlinking(cleanupMode);
-}
-
-void AccessibleBlinkingReminderManager::BlinkingWorkContinuous()
-{
-    HILOG_INFO("Continuous blinking work start");
-    bool isOn = true;
-    std::unique_lock<std::mutex> lock(mutex_);
-    while (state_.isRunning) {
-        RemoveExpiredScenarios();
-        int32_t effectiveMode = ComputeEffectiveMode(state_);
-        if (effectiveMode == FlashReminderMode::NONE || state_.scenarioStates.empty()) {
-            break;
-        }
-        ExecuteBlinkCycle(lock, effectiveMode, isOn);
-        isOn = !isOn;
-        if (!state_.isRunning) {
-            break;
-        }
-        if (cv_.wait_for(lock, std::chrono::milliseconds(BLINK_INTERVAL_MS),
-            [this] { return !state_.isRunning; })) {
-            break;
-        }
-    }
-    int32_t cleanupMode = state_.flashReminderMode;
-    state_.isRunning = false;
-    ResetRuntimeState();
-    lock.unlock();
-    CleanupBlinking(cleanupMode);
-}
-
 void AccessibleBlinkingReminderManager::SaveOriginalFlashlightState()
 {
 #ifdef OHOS_BUILD_ENABLE_CAMERA
@@ -571,6 +652,7 @@ void AccessibleBlinkingReminderManager::HandleProximityStateChange(bool isNear)
         if (state_.isRunning && !state_.pausedByProximity) {
             state_.pausedByProximity = true;
             lock.unlock();
+            std::lock_guard<std::mutex> deviceLock(deviceMutex_);
             SetDisplayBlinkMode(false);
         }
     } else if (!isNear && state_.proximityNear) {
@@ -599,8 +681,12 @@ void AccessibleBlinkingReminderManager::ExpireFlashlightForAll(std::unique_lock<
         }
     }
     if (anyActive) {
+        bool originalFlashlightState = state_.originalFlashlightState;
         lock.unlock();
-        SetFlashlightMode(state_.originalFlashlightState);
+        {
+            std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+            SetFlashlightMode(originalFlashlightState);
+        }
         lock.lock();
     }
 }
@@ -617,7 +703,10 @@ void AccessibleBlinkingReminderManager::ExpireDisplayForAll(std::unique_lock<std
     }
     if (anyActive) {
         lock.unlock();
-        SetDisplayBlinkMode(false);
+        {
+            std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+            SetDisplayBlinkMode(false);
+        }
         lock.lock();
     }
 }
@@ -704,9 +793,9 @@ BlinkResultCode AccessibleBlinkingReminderManager::HandleStartSingleBlink(
     state_.singleScenario = scenario;
     state_.flashReminderMode = mode;
     state_.scenarioStates[scenario] = MakeScenarioState(scenario, mode, displayBlocked);
-    state_.isRunning = true;
-    blinkingThread_ = std::make_unique<std::thread>(
-        &AccessibleBlinkingReminderManager::BlinkingWorkSingle, this);
+    if (!StartBlinkingLocked()) {
+        return BlinkResultCode::DEVICE_IN_USE;
+    }
     return BlinkResultCode::BLINK_SUCCESS;
 }
 
@@ -723,14 +812,15 @@ BlinkResultCode AccessibleBlinkingReminderManager::HandleStartContinuousBlink(
             return BlinkResultCode::BLINK_SUCCESS;
         }
         state_.scenarioStates[scenario] = MakeScenarioState(scenario, mode, displayBlocked);
+        ScheduleScenarioExpiryLocked();
         return BlinkResultCode::BLINK_SUCCESS;
     }
     state_.currentMode = BlinkingMode::CONTINUOUS_BLINK;
     state_.flashReminderMode = mode;
     state_.scenarioStates[scenario] = MakeScenarioState(scenario, mode, displayBlocked);
-    state_.isRunning = true;
-    blinkingThread_ = std::make_unique<std::thread>(
-        &AccessibleBlinkingReminderManager::BlinkingWorkContinuous, this);
+    if (!StartBlinkingLocked()) {
+        return BlinkResultCode::DEVICE_IN_USE;
+    }
     return BlinkResultCode::BLINK_SUCCESS;
 }
 
@@ -866,7 +956,6 @@ BlinkResultCode AccessibleBlinkingReminderManager::StartBlinking(int32_t mode, i
     if (!state_.isRunning && IsFlashlightEnabled(flashReminderMode)) {
         SaveOriginalFlashlightState();
     }
-    JoinFinishedThread(lock);
     if (mode == BlinkingMode::SINGLE_BLINK) {
         return HandleStartSingleBlink(scenario, flashReminderMode, displayBlocked);
     } else if (mode == BlinkingMode::CONTINUOUS_BLINK) {
@@ -879,7 +968,6 @@ BlinkResultCode AccessibleBlinkingReminderManager::StopBlinking(int32_t mode, in
 {
     HILOG_INFO("mode=%{public}d, scenario=%{public}d", mode, scenario);
     std::unique_lock<std::mutex> lock(mutex_);
-    JoinFinishedThread(lock);
     if (!state_.isRunning) {
         return BlinkResultCode::BLINK_SUCCESS;
     }
@@ -31,6 +31,10 @@ namespace Accessibility {
 namespace {
 constexpr int32_t WAIT_BLINKING_MS = 1500;
 constexpr int32_t WAIT_STOP_MS = 500;
+constexpr int32_t SINGLE_BLINK_STEPS = 4;
+constexpr int64_t NOW_MS = 100000;
+constexpr int64_t DISPLAY_MAX_DURATION_MS = 10000;
+constexpr int64_t FLASH_MAX_DURATION_MS = 1800000;
 } // namespace
 
 class AccessibleBlinkingReminderManagerTest : public testing::Test {
@@ -1173,5 +1177,105 @@ HWTEST_F(AccessibleBlinkingReminderManagerTest,
     GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_SetFunctionEnabledRunning_002 end";
 }
 
+// ==================== OnBlinkStep ====================
+
+/**
+ * @tc.number: AccessibleBlinkingReminderManager_Unittest_OnBlinkStep_001
+ * @tc.name: OnBlinkStep
+ * @tc.desc: Test a single blink finishes after its phases and a step of an older blinking does nothing.
+ */
+HWTEST_F(AccessibleBlinkingReminderManagerTest,
+    AccessibleBlinkingReminderManager_Unittest_OnBlinkStep_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_OnBlinkStep_001 start";
+    manager_.state_.isRunning = true;
+    manager_.state_.currentMode = BlinkingMode::SINGLE_BLINK;
+    manager_.state_.singleScenario = BlinkingScenario::TESTING;
+    manager_.state_.flashReminderMode = FlashReminderMode::DISPLAY;
+    manager_.state_.scenarioStates[BlinkingScenario::TESTING] = AccessibleBlinkingReminderManager::MakeScenarioState(
+        BlinkingScenario::TESTING, FlashReminderMode::DISPLAY, false);
+    manager_.state_.stepIndex = 0;
+    uint64_t generation = manager_.state_.generation;
+
+    manager_.OnBlinkStep(generation + 1);
+    EXPECT_EQ(manager_.state_.stepIndex, 0);
+    for (int32_t i = 0; i < SINGLE_BLINK_STEPS; i++) {
+        manager_.OnBlinkStep(generation);
+    }
+    EXPECT_TRUE(manager_.state_.isRunning);
+    EXPECT_EQ(manager_.state_.stepIndex, SINGLE_BLINK_STEPS);
+    manager_.OnBlinkStep(generation);
+    EXPECT_FALSE(manager_.state_.isRunning);
+    EXPECT_NE(manager_.state_.generation, generation);
+    EXPECT_TRUE(manager_.state_.scenarioStates.empty());
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_OnBlinkStep_001 end";
+}
+
+// ==================== OnScenarioExpiry ====================
+
+/**
+ * @tc.number: AccessibleBlinkingReminderManager_Unittest_GetNextExpiryDelayMs_001
+ * @tc.name: GetNextExpiryDelayMs
+ * @tc.desc: Test the next expiry is the earliest deadline of the active components.
+ */
+HWTEST_F(AccessibleBlinkingReminderManagerTest,
+    AccessibleBlinkingReminderManager_Unittest_GetNextExpiryDelayMs_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_GetNextExpiryDelayMs_001 start";
+    AccessibleBlinkingReminderManager::BlinkState state;
+    EXPECT_EQ(AccessibleBlinkingReminderManager::GetNextExpiryDelayMs(state, NOW_MS), -1);
+
+    AccessibleBlinkingReminderManager::ScenarioState flashState;
+    flashState.joinTimeMs = NOW_MS;
+    flashState.displayExpired = true;
+    state.scenarioStates[BlinkingScenario::ALARM] = flashState;
+    EXPECT_EQ(AccessibleBlinkingReminderManager::GetNextExpiryDelayMs(state, NOW_MS), FLASH_MAX_DURATION_MS);
+
+    AccessibleBlinkingReminderManager::ScenarioState displayState;
+    displayState.joinTimeMs = NOW_MS;
+    displayState.displayStartTimeMs = NOW_MS;
+    displayState.flashlightExpired = true;
+    state.scenarioStates[BlinkingScenario::CALL] = displayState;
+    EXPECT_EQ(AccessibleBlinkingReminderManager::GetNextExpiryDelayMs(state, NOW_MS + 1),
+        DISPLAY_MAX_DURATION_MS - 1);
+    EXPECT_EQ(AccessibleBlinkingReminderManager::GetNextExpiryDelayMs(state, NOW_MS + DISPLAY_MAX_DURATION_MS + 1),
+        0);
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_GetNextExpiryDelayMs_001 end";
+}
+
+/**
+ * @tc.number: AccessibleBlinkingReminderManager_Unittest_OnScenarioExpiry_001
+ * @tc.name: OnScenarioExpiry
+ * @tc.desc: Test the expiry removes the expired scenarios and stops the blinking when none is left.
+ */
+HWTEST_F(AccessibleBlinkingReminderManagerTest,
+    AccessibleBlinkingReminderManager_Unittest_OnScenarioExpiry_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_OnScenarioExpiry_001 start";
+    int64_t nowMs = AccessibleBlinkingReminderManager::GetCurrentTimeMs();
+    manager_.state_.isRunning = true;
+    manager_.state_.currentMode = BlinkingMode::CONTINUOUS_BLINK;
+    manager_.state_.flashReminderMode = FlashReminderMode::DISPLAY;
+    AccessibleBlinkingReminderManager::ScenarioState expiredState;
+    expiredState.joinTimeMs = nowMs - DISPLAY_MAX_DURATION_MS;
+    expiredState.displayStartTimeMs = expiredState.joinTimeMs;
+    expiredState.flashlightExpired = true;
+    manager_.state_.scenarioStates[BlinkingScenario::ALARM] = expiredState;
+    manager_.state_.scenarioStates[BlinkingScenario::CALL] = AccessibleBlinkingReminderManager::MakeScenarioState(
+        BlinkingScenario::CALL, FlashReminderMode::DISPLAY, false);
+    uint64_t generation = manager_.state_.generation;
+
+    manager_.OnScenarioExpiry(generation);
+    EXPECT_TRUE(manager_.state_.isRunning);
+    EXPECT_EQ(manager_.state_.scenarioStates.size(), 1u);
+    EXPECT_EQ(manager_.state_.scenarioStates.count(BlinkingScenario::CALL), 1u);
+
+    manager_.state_.scenarioStates[BlinkingScenario::CALL].displayStartTimeMs = expiredState.displayStartTimeMs;
+    manager_.OnScenarioExpiry(generation);
+    EXPECT_FALSE(manager_.state_.isRunning);
+    EXPECT_TRUE(manager_.state_.scenarioStates.empty());
+    GTEST_LOG_(INFO) << "AccessibleBlinkingReminderManager_Unittest_OnScenarioExpiry_001 end";
+}
+
 } // namespace Accessibility
 } // namespace OHOS
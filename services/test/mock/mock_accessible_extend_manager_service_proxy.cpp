@@ -323,6 +323,28 @@ void ExtendManagerServiceProxy::SetCurrentAccountId(int32_t accountId)
 {
     (void)accountId;
 }
+
+bool ExtendManagerServiceProxy::DumpInputStatistics(std::string &dumpInfo)
+{
+    (void)dumpInfo;
+    return true;
+}
+
+bool ExtendManagerServiceProxy::ResetInputStatistics()
+{
+    return true;
+}
+
+bool ExtendManagerServiceProxy::StartInputRecord()
+{
+    return true;
+}
+
+bool ExtendManagerServiceProxy::StopInputRecord(std::string &records)
+{
+    (void)records;
+    return true;
+}
 } // namespace Accessibility
 } // namespace OHOS
 // LCOV_EXCL_STOP
@@ -57,7 +57,11 @@ enum class ExtMethod : int32_t {
     ON_SCREEN_MAGNIFICATION_STATE_CHANGED,
     OFF_ZOOM_GESTURE,
     SET_MAGNIFICATION_STATE,
-    IS_MAGNIFICATION_WINDOW_ACTIVATE
+    IS_MAGNIFICATION_WINDOW_ACTIVATE,
+    DUMP_INPUT_STATISTICS,
+    RESET_INPUT_STATISTICS,
+    START_INPUT_RECORD,
+    STOP_INPUT_RECORD
 };
 
 class ExtendManagerServiceProxy {
@@ -99,6 +103,10 @@ public:
     void SetMagnificationState(const bool state, const uint32_t type, const uint32_t mode);
     bool IsMagnificationWindowActivate();
     void SetCurrentAccountId(int32_t accountId);
+    bool DumpInputStatistics(std::string &dumpInfo);
+    bool ResetInputStatistics();
+    bool StartInputRecord();
+    bool StopInputRecord(std::string &records);
 
     // callback
     bool SetSendAccessibilityEventToAACallback();
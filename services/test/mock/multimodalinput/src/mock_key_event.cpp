@@ -159,5 +159,15 @@ int32_t KeyEvent::GetKeyAction() const
 {
     return keyAction_;
 }
+
+void KeyEvent::SetKeyAction(int32_t keyAction)
+{
+    keyAction_ = keyAction;
+}
+
+std::vector<KeyEvent::KeyItem> KeyEvent::GetKeyItems() const
+{
+    return keys_;
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
@@ -33,13 +33,13 @@ public:
     MOCK_METHOD1(ClearServiceKeyEvents, void(AccessibleAbilityConnection& connection));
 
     MOCK_METHOD0(DestroyEvents, void());
-    MOCK_METHOD1(RemoveProcessingEvent, bool(std::shared_ptr<ProcessingEvent> event));
+    MOCK_METHOD0(ProcessTimeoutEvents, void());
 };
 
 class MockMtKeyEventFilterEventHandler : public KeyEventFilterEventHandler {
 public:
     MockMtKeyEventFilterEventHandler(
-        const std::shared_ptr<AppExecFwk::EventRunner>& runner, KeyEventFilter& keyEventFilter);
+        const std::shared_ptr<GestureTimerWheel>& wheel, KeyEventFilter& keyEventFilter);
     virtual ~MockMtKeyEventFilterEventHandler() = default;
 
     MOCK_METHOD1(ProcessEvent, void(const AppExecFwk::InnerEvent::Pointer& event));
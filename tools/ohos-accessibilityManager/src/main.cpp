@@ -15,7 +15,10 @@
 
 // LCOV_EXCL_START
 #include <iostream>
+#include <algorithm>
 #include <charconv>
+#include <chrono>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -31,6 +34,11 @@ using namespace OHOS;
 using namespace Accessibility;
 
 constexpr int32_t ARGC_COUNT_TWO = 2;
+constexpr int32_t DEFAULT_BENCH_COUNT = 100;
+constexpr int32_t MAX_BENCH_COUNT = 100000;
+constexpr size_t PERCENTILE_MEDIAN = 50;
+constexpr size_t PERCENTILE_P99 = 99;
+constexpr size_t PERCENTILE_MAX = 100;
 
 void PrintHelp(const std::string& subcommand = "")
 {
@@ -72,6 +80,8 @@ void PrintHelp(const std::string& subcommand = "")
         std::cout << "  ignore-repeat-click-get-state         Get ignore repeat click state" << std::endl;
         std::cout << "  ignore-repeat-click-set-time          Set ignore repeat click interval" << std::endl;
         std::cout << "  ignore-repeat-click-get-time          Get ignore repeat click time" << std::endl;
+        std::cout << "  batch                                 Run commands read from stdin" << std::endl;
+        std::cout << "  bench                                 Measure the latency of a get command" << std::endl;
         std::cout << std::endl;
         std::cout << "Examples:" << std::endl;
         std::cout << "  # Check if screen reader is enabled" << std::endl;
@@ -83,6 +93,10 @@ void PrintHelp(const std::string& subcommand = "")
         std::cout << "  # Set magnification state" << std::endl;
         std::cout << "  ohos-a11yManager magnification-set-state --state true" << std::endl;
         std::cout << std::endl;
+        std::cout << "  # Set several features in one process" << std::endl;
+        std::cout << "  printf 'shortkey-set-state --state true\\naudio-set-mono --state true\\n' | " \
+            "ohos-a11yManager batch" << std::endl;
+        std::cout << std::endl;
         std::cout << "  # View subcommand help" << std::endl;
         std::cout << "  ohos-a11yManager magnification-set-state --help" << std::endl;
     } else {
@@ -111,6 +125,12 @@ void PrintHelp(const std::string& subcommand = "")
         } else if (subcommand == "ignore-repeat-click-set-time") {
             std::cout << "  --interval  <value>    Interval value (required, values: [0=0.1s, 1=0.4s, 2=0.7s, " \
                 "3=1.0s, 4=1.3s])" << std::endl;
+        } else if (subcommand == "batch") {
+            std::cout << "  --stop-on-error        Stop at the first failed command (optional)" << std::endl;
+        } else if (subcommand == "bench") {
+            std::cout << "  --command   <value>    The get command to measure (required)" << std::endl;
+            std::cout << "  --count     <value>    Number of measured calls (optional, range: 1 to 100000, " \
+                "default: 100)" << std::endl;
         }
         std::cout << "  --help                  Display this help message" << std::endl;
         std::cout << std::endl;
@@ -149,6 +169,15 @@ void PrintHelp(const std::string& subcommand = "")
             std::cout << std::endl;
             std::cout << "  # Set interval to 1.0s" << std::endl;
             std::cout << "  ohos-a11yManager ignore-repeat-click-set-time --interval 3" << std::endl;
+        } else if (subcommand == "batch") {
+            std::cout << "  # Run the commands of a script, lines starting with # are skipped" << std::endl;
+            std::cout << "  ohos-a11yManager batch < provision.txt" << std::endl;
+        } else if (subcommand == "bench") {
+            std::cout << "  # Measure 1000 reads of the magnification state" << std::endl;
+            std::cout << "  ohos-a11yManager bench --command magnification-get-state --count 1000" << std::endl;
+            std::cout << std::endl;
+            std::cout << "  # Measure 100 reads of the audio balance" << std::endl;
+            std::cout << "  ohos-a11yManager bench --command audio-get-balance" << std::endl;
         } else {
             std::cout << "  # Get current state" << std::endl;
             std::cout << "  ohos-a11yManager " << subcommand << std::endl;
@@ -843,6 +872,9 @@ int CommandRepeatClickGetTime(const std::vector<std::string>& args)
 
 typedef int (*CommandHandler)(const std::vector<std::string>&);
 
+int CommandBatch(const std::vector<std::string>& args);
+int CommandBench(const std::vector<std::string>& args);
+
 std::unordered_map<std::string, CommandHandler> g_commands = {
     {"state-is-screen-reader-enabled", CommandStateIsScreenReaderEnabled},
     {"ability-enable-screen-reader", CommandAbilityEnable},
@@ -871,8 +903,139 @@ std::unordered_map<std::string, CommandHandler> g_commands = {
     {"ignore-repeat-click-get-state", CommandRepeatClickGetState},
     {"ignore-repeat-click-set-time", CommandRepeatClickSetTime},
     {"ignore-repeat-click-get-time", CommandRepeatClickGetTime},
+    {"batch", CommandBatch},
+    {"bench", CommandBench},
 };
 
+int RunCommand(const std::string& command, const std::vector<std::string>& args)
+{
+    // Check for subcommand help
+    if (HasOption(args, "--help") || HasOption(args, "-h")) {
+        PrintHelp(command);
+        return 0;
+    }
+
+    auto it = g_commands.find(command);
+    if (it == g_commands.end()) {
+        return OutputError("ERR_UNKNOWN_COMMAND", "Unknown command: " + command, \
+            "Run 'ohos-a11yManager --help' for usage information");
+    }
+
+    return it->second(args);
+}
+
+// The commands share the connected config client of the process, so a script pays one startup and one connection
+int CommandBatch(const std::vector<std::string>& args)
+{
+    bool stopOnError = HasOption(args, "--stop-on-error");
+    int result = 0;
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream stream(line);
+        std::vector<std::string> words;
+        std::string word;
+        while (stream >> word) {
+            words.push_back(word);
+        }
+        if (words.empty() || words[0][0] == '#') {
+            continue;
+        }
+
+        std::string command = words[0];
+        std::vector<std::string> commandArgs(words.begin() + 1, words.end());
+        int ret = 0;
+        if (command == "batch") {
+            ret = OutputError("ERR_ARG_INVALID", "Batch failed: batch can not run inside batch", \
+                "Please remove the batch line from the script");
+        } else {
+            ret = RunCommand(command, commandArgs);
+        }
+        if (ret != 0) {
+            result = ret;
+            if (stopOnError) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+// set commands are not measured, each call writes the config and adds a permission used record over IPC
+bool IsBenchCommand(const std::string& command)
+{
+    return command.find("-get-") != std::string::npos || command == "state-is-screen-reader-enabled";
+}
+
+int64_t GetPercentile(const std::vector<int64_t>& sortedSamples, size_t percentile)
+{
+    // nearest rank
+    size_t rank = (sortedSamples.size() * percentile + PERCENTILE_MAX - 1) / PERCENTILE_MAX;
+    return sortedSamples[rank > 0 ? rank - 1 : 0];
+}
+
+int64_t TimeCommandUs(CommandHandler handler, const std::vector<std::string>& args, int& ret)
+{
+    auto begin = std::chrono::steady_clock::now();
+    ret = handler(args);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+int CommandBench(const std::vector<std::string>& args)
+{
+    std::string command = GetOption(args, "--command");
+    if (command.empty()) {
+        return OutputError("ERR_ARG_MISSING",
+            "Bench failed: Missing required parameter. Parameter: --command", \
+            "Please provide a get command using --command parameter");
+    }
+    auto it = g_commands.find(command);
+    if (it == g_commands.end() || !IsBenchCommand(command)) {
+        return OutputError("ERR_ARG_INVALID",
+            "Bench failed: Invalid parameter value. Parameter: --command", \
+            "Please provide a get command using --command parameter");
+    }
+    int32_t count = DEFAULT_BENCH_COUNT;
+    std::string countStr = GetOption(args, "--count");
+    if (!countStr.empty() && (!ConvertStringToInt64(countStr, count) || count < 1 || count > MAX_BENCH_COUNT)) {
+        return OutputError("ERR_ARG_INVALID",
+            "Bench failed: Invalid parameter value. Parameter: --count", \
+            "Please provide valid count using --count parameter (range: 1 to 100000)");
+    }
+
+    // the results of the measured calls are not printed, only their latency
+    std::ostringstream discarded;
+    std::streambuf* output = std::cout.rdbuf(discarded.rdbuf());
+    int ret = 0;
+    // the first call also connects the config client, it is reported apart from the measured calls
+    int64_t firstUs = TimeCommandUs(it->second, args, ret);
+    int32_t failedCount = 0;
+    std::vector<int64_t> samples;
+    samples.reserve(static_cast<size_t>(count));
+    for (int32_t i = 0; i < count; i++) {
+        samples.push_back(TimeCommandUs(it->second, args, ret));
+        failedCount += (ret != 0) ? 1 : 0;
+        discarded.str("");
+    }
+    std::cout.rdbuf(output);
+
+    std::sort(samples.begin(), samples.end());
+    nlohmann::json data;
+    data["command"] = command;
+    data["count"] = count;
+    data["failed"] = failedCount;
+    data["firstUs"] = firstUs;
+    data["minUs"] = samples.front();
+    data["medianUs"] = GetPercentile(samples, PERCENTILE_MEDIAN);
+    data["p99Us"] = GetPercentile(samples, PERCENTILE_P99);
+    data["maxUs"] = samples.back();
+    if (failedCount == count) {
+        return OutputError("ERR_BENCH", "Bench failed: every call of " + command + " failed", \
+            "Please run the command alone to see the error");
+    }
+    return OutputSuccess(data.dump());
+}
+
 int main(int argc, char* argv[])
 {
     if (argc < ARGC_COUNT_TWO) {
@@ -892,18 +1055,6 @@ int main(int argc, char* argv[])
         return 0;
     }
 
-    // Check for subcommand help
-    if (HasOption(args, "--help") || HasOption(args, "-h")) {
-        PrintHelp(command);
-        return 0;
-    }
-
-    auto it = g_commands.find(command);
-    if (it == g_commands.end()) {
-        return OutputError("ERR_UNKNOWN_COMMAND", "Unknown command: " + command, \
-            "Run 'ohos-a11yManager --help' for usage information");
-    }
-
-    return it->second(args);
+    return RunCommand(command, args);
 }
-// LCOV_EXCL_STOP
\ No newline at end of file
+// LCOV_EXCL_STOP